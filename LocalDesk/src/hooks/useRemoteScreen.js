@@ -1,5 +1,9 @@
 import { useState, useEffect, useCallback, useRef } from 'react';
 import { RTCPeerConnection, RTCIceCandidate, RTCSessionDescription, MediaStream, mediaDevices } from 'react-native-webrtc';
+import { InputFrameWriter, MODIFIER_FLAGS } from '../utils/inputFrame';
+
+// İkili girdi çerçevesi gönderim aralığı (hareketler bu süre içinde birikir)
+const INPUT_FRAME_INTERVAL = 16;
 
 const ICE_SERVERS = {
   iceServers: [
@@ -17,6 +21,11 @@ export const useRemoteScreen = (socket, deviceInfo) => {
   const [selectedSourceId, setSelectedSourceId] = useState(null);
   
   const peerConnectionRef = useRef(null);
+  // İkili girdi: sunucu input-capabilities ile destek bildirirse eventler
+  // çerçevede biriktirilir ve tek remote-input mesajıyla gönderilir
+  const inputFrameRef = useRef(new InputFrameWriter());
+  const inputFrameSupportedRef = useRef(false);
+  const inputFrameTimerRef = useRef(null);
   const socketRef = useRef(socket);
   const deviceRef = useRef(deviceInfo);
   
@@ -90,6 +99,7 @@ export const useRemoteScreen = (socket, deviceInfo) => {
       try {
         setIsConnecting(true);
         setError(null);
+        inputFrameRef.current.reset();
         console.log('📹 Remote Screen oturumu başlatılıyor...');
         console.log('📹 Selected source ID:', currentSourceId || selectedSourceId);
         
@@ -216,61 +226,122 @@ export const useRemoteScreen = (socket, deviceInfo) => {
       peerConnectionRef.current.close();
       peerConnectionRef.current = null;
     }
+
+    if (inputFrameTimerRef.current) {
+      clearTimeout(inputFrameTimerRef.current);
+      inputFrameTimerRef.current = null;
+    }
+    inputFrameRef.current.reset();
     
     setRemoteStream(null);
     setIsSessionActive(false);
     setIsConnecting(false);
   }, []);
 
+  // Biriken girdi çerçevesini gönder
+  const flushInputFrame = useCallback(() => {
+    if (inputFrameTimerRef.current) {
+      clearTimeout(inputFrameTimerRef.current);
+      inputFrameTimerRef.current = null;
+    }
+
+    const frame = inputFrameRef.current.finish();
+    if (frame && socketRef.current) {
+      socketRef.current.emit('remote-input', frame);
+    }
+  }, []);
+
+  // Kaydı çerçeveye ekle: hareketler kısa süre birikir, tuş/tekerlek hemen gider
+  // Dönüş false ise ikili girdi kullanılamıyor, JSON eventi gönderilmeli
+  const queueInput = useCallback((write, immediate) => {
+    if (!inputFrameSupportedRef.current) {
+      return false;
+    }
+
+    const writer = inputFrameRef.current;
+    if (writer.full) {
+      flushInputFrame();
+    }
+    if (!write(writer)) {
+      return false;
+    }
+
+    if (immediate || writer.full) {
+      flushInputFrame();
+    } else if (!inputFrameTimerRef.current) {
+      inputFrameTimerRef.current = setTimeout(flushInputFrame, INPUT_FRAME_INTERVAL);
+    }
+    return true;
+  }, [flushInputFrame]);
+
   // Mouse hareketini gönder (normalized coordinates 0-1)
   const sendMouseMove = useCallback((x, y) => {
-    if (!socketRef.current || !isSessionActive) {
-      console.warn('⚠️ Cannot send mouse move - socket:', !!socketRef.current, 'active:', isSessionActive);
-      return;
-    }
-    
-    console.log('🖱️ Sending mouse move:', { x, y });
+    if (!socketRef.current || !isSessionActive) return;
+
+    if (queueInput(writer => writer.move(x, y), false)) return;
     socketRef.current.emit('remote-mouse-move', { x, y });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput]);
 
   // Mouse tıklamasını gönder
   const sendMouseClick = useCallback((button, x, y) => {
     if (!socketRef.current || !isSessionActive) return;
     
-    console.log(`🖱️ Mouse click: ${button} at (${x}, ${y})`);
+    if (queueInput(writer => writer.click(button, x, y), true)) return;
     socketRef.current.emit('remote-mouse-click', { button, x, y });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput]);
 
   // Mouse button down (sürükleme başlangıcı)
   const sendMouseButtonDown = useCallback((button, x, y) => {
     if (!socketRef.current || !isSessionActive) return;
     
-    console.log(`🖱️ Mouse button down: ${button} at (${x}, ${y})`);
+    if (queueInput(writer => writer.button(button, true, x, y), true)) return;
     socketRef.current.emit('remote-mouse-button-down', { button, x, y });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput]);
 
   // Mouse button up (sürükleme bitişi)
   const sendMouseButtonUp = useCallback((button, x, y) => {
     if (!socketRef.current || !isSessionActive) return;
     
-    console.log(`🖱️ Mouse button up: ${button} at (${x}, ${y})`);
+    if (queueInput(writer => writer.button(button, false, x, y), true)) return;
     socketRef.current.emit('remote-mouse-button-up', { button, x, y });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput]);
 
   // Scroll olayını gönder
   const sendMouseScroll = useCallback((deltaX, deltaY) => {
     if (!socketRef.current || !isSessionActive) return;
     
+    // Sunucudaki JSON yolu ile aynı çentik dönüşümü
+    const notchesX = Math.round((deltaX || 0) / 10);
+    const notchesY = Math.round(-(deltaY || 0) / 10);
+    if (inputFrameSupportedRef.current && notchesX === 0 && notchesY === 0) return;
+    if (queueInput(writer => writer.scroll(notchesX, notchesY), true)) return;
     socketRef.current.emit('remote-mouse-scroll', { deltaX, deltaY });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput]);
 
   // Klavye girişini gönder
+  // Tuş kombinasyonları çerçeveye girer; metin ve uzun tuş adları JSON ile gider
   const sendKeyboardInput = useCallback((text = null, keys = null) => {
     if (!socketRef.current || !isSessionActive) return;
     
+    if (!text && keys && keys.length > 0) {
+      let modifiers = 0;
+      const others = [];
+      for (const key of keys) {
+        const flag = MODIFIER_FLAGS[key.toLowerCase()];
+        if (flag) {
+          modifiers |= flag;
+        } else {
+          others.push(key);
+        }
+      }
+      if (others.length === 1 && queueInput(writer => writer.key(modifiers, others[0]), true)) return;
+    }
+
+    // Sıra korunsun: bekleyen çerçeve önce gitsin
+    flushInputFrame();
     console.log(`⌨️ Keyboard input: text="${text}", keys=${keys}`);
     socketRef.current.emit('remote-keyboard-input', { text, keys });
-  }, [isSessionActive]);
+  }, [isSessionActive, queueInput, flushInputFrame]);
 
   // Medya kontrolü gönder
   const sendMediaControl = useCallback((action) => {
@@ -290,6 +361,9 @@ export const useRemoteScreen = (socket, deviceInfo) => {
 
   // Ses seviyesini al
   const [volume, setVolume] = useState(50);
+  const [isMuted, setIsMuted] = useState(false);
+  // Son yerel ayar zamanı (slider sürüklenirken sunucudan gelen yankıları yok say)
+  const lastLocalVolumeSetRef = useRef(0);
   
   const fetchVolume = useCallback(async () => {
     const device = deviceRef.current;
@@ -325,6 +399,7 @@ export const useRemoteScreen = (socket, deviceInfo) => {
       if (response.ok) {
         const data = await response.json();
         if (data.success) {
+          lastLocalVolumeSetRef.current = Date.now();
           setVolume(clampedVolume);
           // Ayrıca socket event'i de gönder (hızlı feedback için)
           sendVolumeControl('set', clampedVolume);
@@ -392,8 +467,23 @@ export const useRemoteScreen = (socket, deviceInfo) => {
       }
     };
 
+    // Sunucu ses/mute değişikliklerini push eder (donanım tuşları, başka uygulamalar)
+    const handleVolumeChanged = (data) => {
+      if (typeof data?.volume !== 'number') return;
+      if (Date.now() - lastLocalVolumeSetRef.current < 500) return;
+      setVolume(data.volume);
+      setIsMuted(!!data.mute);
+    };
+
+    // Sunucu ikili girdi çerçevesini destekliyor mu (her oturum başında bildirilir)
+    const handleInputCapabilities = (data) => {
+      inputFrameSupportedRef.current = data?.inputFrame === 1;
+    };
+
     socketRef.current.on('webrtc-answer', handleAnswer);
     socketRef.current.on('webrtc-ice-candidate', handleIceCandidate);
+    socketRef.current.on('volume-changed', handleVolumeChanged);
+    socketRef.current.on('input-capabilities', handleInputCapabilities);
     
     console.log('✅ WebRTC signaling listeners registered');
 
@@ -401,6 +491,8 @@ export const useRemoteScreen = (socket, deviceInfo) => {
       console.log('📹 Cleaning up WebRTC signaling listeners');
       socketRef.current?.off('webrtc-answer', handleAnswer);
       socketRef.current?.off('webrtc-ice-candidate', handleIceCandidate);
+      socketRef.current?.off('volume-changed', handleVolumeChanged);
+      socketRef.current?.off('input-capabilities', handleInputCapabilities);
     };
   }, []);
 
@@ -427,6 +519,7 @@ export const useRemoteScreen = (socket, deviceInfo) => {
     sendMediaControl,
     sendVolumeControl,
     volume,
+    isMuted,
     setVolumeLevel,
     fetchVolume,
     screenSources,
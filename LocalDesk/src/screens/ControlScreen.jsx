@@ -13,6 +13,7 @@ import {
 import { SafeAreaView, useSafeAreaInsets } from 'react-native-safe-area-context';
 import AsyncStorage from '@react-native-async-storage/async-storage';
 import { useI18n } from '../contexts/I18nContext';
+import { atlasCellFor, getCachedIconAtlas, loadIconAtlas } from '../utils/iconAtlas';
 
 const STORAGE_KEYS = {
   HEADER_EXPANDED: '@localdesk_header_expanded',
@@ -37,12 +38,33 @@ export const ControlScreen = ({
   const [viewMode, setViewMode] = useState('both'); // 'both', 'iconOnly', 'textOnly'
   const [gridSize, setGridSize] = useState(4); // 4 veya 8
   const [isLoading, setIsLoading] = useState(true);
+  const atlasCell = atlasCellFor(getCardSize(gridSize, viewMode).iconSize);
+  const [iconAtlas, setIconAtlas] = useState(() => getCachedIconAtlas(device, page?.id, atlasCell));
 
   // Ayarları AsyncStorage'dan yükle
   useEffect(() => {
     loadSettings();
   }, []);
 
+  // Sayfanın ikonları tek pakette (bkz. utils/iconAtlas.js). Önceki indirme
+  // hemen gösterilir; kısayollar değiştiyse sunucu yenisini, değişmediyse 304 döner.
+  useEffect(() => {
+    let active = true;
+    setIconAtlas(getCachedIconAtlas(device, page?.id, atlasCell));
+    loadIconAtlas(device, page?.id, atlasCell)
+      .then((atlas) => {
+        if (active) {
+          setIconAtlas(atlas);
+        }
+      })
+      .catch(() => {
+        // Ağ hatası: önbellekteki atlas veya tek tek ikonlar kullanılır
+      });
+    return () => {
+      active = false;
+    };
+  }, [device, page?.id, atlasCell, shortcuts]);
+
   // Ayarları yükle
   const loadSettings = async () => {
     try {
@@ -386,6 +408,7 @@ export const ControlScreen = ({
                   onPress={onExecuteShortcut}
                   disabled={!isConnected}
                   device={device}
+                  iconAtlas={iconAtlas}
                   viewMode={viewMode}
                   gridSize={gridSize}
                 />
@@ -406,8 +429,41 @@ export const ControlScreen = ({
   );
 };
 
+// Grid size'a göre kart ve ikon boyutu
+const getCardSize = (gridSize, viewMode) => {
+  const { width } = Dimensions.get('window');
+  const padding = 16; // scrollContent padding (küçültüldü)
+  const gap = 8; // actionsGrid gap (küçültüldü)
+  const totalGaps = (gridSize - 1) * gap;
+  const cardWidth = (width - (padding * 16) - totalGaps) / gridSize;
+  const cardHeight = viewMode === 'textOnly' ? cardWidth * 0.6 : cardWidth*0.8;
+  const iconSize = cardWidth * 0.7;
+  return { cardWidth, cardHeight, iconSize };
+};
+
+// Atlastaki ikon: atlas resmi kaydırılıp ikonun dikdörtgeniyle kırpılır (contain gibi ortalanır)
+const AtlasIcon = ({ atlas, icon, size }) => {
+  const scale = size / Math.max(icon.width, icon.height);
+  return (
+    <View style={[styles.atlasIconBox, { width: size, height: size }]}>
+      <View style={{ width: icon.width * scale, height: icon.height * scale, overflow: 'hidden' }}>
+        <Image
+          source={{ uri: atlas.image }}
+          style={{
+            position: 'absolute',
+            left: -icon.x * scale,
+            top: -icon.y * scale,
+            width: atlas.width * scale,
+            height: atlas.height * scale
+          }}
+        />
+      </View>
+    </View>
+  );
+};
+
 // Shortcut Card Component
-const ShortcutCard = ({ shortcut, onPress, disabled, device, viewMode = 'both', gridSize = 4 }) => {
+const ShortcutCard = ({ shortcut, onPress, disabled, device, iconAtlas, viewMode = 'both', gridSize = 4 }) => {
   const { t } = useI18n();
   const handlePress = () => {
     if (!disabled && onPress) {
@@ -418,8 +474,9 @@ const ShortcutCard = ({ shortcut, onPress, disabled, device, viewMode = 'both',
   // İkon emoji mi dosya mı kontrol et
   const icon = shortcut?.icon || '⌨️';
   const isEmoji = icon.length <= 4;
+  const atlasIcon = !isEmoji && iconAtlas?.image ? iconAtlas.icons[icon] : null;
 
-  // Resim URL'ini oluştur
+  // Resim URL'ini oluştur (atlasta yoksa)
   const iconUrl = device 
     ? `http://${device.host}:${device.port}/icons/${icon}` 
     : `http://localhost:3100/icons/${icon}`;
@@ -427,16 +484,9 @@ const ShortcutCard = ({ shortcut, onPress, disabled, device, viewMode = 'both',
   const showIcon = viewMode === 'both' || viewMode === 'iconOnly';
   const showText = viewMode === 'both' || viewMode === 'textOnly';
 
-  // Grid size'a göre kart boyutunu hesapla
+  // Grid size'a göre kart ve ikon boyutu
   const { width } = Dimensions.get('window');
-  const padding = 16; // scrollContent padding (küçültüldü)
-  const gap = 8; // actionsGrid gap (küçültüldü)
-  const totalGaps = (gridSize - 1) * gap;
-  const cardWidth = (width - (padding * 16) - totalGaps) / gridSize;
-  const cardHeight = viewMode === 'textOnly' ? cardWidth * 0.6 : cardWidth*0.8;
-  
-  // İkon boyutunu gridSize'a göre ayarla
-  const iconSize = cardWidth * 0.7;
+  const { cardWidth, cardHeight, iconSize } = getCardSize(gridSize, viewMode);
   const iconFontSize = gridSize === 8 ? 16 : width/17;
 
   return (
@@ -460,6 +510,8 @@ const ShortcutCard = ({ shortcut, onPress, disabled, device, viewMode = 'both',
         <View style={[styles.iconCircle]}>
           {isEmoji ? (
             <Text style={[styles.cardIcon, { fontSize: iconFontSize }]}>{icon}</Text>
+          ) : atlasIcon ? (
+            <AtlasIcon atlas={iconAtlas} icon={atlasIcon} size={iconSize} />
           ) : (
             <Image
               source={{ uri: iconUrl }}
@@ -687,6 +739,10 @@ const styles = StyleSheet.create({
   cardIconImage: {
     // width ve height dinamik olarak inline style ile ayarlanıyor
   },
+  atlasIconBox: {
+    alignItems: 'center',
+    justifyContent: 'center'
+  },
   cardTitle: {
     fontSize: 14,
     fontWeight: '600',
@@ -145,6 +145,11 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
     return `${mins}:${secs.toString().padStart(2, '0')}`;
   };
 
+  // Kaynak küçük resmi: sunucu göreli adres (/screen-thumbnails/<etag>) veya eski sürümlerde data URL verir
+  const thumbnailUri = (thumbnail) => (
+    thumbnail.startsWith('/') ? `http://${device.host}:${device.port}${thumbnail}` : thumbnail
+  );
+
   // Video layout değişikliğinde boyutları al ve gerçek render boyutunu hesapla
   const handleVideoLayout = (event) => {
     const { width, height } = event.nativeEvent.layout;
@@ -486,7 +491,7 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
     console.log('📹 Session active:', isSessionActive);
   }, [videoSize, isSessionActive]);
 
-  // Medya durumunu periyodik olarak güncelle
+  // Medya durumu: değişiklikler sunucudan 'media-changed' ile push edilir
   React.useEffect(() => {
     if (!isSessionActive || !showMediaControls) return;
 
@@ -502,20 +507,34 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
       }
     };
 
+    const handleMediaChanged = (status) => {
+      if (status) setMediaStatus(status);
+    };
+
     fetchMediaStatus();
-    const interval = setInterval(fetchMediaStatus, 2000); // Her 2 saniyede bir güncelle
+    socket?.on('media-changed', handleMediaChanged);
+
+    // Çalarken pozisyonu yerelde ilerlet (sunucu her saniye push etmez)
+    const ticker = setInterval(() => {
+      setMediaStatus(prev => (prev.isPlaying && prev.duration > 0)
+        ? { ...prev, position: Math.min(prev.duration, prev.position + 1) }
+        : prev);
+    }, 1000);
+    // Native backend'i olmayan sunucular (Windows) push yapmaz; seyrek yeniden eşitle
+    const resync = setInterval(fetchMediaStatus, 10000);
 
-    return () => clearInterval(interval);
-  }, [isSessionActive, showMediaControls, device]);
+    return () => {
+      clearInterval(ticker);
+      clearInterval(resync);
+      socket?.off('media-changed', handleMediaChanged);
+    };
+  }, [isSessionActive, showMediaControls, device, socket]);
 
-  // Ses seviyesini periyodik olarak güncelle
+  // Ses seviyesini bir kez al; sonraki değişiklikler 'volume-changed' ile push edilir
   React.useEffect(() => {
     if (!isSessionActive || !showMediaControls) return;
 
     fetchVolume();
-    const interval = setInterval(fetchVolume, 3000); // Her 3 saniyede bir güncelle
-
-    return () => clearInterval(interval);
   }, [isSessionActive, showMediaControls, fetchVolume]);
 
   return (
@@ -704,11 +723,20 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
       {showMediaControls && isSessionActive && (
         <View style={styles.mediaContainer}>
           <View style={styles.mediaInfo}>
-            <Image 
-              source={playIcon} 
-              style={[styles.mediaInfoIcon, { tintColor: '#999' }]}
-              resizeMode="contain"
-            />
+            {mediaStatus.art ? (
+              // Adres içerik hash'i içerir; parça değişmedikçe yeniden indirilmez
+              <Image 
+                source={{ uri: `http://${device.host}:${device.port}${mediaStatus.art}` }} 
+                style={styles.mediaArt}
+                resizeMode="cover"
+              />
+            ) : (
+              <Image 
+                source={playIcon} 
+                style={[styles.mediaInfoIcon, { tintColor: '#999' }]}
+                resizeMode="contain"
+              />
+            )}
             <Text style={styles.mediaInfoText}>
               {mediaStatus.title}
               {mediaStatus.artist ? ` - ${mediaStatus.artist}` : ''}
@@ -861,9 +889,8 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
               <TouchableOpacity
                 style={styles.volumeButton}
                 onPress={() => {
+                  // Yeni mute durumu sunucudan 'volume-changed' ile gelir
                   sendVolumeControl('mute');
-                  // Mute durumunu toggle etmek için kısa bir delay sonra volume'u yeniden al
-                  setTimeout(() => fetchVolume(), 200);
                 }}
               >
                 <Image 
@@ -1351,7 +1378,7 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
                       >
                         {source.thumbnail && (
                           <Image 
-                            source={{ uri: source.thumbnail }} 
+                            source={{ uri: thumbnailUri(source.thumbnail) }} 
                             style={styles.sourceThumbnail}
                             resizeMode="cover"
                           />
@@ -1390,7 +1417,7 @@ export const RemoteScreenScreen = ({ device, socket, onBack, onDisconnect }) =>
                       >
                         {source.thumbnail && (
                           <Image 
-                            source={{ uri: source.thumbnail }} 
+                            source={{ uri: thumbnailUri(source.thumbnail) }} 
                             style={styles.sourceThumbnail}
                             resizeMode="cover"
                           />
@@ -1783,6 +1810,12 @@ const styles = StyleSheet.create({
     width: 16,
     height: 16
   },
+  mediaArt: {
+    width: 40,
+    height: 40,
+    borderRadius: 4,
+    backgroundColor: '#222'
+  },
   mediaInfoText: {
     fontSize: 12,
     color: '#999',
@@ -0,0 +1,131 @@
+// Sayfa ikon atlası (GET /icon-atlas/:pageId)
+// Sayfanın tüm ikonları tek istekte gelir: kısa bir ikili manifest + tek PNG.
+// Format: desktop/server/icon-addon/icon_atlas.h
+//
+// Başlık (20 bayt): 'L' 'A' sürüm 0 | u16 hücre | u16 ikon sayısı |
+//                   u16 genişlik | u16 yükseklik | u32 PNG konumu | u32 PNG boyu
+// İkon: u16 x | u16 y | u16 genişlik | u16 yükseklik | u8 ad uzunluğu | ad
+//
+// Atlasta olmayan ikonlar (gif, svg, bozuk dosya) /icons/<ad> adresinden yüklenir.
+
+import { PixelRatio } from 'react-native';
+
+const HEADER_SIZE = 20;
+const VERSION = 1;
+// Sunucudaki ICON_ATLAS_CELLS ile aynı
+const ATLAS_CELLS = [64, 96, 128, 192, 256];
+const BASE64_CHUNK = 0x8000;
+
+// `${host}:${port}/${pageId}@${hücre}` -> { etag, atlas }
+const atlasCache = new Map();
+
+const cacheKey = (device, pageId, cell) => `${device.host}:${device.port}/${pageId}@${cell}`;
+
+// Ekranda size dp olan ikon için atlas hücresi (piksel)
+export const atlasCellFor = (size) => {
+  const pixels = Math.ceil(size * PixelRatio.get());
+  return ATLAS_CELLS.find(cell => cell >= pixels) || ATLAS_CELLS[ATLAS_CELLS.length - 1];
+};
+
+const decodeUtf8 = (bytes) => {
+  let text = '';
+  for (let i = 0; i < bytes.length;) {
+    const byte = bytes[i++];
+    let code = byte;
+    if (byte >= 0xF0) {
+      code = ((byte & 0x07) << 18) | ((bytes[i++] & 0x3F) << 12) | ((bytes[i++] & 0x3F) << 6) | (bytes[i++] & 0x3F);
+    } else if (byte >= 0xE0) {
+      code = ((byte & 0x0F) << 12) | ((bytes[i++] & 0x3F) << 6) | (bytes[i++] & 0x3F);
+    } else if (byte >= 0xC0) {
+      code = ((byte & 0x1F) << 6) | (bytes[i++] & 0x3F);
+    }
+    text += String.fromCodePoint(code);
+  }
+  return text;
+};
+
+const toBase64 = (bytes) => {
+  let binary = '';
+  for (let i = 0; i < bytes.length; i += BASE64_CHUNK) {
+    binary += String.fromCharCode.apply(null, bytes.subarray(i, i + BASE64_CHUNK));
+  }
+  return btoa(binary);
+};
+
+// Paket -> { cell, width, height, icons: { ad: { x, y, width, height } }, image } (geçersizse null)
+export const parseIconAtlas = (buffer) => {
+  const bytes = new Uint8Array(buffer);
+  if (bytes.length < HEADER_SIZE || bytes[0] !== 0x4C || bytes[1] !== 0x41 || bytes[2] !== VERSION) {
+    return null;
+  }
+
+  const view = new DataView(buffer);
+  const count = view.getUint16(6, true);
+  const imageOffset = view.getUint32(12, true);
+  const imageBytes = view.getUint32(16, true);
+  if (imageOffset + imageBytes > bytes.length) {
+    return null;
+  }
+
+  const icons = Object.create(null);
+  let offset = HEADER_SIZE;
+  for (let i = 0; i < count; i++) {
+    if (offset + 9 > imageOffset) {
+      return null;
+    }
+    const nameLength = bytes[offset + 8];
+    icons[decodeUtf8(bytes.subarray(offset + 9, offset + 9 + nameLength))] = {
+      x: view.getUint16(offset, true),
+      y: view.getUint16(offset + 2, true),
+      width: view.getUint16(offset + 4, true),
+      height: view.getUint16(offset + 6, true)
+    };
+    offset += 9 + nameLength;
+  }
+
+  return {
+    cell: view.getUint16(4, true),
+    width: view.getUint16(8, true),
+    height: view.getUint16(10, true),
+    icons,
+    image: imageBytes > 0
+      ? `data:image/png;base64,${toBase64(bytes.subarray(imageOffset, imageOffset + imageBytes))}`
+      : null
+  };
+};
+
+// Son indirilen atlas (sayfa değişiminde anında gösterilir, sonra doğrulanır)
+export const getCachedIconAtlas = (device, pageId, cell) => {
+  if (!device || !pageId) {
+    return null;
+  }
+  return atlasCache.get(cacheKey(device, pageId, cell))?.atlas || null;
+};
+
+// Atlası indir veya doğrula (değişmediyse 304, önbellekteki döner). Atlas yoksa null.
+export const loadIconAtlas = async (device, pageId, cell) => {
+  if (!device || !pageId) {
+    return null;
+  }
+
+  const key = cacheKey(device, pageId, cell);
+  const cached = atlasCache.get(key);
+  const response = await fetch(
+    `http://${device.host}:${device.port}/icon-atlas/${encodeURIComponent(pageId)}?cell=${cell}`,
+    { headers: cached ? { 'If-None-Match': cached.etag } : {} }
+  );
+
+  if (response.status === 304 && cached) {
+    return cached.atlas;
+  }
+  if (!response.ok) {
+    atlasCache.delete(key);
+    return null;
+  }
+
+  const atlas = parseIconAtlas(await response.arrayBuffer());
+  if (atlas) {
+    atlasCache.set(key, { etag: response.headers.get('ETag'), atlas });
+  }
+  return atlas;
+};
@@ -0,0 +1,164 @@
+// İkili girdi çerçevesi (remote-input)
+// Fare ve tuş eventleri sabit boyutlu kayıtlar halinde tek mesajda gönderilir.
+// Format: desktop/server/keyboard-addon/input_frame.h
+//
+// Başlık (16 bayt): 'L' 'I' sürüm kayıtBoyutu | u32 sıra | u32 zaman (ms) | u16 sayı | u16 0
+// Kayıt (16 bayt): u8 tür | u8 bayrak | u16 zaman farkı (ms) | 12 bayt veri
+
+const HEADER_SIZE = 16;
+const RECORD_SIZE = 16;
+const KEY_NAME_SIZE = 12;
+const NORMALIZED_MAX = 65535;
+
+const TYPE_MOVE = 1;
+const TYPE_MOVE_BY = 2;
+const TYPE_BUTTON = 3;
+const TYPE_CLICK = 4;
+const TYPE_SCROLL = 5;
+const TYPE_KEY = 6;
+
+const FLAG_DOWN = 1;
+const FLAG_HAS_POSITION = 2;
+
+const BUTTONS = { left: 0, middle: 1, right: 2, 0: 0, 1: 1, 2: 2 };
+
+// Değiştirici tuş adı -> bayrak (Ctrl, Alt, Shift, Win)
+export const MODIFIER_FLAGS = {
+  control: 1,
+  ctrl: 1,
+  alt: 2,
+  shift: 4,
+  win: 8,
+  command: 8,
+  meta: 8
+};
+
+const toNormalized = (value) => Math.round(Math.max(0, Math.min(1, value)) * NORMALIZED_MAX);
+
+export class InputFrameWriter {
+  constructor(maxRecords = 64) {
+    this.maxRecords = maxRecords;
+    this.bytes = new Uint8Array(HEADER_SIZE + maxRecords * RECORD_SIZE);
+    this.view = new DataView(this.bytes.buffer);
+    this.sequence = 0;
+    this.count = 0;
+    this.baseTime = 0;
+  }
+
+  get length() {
+    return this.count;
+  }
+
+  get full() {
+    return this.count >= this.maxRecords;
+  }
+
+  // Yeni oturum: sıra numarası baştan başlar (sunucu da sıfırlar)
+  reset() {
+    this.sequence = 0;
+    this.count = 0;
+  }
+
+  record(type, flags) {
+    if (this.full) {
+      return -1;
+    }
+
+    const now = Date.now();
+    if (this.count === 0) {
+      this.baseTime = now;
+    }
+
+    const offset = HEADER_SIZE + this.count * RECORD_SIZE;
+    this.bytes.fill(0, offset, offset + RECORD_SIZE);
+    this.bytes[offset] = type;
+    this.bytes[offset + 1] = flags;
+    this.view.setUint16(offset + 2, Math.min(now - this.baseTime, 0xffff), true);
+    this.count++;
+    return offset;
+  }
+
+  pair(offset, x, y) {
+    this.view.setInt32(offset + 4, x, true);
+    this.view.setInt32(offset + 8, y, true);
+  }
+
+  // Normalize konum (0-1)
+  move(x, y) {
+    const offset = this.record(TYPE_MOVE, 0);
+    if (offset < 0) return false;
+    this.pair(offset, toNormalized(x), toNormalized(y));
+    return true;
+  }
+
+  // Piksel farkı
+  moveBy(dx, dy) {
+    const offset = this.record(TYPE_MOVE_BY, 0);
+    if (offset < 0) return false;
+    this.pair(offset, Math.round(dx), Math.round(dy));
+    return true;
+  }
+
+  button(button, down, x, y) {
+    return this.pointerButton(TYPE_BUTTON, button, down ? FLAG_DOWN : 0, x, y);
+  }
+
+  click(button, x, y) {
+    return this.pointerButton(TYPE_CLICK, button, 0, x, y);
+  }
+
+  pointerButton(type, button, flags, x, y) {
+    const hasPosition = typeof x === 'number' && typeof y === 'number';
+    const offset = this.record(type, flags | (hasPosition ? FLAG_HAS_POSITION : 0));
+    if (offset < 0) return false;
+    if (hasPosition) {
+      this.pair(offset, toNormalized(x), toNormalized(y));
+    }
+    this.bytes[offset + 12] = BUTTONS[button] ?? 0;
+    return true;
+  }
+
+  // Çentik; pozitif dy yukarı, pozitif dx sağa
+  scroll(dx, dy) {
+    const offset = this.record(TYPE_SCROLL, 0);
+    if (offset < 0) return false;
+    this.pair(offset, Math.round(dx), Math.round(dy));
+    return true;
+  }
+
+  // Tuş adı ASCII ve en fazla 12 karakter olmalı; değilse false (JSON ile gönderilmeli)
+  static canEncodeKey(name) {
+    return typeof name === 'string' && name.length > 0 && name.length <= KEY_NAME_SIZE && /^[\x21-\x7e]+$/.test(name);
+  }
+
+  key(modifiers, name) {
+    if (!InputFrameWriter.canEncodeKey(name)) return false;
+    const offset = this.record(TYPE_KEY, modifiers & 0x0f);
+    if (offset < 0) return false;
+    for (let i = 0; i < name.length; i++) {
+      this.bytes[offset + 4 + i] = name.charCodeAt(i);
+    }
+    return true;
+  }
+
+  // Çerçeveyi tamamla ve kopyasını döndür (yazıcı boşalır); boşsa null
+  finish() {
+    if (this.count === 0) {
+      return null;
+    }
+
+    this.sequence = (this.sequence + 1) >>> 0;
+    this.bytes[0] = 0x4c; // 'L'
+    this.bytes[1] = 0x49; // 'I'
+    this.bytes[2] = 1;
+    this.bytes[3] = RECORD_SIZE;
+    this.view.setUint32(4, this.sequence, true);
+    this.view.setUint32(8, this.baseTime >>> 0, true);
+    this.view.setUint16(12, this.count, true);
+    this.view.setUint16(14, 0, true);
+
+    const frame = this.bytes.slice(0, HEADER_SIZE + this.count * RECORD_SIZE);
+    this.count = 0;
+    return frame;
+  }
+}
@@ -28,6 +28,39 @@ function getDataDir() {
   }
 }
 
+// Kaynak seçici küçük resim boyutu (px, uzun kenar)
+const SCREEN_THUMBNAIL_SIZE = 150;
+// Kaynak listesi bu süre boyunca yeniden kullanılır (seçici açılırken telefon ve
+// masaüstü arayüzü art arda sorsa bile desktopCapturer bir kez çalışır)
+const SCREEN_SOURCES_TTL = 1000;
+let screenSourcesRequest = null; // { promise, time } - time: tamamlandığı an (sürerken 0)
+
+// Ekran ve pencere kaynakları. Süren bir istek varsa onu bekler.
+// Küçük resimler server'ın native önbelleğinden geçer (bkz. buildScreenSources).
+function getScreenSources() {
+  const cached = screenSourcesRequest;
+  if (cached && (cached.time === 0 || Date.now() - cached.time < SCREEN_SOURCES_TTL)) {
+    return cached.promise;
+  }
+
+  const request = { promise: null, time: 0 };
+  request.promise = desktopCapturer.getSources({
+    types: ['screen', 'window'],
+    thumbnailSize: { width: SCREEN_THUMBNAIL_SIZE, height: SCREEN_THUMBNAIL_SIZE }
+  })
+    .then(sources => server.buildScreenSources(sources, SCREEN_THUMBNAIL_SIZE))
+    .catch(error => {
+      console.error('❌ Screen sources hatası:', error);
+      return { screens: [], windows: [] };
+    })
+    .finally(() => {
+      request.time = Date.now();
+    });
+
+  screenSourcesRequest = request;
+  return request.promise;
+}
+
 function createWindow() {
   mainWindow = new BrowserWindow({
     width: 1200,
@@ -72,38 +105,7 @@ app.whenReady().then(async () => {
   });
 
   // Server'a screen sources callback'i ekle
-  server.getScreenSourcesCallback = async () => {
-    try {
-      const sources = await desktopCapturer.getSources({
-        types: ['screen', 'window'],
-        thumbnailSize: { width: 150, height: 150 }
-      });
-      
-      // Kaynakları kategorize et
-      const screens = sources
-        .filter(s => s.id.startsWith('screen:'))
-        .map(s => ({
-          id: s.id,
-          name: s.name,
-          type: 'screen',
-          thumbnail: s.thumbnail ? s.thumbnail.toDataURL() : null
-        }));
-      
-      const windows = sources
-        .filter(s => s.id.startsWith('window:'))
-        .map(s => ({
-          id: s.id,
-          name: s.name,
-          type: 'window',
-          thumbnail: s.thumbnail ? s.thumbnail.toDataURL() : null
-        }));
-      
-      return { screens, windows };
-    } catch (error) {
-      console.error('❌ Screen sources hatası:', error);
-      return { screens: [], windows: [] };
-    }
-  };
+  server.getScreenSourcesCallback = getScreenSources;
 
   // Server'a screen info callback'i ekle (sourceId'ye göre ekran bilgisi)
   server.getScreenInfoCallback = async (sourceId) => {
@@ -206,9 +208,9 @@ ipcMain.handle('get-pages', async () => {
   return server.getPages();
 });
 
-ipcMain.handle('add-page', async (event, name, icon, targetApp) => {
+ipcMain.handle('add-page', async (event, name, icon, targetApp, deliveryMode) => {
   if (!server) return { success: false, message: 'Server henüz başlatılmadı' };
-  return server.addPage(name, icon, targetApp);
+  return server.addPage(name, icon, targetApp, deliveryMode);
 });
 
 ipcMain.handle('update-page-target-app', async (event, pageId, targetApp) => {
@@ -216,6 +218,11 @@ ipcMain.handle('update-page-target-app', async (event, pageId, targetApp) => {
   return server.updatePageTargetApp(pageId, targetApp);
 });
 
+ipcMain.handle('update-page-delivery-mode', async (event, pageId, deliveryMode) => {
+  if (!server) return { success: false, message: 'Server henüz başlatılmadı' };
+  return server.updatePageDeliveryMode(pageId, deliveryMode);
+});
+
 ipcMain.handle('update-page-name', async (event, pageId, newName) => {
   if (!server) return { success: false, message: 'Server henüz başlatılmadı' };
   return server.updatePageName(pageId, newName);
@@ -339,37 +346,17 @@ ipcMain.handle('get-windows', async () => {
 });
 
 // Ekran ve pencere kaynaklarını al (WebRTC için)
+// Küçük resim adresleri server'a görelidir; masaüstü arayüzü için tam adrese çevrilir
 ipcMain.handle('get-screen-sources', async () => {
-  try {
-    const sources = await desktopCapturer.getSources({
-      types: ['screen', 'window'],
-      thumbnailSize: { width: 150, height: 150 }
-    });
-    
-    // Kaynakları kategorize et
-    const screens = sources
-      .filter(s => s.id.startsWith('screen:'))
-      .map(s => ({
-        id: s.id,
-        name: s.name,
-        type: 'screen',
-        thumbnail: s.thumbnail ? s.thumbnail.toDataURL() : null
-      }));
-    
-    const windows = sources
-      .filter(s => s.id.startsWith('window:'))
-      .map(s => ({
-        id: s.id,
-        name: s.name,
-        type: 'window',
-        thumbnail: s.thumbnail ? s.thumbnail.toDataURL() : null
-      }));
-    
-    return { screens, windows };
-  } catch (error) {
-    console.error('❌ Screen sources hatası:', error);
-    return { screens: [], windows: [] };
-  }
+  if (!server) return { screens: [], windows: [] };
+  const { screens, windows } = await getScreenSources();
+  const absolute = (source) => ({
+    ...source,
+    thumbnail: source.thumbnail && source.thumbnail.startsWith('/')
+      ? `http://localhost:${server.port}${source.thumbnail}`
+      : source.thumbnail
+  });
+  return { screens: screens.map(absolute), windows: windows.map(absolute) };
 });
 
 // Sayfa için hedef uygulama seç
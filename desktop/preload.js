@@ -4,9 +4,10 @@ const { contextBridge, ipcRenderer } = require('electron');
 contextBridge.exposeInMainWorld('electronAPI', {
   // Sayfalar yönetimi
   getPages: () => ipcRenderer.invoke('get-pages'),
-  addPage: (name, icon, targetApp) => ipcRenderer.invoke('add-page', name, icon, targetApp),
+  addPage: (name, icon, targetApp, deliveryMode) => ipcRenderer.invoke('add-page', name, icon, targetApp, deliveryMode),
   updatePageName: (pageId, newName) => ipcRenderer.invoke('update-page-name', pageId, newName),
   updatePageTargetApp: (pageId, targetApp) => ipcRenderer.invoke('update-page-target-app', pageId, targetApp),
+  updatePageDeliveryMode: (pageId, deliveryMode) => ipcRenderer.invoke('update-page-delivery-mode', pageId, deliveryMode),
   deletePage: (pageId) => ipcRenderer.invoke('delete-page', pageId),
   addShortcutToPage: (pageId, shortcut) => ipcRenderer.invoke('add-shortcut-to-page', pageId, shortcut),
   updateShortcutInPage: (pageId, shortcutId, shortcut) => ipcRenderer.invoke('update-shortcut-in-page', pageId, shortcutId, shortcut),
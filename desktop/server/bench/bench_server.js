@@ -0,0 +1,72 @@
+// input_path_bench.js için sunucu süreci
+// LocalDeskServer'ı test backend'iyle (LOCALDESK_TEST_BACKEND) başlatır: tuşlar,
+// ses ve medya OS'e gitmeden native addon'larda kaydedilir. Discovery (UDP/mDNS)
+// başlatılmaz ki aynı ağdaki telefonlar benchmark sunucusunu görmesin.
+//
+// Doğrudan çalıştırılmaz; harness fork eder:
+//   bench_server.js <veri dizini>
+// IPC: { type: 'ready', port } gönderir; { id, type: 'stats' | 'publish-media' }
+// isteklerine { id, result } ile cevap verir.
+
+if (!process.env.LOCALDESK_TEST_BACKEND) {
+  process.env.LOCALDESK_TEST_BACKEND = 'null';
+}
+
+const discovery = require('../discovery');
+
+discovery.start = async () => {};
+discovery.stop = async () => {};
+
+const LocalDeskServer = require('../index');
+
+let volumeAddon = null;
+let mediaAddon = null;
+try {
+  volumeAddon = require('../volume-addon');
+} catch (error) {
+  // index.js zaten uyardı
+}
+try {
+  mediaAddon = require('../media-addon');
+} catch (error) {
+  // index.js zaten uyardı
+}
+
+function testBackend(addon) {
+  return addon && addon.getTestBackend ? addon.getTestBackend() : null;
+}
+
+async function main() {
+  const server = new LocalDeskServer(process.argv[2]);
+  // Boş port: aynı makinede çalışan gerçek sunucuyla (3100) çakışmasın
+  server.port = 0;
+  await server.start();
+
+  process.on('message', (message) => {
+    let result = null;
+    if (message.type === 'stats') {
+      result = {
+        keyboard: testBackend(server.keyboardAddon),
+        volume: testBackend(volumeAddon),
+        media: testBackend(mediaAddon)
+      };
+    } else if (message.type === 'publish-media') {
+      result = mediaAddon && mediaAddon.publishTestMedia
+        ? mediaAddon.publishTestMedia(message.status)
+        : false;
+    }
+    process.send({ id: message.id, result });
+  });
+
+  process.on('disconnect', async () => {
+    await server.stop();
+    process.exit(0);
+  });
+
+  process.send({ type: 'ready', port: server.server.address().port });
+}
+
+main().catch((error) => {
+  console.error('❌ Benchmark sunucusu başlatılamadı:', error);
+  process.exit(1);
+});
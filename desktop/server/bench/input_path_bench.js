@@ -0,0 +1,318 @@
+// Uçtan uca girdi yolu benchmark'ı
+// Gerçek sunucuyu (server/index.js) test backend'iyle ayrı bir süreçte başlatır
+// ve Socket.IO istemcileriyle ölçer: istemcinin emit ettiği andan sunucunun
+// cevabı (execute-result, volume-changed, HTTP yanıtı) istemciye ulaşana kadar.
+// Tuşlar native addon'da kaydedilir, OS'e gönderilmez; ekrandaki pencereler
+// etkilenmez.
+//
+// Senaryolar:
+//   tek basış     - kapalı döngü, her basış öncekinin sonucunu bekler
+//   burst         - BURST basış art arda emit edilir (makro tuşu / hızlı tıklama)
+//   çok istemci   - CLIENTS telefon aynı anda kapalı döngü basar
+//   ses           - remote-volume-control set -> volume-changed
+//   medya durumu  - GET /media-status (native önbellek)
+//
+// Çalıştırma: node bench/input_path_bench.js [--presses N] [--clients N] [--burst N] [--backend null|recording]
+// socket.io-client gerekir: mobil uygulamanın bağımlılıkları (LocalDesk/node_modules)
+// veya `npm install --no-save socket.io-client`.
+
+const { fork } = require('child_process');
+const fs = require('fs');
+const http = require('http');
+const os = require('os');
+const path = require('path');
+
+function option(name, fallback) {
+  const index = process.argv.indexOf(`--${name}`);
+  return index >= 0 && process.argv[index + 1] ? process.argv[index + 1] : fallback;
+}
+
+const PRESSES = Number(option('presses', 5000));
+const CLIENTS = Number(option('clients', 4));
+const BURST = Number(option('burst', 50));
+const BACKEND = option('backend', 'recording');
+const VOLUME_CHANGES = Number(option('volume', 100));
+const VERBOSE = process.argv.includes('--verbose');
+
+// Zamanlayıcı aynı hedefe 30 ms'den sık yazmaz (VolumeScheduler::kSetInterval)
+const VOLUME_INTERVAL_MS = 40;
+
+function loadSocketClient() {
+  const candidates = [
+    'socket.io-client',
+    path.join(__dirname, '..', '..', '..', 'LocalDesk', 'node_modules', 'socket.io-client')
+  ];
+  for (const candidate of candidates) {
+    try {
+      return require(candidate);
+    } catch (error) {
+      // Sıradaki aday
+    }
+  }
+  console.error('❌ socket.io-client bulunamadı');
+  console.error('💡 Çözüm: cd LocalDesk && npm install  veya  npm install --no-save socket.io-client');
+  process.exit(1);
+}
+
+const { io } = loadSocketClient();
+
+const SHORTCUT = { id: 1, label: 'Kaydet', icon: '💾', keys: ['CONTROL', 'S'], color: '#00C853', actionType: 'keys' };
+
+// Geçici veri dizini: config, tek sayfa ve önceden güvenilir istemciler
+function createDataDir() {
+  const dataDir = fs.mkdtempSync(path.join(os.tmpdir(), 'localdesk-bench-'));
+  const write = (name, value) => fs.writeFileSync(path.join(dataDir, name), JSON.stringify(value, null, 2));
+
+  write('config.json', { deviceId: 'bench-desktop', deviceName: 'Benchmark' });
+  write('pages.json', [{ id: 'page-bench', name: 'Benchmark', shortcuts: [SHORTCUT] }]);
+  write('trusted.json', Array.from({ length: CLIENTS }, (_, i) => ({
+    id: `bench-client-${i}`,
+    name: `Benchmark ${i}`,
+    type: 'phone',
+    addedAt: Date.now(),
+    autoConnect: true
+  })));
+  return dataDir;
+}
+
+function startServer(dataDir) {
+  const child = fork(path.join(__dirname, 'bench_server.js'), [dataDir], {
+    env: { ...process.env, LOCALDESK_TEST_BACKEND: BACKEND },
+    // Sunucu logları (LOCALDESK_LOG_LEVEL=debug ise her basış) ölçümü bozmasın
+    stdio: VERBOSE ? 'inherit' : ['ignore', 'ignore', 'inherit', 'ipc']
+  });
+
+  let nextId = 0;
+  const pending = new Map();
+  child.on('message', (message) => {
+    const resolve = pending.get(message.id);
+    if (resolve) {
+      pending.delete(message.id);
+      resolve(message.result);
+    }
+  });
+
+  const request = (type, payload = {}) => new Promise((resolve) => {
+    const id = ++nextId;
+    pending.set(id, resolve);
+    child.send({ id, type, ...payload });
+  });
+
+  const ready = new Promise((resolve, reject) => {
+    child.on('message', (message) => {
+      if (message.type === 'ready') resolve(message.port);
+    });
+    child.on('exit', (code) => reject(new Error(`Sunucu süreci kapandı (${code})`)));
+  });
+
+  return { child, request, ready };
+}
+
+function connectClient(port, index) {
+  return new Promise((resolve, reject) => {
+    const socket = io(`http://127.0.0.1:${port}`, { transports: ['websocket'], forceNew: true, reconnection: false });
+    socket.once('connect_error', reject);
+    socket.once('connect', () => {
+      socket.emit('pair-request', { deviceId: `bench-client-${index}`, deviceName: `Benchmark ${index}`, deviceType: 'phone' });
+    });
+    socket.once('pair-response', (response) => {
+      if (response.success) resolve(socket);
+      else reject(new Error(response.message));
+    });
+  });
+}
+
+function pressShortcut(socket) {
+  socket.emit('execute-shortcut', { shortcutId: SHORTCUT.id, keys: SHORTCUT.keys, actionType: 'keys', pageId: 'page-bench' });
+}
+
+// Tek sokette sonuçlar gönderim sırasıyla gelir: FIFO ile eşleştirilir
+function trackResults(socket, samples) {
+  const sent = [];
+  const waiters = [];
+  socket.on('execute-result', () => {
+    const start = sent.shift();
+    samples.push(Number(process.hrtime.bigint() - start));
+    const waiter = waiters.shift();
+    if (waiter) waiter();
+  });
+  return {
+    press() {
+      sent.push(process.hrtime.bigint());
+      pressShortcut(socket);
+      return new Promise((resolve) => waiters.push(resolve));
+    }
+  };
+}
+
+function summarize(label, samplesNs, seconds) {
+  const sorted = Float64Array.from(samplesNs).sort();
+  const at = (q) => sorted.length ? sorted[Math.round(q * (sorted.length - 1))] / 1e6 : 0;
+  return {
+    senaryo: label,
+    adet: sorted.length,
+    'p50 ms': at(0.5).toFixed(3),
+    'p99 ms': at(0.99).toFixed(3),
+    'p99.9 ms': at(0.999).toFixed(3),
+    'max ms': (sorted.length ? sorted[sorted.length - 1] / 1e6 : 0).toFixed(2),
+    'işlem/s': Math.round(sorted.length / seconds)
+  };
+}
+
+async function timed(fn) {
+  const start = process.hrtime.bigint();
+  await fn();
+  return Number(process.hrtime.bigint() - start) / 1e9;
+}
+
+async function runSingle(tracker) {
+  return timed(async () => {
+    for (let i = 0; i < PRESSES; i++) {
+      await tracker.press();
+    }
+  });
+}
+
+async function runBurst(tracker) {
+  const seconds = await timed(async () => {
+    for (let done = 0; done < PRESSES; done += BURST) {
+      const batch = [];
+      for (let i = 0; i < BURST; i++) {
+        batch.push(tracker.press());
+      }
+      await Promise.all(batch);
+    }
+  });
+  return seconds;
+}
+
+async function runMultiClient(trackers) {
+  const perClient = Math.ceil(PRESSES / trackers.length);
+  return timed(() => Promise.all(trackers.map(async (tracker) => {
+    for (let i = 0; i < perClient; i++) {
+      await tracker.press();
+    }
+  })));
+}
+
+// volume-changed herkese yayınlanır; aynı değer tekrar bildirilmez, değerler farklı seçilir
+async function runVolume(socket) {
+  const samples = [];
+  const seconds = await timed(async () => {
+    for (let i = 0; i < VOLUME_CHANGES; i++) {
+      const value = i % 2 === 0 ? 20 + (i % 30) : 80 - (i % 30);
+      const start = process.hrtime.bigint();
+      await new Promise((resolve) => {
+        const onChange = ({ volume }) => {
+          if (Math.round(volume) !== value) return;
+          socket.off('volume-changed', onChange);
+          resolve();
+        };
+        socket.on('volume-changed', onChange);
+        socket.emit('remote-volume-control', { action: 'set', value });
+      });
+      samples.push(Number(process.hrtime.bigint() - start));
+      await new Promise((resolve) => setTimeout(resolve, VOLUME_INTERVAL_MS));
+    }
+  });
+  return { samples, seconds };
+}
+
+function getJson(agent, port, pathname) {
+  return new Promise((resolve, reject) => {
+    http.get({ host: '127.0.0.1', port, path: pathname, agent }, (res) => {
+      let body = '';
+      res.setEncoding('utf8');
+      res.on('data', (chunk) => { body += chunk; });
+      res.on('end', () => resolve(JSON.parse(body)));
+    }).on('error', reject);
+  });
+}
+
+async function runMediaStatus(port) {
+  const agent = new http.Agent({ keepAlive: true, maxSockets: 1 });
+  const samples = [];
+  const seconds = await timed(async () => {
+    for (let i = 0; i < PRESSES; i++) {
+      const start = process.hrtime.bigint();
+      await getJson(agent, port, '/media-status');
+      samples.push(Number(process.hrtime.bigint() - start));
+    }
+  });
+  agent.destroy();
+  return { samples, seconds };
+}
+
+async function main() {
+  const dataDir = createDataDir();
+  const server = startServer(dataDir);
+  const sockets = [];
+
+  try {
+    const port = await server.ready;
+    for (let i = 0; i < CLIENTS; i++) {
+      sockets.push(await connectClient(port, i));
+    }
+
+    console.log(`Girdi yolu benchmark'ı (backend: ${BACKEND}, ${PRESSES} basış, ${CLIENTS} istemci, burst ${BURST})`);
+    const rows = [];
+
+    // Isınma: JIT, addon önbellekleri, Socket.IO tamponları
+    const warmup = trackResults(sockets[0], []);
+    for (let i = 0; i < 200; i++) {
+      await warmup.press();
+    }
+    sockets[0].removeAllListeners('execute-result');
+
+    let samples = [];
+    let tracker = trackResults(sockets[0], samples);
+    let seconds = await runSingle(tracker);
+    rows.push(summarize('tek basış', samples, seconds));
+    sockets[0].removeAllListeners('execute-result');
+
+    samples = [];
+    tracker = trackResults(sockets[0], samples);
+    seconds = await runBurst(tracker);
+    rows.push(summarize(`burst (${BURST})`, samples, seconds));
+    sockets[0].removeAllListeners('execute-result');
+
+    samples = [];
+    const trackers = sockets.map((socket) => trackResults(socket, samples));
+    seconds = await runMultiClient(trackers);
+    rows.push(summarize(`çok istemci (${CLIENTS})`, samples, seconds));
+    sockets.forEach((socket) => socket.removeAllListeners('execute-result'));
+
+    // Addon derlenmemişse volume-changed hiç gelmez; senaryo atlanır
+    const backends = await server.request('stats');
+    if (backends.volume) {
+      const volume = await runVolume(sockets[0]);
+      rows.push(summarize('ses set', volume.samples, volume.seconds));
+    }
+
+    const media = await runMediaStatus(port);
+    rows.push(summarize(backends.media ? 'medya durumu' : 'medya durumu (yedek)', media.samples, media.seconds));
+
+    console.table(rows);
+
+    const stats = await server.request('stats');
+    console.log('Native kayıt:', JSON.stringify(stats));
+    for (const name of ['keyboard', 'volume', 'media']) {
+      if (!stats[name]) {
+        console.warn(`⚠️  ${name} addon test backend'i yok (addon derlenmemiş olabilir); ilgili yol native kısım olmadan ölçüldü`);
+      }
+    }
+  } finally {
+    sockets.forEach((socket) => socket.close());
+    if (server.child.exitCode === null) {
+      const exited = new Promise((resolve) => server.child.once('exit', resolve));
+      server.child.disconnect();
+      await exited;
+    }
+    fs.rmSync(dataDir, { recursive: true, force: true });
+  }
+}
+
+main().catch((error) => {
+  console.error('❌ Benchmark başarısız:', error.message);
+  process.exit(1);
+});
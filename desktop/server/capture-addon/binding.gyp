@@ -0,0 +1,62 @@
+{
+  "targets": [
+    {
+      "target_name": "capture",
+      "sources": [ "capture.cc", "screen_capture.cc" ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').gyp\")"
+      ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "defines": [ "NAPI_CPP_EXCEPTIONS" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [
+            "thumbnail_cache.cc",
+            "../native-common/image_resize.cc",
+            "../native-common/image_codec_win.cc"
+          ],
+          "defines": [ "CAPTURE_THUMBNAILS" ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "ExceptionHandling": 1
+            },
+            "VCLinkerTool": {
+              "AdditionalDependencies": [
+                "ole32.lib",
+                "oleaut32.lib",
+                "windowscodecs.lib"
+              ]
+            }
+          }
+        }],
+        ["OS=='linux'", {
+          "sources": [
+            "screen_capture_x11.cc",
+            "thumbnail_cache.cc",
+            "../native-common/image_resize.cc",
+            "../native-common/image_codec.cc"
+          ],
+          "defines": [ "CAPTURE_THUMBNAILS" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags x11 xext xdamage xfixes xrandr libjpeg libpng)" ],
+          "libraries": [ "<!@(pkg-config --libs x11 xext xdamage xfixes xrandr libjpeg libpng)" ]
+        }]
+      ]
+    }
+  ],
+  "conditions": [
+    ["OS=='linux'", {
+      "targets": [
+        {
+          "target_name": "x11_paint",
+          "type": "executable",
+          "sources": [ "test/x11_paint.cc" ],
+          "libraries": [ "-lxcb" ]
+        }
+      ]
+    }]
+  ]
+}
@@ -0,0 +1,411 @@
+#include <napi.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../native-common/metrics_napi.h"
+#include "screen_capture.h"
+#ifdef CAPTURE_THUMBNAILS
+#include "thumbnail_cache.h"
+#endif
+
+// Ekran yakalama (Linux: X11 MIT-SHM + XDamage, bkz. screen_capture.h)
+// grab(): kare paylaşılan bellek segmentini doğrudan gösteren (external) bir
+// ArrayBuffer olarak döner, kopya yoktur. Electron'un V8 sandbox'ı external
+// ArrayBuffer'lara izin vermez; orada grab() kareyi kopyalar. Electron için
+// grabInto(buffer) kullanılmalı: JS'in bir kez ayırdığı tampona sadece değişen
+// dikdörtgenler kopyalanır.
+
+// Çağrı metrikleri (getStats); grab / grabInto ScreenCapture metodlarıdır
+metrics::Registry captureMetrics("capture");
+metrics::Api& grabMetrics = captureMetrics.Add("grab");
+metrics::Api& grabIntoMetrics = captureMetrics.Add("grabInto");
+
+// Process'in external ArrayBuffer'a izin verip vermediği (ilk denemede öğrenilir)
+bool externalBuffersAllowed = true;
+
+// Segment referansını ArrayBuffer'ın ömrüne bağla; olmuyorsa kopyala
+Napi::Value FrameBuffer(Napi::Env env, const CapturedFrame& frame) {
+    size_t size = static_cast<size_t>(frame.stride) * frame.height;
+
+    if (externalBuffersAllowed) {
+        auto* owner = new std::shared_ptr<const void>(frame.owner);
+        napi_value value;
+        napi_status status = napi_create_external_arraybuffer(
+            env, const_cast<uint8_t*>(frame.pixels), size,
+            [](napi_env, void*, void* hint) {
+                delete static_cast<std::shared_ptr<const void>*>(hint);
+            },
+            owner, &value);
+        if (status == napi_ok) {
+            return Napi::Value(env, value);
+        }
+        delete owner;
+        if (status != napi_no_external_buffers_allowed) {
+            Napi::Error::New(env, "ArrayBuffer oluşturulamadı").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        externalBuffersAllowed = false;
+    }
+
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, size);
+    std::memcpy(buffer.Data(), frame.pixels, size);
+    return buffer;
+}
+
+// Dikdörtgenler düz dizi olarak: [x, y, width, height, ...]
+Napi::Int32Array RectArray(Napi::Env env, const std::vector<DirtyRect>& rects) {
+    Napi::Int32Array array = Napi::Int32Array::New(env, rects.size() * 4);
+    for (size_t i = 0; i < rects.size(); i++) {
+        array[i * 4 + 0] = rects[i].x;
+        array[i * 4 + 1] = rects[i].y;
+        array[i * 4 + 2] = rects[i].width;
+        array[i * 4 + 3] = rects[i].height;
+    }
+    return array;
+}
+
+// Ortak sonuç: { success, changed, full, width, height, stride, rects }
+Napi::Object FrameObject(Napi::Env env, const CapturedFrame& frame, int stride) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, true));
+    result.Set("changed", Napi::Boolean::New(env, frame.changed));
+    result.Set("full", Napi::Boolean::New(env, frame.full));
+    result.Set("width", Napi::Number::New(env, frame.width));
+    result.Set("height", Napi::Number::New(env, frame.height));
+    result.Set("stride", Napi::Number::New(env, stride));
+    result.Set("rects", RectArray(env, frame.rects));
+    return result;
+}
+
+Napi::Object ErrorObject(Napi::Env env, const std::string& error) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, false));
+    result.Set("error", Napi::String::New(env, error));
+    return result;
+}
+
+// ScreenCapture: tek bir monitör / pencere / uygulama için kalıcı yakalayıcı
+// new ScreenCapture({ monitor } | { window } | { targetApp })
+class ScreenCapture : public Napi::ObjectWrap<ScreenCapture> {
+public:
+    static Napi::Function Define(Napi::Env env) {
+        return DefineClass(env, "ScreenCapture", {
+            InstanceMethod("grab", &ScreenCapture::Grab),
+            InstanceMethod("grabInto", &ScreenCapture::GrabInto),
+            InstanceMethod("getSize", &ScreenCapture::GetSize),
+            InstanceMethod("close", &ScreenCapture::Close)
+        });
+    }
+
+    explicit ScreenCapture(const Napi::CallbackInfo& info)
+        : Napi::ObjectWrap<ScreenCapture>(info) {
+        Napi::Env env = info.Env();
+
+        CaptureTarget target;
+        if (info.Length() > 0 && info[0].IsObject()) {
+            Napi::Object options = info[0].As<Napi::Object>();
+            if (options.Has("monitor") && options.Get("monitor").IsNumber()) {
+                target.monitor = options.Get("monitor").As<Napi::Number>().Int32Value();
+            }
+            if (options.Has("window") && options.Get("window").IsNumber()) {
+                target.window = static_cast<unsigned long>(options.Get("window").As<Napi::Number>().Int64Value());
+            }
+            if (options.Has("targetApp") && options.Get("targetApp").IsString()) {
+                target.app = options.Get("targetApp").As<Napi::String>().Utf8Value();
+            }
+        }
+
+        std::string error;
+        if (!capturer_.Open(target, error)) {
+            Napi::Error::New(env, error).ThrowAsJavaScriptException();
+        }
+    }
+
+private:
+    Napi::Value Grab(const Napi::CallbackInfo& info) {
+        return Measured(grabMetrics, &ScreenCapture::GrabFrame, info);
+    }
+
+    Napi::Value GrabInto(const Napi::CallbackInfo& info) {
+        return Measured(grabIntoMetrics, &ScreenCapture::GrabFrameInto, info);
+    }
+
+    // metrics::Export'un instance metodu karşılığı
+    Napi::Value Measured(metrics::Api& api, Napi::Value (ScreenCapture::*method)(const Napi::CallbackInfo&),
+                         const Napi::CallbackInfo& info) {
+        metrics::Scope scope(api);
+        Napi::Value result = (this->*method)(info);
+        if (metrics::IsFailure(info.Env(), result)) {
+            scope.Fail();
+        }
+        return result;
+    }
+
+    // grab() - { success, changed, full, width, height, stride, rects, data? }
+    // data sadece changed=true iken döner ve bir sonraki grab()'a kadar geçerlidir
+    Napi::Value GrabFrame(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+
+        CapturedFrame frame;
+        std::string error;
+        if (!capturer_.Grab(frame, error)) {
+            return ErrorObject(env, error);
+        }
+
+        Napi::Object result = FrameObject(env, frame, frame.stride);
+        if (frame.changed) {
+            result.Set("data", FrameBuffer(env, frame));
+        }
+        return result;
+    }
+
+    // grabInto(buffer) - değişen dikdörtgenleri JS tamponuna kopyala
+    // Tampon sıkışık BGRA'dır (stride = width * 4); boyut değişirse
+    // success=false + requiredBytes döner, çağıran yeni tampon ayırıp tekrar dener.
+    Napi::Value GrabFrameInto(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+
+        uint8_t* target = nullptr;
+        size_t length = 0;
+        if (info.Length() > 0 && info[0].IsArrayBuffer()) {
+            Napi::ArrayBuffer buffer = info[0].As<Napi::ArrayBuffer>();
+            target = static_cast<uint8_t*>(buffer.Data());
+            length = buffer.ByteLength();
+        } else if (info.Length() > 0 && info[0].IsTypedArray()) {
+            Napi::Uint8Array array = info[0].As<Napi::Uint8Array>();
+            target = array.Data();
+            length = array.ByteLength();
+        } else {
+            Napi::TypeError::New(env, "ArrayBuffer veya Uint8Array bekleniyor").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        int width = 0, height = 0;
+        if (!capturer_.Size(width, height)) {
+            return ErrorObject(env, "Yakalama açık değil");
+        }
+
+        // Tampon küçükse kare okunmaz (damage kaybolmasın); çağıran yeni tampon
+        // ayırınca ilk kare tam kare gelir
+        size_t required = static_cast<size_t>(width) * 4 * height;
+        if (length < required) {
+            capturer_.Invalidate();
+            Napi::Object result = ErrorObject(env, "Tampon küçük");
+            result.Set("requiredBytes", Napi::Number::New(env, static_cast<double>(required)));
+            return result;
+        }
+
+        CapturedFrame frame;
+        std::string error;
+        if (!capturer_.Grab(frame, error)) {
+            return ErrorObject(env, error);
+        }
+
+        int stride = frame.width * 4;
+        required = static_cast<size_t>(stride) * frame.height;
+        if (length < required) {
+            // Grab sırasında çözünürlük değişti: okunan değişiklikler tampona
+            // yazılamadı, bir sonraki kare tam kare gelsin
+            capturer_.Invalidate();
+            Napi::Object result = ErrorObject(env, "Tampon küçük");
+            result.Set("requiredBytes", Napi::Number::New(env, static_cast<double>(required)));
+            return result;
+        }
+
+        for (const DirtyRect& rect : frame.rects) {
+            const uint8_t* source = frame.pixels + static_cast<size_t>(rect.y) * frame.stride + rect.x * 4;
+            uint8_t* destination = target + static_cast<size_t>(rect.y) * stride + rect.x * 4;
+            size_t bytes = static_cast<size_t>(rect.width) * 4;
+            for (int32_t row = 0; row < rect.height; row++) {
+                std::memcpy(destination, source, bytes);
+                source += frame.stride;
+                destination += stride;
+            }
+        }
+
+        return FrameObject(env, frame, stride);
+    }
+
+    Napi::Value GetSize(const Napi::CallbackInfo& info) {
+        Napi::Env env = info.Env();
+
+        int width = 0, height = 0;
+        if (!capturer_.Size(width, height)) {
+            return ErrorObject(env, "Yakalama açık değil");
+        }
+
+        Napi::Object result = Napi::Object::New(env);
+        result.Set("success", Napi::Boolean::New(env, true));
+        result.Set("width", Napi::Number::New(env, width));
+        result.Set("height", Napi::Number::New(env, height));
+        return result;
+    }
+
+    Napi::Value Close(const Napi::CallbackInfo& info) {
+        capturer_.Close();
+        return info.Env().Undefined();
+    }
+
+    ScreenCapturer capturer_;
+};
+
+// N-API: listMonitors() - { success, monitors: [{ index, name, x, y, width, height, primary }] }
+Napi::Value ListMonitors(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    std::vector<MonitorInfo> monitors;
+    std::string error;
+    if (!ScreenCapturer::ListMonitors(monitors, error)) {
+        Napi::Object result = ErrorObject(env, error);
+        result.Set("monitors", Napi::Array::New(env));
+        return result;
+    }
+
+    Napi::Array list = Napi::Array::New(env, monitors.size());
+    for (size_t i = 0; i < monitors.size(); i++) {
+        const MonitorInfo& monitor = monitors[i];
+        Napi::Object item = Napi::Object::New(env);
+        item.Set("index", Napi::Number::New(env, monitor.index));
+        item.Set("name", Napi::String::New(env, monitor.name));
+        item.Set("x", Napi::Number::New(env, monitor.x));
+        item.Set("y", Napi::Number::New(env, monitor.y));
+        item.Set("width", Napi::Number::New(env, monitor.width));
+        item.Set("height", Napi::Number::New(env, monitor.height));
+        item.Set("primary", Napi::Boolean::New(env, monitor.primary));
+        list[static_cast<uint32_t>(i)] = item;
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, true));
+    result.Set("monitors", list);
+    return result;
+}
+
+// N-API: getCaptureBackend() - { backend: 'x11-shm' | 'x11' | 'none' }
+Napi::Value GetCaptureBackend(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("backend", Napi::String::New(env, ScreenCapturer::Backend()));
+    return result;
+}
+
+#ifdef CAPTURE_THUMBNAILS
+// Kaynak seçici küçük resimleri (bkz. thumbnail_cache.h)
+// Senkron çalışır: içerik değişmediyse sadece ~150x150 bitmap'in özeti alınır,
+// değiştiyse küçük bir JPEG kodlanır (milisaniyenin altında).
+
+// Küçük resim: { success, etag, width, height, changed }
+Napi::Object ThumbnailObject(Napi::Env env, const ThumbnailResult& thumbnail) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, true));
+    result.Set("etag", Napi::String::New(env, thumbnail.etag));
+    result.Set("width", Napi::Number::New(env, thumbnail.width));
+    result.Set("height", Napi::Number::New(env, thumbnail.height));
+    result.Set("changed", Napi::Boolean::New(env, thumbnail.changed));
+    return result;
+}
+
+// N-API: updateThumbnail(sourceId, bitmap, width, height, size)
+// bitmap: NativeImage.toBitmap() çıktısı (BGRA); satır aralığı bayt sayısından bulunur
+Napi::Value UpdateThumbnail(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 5 || !info[0].IsString() || !info[1].IsBuffer() || !info[2].IsNumber() ||
+        !info[3].IsNumber() || !info[4].IsNumber()) {
+        Napi::TypeError::New(env, "sourceId, bitmap, width, height ve size bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string sourceId = info[0].As<Napi::String>().Utf8Value();
+    Napi::Buffer<uint8_t> bitmap = info[1].As<Napi::Buffer<uint8_t>>();
+    int width = info[2].As<Napi::Number>().Int32Value();
+    int height = info[3].As<Napi::Number>().Int32Value();
+    int size = info[4].As<Napi::Number>().Int32Value();
+
+    if (size < 16 || size > 1024) {
+        Napi::TypeError::New(env, "size 16-1024 aralığında olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (width <= 0 || height <= 0 || bitmap.Length() % static_cast<size_t>(height) != 0) {
+        return ErrorObject(env, "Bitmap boyutu width/height ile uyuşmuyor");
+    }
+
+    int stride = static_cast<int>(bitmap.Length() / static_cast<size_t>(height));
+    ThumbnailResult thumbnail;
+    std::string error;
+    if (!DefaultThumbnailCache().Update(sourceId, bitmap.Data(), width, height, stride, size, thumbnail, error)) {
+        return ErrorObject(env, error);
+    }
+    return ThumbnailObject(env, thumbnail);
+}
+
+// N-API: getThumbnail(etag) - önbellekte varsa { etag, data (JPEG Buffer), width, height }, yoksa null
+Napi::Value GetThumbnail(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "etag bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ThumbnailResult thumbnail;
+    if (!DefaultThumbnailCache().Find(info[0].As<Napi::String>().Utf8Value(), thumbnail)) {
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("etag", Napi::String::New(env, thumbnail.etag));
+    result.Set("data", Napi::Buffer<uint8_t>::Copy(env, thumbnail.jpeg->data(), thumbnail.jpeg->size()));
+    result.Set("width", Napi::Number::New(env, thumbnail.width));
+    result.Set("height", Napi::Number::New(env, thumbnail.height));
+    return result;
+}
+
+// N-API: retainThumbnails(sourceIds) - listede olmayan kaynakları unutur, sayısını döner
+Napi::Value RetainThumbnails(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "sourceIds dizisi bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Array list = info[0].As<Napi::Array>();
+    std::vector<std::string> sourceIds;
+    sourceIds.reserve(list.Length());
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        Napi::Value item = list[i];
+        if (item.IsString()) {
+            sourceIds.push_back(item.As<Napi::String>().Utf8Value());
+        }
+    }
+
+    size_t dropped = DefaultThumbnailCache().Retain(sourceIds);
+    return Napi::Number::New(env, static_cast<double>(dropped));
+}
+#endif
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), captureMetrics);
+}
+
+// Modül başlatma
+Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    exports.Set(Napi::String::New(env, "ScreenCapture"), ScreenCapture::Define(env));
+    metrics::Export(env, exports, captureMetrics, "listMonitors", ListMonitors);
+    metrics::Export(env, exports, captureMetrics, "getCaptureBackend", GetCaptureBackend);
+#ifdef CAPTURE_THUMBNAILS
+    metrics::Export(env, exports, captureMetrics, "updateThumbnail", UpdateThumbnail);
+    metrics::Export(env, exports, captureMetrics, "getThumbnail", GetThumbnail);
+    metrics::Export(env, exports, captureMetrics, "retainThumbnails", RetainThumbnails);
+#endif
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+    return exports;
+}
+
+NODE_API_MODULE(capture, Init)
@@ -0,0 +1,27 @@
+const path = require('path');
+const addonPath = path.join(__dirname, 'build', 'Release', 'capture.node');
+
+let captureAddon = null;
+
+try {
+  captureAddon = require(addonPath);
+} catch (error) {
+  console.error('❌ Capture addon yüklenemedi:', error.message);
+  console.error('💡 Çözüm: cd desktop/server/capture-addon && npm install');
+  
+  // Fallback: Dummy implementation
+  captureAddon = {
+    ScreenCapture: class {
+      constructor() {
+        throw new Error('Capture addon yüklenemedi');
+      }
+    },
+    listMonitors: () => ({ monitors: [], success: false, error: error.message }),
+    getCaptureBackend: () => ({ backend: 'none' }),
+    updateThumbnail: () => ({ success: false, error: error.message }),
+    getThumbnail: () => null,
+    retainThumbnails: () => 0
+  };
+}
+
+module.exports = captureAddon;
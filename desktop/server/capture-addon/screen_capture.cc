@@ -0,0 +1,61 @@
+#include "screen_capture.h"
+
+#include <algorithm>
+
+void ScreenCapturer::ClipRects(std::vector<DirtyRect>& rects, int width, int height) {
+    size_t kept = 0;
+    for (const DirtyRect& rect : rects) {
+        int32_t left = std::max<int32_t>(rect.x, 0);
+        int32_t top = std::max<int32_t>(rect.y, 0);
+        int32_t right = std::min<int32_t>(rect.x + rect.width, width);
+        int32_t bottom = std::min<int32_t>(rect.y + rect.height, height);
+        if (right <= left || bottom <= top) {
+            continue;
+        }
+        rects[kept++] = DirtyRect{ left, top, right - left, bottom - top };
+    }
+    rects.resize(kept);
+}
+
+#ifndef __linux__
+
+// Linux dışı platformlarda native yakalama yok (Windows: desktopCapturer kullanılır)
+
+struct ScreenCapturer::Impl {};
+
+ScreenCapturer::ScreenCapturer() : impl_(new Impl()) {}
+
+ScreenCapturer::~ScreenCapturer() = default;
+
+bool ScreenCapturer::Open(const CaptureTarget&, std::string& error) {
+    error = "Native ekran yakalama bu platformda desteklenmiyor";
+    return false;
+}
+
+void ScreenCapturer::Close() {}
+
+bool ScreenCapturer::IsOpen() {
+    return false;
+}
+
+bool ScreenCapturer::Grab(CapturedFrame&, std::string& error) {
+    error = "Native ekran yakalama bu platformda desteklenmiyor";
+    return false;
+}
+
+bool ScreenCapturer::Size(int&, int&) {
+    return false;
+}
+
+void ScreenCapturer::Invalidate() {}
+
+const char* ScreenCapturer::Backend() {
+    return "none";
+}
+
+bool ScreenCapturer::ListMonitors(std::vector<MonitorInfo>&, std::string& error) {
+    error = "Native ekran yakalama bu platformda desteklenmiyor";
+    return false;
+}
+
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Native ekran yakalama (Linux: X11)
+// Kare, X sunucusuyla paylaşılan bellek segmentine (MIT-SHM) doğrudan yazılır;
+// istemci tarafında kopya yoktur. XDamage ile sadece son kareden beri değişen
+// dikdörtgenler raporlanır: ekranda değişiklik yoksa Grab() sunucuya hiç istek
+// göndermez, boşta bekleyen masaüstü neredeyse hiç CPU harcamaz.
+//
+// Bir ScreenCapturer tek bir hedefi (monitör, pencere veya uygulama penceresi)
+// yakalar ve kendi X bağlantısını açar. Metodlar thread-safe'dir.
+
+struct MonitorInfo {
+    int index = 0;
+    std::string name;
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    bool primary = false;
+};
+
+struct CaptureTarget {
+    int monitor = -1;           // Monitör index'i (-1 = tüm ekran)
+    unsigned long window = 0;   // X pencere kimliği (0 = yok)
+    std::string app;            // targetApp: WM_CLASS veya process adı
+};
+
+struct DirtyRect {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+};
+
+struct CapturedFrame {
+    bool changed = false;   // Son Grab'dan beri değişiklik var mı
+    bool full = false;      // Tüm kare geçersiz (ilk kare, boyut değişimi)
+    int width = 0;
+    int height = 0;
+    int stride = 0;         // Satır başına byte
+    const uint8_t* pixels = nullptr;   // BGRA, bir sonraki Grab'a kadar geçerli
+    std::shared_ptr<const void> owner; // pixels'ın bulunduğu segmenti canlı tutar
+    std::vector<DirtyRect> rects;      // Kareye göre koordinatlar, kırpılmış
+};
+
+class ScreenCapturer {
+public:
+    ScreenCapturer();
+    ~ScreenCapturer();
+
+    ScreenCapturer(const ScreenCapturer&) = delete;
+    ScreenCapturer& operator=(const ScreenCapturer&) = delete;
+
+    // Hedefi aç (X bağlantısı, paylaşılan bellek, damage nesnesi)
+    bool Open(const CaptureTarget& target, std::string& error);
+    void Close();
+    bool IsOpen();
+
+    // Değişiklik yoksa frame.changed=false döner ve pixel okunmaz
+    bool Grab(CapturedFrame& frame, std::string& error);
+
+    // Yakalanan alanın boyutu
+    bool Size(int& width, int& height);
+
+    // Bir sonraki Grab tam kare döndürsün (ör. çağıranın tamponu yeniden ayrıldı)
+    void Invalidate();
+
+    // "x11-shm", "x11" (MIT-SHM yok) veya "none"
+    static const char* Backend();
+    static bool ListMonitors(std::vector<MonitorInfo>& monitors, std::string& error);
+
+    // Dikdörtgenleri alana kırp, boş olanları at
+    static void ClipRects(std::vector<DirtyRect>& rects, int width, int height);
+
+private:
+    struct Impl;
+
+    std::mutex mutex_;
+    std::unique_ptr<Impl> impl_;
+};
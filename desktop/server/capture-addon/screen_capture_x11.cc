@@ -0,0 +1,695 @@
+#include "screen_capture.h"
+
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <X11/extensions/Xdamage.h>
+#include <X11/extensions/Xfixes.h>
+#include <X11/extensions/Xrandr.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+// Linux: X11 (MIT-SHM + XDamage + RandR)
+// Hedef çizilebilir alan (root penceresi veya uygulama penceresi) için bir damage
+// nesnesi oluşturulur (XDamageReportNonEmpty). Sunucu, damage boşken ilk
+// değişiklikte tek bir DamageNotify gönderir; Grab() bu eventi görmediyse hiçbir
+// istek göndermeden "değişmedi" döner. Event geldiyse önce damage bölgesi
+// alınıp sıfırlanır (XDamageSubtract), sonra kare XShmGetImage ile paylaşılan
+// belleğe okunur. Bu sırada oluşan değişiklikler yeni bir event üretir, kaçmaz.
+//
+// Test: `Xvfb :99 -screen 0 1920x1080x24 &` ve `DISPLAY=:99`; Xvfb MIT-SHM,
+// DAMAGE ve RandR uzantılarını destekler (`xdpyinfo -queryExtensions`).
+
+namespace {
+
+// Xlib'in varsayılan hata handler'ı process'i sonlandırır (ör. pencere kapanınca
+// BadWindow). Yakalayıcı çağrıları süresince hatalar kaydedilir, sonra önceki
+// handler geri yüklenir; iç içe kullanılabilir. Sadece JS thread'inden çağrılır.
+// (Chromium kendi X bağlantısını kullandığı için Electron etkilenmez.)
+int trappedError = 0;
+int trapDepth = 0;
+int (*previousHandler)(Display*, XErrorEvent*) = nullptr;
+
+int TrapHandler(Display*, XErrorEvent* event) {
+    trappedError = event->error_code;
+    return 0;
+}
+
+class ErrorTrap {
+public:
+    explicit ErrorTrap(Display* display) : display_(display) {
+        if (trapDepth++ == 0) {
+            trappedError = 0;
+            previousHandler = XSetErrorHandler(TrapHandler);
+        }
+    }
+
+    ~ErrorTrap() {
+        if (--trapDepth == 0) {
+            XSetErrorHandler(previousHandler);
+        }
+    }
+
+    // Bekleyen istekleri sunucuya gönderip hata oluştu mu bak (ve sıfırla)
+    int Check() {
+        XSync(display_, False);
+        int error = trappedError;
+        trappedError = 0;
+        return error;
+    }
+
+private:
+    Display* display_;
+};
+
+struct Connection {
+    Display* display = nullptr;
+
+    ~Connection() {
+        if (display) {
+            XCloseDisplay(display);
+        }
+    }
+};
+
+// Yakalanan karenin belleği. JS'e verilen ArrayBuffer'lar bu nesneyi paylaşır;
+// yakalayıcı kapansa bile son referans bırakılana kadar segment ayrılmaz.
+struct SharedImage {
+    std::shared_ptr<Connection> connection;
+    XImage* image = nullptr;
+    XShmSegmentInfo shm{};
+    bool attached = false;
+
+    ~SharedImage() {
+        if (attached) {
+            XShmDetach(connection->display, &shm);
+            XFlush(connection->display);
+        }
+        if (image) {
+            if (shm.shmaddr) {
+                image->data = nullptr; // Segment XDestroyImage ile free edilmemeli
+            }
+            XDestroyImage(image);
+        }
+        if (shm.shmaddr) {
+            shmdt(shm.shmaddr);
+        }
+    }
+};
+
+// targetApp karşılaştırması: yol, ".exe" uzantısı ve büyük/küçük harf yok sayılır
+std::string NormalizeApp(std::string name) {
+    size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos) {
+        name = name.substr(slash + 1);
+    }
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".exe") == 0) {
+        name.resize(name.size() - 4);
+    }
+    return name;
+}
+
+bool ReadWindowList(Display* display, Window root, const char* atomName, std::vector<Window>& windows) {
+    Atom atom = XInternAtom(display, atomName, True);
+    if (atom == None) {
+        return false;
+    }
+
+    Atom type;
+    int format;
+    unsigned long count, remaining;
+    unsigned char* data = nullptr;
+    if (XGetWindowProperty(display, root, atom, 0, 65536, False, XA_WINDOW,
+                           &type, &format, &count, &remaining, &data) != Success || !data) {
+        return false;
+    }
+
+    Window* list = reinterpret_cast<Window*>(data);
+    windows.assign(list, list + count);
+    XFree(data);
+    return !windows.empty();
+}
+
+unsigned long WindowPid(Display* display, Window window) {
+    Atom atom = XInternAtom(display, "_NET_WM_PID", True);
+    if (atom == None) {
+        return 0;
+    }
+
+    Atom type;
+    int format;
+    unsigned long count, remaining;
+    unsigned char* data = nullptr;
+    unsigned long pid = 0;
+    if (XGetWindowProperty(display, window, atom, 0, 1, False, XA_CARDINAL,
+                           &type, &format, &count, &remaining, &data) == Success && data) {
+        if (count == 1) {
+            pid = *reinterpret_cast<unsigned long*>(data);
+        }
+        XFree(data);
+    }
+    return pid;
+}
+
+bool WindowMatchesApp(Display* display, Window window, const std::string& app) {
+    XClassHint hint{};
+    if (XGetClassHint(display, window, &hint)) {
+        bool match = (hint.res_name && NormalizeApp(hint.res_name) == app) ||
+                     (hint.res_class && NormalizeApp(hint.res_class) == app);
+        if (hint.res_name) XFree(hint.res_name);
+        if (hint.res_class) XFree(hint.res_class);
+        if (match) {
+            return true;
+        }
+    }
+
+    unsigned long pid = WindowPid(display, window);
+    if (pid == 0) {
+        return false;
+    }
+
+    std::string comm;
+    std::ifstream file("/proc/" + std::to_string(pid) + "/comm");
+    if (std::getline(file, comm) && NormalizeApp(comm) == app) {
+        return true;
+    }
+
+    char exe[4096];
+    ssize_t length = readlink(("/proc/" + std::to_string(pid) + "/exe").c_str(), exe, sizeof(exe) - 1);
+    return length > 0 && NormalizeApp(std::string(exe, static_cast<size_t>(length))) == app;
+}
+
+// En üstteki eşleşen görünür uygulama penceresi
+Window FindAppWindow(Display* display, Window root, const std::string& app) {
+    std::vector<Window> windows;
+    if (!ReadWindowList(display, root, "_NET_CLIENT_LIST_STACKING", windows) &&
+        !ReadWindowList(display, root, "_NET_CLIENT_LIST", windows)) {
+        return None;
+    }
+
+    std::string key = NormalizeApp(app);
+    for (auto it = windows.rbegin(); it != windows.rend(); ++it) {
+        XWindowAttributes attributes;
+        if (!XGetWindowAttributes(display, *it, &attributes) || attributes.map_state != IsViewable) {
+            continue;
+        }
+        if (WindowMatchesApp(display, *it, key)) {
+            return *it;
+        }
+    }
+    return None;
+}
+
+bool QueryMonitors(Display* display, std::vector<MonitorInfo>& monitors) {
+    Window root = DefaultRootWindow(display);
+    monitors.clear();
+
+    // RandR 1.5 monitörleri (yoksa tüm ekran tek monitör sayılır)
+    int eventBase, errorBase, major = 0, minor = 0;
+    if (XRRQueryExtension(display, &eventBase, &errorBase) &&
+        XRRQueryVersion(display, &major, &minor) &&
+        (major > 1 || (major == 1 && minor >= 5))) {
+        int count = 0;
+        XRRMonitorInfo* list = XRRGetMonitors(display, root, True, &count);
+        for (int i = 0; list && i < count; i++) {
+            MonitorInfo info;
+            info.index = i;
+            char* name = list[i].name != None ? XGetAtomName(display, list[i].name) : nullptr;
+            info.name = name ? name : "monitor-" + std::to_string(i);
+            if (name) XFree(name);
+            info.x = list[i].x;
+            info.y = list[i].y;
+            info.width = list[i].width;
+            info.height = list[i].height;
+            info.primary = list[i].primary != 0;
+            monitors.push_back(std::move(info));
+        }
+        if (list) {
+            XRRFreeMonitors(list);
+        }
+    }
+
+    if (monitors.empty()) {
+        MonitorInfo info;
+        info.name = "screen";
+        info.width = DisplayWidth(display, DefaultScreen(display));
+        info.height = DisplayHeight(display, DefaultScreen(display));
+        info.primary = true;
+        monitors.push_back(std::move(info));
+    }
+    return true;
+}
+
+} // namespace
+
+struct ScreenCapturer::Impl {
+    std::shared_ptr<Connection> connection;
+    Display* display = nullptr;
+    CaptureTarget target;
+
+    // Yakalanan çizilebilir alan ve içindeki dikdörtgen (root koordinatları monitör için)
+    Drawable drawable = None;
+    bool isWindow = false;
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    Visual* visual = nullptr;
+    int depth = 0;
+
+    bool useShm = false;
+    std::shared_ptr<SharedImage> image;
+
+    bool hasDamage = false;
+    int damageEventBase = 0;
+    Damage damage = None;
+    XserverRegion region = None;
+
+    bool damaged = false;   // DamageNotify alındı
+    bool full = true;       // Bir sonraki kare tamamen gönderilmeli
+    bool reconfigure = false;
+    bool gone = false;
+
+    bool Connect(std::string& error) {
+        connection = std::make_shared<Connection>();
+        connection->display = XOpenDisplay(nullptr);
+        display = connection->display;
+        if (!display) {
+            error = "X sunucusuna bağlanılamadı (DISPLAY ayarlı mı?)";
+            return false;
+        }
+
+        int major, minor;
+        Bool pixmaps;
+        // Uzak X bağlantılarında (ssh -X) paylaşılan bellek kullanılamaz
+        useShm = XShmQueryExtension(display) && XShmQueryVersion(display, &major, &minor, &pixmaps);
+
+        int damageErrorBase, fixesEventBase, fixesErrorBase;
+        hasDamage = XDamageQueryExtension(display, &damageEventBase, &damageErrorBase) &&
+                    XFixesQueryExtension(display, &fixesEventBase, &fixesErrorBase);
+        if (hasDamage) {
+            int fixesMajor = 2, fixesMinor = 0;
+            XFixesQueryVersion(display, &fixesMajor, &fixesMinor);
+            int damageMajor = 1, damageMinor = 1;
+            XDamageQueryVersion(display, &damageMajor, &damageMinor);
+        }
+        return true;
+    }
+
+    // Hedefin çizilebilir alanını ve sınırlarını belirle
+    bool Resolve(std::string& error) {
+        Window root = DefaultRootWindow(display);
+
+        Window window = target.window;
+        if (!window && !target.app.empty()) {
+            window = FindAppWindow(display, root, target.app);
+            if (!window) {
+                error = "Uygulama penceresi bulunamadı: " + target.app;
+                return false;
+            }
+        }
+
+        if (window) {
+            XWindowAttributes attributes;
+            ErrorTrap trap(display);
+            Status status = XGetWindowAttributes(display, window, &attributes);
+            if (trap.Check() || !status) {
+                error = "Pencere bulunamadı";
+                return false;
+            }
+            if (attributes.map_state != IsViewable) {
+                error = "Pencere görünür değil (simge durumunda olabilir)";
+                return false;
+            }
+
+            drawable = window;
+            isWindow = true;
+            x = 0;
+            y = 0;
+            width = attributes.width;
+            height = attributes.height;
+            visual = attributes.visual;
+            depth = attributes.depth;
+            return true;
+        }
+
+        drawable = root;
+        isWindow = false;
+        visual = DefaultVisual(display, DefaultScreen(display));
+        depth = DefaultDepth(display, DefaultScreen(display));
+
+        std::vector<MonitorInfo> monitors;
+        QueryMonitors(display, monitors);
+        if (target.monitor < 0) {
+            x = 0;
+            y = 0;
+            width = DisplayWidth(display, DefaultScreen(display));
+            height = DisplayHeight(display, DefaultScreen(display));
+        } else if (target.monitor < static_cast<int>(monitors.size())) {
+            const MonitorInfo& monitor = monitors[target.monitor];
+            x = monitor.x;
+            y = monitor.y;
+            width = monitor.width;
+            height = monitor.height;
+        } else {
+            error = "Monitör bulunamadı: " + std::to_string(target.monitor);
+            return false;
+        }
+        return true;
+    }
+
+    bool AllocateImage(std::string& error) {
+        image.reset();
+        if (width <= 0 || height <= 0) {
+            error = "Geçersiz yakalama boyutu";
+            return false;
+        }
+        if (!useShm) {
+            return true; // Her karede XGetImage
+        }
+
+        auto shared = std::make_shared<SharedImage>();
+        shared->connection = connection;
+        shared->image = XShmCreateImage(display, visual, depth, ZPixmap, nullptr, &shared->shm, width, height);
+        if (!shared->image) {
+            error = "XShmCreateImage başarısız";
+            return false;
+        }
+        if (shared->image->bits_per_pixel != 32) {
+            error = "Desteklenmeyen renk derinliği: " + std::to_string(shared->image->bits_per_pixel) + " bpp";
+            return false;
+        }
+
+        shared->shm.shmid = shmget(IPC_PRIVATE, static_cast<size_t>(shared->image->bytes_per_line) * height, IPC_CREAT | 0600);
+        if (shared->shm.shmid < 0) {
+            error = "Paylaşılan bellek ayrılamadı";
+            return false;
+        }
+        shared->shm.shmaddr = static_cast<char*>(shmat(shared->shm.shmid, nullptr, 0));
+        if (shared->shm.shmaddr == reinterpret_cast<char*>(-1)) {
+            shared->shm.shmaddr = nullptr;
+            shmctl(shared->shm.shmid, IPC_RMID, nullptr);
+            error = "Paylaşılan bellek bağlanamadı";
+            return false;
+        }
+        shared->image->data = shared->shm.shmaddr;
+        shared->shm.readOnly = False;
+
+        ErrorTrap trap(display);
+        XShmAttach(display, &shared->shm);
+        int failed = trap.Check();
+        // Segment iki taraf da ayrılınca otomatik silinsin (çökmede sızmasın)
+        shmctl(shared->shm.shmid, IPC_RMID, nullptr);
+        if (failed) {
+            useShm = false; // ör. sunucu farklı bir makinede
+            return true;
+        }
+
+        shared->attached = true;
+        image = std::move(shared);
+        return true;
+    }
+
+    bool CreateDamage() {
+        if (!hasDamage) {
+            return true;
+        }
+
+        ErrorTrap trap(display);
+        damage = XDamageCreate(display, drawable, XDamageReportNonEmpty);
+        region = XFixesCreateRegion(display, nullptr, 0);
+        if (trap.Check()) {
+            DestroyDamage();
+            hasDamage = false; // Her kare tam kare sayılır
+        }
+        return true;
+    }
+
+    void DestroyDamage() {
+        if (damage != None) {
+            XDamageDestroy(display, damage);
+            damage = None;
+        }
+        if (region != None) {
+            XFixesDestroyRegion(display, region);
+            region = None;
+        }
+    }
+
+    // Boyut değişimi, pencerenin kapanması ve içerik değişiklikleri için
+    void Watch() {
+        XSelectInput(display, drawable, StructureNotifyMask);
+        CreateDamage();
+    }
+
+    bool Open(const CaptureTarget& newTarget, std::string& error) {
+        target = newTarget;
+        if (!Connect(error)) {
+            Close();
+            return false;
+        }
+
+        ErrorTrap trap(display);
+        if (!Resolve(error) || !AllocateImage(error)) {
+            Close();
+            return false;
+        }
+        Watch();
+        if (trap.Check()) {
+            error = "Yakalama hedefi izlenemedi";
+            Close();
+            return false;
+        }
+
+        full = true;
+        damaged = false;
+        reconfigure = false;
+        gone = false;
+        return true;
+    }
+
+    void Close() {
+        if (display) {
+            // Pencere kapandıysa damage nesnesi sunucuda zaten silinmiştir (BadDamage)
+            ErrorTrap trap(display);
+            DestroyDamage();
+            trap.Check();
+        }
+        // Segment ve bağlantı, JS'de kalan son kare bırakılınca kapanır
+        image.reset();
+        connection.reset();
+        display = nullptr;
+        drawable = None;
+    }
+
+    // Bekleyen eventleri işle (sunucuya istek göndermez)
+    void DrainEvents() {
+        while (XPending(display) > 0) {
+            XEvent event;
+            XNextEvent(display, &event);
+
+            if (hasDamage && event.type == damageEventBase + XDamageNotify) {
+                damaged = true;
+            } else if (event.type == ConfigureNotify && event.xconfigure.window == drawable) {
+                // Root: ekran çözünürlüğü / monitör düzeni değişti
+                reconfigure = true;
+            } else if (event.type == DestroyNotify && event.xdestroywindow.window == drawable) {
+                gone = true;
+            } else if (event.type == UnmapNotify && event.xunmap.window == drawable) {
+                gone = true;
+            }
+        }
+    }
+
+    bool Reconfigure(std::string& error) {
+        Drawable oldDrawable = drawable;
+        int oldWidth = width;
+        int oldHeight = height;
+        if (!Resolve(error)) {
+            return false;
+        }
+        if ((drawable != oldDrawable || width != oldWidth || height != oldHeight) && !AllocateImage(error)) {
+            return false;
+        }
+        if (drawable != oldDrawable) {
+            DestroyDamage();
+            Watch();
+        }
+        reconfigure = false;
+        full = true;
+        return true;
+    }
+
+    // Damage bölgesini al ve sıfırla; dikdörtgenleri kare koordinatlarına çevir
+    void TakeDamage(std::vector<DirtyRect>& rects) {
+        rects.clear();
+        if (!hasDamage) {
+            return;
+        }
+
+        XDamageSubtract(display, damage, None, region);
+        damaged = false;
+
+        int count = 0;
+        XRectangle* list = XFixesFetchRegion(display, region, &count);
+        if (!list) {
+            return;
+        }
+        rects.reserve(count);
+        for (int i = 0; i < count; i++) {
+            rects.push_back(DirtyRect{ list[i].x - x, list[i].y - y, list[i].width, list[i].height });
+        }
+        XFree(list);
+
+        ScreenCapturer::ClipRects(rects, width, height);
+    }
+
+    bool Fetch(CapturedFrame& frame, std::string& error) {
+        ErrorTrap trap(display);
+
+        if (useShm && image) {
+            XShmGetImage(display, drawable, image->image, x, y, AllPlanes);
+            if (trap.Check()) {
+                error = isWindow ? "Pencere okunamadı (ekran dışına taşıyor olabilir)" : "Ekran okunamadı";
+                return false;
+            }
+        } else {
+            XImage* plain = XGetImage(display, drawable, x, y, width, height, AllPlanes, ZPixmap);
+            if (trap.Check() || !plain) {
+                if (plain) XDestroyImage(plain);
+                error = isWindow ? "Pencere okunamadı (ekran dışına taşıyor olabilir)" : "Ekran okunamadı";
+                return false;
+            }
+            if (plain->bits_per_pixel != 32) {
+                XDestroyImage(plain);
+                error = "Desteklenmeyen renk derinliği";
+                return false;
+            }
+            auto shared = std::make_shared<SharedImage>();
+            shared->connection = connection;
+            shared->image = plain;
+            image = std::move(shared);
+        }
+
+        frame.pixels = reinterpret_cast<const uint8_t*>(image->image->data);
+        frame.stride = image->image->bytes_per_line;
+        frame.owner = image;
+        return true;
+    }
+};
+
+ScreenCapturer::ScreenCapturer() : impl_(new Impl()) {}
+
+ScreenCapturer::~ScreenCapturer() {
+    impl_->Close();
+}
+
+bool ScreenCapturer::Open(const CaptureTarget& target, std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->Close();
+    return impl_->Open(target, error);
+}
+
+void ScreenCapturer::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->Close();
+}
+
+bool ScreenCapturer::IsOpen() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return impl_->display != nullptr;
+}
+
+bool ScreenCapturer::Grab(CapturedFrame& frame, std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Impl& impl = *impl_;
+
+    frame = CapturedFrame();
+    if (!impl.display) {
+        error = "Yakalama açık değil";
+        return false;
+    }
+
+    ErrorTrap trap(impl.display);
+    impl.DrainEvents();
+    if (impl.gone) {
+        impl.Close();
+        error = "Pencere kapandı veya gizlendi";
+        return false;
+    }
+    if (impl.reconfigure && !impl.Reconfigure(error)) {
+        return false;
+    }
+
+    frame.width = impl.width;
+    frame.height = impl.height;
+
+    // Boşta: damage eventi yoksa sunucuya hiç gidilmez
+    if (impl.hasDamage && !impl.full && !impl.damaged) {
+        return true;
+    }
+
+    impl.TakeDamage(frame.rects);
+    if (impl.hasDamage && !impl.full && frame.rects.empty()) {
+        return true; // Değişiklik başka bir monitörde
+    }
+
+    if (!impl.Fetch(frame, error)) {
+        return false;
+    }
+
+    frame.changed = true;
+    frame.full = impl.full || !impl.hasDamage;
+    if (frame.full) {
+        frame.rects.assign(1, DirtyRect{ 0, 0, impl.width, impl.height });
+    }
+    impl.full = false;
+    return true;
+}
+
+bool ScreenCapturer::Size(int& width, int& height) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!impl_->display) {
+        return false;
+    }
+    width = impl_->width;
+    height = impl_->height;
+    return true;
+}
+
+void ScreenCapturer::Invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->full = true;
+}
+
+const char* ScreenCapturer::Backend() {
+    static const char* backend = []() {
+        Display* display = XOpenDisplay(nullptr);
+        if (!display) {
+            return "none";
+        }
+        const char* name = XShmQueryExtension(display) ? "x11-shm" : "x11";
+        XCloseDisplay(display);
+        return name;
+    }();
+    return backend;
+}
+
+bool ScreenCapturer::ListMonitors(std::vector<MonitorInfo>& monitors, std::string& error) {
+    Display* display = XOpenDisplay(nullptr);
+    if (!display) {
+        error = "X sunucusuna bağlanılamadı (DISPLAY ayarlı mı?)";
+        return false;
+    }
+    QueryMonitors(display, monitors);
+    XCloseDisplay(display);
+    return true;
+}
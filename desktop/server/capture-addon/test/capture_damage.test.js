@@ -0,0 +1,206 @@
+// Linux XDamage + MIT-SHM yakalama testi (Xvfb üzerinde)
+// Kök pencereye x11_paint ile dikdörtgen çizilir; grab / grabInto sadece boyanan
+// bölgeyi değişmiş dikdörtgen olarak döndürmeli ve pikseller doğru gelmeli.
+// Xvfb veya build/Release/x11_paint yoksa testler atlanır.
+
+const { test, before, after } = require('node:test');
+const assert = require('node:assert');
+const { spawn } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const readline = require('readline');
+const { startXvfb, waitFor } = require('../../keyboard-addon/test/xvfb');
+
+const PAINT = path.join(__dirname, '..', 'build', 'Release', 'x11_paint');
+
+let xvfb = null;
+let painter = null;
+let addon = null;
+
+// Boyayıcıyı başlat -> { fill(x, y, w, h, rgb) -> Promise, stop() } | null
+async function startPainter(display) {
+  if (!fs.existsSync(PAINT)) {
+    return null;
+  }
+
+  const child = spawn(PAINT, [], {
+    env: { ...process.env, DISPLAY: display },
+    stdio: ['pipe', 'pipe', 'inherit']
+  });
+  const lines = readline.createInterface({ input: child.stdout });
+  const waiting = [];
+  lines.on('line', (line) => {
+    const next = waiting.shift();
+    if (next) {
+      next(line);
+    }
+  });
+  child.on('exit', () => waiting.splice(0).forEach(resolve => resolve('exit')));
+
+  const nextLine = () => new Promise(resolve => waiting.push(resolve));
+  if (await nextLine() !== 'ready') {
+    child.kill();
+    return null;
+  }
+
+  return {
+    async fill(x, y, width, height, rgb) {
+      const reply = nextLine();
+      child.stdin.write(`fill ${x} ${y} ${width} ${height} ${rgb}\n`);
+      if (await reply !== 'ok') {
+        throw new Error('x11_paint: fill');
+      }
+    },
+    stop() {
+      child.stdin.end();
+      child.kill();
+    }
+  };
+}
+
+// Değişen dikdörtgenlerden biri verilen bölgeyi tamamen kapsıyor mu
+function covers(rects, x, y, width, height) {
+  for (let i = 0; i < rects.length; i += 4) {
+    if (rects[i] <= x && rects[i + 1] <= y &&
+        rects[i] + rects[i + 2] >= x + width && rects[i + 1] + rects[i + 3] >= y + height) {
+      return true;
+    }
+  }
+  return false;
+}
+
+function rectArea(rects) {
+  let area = 0;
+  for (let i = 0; i < rects.length; i += 4) {
+    area += rects[i + 2] * rects[i + 3];
+  }
+  return area;
+}
+
+// BGRA piksel -> [r, g, b]
+function pixel(data, stride, x, y) {
+  const offset = y * stride + x * 4;
+  return [data[offset + 2], data[offset + 1], data[offset]];
+}
+
+// Damage olayı sunucudan gelene kadar grab'ı tekrarla
+async function grabChanged(grab) {
+  let frame = null;
+  await waitFor(() => {
+    frame = grab();
+    return !frame.success || frame.changed;
+  }, 2000);
+  return frame;
+}
+
+before(async () => {
+  xvfb = await startXvfb();
+  if (!xvfb) {
+    return;
+  }
+  painter = await startPainter(xvfb.display);
+  // Addon bağlantıyı ScreenCapture açılırken kurar; DISPLAY önceden ayarlanmalı
+  process.env.DISPLAY = xvfb.display;
+  addon = require('..');
+});
+
+after(() => {
+  if (painter) {
+    painter.stop();
+  }
+  if (xvfb) {
+    xvfb.stop();
+  }
+});
+
+function skipReason() {
+  if (!xvfb) {
+    return 'Xvfb yok';
+  }
+  if (!painter) {
+    return 'x11_paint derlenmemiş (node-gyp rebuild)';
+  }
+  if (addon.getCaptureBackend().backend === 'none') {
+    return 'capture addon derlenmemiş';
+  }
+  return null;
+}
+
+test('grab sadece boyanan bölgeyi döndürür', async (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  const capture = new addon.ScreenCapture({ monitor: -1 });
+  try {
+    let frame = capture.grab();
+    assert.ok(frame.success, frame.error);
+    assert.deepStrictEqual([frame.width, frame.height], [640, 480]);
+    assert.ok(frame.changed && frame.full, 'ilk kare tam kare');
+
+    frame = capture.grab();
+    assert.ok(frame.success && !frame.changed, 'değişiklik yokken changed=false');
+    assert.strictEqual(frame.data, undefined);
+
+    await painter.fill(100, 50, 40, 30, 'ff0000');
+    frame = await grabChanged(() => capture.grab());
+    assert.ok(frame.success && frame.changed, 'boyama damage üretti');
+    assert.ok(!frame.full, 'tam kare değil, sadece değişen bölge');
+    assert.ok(covers(frame.rects, 100, 50, 40, 30), `dikdörtgenler: ${Array.from(frame.rects)}`);
+    assert.ok(rectArea(frame.rects) < 640 * 480 / 10, 'değişen alan boyanan bölgeyle sınırlı');
+
+    const data = new Uint8Array(frame.data);
+    assert.deepStrictEqual(pixel(data, frame.stride, 110, 60), [255, 0, 0]);
+    assert.deepStrictEqual(pixel(data, frame.stride, 139, 79), [255, 0, 0]);
+    assert.notDeepStrictEqual(pixel(data, frame.stride, 140, 80), [255, 0, 0]);
+
+    frame = capture.grab();
+    assert.ok(frame.success && !frame.changed, 'damage okunduktan sonra temiz');
+  } finally {
+    capture.close();
+  }
+});
+
+test('grabInto değişen bölgeyi JS tamponuna kopyalar', async (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  const capture = new addon.ScreenCapture({ monitor: -1 });
+  try {
+    let frame = capture.grabInto(new Uint8Array(16));
+    assert.ok(!frame.success && frame.requiredBytes === 640 * 480 * 4, 'küçük tamponda requiredBytes');
+
+    const buffer = new Uint8Array(frame.requiredBytes);
+    frame = capture.grabInto(buffer);
+    assert.ok(frame.success && frame.full, 'tampon ayrıldıktan sonra tam kare');
+    assert.strictEqual(frame.stride, 640 * 4);
+    const untouched = pixel(buffer, frame.stride, 300, 300);
+
+    await painter.fill(200, 150, 16, 16, '00ff00');
+    frame = await grabChanged(() => capture.grabInto(buffer));
+    assert.ok(frame.success && frame.changed && !frame.full);
+    assert.ok(covers(frame.rects, 200, 150, 16, 16), `dikdörtgenler: ${Array.from(frame.rects)}`);
+    assert.deepStrictEqual(pixel(buffer, frame.stride, 207, 157), [0, 255, 0]);
+    assert.deepStrictEqual(pixel(buffer, frame.stride, 300, 300), untouched, 'boyanmayan bölge korunur');
+  } finally {
+    capture.close();
+  }
+});
+
+test('listMonitors Xvfb ekranını RandR ile bulur', (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  const result = addon.listMonitors();
+  assert.ok(result.success, result.error);
+  assert.ok(result.monitors.length >= 1);
+  assert.deepStrictEqual([result.monitors[0].width, result.monitors[0].height], [640, 480]);
+});
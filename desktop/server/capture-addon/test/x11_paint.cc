@@ -0,0 +1,58 @@
+// Testler için X11 boyayıcı: kök pencereye dolu dikdörtgen çizer (XDamage üretir)
+// Komutlar stdin'den satır satır okunur; her komut sunucuyla eşitlendikten sonra
+// "ok" yazılır.
+//
+//   fill <x> <y> <genişlik> <yükseklik> <rrggbb>
+//
+// Derleme: node-gyp rebuild (build/Release/x11_paint)
+
+#include <xcb/xcb.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int main() {
+    xcb_connection_t* conn = xcb_connect(nullptr, nullptr);
+    if (xcb_connection_has_error(conn)) {
+        std::fprintf(stderr, "X sunucusuna bağlanılamadı\n");
+        return 1;
+    }
+    xcb_screen_t* screen = xcb_setup_roots_iterator(xcb_get_setup(conn)).data;
+
+    xcb_gcontext_t gc = xcb_generate_id(conn);
+    uint32_t values[] = { screen->black_pixel, 0 };
+    xcb_create_gc(conn, gc, screen->root, XCB_GC_FOREGROUND | XCB_GC_SUBWINDOW_MODE, values);
+
+    std::printf("ready\n");
+    std::fflush(stdout);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream input(line);
+        std::string command;
+        xcb_rectangle_t rect;
+        std::string color;
+        input >> command >> rect.x >> rect.y >> rect.width >> rect.height >> color;
+        if (command != "fill" || input.fail()) {
+            std::printf("error %s\n", line.c_str());
+            std::fflush(stdout);
+            continue;
+        }
+
+        // 24 bit TrueColor (Xvfb varsayılanı): piksel değeri 0xRRGGBB
+        uint32_t pixel = static_cast<uint32_t>(std::strtoul(color.c_str(), nullptr, 16));
+        xcb_change_gc(conn, gc, XCB_GC_FOREGROUND, &pixel);
+        xcb_poly_fill_rectangle(conn, screen->root, gc, 1, &rect);
+        free(xcb_get_input_focus_reply(conn, xcb_get_input_focus(conn), nullptr));
+
+        std::printf("ok\n");
+        std::fflush(stdout);
+    }
+
+    xcb_disconnect(conn);
+    return 0;
+}
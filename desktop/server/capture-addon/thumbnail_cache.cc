@@ -0,0 +1,150 @@
+#include "thumbnail_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+#include "../native-common/content_hash.h"
+#include "../native-common/image_codec.h"
+#include "../native-common/image_resize.h"
+
+namespace {
+
+// Kodlanmış küçük resimler için bellek bütçesi (150 px JPEG ~4-8 KB; yüzlerce pencere sığar)
+const size_t kThumbnailCacheBudget = 4 * 1024 * 1024;
+const int kJpegQuality = 75;
+// desktopCapturer küçük resimleri küçüktür; daha büyüğü hatalı çağrıdır
+const int kMaxSourceSide = 4096;
+
+// Alan ortalaması kanallardan bağımsızdır; BGRA küçültülür, sadece küçük
+// sonuçta B ve R yer değiştirilir.
+void SwapRedBlue(ImageRGBA& image) {
+    uint8_t* pixel = image.pixels.data();
+    uint8_t* end = pixel + image.pixels.size();
+    for (; pixel < end; pixel += 4) {
+        std::swap(pixel[0], pixel[2]);
+    }
+}
+
+} // namespace
+
+ThumbnailCache& DefaultThumbnailCache() {
+    static ThumbnailCache cache(kThumbnailCacheBudget);
+    return cache;
+}
+
+bool ThumbnailCache::Update(const std::string& sourceId, const uint8_t* bgra, int width, int height, int stride,
+                            int size, ThumbnailResult& result, std::string& error) {
+    if (!bgra || width <= 0 || height <= 0 || width > kMaxSourceSide || height > kMaxSourceSide ||
+        stride < width * 4) {
+        error = "Küçük resim bitmap'i geçersiz";
+        return false;
+    }
+
+    // Anahtar: görünen piksellerin özeti (satır sonu dolgusu hariç) + boyutlar
+    size_t rowBytes = static_cast<size_t>(width) * 4;
+    uint64_t hash = ContentHashWords(bgra, rowBytes);
+    for (int y = 1; y < height; y++) {
+        hash = ContentHashWords(bgra + static_cast<size_t>(y) * stride, rowBytes, hash);
+    }
+    const int dimensions[] = { width, height, size };
+    hash = ContentHash(reinterpret_cast<const uint8_t*>(dimensions), sizeof(dimensions), hash);
+    std::string etag = HashToHex(hash);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const Entry* entry = entries_.Find(etag);
+        if (entry) {
+            sources_[sourceId] = etag;
+            result.etag = etag;
+            result.jpeg = entry->jpeg;
+            result.width = entry->width;
+            result.height = entry->height;
+            result.changed = false;
+            return true;
+        }
+    }
+
+    ImageRGBA source;
+    source.width = width;
+    source.height = height;
+    source.pixels.resize(rowBytes * height);
+    for (int y = 0; y < height; y++) {
+        std::memcpy(source.pixels.data() + y * rowBytes, bgra + static_cast<size_t>(y) * stride, rowBytes);
+    }
+
+    int fitWidth = 0;
+    int fitHeight = 0;
+    FitWithin(width, height, size, fitWidth, fitHeight);
+
+    ImageRGBA scaled;
+    ImageRGBA* output = &source;
+    if (fitWidth != width || fitHeight != height) {
+        if (!ResizeArea(source, fitWidth, fitHeight, scaled)) {
+            error = "Küçük resim küçültülemedi";
+            return false;
+        }
+        output = &scaled;
+    }
+    SwapRedBlue(*output);
+
+    auto jpeg = std::make_shared<std::vector<uint8_t>>();
+    if (!EncodeJpeg(*output, kJpegQuality, *jpeg, error)) {
+        return false;
+    }
+
+    result.etag = etag;
+    result.jpeg = jpeg;
+    result.width = output->width;
+    result.height = output->height;
+    result.changed = true;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.Put(etag, { jpeg, output->width, output->height }, jpeg->size());
+    sources_[sourceId] = etag;
+    return true;
+}
+
+bool ThumbnailCache::Find(const std::string& etag, ThumbnailResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const Entry* entry = entries_.Find(etag);
+    if (!entry) {
+        return false;
+    }
+
+    result.etag = etag;
+    result.jpeg = entry->jpeg;
+    result.width = entry->width;
+    result.height = entry->height;
+    result.changed = false;
+    return true;
+}
+
+size_t ThumbnailCache::Retain(const std::vector<std::string>& sourceIds) {
+    std::unordered_set<std::string> keep(sourceIds.begin(), sourceIds.end());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::string> dropped;
+    for (auto it = sources_.begin(); it != sources_.end();) {
+        if (keep.count(it->first)) {
+            ++it;
+        } else {
+            dropped.push_back(it->second);
+            it = sources_.erase(it);
+        }
+    }
+
+    // Aynı içeriği gösteren başka bir kaynak (ör. ayna ekran) hâlâ kullanıyorsa tut
+    std::unordered_set<std::string> inUse;
+    for (const auto& source : sources_) {
+        inUse.insert(source.second);
+    }
+    for (const std::string& etag : dropped) {
+        if (!inUse.count(etag)) {
+            entries_.Erase(etag);
+        }
+    }
+    return dropped.size();
+}
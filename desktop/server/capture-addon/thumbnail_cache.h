@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../native-common/lru_cache.h"
+
+// Ekran / pencere kaynağı küçük resimleri (kaynak seçici için)
+// Girdi, desktopCapturer küçük resminin ham BGRA bitmap'idir. Her çağrıda sadece
+// görünen piksellerin içerik özeti alınır; özet önbellekte varsa çözme/kodlama
+// yapılmaz ve aynı ETag döner. Yoksa SIMD alan ortalamasıyla kutucuğa küçültülür
+// ve bir kez JPEG kodlanır. Kodlanmış baytlar özet (+ boyut) = ETag anahtarlı,
+// bayt bütçeli bir LRU'da tutulur. Kaynak başına son ETag de saklanır; kapanan
+// pencerelerin girdileri Retain() ile bırakılır.
+
+struct ThumbnailResult {
+    std::string etag;   // 16 haneli hex içerik özeti
+    std::shared_ptr<const std::vector<uint8_t>> jpeg;
+    int width = 0;
+    int height = 0;
+    bool changed = false; // Bu çağrıda yeniden kodlandı
+};
+
+class ThumbnailCache {
+public:
+    explicit ThumbnailCache(size_t budget) : entries_(budget) {}
+
+    // bgra: width x height piksel, satırlar arası stride bayt; size: kutucuk kenarı
+    bool Update(const std::string& sourceId, const uint8_t* bgra, int width, int height, int stride,
+                int size, ThumbnailResult& result, std::string& error);
+
+    // Daha önce üretilmiş bir küçük resmi ETag ile bul
+    bool Find(const std::string& etag, ThumbnailResult& result);
+
+    // Listede olmayan kaynakları unut; başka kaynağın kullanmadığı küçük
+    // resimleri önbellekten at. Unutulan kaynak sayısını döner.
+    size_t Retain(const std::vector<std::string>& sourceIds);
+
+private:
+    struct Entry {
+        std::shared_ptr<const std::vector<uint8_t>> jpeg;
+        int width = 0;
+        int height = 0;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::string> sources_; // kaynak id -> son ETag
+    LruCache<std::string, Entry> entries_;
+};
+
+// Process genelindeki küçük resim önbelleği
+ThumbnailCache& DefaultThumbnailCache();
@@ -0,0 +1,216 @@
+// Discovery yanıtlayıcısı benchmark'ı
+// Yanıtlayıcı loopback'te rastgele bir portta başlatılır; istemciler 127.0.0.0/8
+// içinde farklı adreslere bağlanır, böylece her biri hız sınırı için ayrı bir
+// kaynak sayılır (Linux'ta tüm 127/8 loopback'tir).
+//   gidiş-dönüş - tek istek, yanıt gelene kadar bekler (telefonun tek sorgusu)
+//   patlama     - çok sayıda telefon aynı anda birkaç sorgu gönderir (uygulama
+//                 açılışı); yanıt hızı ve bir uyanışta okunan paket sayısı
+//   taşkın      - tek kaynak sürekli sorgu gönderir; yanıtlar kBurst + saniyede
+//                 kRefillPerSecond ile sınırlı kalmalı
+//
+// Derleme: node-gyp rebuild (build/Release/discovery_bench)
+// Çalıştırma: ./build/Release/discovery_bench [patlama istemcisi] [taşkın süresi ms]
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../discovery_responder.h"
+
+namespace {
+
+const char kRequest[] = "LOCALDESK_DISCOVER_REQUEST";
+const char kResponse[] =
+    "{\"type\":\"LOCALDESK_DISCOVER_RESPONSE\",\"deviceId\":\"bench-device\","
+    "\"deviceName\":\"Bench\",\"deviceType\":\"desktop\",\"port\":3000}";
+
+constexpr int kRttClients = 256;
+constexpr int kRttRounds = 4; // kBurst'ün altında; gidiş-dönüşte sınıra takılmaz
+constexpr int kBurstRequests = 8;
+
+void Report(const char* label, std::vector<int64_t>& samples) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-22s %6zu örnek  p50 %8.1f us  p99 %8.1f us  max %8.1f us\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.maxUs);
+}
+
+// 127.a.b.c adresine bağlı istemci soketi (-1: başarısız)
+int Client(uint32_t address, int timeoutMs) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    sockaddr_in local;
+    std::memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(address);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+bool Send(int fd, uint16_t port, const char* message) {
+    sockaddr_in target;
+    std::memset(&target, 0, sizeof(target));
+    target.sin_family = AF_INET;
+    target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    target.sin_port = htons(port);
+    return sendto(fd, message, std::strlen(message), 0, reinterpret_cast<sockaddr*>(&target), sizeof(target)) >= 0;
+}
+
+// Yanıtı bekle; geçerli bir discovery yanıtıysa true
+bool Receive(int fd) {
+    char buffer[DiscoveryResponder::kPacketSize];
+    ssize_t size = recv(fd, buffer, sizeof(buffer) - 1, 0);
+    if (size <= 0) {
+        return false;
+    }
+    buffer[size] = '\0';
+    return std::strncmp(buffer, kResponse, sizeof(kResponse) - 2) == 0 &&
+           std::strstr(buffer, ",\"timestamp\":") != nullptr && buffer[size - 1] == '}';
+}
+
+uint32_t LoopbackAddress(uint32_t network, uint32_t index) {
+    return (127u << 24) | (network << 16) | ((index >> 8) << 8) | ((index & 0xFF) + 1);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int burstClients = argc > 1 ? std::atoi(argv[1]) : 64;
+    int floodMs = argc > 2 ? std::atoi(argv[2]) : 2000;
+    if (burstClients < 1 || burstClients > 4096 || floodMs < 100) {
+        std::printf("Geçersiz parametre\n");
+        return 1;
+    }
+
+    DiscoveryResponder responder;
+    metrics::Registry registry("discovery");
+    metrics::Api& batchMetrics = registry.Add("batch");
+    std::string error;
+    if (!responder.SetResponse(kResponse, error) || !responder.Start(0, &batchMetrics, error)) {
+        std::printf("Yanıtlayıcı başlatılamadı: %s\n", error.c_str());
+        return 1;
+    }
+    uint16_t port = responder.Stats().port;
+    std::printf("Discovery benchmark'ı (port %u, batch %zu)\n", port, DiscoveryResponder::kBatch);
+
+    // Gidiş-dönüş
+    std::vector<int64_t> rtt;
+    int lost = 0;
+    for (int i = 0; i < kRttClients; i++) {
+        int fd = Client(LoopbackAddress(1, static_cast<uint32_t>(i)), 500);
+        if (fd < 0) {
+            std::printf("  istemci soketi açılamadı\n");
+            return 1;
+        }
+        for (int round = 0; round < kRttRounds; round++) {
+            int64_t start = testbackend::NowNs();
+            if (Send(fd, port, kRequest) && Receive(fd)) {
+                rtt.push_back(testbackend::NowNs() - start);
+            } else {
+                lost++;
+            }
+        }
+        close(fd);
+    }
+    Report("gidiş-dönüş", rtt);
+    if (lost > 0) {
+        std::printf("  %-22s %d yanıt gelmedi\n", "", lost);
+    }
+
+    // Discovery isteği olmayan paketler yanıtlanmaz
+    {
+        int fd = Client(LoopbackAddress(3, 0), 100);
+        Send(fd, port, "HELLO");
+        bool answered = Receive(fd);
+        close(fd);
+        std::printf("  %-22s %s\n", "geçersiz paket", answered ? "YANITLANDI (hata)" : "yanıtlanmadı");
+    }
+
+    // Patlama: tüm istemciler önce gönderir, sonra yanıtları toplar
+    DiscoveryStats before = responder.Stats();
+    std::vector<int> clients;
+    for (int i = 0; i < burstClients; i++) {
+        int fd = Client(LoopbackAddress(2, static_cast<uint32_t>(i)), 500);
+        if (fd < 0) {
+            std::printf("  istemci soketi açılamadı\n");
+            return 1;
+        }
+        clients.push_back(fd);
+    }
+    int64_t burstStart = testbackend::NowNs();
+    for (int round = 0; round < kBurstRequests; round++) {
+        for (int fd : clients) {
+            Send(fd, port, kRequest);
+        }
+    }
+    int received = 0;
+    int64_t lastReply = burstStart;
+    for (int fd : clients) {
+        for (int round = 0; round < kBurstRequests && Receive(fd); round++) {
+            received++;
+            lastReply = testbackend::NowNs();
+        }
+        close(fd);
+    }
+    // Son yanıta kadar (kayıp paketlerin bekleme süresi hariç)
+    double burstMs = (lastReply - burstStart) / 1e6;
+    DiscoveryStats after = responder.Stats();
+    uint64_t batches = after.batches - before.batches;
+    std::printf("  %-22s %d/%d yanıt, %.1f ms (%.0f yanıt/s), %llu uyanış, uyanış başına %.1f paket (en çok %llu)\n",
+                "patlama", received, burstClients * kBurstRequests, burstMs, received / (burstMs / 1000.0),
+                static_cast<unsigned long long>(batches),
+                batches ? static_cast<double>(after.requests - before.requests) / batches : 0.0,
+                static_cast<unsigned long long>(after.maxBatch));
+
+    // Taşkın: tek kaynak, 500 us arayla istek
+    int flood = Client(LoopbackAddress(4, 0), 50);
+    int floodReplies = 0;
+    int sent = 0;
+    int64_t floodStart = testbackend::NowNs();
+    while ((testbackend::NowNs() - floodStart) / 1000000 < floodMs) {
+        Send(flood, port, kRequest);
+        sent++;
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    while (Receive(flood)) {
+        floodReplies++;
+    }
+    close(flood);
+    double floodSeconds = (testbackend::NowNs() - floodStart) / 1e9;
+    std::printf("  %-22s %d istek, %d yanıt (beklenen en çok ~%.0f)\n", "taşkın", sent, floodReplies,
+                RateLimiter::kBurst + RateLimiter::kRefillPerSecond * floodSeconds);
+
+    DiscoveryStats stats = responder.Stats();
+    std::printf("  %-22s %llu istek, %llu yanıt, %llu sınırlı, %llu geçersiz\n", "toplam",
+                static_cast<unsigned long long>(stats.requests), static_cast<unsigned long long>(stats.replies),
+                static_cast<unsigned long long>(stats.limited), static_cast<unsigned long long>(stats.ignored));
+
+    metrics::Summary batch = batchMetrics.Snapshot();
+    std::printf("  %-22s %llu uyanış, p50 %.1f us, p99 %.1f us\n", "batch süresi",
+                static_cast<unsigned long long>(batch.calls), batch.p50Us, batch.p99Us);
+
+    responder.Stop();
+    return 0;
+}
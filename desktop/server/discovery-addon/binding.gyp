@@ -0,0 +1,46 @@
+{
+  "targets": [
+    {
+      "target_name": "discovery",
+      "sources": [ "discovery.cc", "discovery_responder.cc" ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').gyp\")"
+      ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "defines": [ "NAPI_CPP_EXCEPTIONS" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "discovery_responder_win.cc" ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "ExceptionHandling": 1
+            },
+            "VCLinkerTool": {
+              "AdditionalDependencies": [ "ws2_32.lib" ]
+            }
+          }
+        }],
+        ["OS!='win'", {
+          "sources": [ "discovery_responder_posix.cc" ]
+        }]
+      ]
+    }
+  ],
+  "conditions": [
+    ["OS!='win'", {
+      "targets": [
+        {
+          "target_name": "discovery_bench",
+          "type": "executable",
+          "sources": [ "bench/discovery_bench.cc", "discovery_responder.cc", "discovery_responder_posix.cc" ],
+          "cflags!": [ "-fno-exceptions" ],
+          "cflags_cc!": [ "-fno-exceptions" ]
+        }
+      ]
+    }]
+  ]
+}
@@ -0,0 +1,105 @@
+#include <napi.h>
+
+#include <string>
+
+#include "../native-common/metrics_napi.h"
+#include "discovery_responder.h"
+
+// UDP discovery yanıtlayıcısı (bkz. discovery_responder.h)
+// start() soketi açar ve yanıtlayıcı thread'ini başlatır; sonrasında istekler
+// JS'e hiç uğramaz. Ad veya port değişince setResponse() yeni JSON'u verir.
+
+// Çağrı metrikleri (getStats)
+// "batch" yanıtlayıcı thread'inde bir uyanışın okuma -> gönderme süresidir.
+metrics::Registry discoveryMetrics("discovery");
+metrics::Api& batchMetrics = discoveryMetrics.Add("batch");
+
+Napi::Object DiscoveryStatsObject(Napi::Env env, const DiscoveryStats& stats) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("running", Napi::Boolean::New(env, stats.running));
+    result.Set("port", Napi::Number::New(env, stats.port));
+    result.Set("requests", Napi::Number::New(env, static_cast<double>(stats.requests)));
+    result.Set("replies", Napi::Number::New(env, static_cast<double>(stats.replies)));
+    result.Set("limited", Napi::Number::New(env, static_cast<double>(stats.limited)));
+    result.Set("ignored", Napi::Number::New(env, static_cast<double>(stats.ignored)));
+    result.Set("batches", Napi::Number::New(env, static_cast<double>(stats.batches)));
+    result.Set("maxBatch", Napi::Number::New(env, static_cast<double>(stats.maxBatch)));
+    return result;
+}
+
+// N-API: start(port, responseJson) - { success, port, error? }
+Napi::Value Start(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2 || !info[0].IsNumber() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Port ve yanıt JSON'u bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    int port = info[0].As<Napi::Number>().Int32Value();
+    if (port < 0 || port > 65535) {
+        Napi::RangeError::New(env, "Port 0-65535 arasında olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string error;
+    bool success = DefaultResponder().SetResponse(info[1].As<Napi::String>().Utf8Value(), error) &&
+                   DefaultResponder().Start(static_cast<uint16_t>(port), &batchMetrics, error);
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, success));
+    result.Set("port", Napi::Number::New(env, DefaultResponder().Stats().port));
+    if (!success) {
+        result.Set("error", Napi::String::New(env, error));
+    }
+    return result;
+}
+
+// N-API: setResponse(responseJson) - sonraki yanıtlardan itibaren geçerli
+Napi::Value SetResponse(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Yanıt JSON'u bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string error;
+    if (!DefaultResponder().SetResponse(info[0].As<Napi::String>().Utf8Value(), error)) {
+        Napi::TypeError::New(env, error).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return Napi::Boolean::New(env, true);
+}
+
+// N-API: stop() - thread durdurulur ve soket kapanır (senkron)
+Napi::Value Stop(const Napi::CallbackInfo& info) {
+    DefaultResponder().Stop();
+    return info.Env().Undefined();
+}
+
+// N-API: getDiscoveryStats() - { running, port, requests, replies, limited, ignored, batches, maxBatch }
+Napi::Value GetDiscoveryStats(const Napi::CallbackInfo& info) {
+    return DiscoveryStatsObject(info.Env(), DefaultResponder().Stats());
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), discoveryMetrics);
+}
+
+// Modül başlatma
+Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    env.AddCleanupHook([]() {
+        DefaultResponder().Stop();
+    });
+
+    metrics::Export(env, exports, discoveryMetrics, "start", Start);
+    metrics::Export(env, exports, discoveryMetrics, "setResponse", SetResponse);
+    metrics::Export(env, exports, discoveryMetrics, "stop", Stop);
+    metrics::Export(env, exports, discoveryMetrics, "getDiscoveryStats", GetDiscoveryStats);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+    return exports;
+}
+
+NODE_API_MODULE(discovery, Init)
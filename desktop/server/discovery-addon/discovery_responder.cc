@@ -0,0 +1,117 @@
+#include "discovery_responder.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char kRequest[] = "LOCALDESK_DISCOVER_REQUEST";
+constexpr size_t kRequestSize = sizeof(kRequest) - 1;
+
+// Önceden serileştirilmiş yanıtın üst sınırı (yanıt tek UDP paketine sığmalı)
+constexpr size_t kMaxResponseSize = 1200;
+
+int64_t MonotonicNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+DiscoveryResponder& DefaultResponder() {
+    static DiscoveryResponder responder;
+    return responder;
+}
+
+bool DiscoveryResponder::Start(uint16_t port, metrics::Api* batchMetrics, std::string& error) {
+    Stop();
+    batchMetrics_ = batchMetrics;
+
+    if (!Open(port, error)) {
+        Close();
+        return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&DiscoveryResponder::Run, this);
+    return true;
+}
+
+void DiscoveryResponder::Stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    running_ = false;
+    Wake();
+    thread_.join();
+    Close();
+    port_ = 0;
+}
+
+bool DiscoveryResponder::SetResponse(const std::string& json, std::string& error) {
+    if (json.size() < 3 || json.front() != '{' || json.back() != '}') {
+        error = "Yanıt boş olmayan bir JSON nesnesi olmalı";
+        return false;
+    }
+    if (json.size() > kMaxResponseSize) {
+        error = "Yanıt çok büyük";
+        return false;
+    }
+
+    // Sondaki "}" çıkarılır; timestamp her yanıtta eklenir
+    std::string prefix = json.substr(0, json.size() - 1);
+    std::atomic_store(&response_, std::shared_ptr<const std::string>(
+        std::make_shared<const std::string>(std::move(prefix))));
+    return true;
+}
+
+DiscoveryStats DiscoveryResponder::Stats() {
+    DiscoveryStats stats;
+    stats.running = running_.load();
+    stats.port = port_.load();
+    stats.requests = requests_.load(std::memory_order_relaxed);
+    stats.replies = replies_.load(std::memory_order_relaxed);
+    stats.limited = limited_.load(std::memory_order_relaxed);
+    stats.ignored = ignored_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.maxBatch = maxBatch_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool DiscoveryResponder::IsRequest(const uint8_t* data, size_t size) {
+    return size >= kRequestSize && std::memcmp(data, kRequest, kRequestSize) == 0;
+}
+
+bool DiscoveryResponder::Admit(uint32_t address) {
+    return limiter_.Admit(address, MonotonicNs());
+}
+
+std::shared_ptr<const std::string> DiscoveryResponder::Response() {
+    return std::atomic_load(&response_);
+}
+
+size_t DiscoveryResponder::FormatSuffix(char* out) {
+    long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    int length = std::snprintf(out, kSuffixSize, ",\"timestamp\":%lld}", now);
+    return length > 0 ? static_cast<size_t>(length) : 0;
+}
+
+void DiscoveryResponder::CountBatch(metrics::Clock::time_point start, size_t received, size_t requests,
+                                    size_t replies, size_t limited, bool failed) {
+    if (batchMetrics_) {
+        batchMetrics_->Record(metrics::ElapsedNs(start), failed);
+    }
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    requests_.fetch_add(requests, std::memory_order_relaxed);
+    replies_.fetch_add(replies, std::memory_order_relaxed);
+    limited_.fetch_add(limited, std::memory_order_relaxed);
+    ignored_.fetch_add(received - requests, std::memory_order_relaxed);
+
+    // Tek yazar (yanıtlayıcı thread'i)
+    if (received > maxBatch_.load(std::memory_order_relaxed)) {
+        maxBatch_.store(received, std::memory_order_relaxed);
+    }
+}
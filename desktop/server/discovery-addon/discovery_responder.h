@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../native-common/metrics.h"
+#include "rate_limiter.h"
+
+// UDP discovery yanıtlayıcısı (LOCALDESK_DISCOVER_REQUEST, port 45454)
+// Kendi thread'inde çalışır; Node event loop'u senkron bir addon çağrısında
+// bloklu olsa da telefonlar yanıt alır. Yanıt JSON'u önceden serileştirilir ve
+// ad / port değişince atomik olarak değiştirilir (shared_ptr atomic store);
+// her yanıtta sadece "timestamp" alanı eklenir.
+//
+// Linux: recvmmsg ile bir uyanışta kBatch pakete kadar okunur, yanıtlar tek
+// sendmmsg ile gönderilir. Diğer POSIX sistemleri ve Windows: paket başına
+// recvfrom / sendto. Kaynak IP başına hız sınırı (bkz. rate_limiter.h) sayesinde
+// çok sayıda telefonun (veya tek bir telefonun) yoğun sorgusu ucuz kalır.
+// discovery_responder.cc ortak kısım; soket döngüsü discovery_responder_posix.cc /
+// discovery_responder_win.cc.
+
+struct DiscoveryStats {
+    bool running = false;
+    uint16_t port = 0;
+    uint64_t requests = 0; // Geçerli discovery isteği
+    uint64_t replies = 0;
+    uint64_t limited = 0;  // Hız sınırına takılan istek
+    uint64_t ignored = 0;  // Discovery isteği olmayan paket
+    uint64_t batches = 0;  // Uyanış (recvmmsg çağrısı)
+    uint64_t maxBatch = 0; // Bir uyanışta okunan en çok paket
+};
+
+class DiscoveryResponder {
+public:
+    static constexpr size_t kBatch = 32;
+    static constexpr size_t kPacketSize = 512;
+    // Uygulama açılışında gelen sorgu patlaması thread uyanana kadar kuyrukta beklesin
+    static constexpr int kReceiveBuffer = 1024 * 1024;
+
+    DiscoveryResponder();
+    ~DiscoveryResponder();
+
+    DiscoveryResponder(const DiscoveryResponder&) = delete;
+    DiscoveryResponder& operator=(const DiscoveryResponder&) = delete;
+
+    // port 0: boş bir port seçilir (bench); çalışıyorsa önce durdurulur.
+    // batchMetrics: her uyanışın okuma -> gönderme süresi (isteğe bağlı)
+    bool Start(uint16_t port, metrics::Api* batchMetrics, std::string& error);
+    void Stop();
+
+    // json: tek satır JSON nesnesi ("{...}"); yanıtlara ',"timestamp":<ms>}' eklenir.
+    // Yanıt ayarlanmadan gelen isteklere cevap verilmez.
+    bool SetResponse(const std::string& json, std::string& error);
+
+    DiscoveryStats Stats();
+
+private:
+    struct Socket;
+
+    // Soket katmanı (platform TU'su)
+    bool Open(uint16_t port, std::string& error);
+    void Wake();  // Bekleyen Run döngüsünü uyandır (Stop)
+    void Close();
+    void Run();
+
+    // Ortak yardımcılar (yanıtlayıcı thread'i)
+    static bool IsRequest(const uint8_t* data, size_t size);
+    bool Admit(uint32_t address);
+    std::shared_ptr<const std::string> Response();
+    // ',"timestamp":<ms>}' -> out (en az kSuffixSize bayt), uzunluk döner
+    static size_t FormatSuffix(char* out);
+    void CountBatch(metrics::Clock::time_point start, size_t received, size_t requests,
+                    size_t replies, size_t limited, bool failed);
+
+    static constexpr size_t kSuffixSize = 48;
+
+    std::unique_ptr<Socket> socket_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint16_t> port_{0};
+    metrics::Api* batchMetrics_ = nullptr;
+    // "}" hariç önceden serileştirilmiş yanıt (std::atomic_load / atomic_store)
+    std::shared_ptr<const std::string> response_;
+    RateLimiter limiter_;
+
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> replies_{0};
+    std::atomic<uint64_t> limited_{0};
+    std::atomic<uint64_t> ignored_{0};
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> maxBatch_{0};
+};
+
+// Process genelindeki yanıtlayıcı
+DiscoveryResponder& DefaultResponder();
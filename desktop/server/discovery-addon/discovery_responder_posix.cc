@@ -0,0 +1,238 @@
+#include "discovery_responder.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+// POSIX: soket ve uyandırma pipe'ı poll ile beklenir. Linux'ta bir uyanışta
+// recvmmsg ile kBatch pakete kadar okunur ve yanıtlar tek sendmmsg ile gider;
+// diğer sistemlerde aynı döngü paket başına recvfrom / sendmsg ile çalışır.
+// Yanıt iki parçadır (önceden serileştirilmiş gövde + timestamp), kopyalanmaz.
+
+namespace {
+
+std::string ErrnoMessage(const char* what) {
+    return std::string(what) + ": " + std::strerror(errno);
+}
+
+} // namespace
+
+struct DiscoveryResponder::Socket {
+    int fd = -1;
+    int wakeRead = -1;
+    int wakeWrite = -1;
+
+    // Yanıtlayıcı thread'inin tamponları (bir kez ayrılır)
+    uint8_t packets[kBatch][kPacketSize];
+    size_t sizes[kBatch];
+    sockaddr_in sources[kBatch];
+    iovec inVectors[kBatch];
+    iovec outVectors[kBatch][2];
+    char suffixes[kBatch][kSuffixSize];
+#ifdef __linux__
+    mmsghdr inMessages[kBatch];
+    mmsghdr outMessages[kBatch];
+#endif
+};
+
+DiscoveryResponder::DiscoveryResponder() : socket_(new Socket()) {}
+
+DiscoveryResponder::~DiscoveryResponder() {
+    Stop();
+}
+
+bool DiscoveryResponder::Open(uint16_t port, std::string& error) {
+    Socket& s = *socket_;
+
+    int pipeFds[2];
+    if (pipe(pipeFds) != 0) {
+        error = ErrnoMessage("Uyandırma pipe'ı oluşturulamadı");
+        return false;
+    }
+    s.wakeRead = pipeFds[0];
+    s.wakeWrite = pipeFds[1];
+    fcntl(s.wakeRead, F_SETFD, FD_CLOEXEC);
+    fcntl(s.wakeWrite, F_SETFD, FD_CLOEXEC);
+
+    s.fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s.fd < 0) {
+        error = ErrnoMessage("UDP soketi oluşturulamadı");
+        return false;
+    }
+    fcntl(s.fd, F_SETFD, FD_CLOEXEC);
+
+    // JS tarafındaki dgram soketi gibi (reuseAddr) ve broadcast yanıtları için
+    int enable = 1;
+    setsockopt(s.fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    setsockopt(s.fd, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+    int bufferSize = kReceiveBuffer;
+    setsockopt(s.fd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(s.fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        error = ErrnoMessage("UDP portu bağlanamadı");
+        return false;
+    }
+
+    socklen_t length = sizeof(address);
+    if (getsockname(s.fd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        error = ErrnoMessage("UDP portu okunamadı");
+        return false;
+    }
+    port_ = ntohs(address.sin_port);
+    return true;
+}
+
+void DiscoveryResponder::Wake() {
+    if (socket_->wakeWrite >= 0) {
+        char byte = 1;
+        while (write(socket_->wakeWrite, &byte, 1) < 0 && errno == EINTR) {
+        }
+    }
+}
+
+void DiscoveryResponder::Close() {
+    Socket& s = *socket_;
+    for (int* fd : {&s.fd, &s.wakeRead, &s.wakeWrite}) {
+        if (*fd >= 0) {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void DiscoveryResponder::Run() {
+    Socket& s = *socket_;
+
+    for (size_t i = 0; i < kBatch; i++) {
+        s.inVectors[i].iov_base = s.packets[i];
+        s.inVectors[i].iov_len = kPacketSize;
+    }
+
+    while (running_) {
+        pollfd fds[2];
+        fds[0].fd = s.fd;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd = s.wakeRead;
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            running_ = false;
+            break;
+        }
+        if (!running_ || !(fds[0].revents & POLLIN)) {
+            continue;
+        }
+
+        // Kuyruk boşalana kadar oku (dolu bir batch'ten sonra poll'e dönülmez)
+        size_t received = kBatch;
+        while (running_ && received == kBatch) {
+            received = 0;
+#ifdef __linux__
+            for (size_t i = 0; i < kBatch; i++) {
+                msghdr& header = s.inMessages[i].msg_hdr;
+                std::memset(&header, 0, sizeof(header));
+                header.msg_name = &s.sources[i];
+                header.msg_namelen = sizeof(sockaddr_in);
+                header.msg_iov = &s.inVectors[i];
+                header.msg_iovlen = 1;
+            }
+            int count = recvmmsg(s.fd, s.inMessages, kBatch, MSG_DONTWAIT, nullptr);
+            if (count <= 0) {
+                break;
+            }
+            received = static_cast<size_t>(count);
+            for (size_t i = 0; i < received; i++) {
+                s.sizes[i] = s.inMessages[i].msg_len;
+            }
+#else
+            socklen_t length = sizeof(sockaddr_in);
+            ssize_t size = recvfrom(s.fd, s.packets[0], kPacketSize, MSG_DONTWAIT,
+                                    reinterpret_cast<sockaddr*>(&s.sources[0]), &length);
+            if (size < 0) {
+                break;
+            }
+            s.sizes[0] = static_cast<size_t>(size);
+            received = 1;
+#endif
+            metrics::Clock::time_point start = metrics::Clock::now();
+            std::shared_ptr<const std::string> response = Response();
+
+            size_t requests = 0;
+            size_t limited = 0;
+            size_t replies = 0;
+            size_t failed = 0;
+            for (size_t i = 0; i < received; i++) {
+                if (!IsRequest(s.packets[i], s.sizes[i])) {
+                    continue;
+                }
+                requests++;
+                if (!response) {
+                    continue;
+                }
+                if (!Admit(ntohl(s.sources[i].sin_addr.s_addr))) {
+                    limited++;
+                    continue;
+                }
+
+                iovec* vectors = s.outVectors[replies];
+                vectors[0].iov_base = const_cast<char*>(response->data());
+                vectors[0].iov_len = response->size();
+                vectors[1].iov_base = s.suffixes[replies];
+                vectors[1].iov_len = FormatSuffix(s.suffixes[replies]);
+#ifdef __linux__
+                msghdr& header = s.outMessages[replies].msg_hdr;
+                std::memset(&header, 0, sizeof(header));
+                header.msg_name = &s.sources[i];
+                header.msg_namelen = sizeof(sockaddr_in);
+                header.msg_iov = vectors;
+                header.msg_iovlen = 2;
+#else
+                msghdr header;
+                std::memset(&header, 0, sizeof(header));
+                header.msg_name = &s.sources[i];
+                header.msg_namelen = sizeof(sockaddr_in);
+                header.msg_iov = vectors;
+                header.msg_iovlen = 2;
+                if (sendmsg(s.fd, &header, 0) < 0) {
+                    failed++;
+                    continue;
+                }
+#endif
+                replies++;
+            }
+
+#ifdef __linux__
+            // Gönderilemeyen yanıt (ulaşılamayan adres vb.) atlanır, kalanlar gider
+            size_t next = 0;
+            while (next < replies) {
+                int count = sendmmsg(s.fd, s.outMessages + next, static_cast<unsigned int>(replies - next), 0);
+                if (count < 0) {
+                    if (errno != EINTR) {
+                        next++;
+                        failed++;
+                    }
+                    continue;
+                }
+                next += static_cast<size_t>(count);
+            }
+            replies -= failed;
+#endif
+            CountBatch(start, received, requests, replies, limited, failed > 0);
+        }
+    }
+}
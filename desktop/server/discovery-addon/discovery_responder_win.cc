@@ -0,0 +1,129 @@
+#include "discovery_responder.h"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+// Windows: recvmmsg / sendmmsg yok; soket kendi thread'inde bloklu recvfrom ile
+// okunur, yanıt WSASendTo ile iki parça (gövde + timestamp) olarak gönderilir.
+// Stop soketi kapatır, bloklu recvfrom hata ile döner ve thread çıkar.
+
+namespace {
+
+std::string WsaMessage(const char* what) {
+    return std::string(what) + " (WSA " + std::to_string(WSAGetLastError()) + ")";
+}
+
+} // namespace
+
+struct DiscoveryResponder::Socket {
+    SOCKET fd = INVALID_SOCKET;
+    bool started = false; // WSAStartup
+    char packet[kPacketSize];
+    char suffix[kSuffixSize];
+};
+
+DiscoveryResponder::DiscoveryResponder() : socket_(new Socket()) {}
+
+DiscoveryResponder::~DiscoveryResponder() {
+    Stop();
+}
+
+bool DiscoveryResponder::Open(uint16_t port, std::string& error) {
+    Socket& s = *socket_;
+
+    WSADATA data;
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+        error = "Winsock başlatılamadı";
+        return false;
+    }
+    s.started = true;
+
+    s.fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s.fd == INVALID_SOCKET) {
+        error = WsaMessage("UDP soketi oluşturulamadı");
+        return false;
+    }
+
+    BOOL enable = TRUE;
+    setsockopt(s.fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&enable), sizeof(enable));
+    setsockopt(s.fd, SOL_SOCKET, SO_BROADCAST, reinterpret_cast<const char*>(&enable), sizeof(enable));
+    int bufferSize = kReceiveBuffer;
+    setsockopt(s.fd, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&bufferSize), sizeof(bufferSize));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(s.fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+        error = WsaMessage("UDP portu bağlanamadı");
+        return false;
+    }
+
+    int length = sizeof(address);
+    if (getsockname(s.fd, reinterpret_cast<sockaddr*>(&address), &length) == SOCKET_ERROR) {
+        error = WsaMessage("UDP portu okunamadı");
+        return false;
+    }
+    port_ = ntohs(address.sin_port);
+    return true;
+}
+
+void DiscoveryResponder::Wake() {
+    if (socket_->fd != INVALID_SOCKET) {
+        closesocket(socket_->fd);
+        socket_->fd = INVALID_SOCKET;
+    }
+}
+
+void DiscoveryResponder::Close() {
+    Wake();
+    if (socket_->started) {
+        WSACleanup();
+        socket_->started = false;
+    }
+}
+
+void DiscoveryResponder::Run() {
+    Socket& s = *socket_;
+    // Wake alanı sıfırlar; thread kendi kopyasını kullanır
+    SOCKET fd = s.fd;
+
+    while (running_) {
+        sockaddr_in source = {};
+        int length = sizeof(source);
+        int size = recvfrom(fd, s.packet, kPacketSize, 0, reinterpret_cast<sockaddr*>(&source), &length);
+        if (size == SOCKET_ERROR) {
+            int code = WSAGetLastError();
+            // Önceki yanıta gelen ICMP "port unreachable" ve kırpılan paket okumayı durdurmaz
+            if (running_ && (code == WSAECONNRESET || code == WSAEMSGSIZE)) {
+                continue;
+            }
+            running_ = false;
+            break;
+        }
+
+        metrics::Clock::time_point start = metrics::Clock::now();
+        size_t requests = 0;
+        size_t limited = 0;
+        size_t replies = 0;
+        bool failed = false;
+        if (IsRequest(reinterpret_cast<const uint8_t*>(s.packet), static_cast<size_t>(size))) {
+            requests = 1;
+            std::shared_ptr<const std::string> response = Response();
+            if (response && !Admit(ntohl(source.sin_addr.s_addr))) {
+                limited = 1;
+            } else if (response) {
+                WSABUF buffers[2];
+                buffers[0].buf = const_cast<char*>(response->data());
+                buffers[0].len = static_cast<ULONG>(response->size());
+                buffers[1].buf = s.suffix;
+                buffers[1].len = static_cast<ULONG>(FormatSuffix(s.suffix));
+                DWORD sent = 0;
+                failed = WSASendTo(fd, buffers, 2, &sent, 0, reinterpret_cast<sockaddr*>(&source),
+                                   sizeof(source), nullptr, nullptr) == SOCKET_ERROR;
+                replies = failed ? 0 : 1;
+            }
+        }
+        CountBatch(start, 1, requests, replies, limited, failed);
+    }
+}
@@ -0,0 +1,21 @@
+const path = require('path');
+const addonPath = path.join(__dirname, 'build', 'Release', 'discovery.node');
+
+let discoveryAddon = null;
+
+try {
+  discoveryAddon = require(addonPath);
+} catch (error) {
+  console.error('❌ Discovery addon yüklenemedi:', error.message);
+  console.error('💡 Çözüm: cd desktop/server/discovery-addon && npm install');
+  
+  // Fallback: start başarısız döner, discovery.js dgram soketine geçer
+  discoveryAddon = {
+    start: () => ({ success: false, port: 0, error: error.message }),
+    setResponse: () => false,
+    stop: () => {},
+    getDiscoveryStats: () => ({ running: false, port: 0, requests: 0, replies: 0, limited: 0 })
+  };
+}
+
+module.exports = discoveryAddon;
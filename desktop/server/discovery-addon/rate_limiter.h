@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Kaynak adresi başına token bucket (discovery yanıtları için)
+// Her IPv4 adresinin kBurst'lük bir kovası vardır; kova saniyede kRefillPerSecond
+// token dolar. Boş kovalı kaynağa yanıt verilmez. Tablo sabit boyutludur
+// (bellek ayırmaz): adres karma ile bir yuvaya düşer, kDistance yuva içinde
+// aranır; hepsi doluysa en uzun süredir görülmeyen kaynak çıkarılır. Çıkarılan
+// kaynak tekrar gelirse dolu kovayla başlar; bu yüzden tablo, aynı anda sorgu
+// yapan telefon sayısından epey büyük tutulur.
+// Thread-safe değildir; sadece yanıtlayıcı thread'i kullanır.
+
+class RateLimiter {
+public:
+    static constexpr size_t kSlots = 1024;     // 2'nin kuvveti
+    static constexpr size_t kDistance = 8;
+    static constexpr uint32_t kBurst = 8;
+    static constexpr uint32_t kRefillPerSecond = 4;
+
+    // nowNs: monoton saat (ns). true: yanıt verilebilir (bir token harcandı)
+    bool Admit(uint32_t address, int64_t nowNs) {
+        Slot* victim = nullptr;
+        size_t start = Hash(address);
+        for (size_t i = 0; i < kDistance; i++) {
+            Slot& slot = slots_[(start + i) & (kSlots - 1)];
+            if (slot.used && slot.address == address) {
+                return Take(slot, nowNs);
+            }
+            if (!victim || !slot.used || (victim->used && slot.lastNs < victim->lastNs)) {
+                victim = &slot;
+            }
+        }
+
+        victim->used = true;
+        victim->address = address;
+        victim->tokensMilli = kBurst * 1000;
+        victim->lastNs = nowNs;
+        return Take(*victim, nowNs);
+    }
+
+private:
+    struct Slot {
+        uint32_t address = 0;
+        bool used = false;
+        uint32_t tokensMilli = 0; // 1/1000 token (kesirli dolum için)
+        int64_t lastNs = 0;
+    };
+
+    // Fibonacci karma; üst bitler (aynı alt ağdaki adresler yayılır)
+    static size_t Hash(uint32_t address) {
+        return static_cast<size_t>((address * 2654435761u) >> 16) & (kSlots - 1);
+    }
+
+    static bool Take(Slot& slot, int64_t nowNs) {
+        int64_t elapsedNs = nowNs - slot.lastNs;
+        if (elapsedNs > 0) {
+            uint64_t refill = static_cast<uint64_t>(elapsedNs) * kRefillPerSecond / 1000000;
+            uint64_t tokens = slot.tokensMilli + refill;
+            if (tokens >= kBurst * 1000) {
+                slot.tokensMilli = kBurst * 1000;
+                slot.lastNs = nowNs;
+            } else {
+                // Sadece dolan kadar ilerlenir; sık gelen paketlerde kesir kaybolmaz
+                slot.tokensMilli = static_cast<uint32_t>(tokens);
+                slot.lastNs += static_cast<int64_t>(refill * 1000000 / kRefillPerSecond);
+            }
+        }
+
+        if (slot.tokensMilli < 1000) {
+            return false;
+        }
+        slot.tokensMilli -= 1000;
+        return true;
+    }
+
+    Slot slots_[kSlots];
+};
@@ -1,5 +1,16 @@
 const dgram = require('dgram');
 const { Bonjour } = require('bonjour-service');
+const log = require('./log');
+
+// Native UDP yanıtlayıcısı (discovery-addon): istekler kendi thread'inde
+// yanıtlanır, JS event loop'u meşgulken de telefonlar masaüstünü bulur.
+// Yüklenemezse aşağıdaki dgram soketi kullanılır.
+let discoveryAddon = null;
+try {
+  discoveryAddon = require('./discovery-addon');
+} catch (error) {
+  log.warn('⚠️  Discovery addon yüklenemedi, dgram soketi kullanılacak:', error.message);
+}
 
 const UDP_PORT = 45454;
 const DISCOVER_REQUEST = 'LOCALDESK_DISCOVER_REQUEST';
@@ -8,6 +19,9 @@ const DISCOVER_RESPONSE = 'LOCALDESK_DISCOVER_RESPONSE';
 class DiscoveryService {
   constructor() {
     this.udpSocket = null;
+    this.nativeResponder = false;
+    // /metrics için (getStats: yanıtlayıcı thread'inin batch süreleri)
+    this.addon = discoveryAddon;
     this.bonjour = null;
     this.bonjourService = null;
     this.port = null;
@@ -20,7 +34,7 @@ class DiscoveryService {
     this.deviceId = deviceId;
     this.deviceName = deviceName;
 
-    console.log('🔍 Discovery servisleri başlatılıyor...');
+    log.info('🔍 Discovery servisleri başlatılıyor...');
 
     // UDP Discovery
     await this.startUDPDiscovery();
@@ -28,44 +42,55 @@ class DiscoveryService {
     // mDNS (Bonjour)
     await this.startMDNS();
 
-    console.log('✅ Discovery servisleri aktif');
+    log.info('✅ Discovery servisleri aktif');
+  }
+
+  // Yanıt gövdesi; timestamp her yanıtta ayrıca eklenir
+  responseFields() {
+    return {
+      type: DISCOVER_RESPONSE,
+      deviceId: this.deviceId,
+      deviceName: this.deviceName,
+      deviceType: 'desktop',
+      port: this.port
+    };
   }
 
   async startUDPDiscovery() {
+    if (discoveryAddon) {
+      const result = discoveryAddon.start(UDP_PORT, JSON.stringify(this.responseFields()));
+      if (result.success) {
+        this.nativeResponder = true;
+        log.info(`✅ UDP discovery yanıtlayıcısı (native) dinliyor: 0.0.0.0:${result.port}`);
+        log.info('📡 Yerel IP adresleri:', this.getLocalIPAddresses().join(', '));
+        return;
+      }
+      log.warn('⚠️  Native discovery başlatılamadı, dgram soketine geçiliyor:', result.error);
+    }
+
     return new Promise((resolve, reject) => {
       this.udpSocket = dgram.createSocket({ type: 'udp4', reuseAddr: true });
 
       this.udpSocket.on('error', (err) => {
-        console.error('❌ UDP socket hatası:', err);
-        console.error('   Port zaten kullanımda olabilir veya güvenlik duvarı engelliyor olabilir');
+        log.error('❌ UDP socket hatası:', err);
+        log.error('   Port zaten kullanımda olabilir veya güvenlik duvarı engelliyor olabilir');
         reject(err);
       });
 
       this.udpSocket.on('message', (msg, rinfo) => {
         const message = msg.toString();
-        console.log('📨 UDP mesaj alındı:', message.substring(0, 50), 'from', rinfo.address);
+        log.debug('📨 UDP mesaj alındı:', message.substring(0, 50), 'from', rinfo.address);
         
         // Discovery isteği geldi mi?
         if (message.startsWith(DISCOVER_REQUEST)) {
-          console.log('📡 Discovery isteği alındı:', rinfo.address);
-          
           // Yanıt gönder
-          const response = JSON.stringify({
-            type: DISCOVER_RESPONSE,
-            deviceId: this.deviceId,
-            deviceName: this.deviceName,
-            deviceType: 'desktop',
-            port: this.port,
-            timestamp: Date.now()
-          });
-          
-          console.log('📤 Discovery yanıtı gönderiliyor:', response);
+          const response = JSON.stringify({ ...this.responseFields(), timestamp: Date.now() });
           
           this.udpSocket.send(response, rinfo.port, rinfo.address, (err) => {
             if (err) {
-              console.error('❌ UDP yanıt gönderme hatası:', err);
+              log.warn('❌ UDP yanıt gönderme hatası:', err.message);
             } else {
-              console.log('✅ Discovery yanıtı gönderildi:', rinfo.address);
+              log.debug('✅ Discovery yanıtı gönderildi:', rinfo.address);
             }
           });
         }
@@ -73,17 +98,17 @@ class DiscoveryService {
 
       this.udpSocket.on('listening', () => {
         const address = this.udpSocket.address();
-        console.log(`✅ UDP socket dinliyor: ${address.address}:${address.port}`);
-        console.log('📡 Yerel IP adresleri:', this.getLocalIPAddresses().join(', '));
+        log.info(`✅ UDP socket dinliyor: ${address.address}:${address.port}`);
+        log.info('📡 Yerel IP adresleri:', this.getLocalIPAddresses().join(', '));
         
         // Broadcast'i etkinleştir
         this.udpSocket.setBroadcast(true);
-        console.log('✅ UDP broadcast etkinleştirildi');
+        log.info('✅ UDP broadcast etkinleştirildi');
         
         resolve();
       });
 
-      console.log(`🔌 UDP socket bağlanıyor: 0.0.0.0:${UDP_PORT}`);
+      log.info(`🔌 UDP socket bağlanıyor: 0.0.0.0:${UDP_PORT}`);
       this.udpSocket.bind(UDP_PORT);
     });
   }
@@ -104,15 +129,20 @@ class DiscoveryService {
         }
       });
 
-      console.log('✅ mDNS servisi yayınlanıyor:', this.deviceName);
+      log.info('✅ mDNS servisi yayınlanıyor:', this.deviceName);
     } catch (error) {
-      console.error('mDNS başlatma hatası:', error);
+      log.error('mDNS başlatma hatası:', error);
       // mDNS başarısız olsa bile devam et (UDP discovery yeterli olabilir)
     }
   }
 
   async stop() {
-    console.log('🛑 Discovery servisleri durduruluyor...');
+    log.info('🛑 Discovery servisleri durduruluyor...');
+
+    if (this.nativeResponder) {
+      discoveryAddon.stop();
+      this.nativeResponder = false;
+    }
 
     if (this.udpSocket) {
       this.udpSocket.close();
@@ -129,7 +159,12 @@ class DiscoveryService {
       this.bonjour = null;
     }
 
-    console.log('✅ Discovery servisleri durduruldu');
+    log.info('✅ Discovery servisleri durduruldu');
+  }
+
+  // { running, port, requests, replies, limited, ignored, batches, maxBatch } veya null (dgram yedeği)
+  getDiscoveryStats() {
+    return this.nativeResponder ? discoveryAddon.getDiscoveryStats() : null;
   }
 
   // Lokal IP adreslerini al
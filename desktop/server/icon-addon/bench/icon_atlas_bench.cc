@@ -0,0 +1,155 @@
+// İkon atlası benchmark'ı
+// Bir sayfanın ikonlarını telefona taşımanın iki yolunu karşılaştırır:
+//   tek tek - her ikon kendi isteğiyle tam boyutta iner ve tam boyutta çözülür
+//   atlas   - tek paket; telefon sadece atlas PNG'sini çözer
+// Ayrıca atlasın ilk üretimi (okuma + çözme + küçültme + PNG) ve kısayollar
+// değişmediğinde önbellekten dönüşü (sadece dosya bilgisi) ölçülür.
+//
+// Derleme: node-gyp rebuild (build/Release/icon_atlas_bench)
+// Çalıştırma: ./build/Release/icon_atlas_bench [ikon sayısı] [kaynak kenarı] [hücre] [dizin]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../../native-common/image_codec.h"
+#include "../../native-common/test_backend.h"
+#include "../icon_atlas.h"
+
+namespace {
+
+constexpr int kRuns = 20;
+
+void Report(const char* label, std::vector<int64_t>& samples) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-22s %6zu örnek  p50 %8.1f us  p99 %8.1f us  max %8.1f us\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.maxUs);
+}
+
+// Kullanıcının seçtiği tipik ikon: saydam zemin üzerinde yumuşak kenarlı renkli daire
+ImageRGBA SyntheticIcon(int size, int seed) {
+    ImageRGBA image;
+    image.width = size;
+    image.height = size;
+    image.pixels.resize(static_cast<size_t>(size) * size * 4);
+
+    double center = size / 2.0;
+    double radius = size * 0.42;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            uint8_t* pixel = image.pixels.data() + (static_cast<size_t>(y) * size + x) * 4;
+            double distance = std::hypot(x + 0.5 - center, y + 0.5 - center);
+            double coverage = std::max(0.0, std::min(1.0, radius - distance + 0.5));
+            pixel[0] = static_cast<uint8_t>((x * 255 / size + seed * 37) & 0xFF);
+            pixel[1] = static_cast<uint8_t>((y * 255 / size + seed * 91) & 0xFF);
+            pixel[2] = static_cast<uint8_t>((seed * 53) & 0xFF);
+            pixel[3] = static_cast<uint8_t>(coverage * 255);
+        }
+    }
+    return image;
+}
+
+bool WriteFile(const std::string& path, const std::vector<uint8_t>& data) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    return static_cast<bool>(file.write(reinterpret_cast<const char*>(data.data()), data.size()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 32;
+    int sourceSize = argc > 2 ? std::atoi(argv[2]) : 512;
+    int cell = argc > 3 ? std::atoi(argv[3]) : 128;
+    std::string dir = argc > 4 ? argv[4] : ".";
+    if (count < 1 || sourceSize < 16 || cell < iconatlas::kMinCell || cell > iconatlas::kMaxCell) {
+        std::printf("Geçersiz parametre\n");
+        return 1;
+    }
+
+    std::printf("İkon atlası benchmark'ı (%d ikon, %d px kaynak, %d px hücre)\n", count, sourceSize, cell);
+
+    std::vector<std::string> names;
+    std::vector<std::vector<uint8_t>> files;
+    size_t sourceBytes = 0;
+    for (int i = 0; i < count; i++) {
+        std::vector<uint8_t> png;
+        std::string error;
+        if (!EncodePng(SyntheticIcon(sourceSize, i), png, error)) {
+            std::printf("  ikon kodlanamadı: %s\n", error.c_str());
+            return 1;
+        }
+        names.push_back("icon-bench-" + std::to_string(i) + ".png");
+        if (!WriteFile(dir + "/" + names.back(), png)) {
+            std::printf("  ikon yazılamadı: %s\n", names.back().c_str());
+            return 1;
+        }
+        sourceBytes += png.size();
+        files.push_back(std::move(png));
+    }
+
+    // Tek tek: telefonun her ikon için yaptığı çözme (tam boyut)
+    std::vector<int64_t> perIcon;
+    for (int run = 0; run < kRuns; run++) {
+        int64_t start = testbackend::NowNs();
+        for (const std::vector<uint8_t>& file : files) {
+            ImageRGBA decoded;
+            std::string error;
+            DecodeImage(file.data(), file.size(), decoded, error);
+        }
+        perIcon.push_back(testbackend::NowNs() - start);
+    }
+    Report("tek tek çözme", perIcon);
+    std::printf("  %-22s %d istek, %zu bayt\n", "", count, sourceBytes);
+
+    // Atlas: ilk üretim (her turda boş önbellek)
+    std::vector<int64_t> builds;
+    AtlasResult atlas;
+    for (int run = 0; run < kRuns; run++) {
+        AtlasCache cache(64 * 1024 * 1024);
+        std::string error;
+        int64_t start = testbackend::NowNs();
+        if (!cache.Build(dir, names, cell, atlas, error)) {
+            std::printf("  atlas üretilemedi: %s\n", error.c_str());
+            return 1;
+        }
+        builds.push_back(testbackend::NowNs() - start);
+    }
+    Report("atlas üretimi", builds);
+
+    // Kısayollar değişmedi: önbellekten
+    AtlasCache cache(64 * 1024 * 1024);
+    std::string error;
+    cache.Build(dir, names, cell, atlas, error);
+    std::vector<int64_t> hits;
+    for (int run = 0; run < kRuns * 10; run++) {
+        AtlasResult hit;
+        int64_t start = testbackend::NowNs();
+        cache.Build(dir, names, cell, hit, error);
+        hits.push_back(testbackend::NowNs() - start);
+    }
+    Report("atlas (önbellek)", hits);
+
+    // Telefonun atlas tarafındaki çözmesi
+    const std::vector<uint8_t>& bundle = *atlas.bundle;
+    size_t pngOffset = bundle[12] | bundle[13] << 8 | bundle[14] << 16 | static_cast<size_t>(bundle[15]) << 24;
+    std::vector<int64_t> atlasDecodes;
+    for (int run = 0; run < kRuns; run++) {
+        ImageRGBA decoded;
+        int64_t start = testbackend::NowNs();
+        DecodeImage(bundle.data() + pngOffset, bundle.size() - pngOffset, decoded, error);
+        atlasDecodes.push_back(testbackend::NowNs() - start);
+    }
+    Report("atlas çözme", atlasDecodes);
+    std::printf("  %-22s 1 istek, %zu bayt (%dx%d, manifest %zu bayt)\n", "", bundle.size(),
+                atlas.width, atlas.height, pngOffset - iconatlas::kHeaderSize);
+
+    for (const std::string& name : names) {
+        std::remove((dir + "/" + name).c_str());
+    }
+    return 0;
+}
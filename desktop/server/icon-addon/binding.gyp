@@ -0,0 +1,76 @@
+{
+  "targets": [
+    {
+      "target_name": "icon",
+      "sources": [
+        "icon.cc",
+        "icon_atlas.cc",
+        "../native-common/image_resize.cc"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').gyp\")"
+      ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "defines": [ "NAPI_CPP_EXCEPTIONS" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "../native-common/image_codec_win.cc" ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "ExceptionHandling": 1
+            },
+            "VCLinkerTool": {
+              "AdditionalDependencies": [
+                "ole32.lib",
+                "oleaut32.lib",
+                "windowscodecs.lib"
+              ]
+            }
+          }
+        }],
+        ["OS=='linux'", {
+          "sources": [ "../native-common/image_codec.cc" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags libjpeg libpng)" ],
+          "libraries": [ "<!@(pkg-config --libs libjpeg libpng)" ]
+        }]
+      ]
+    },
+    {
+      "target_name": "icon_atlas_bench",
+      "type": "executable",
+      "sources": [
+        "bench/icon_atlas_bench.cc",
+        "icon_atlas.cc",
+        "../native-common/image_resize.cc"
+      ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "../native-common/image_codec_win.cc" ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "ExceptionHandling": 1
+            },
+            "VCLinkerTool": {
+              "AdditionalDependencies": [
+                "ole32.lib",
+                "oleaut32.lib",
+                "windowscodecs.lib"
+              ]
+            }
+          }
+        }],
+        ["OS=='linux'", {
+          "sources": [ "../native-common/image_codec.cc" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags libjpeg libpng)" ],
+          "libraries": [ "<!@(pkg-config --libs libjpeg libpng)" ]
+        }]
+      ]
+    }
+  ]
+}
@@ -0,0 +1,144 @@
+#include <napi.h>
+
+#include <string>
+#include <vector>
+
+#include "../native-common/metrics_napi.h"
+#include "icon_atlas.h"
+
+// Sayfa ikon atlası (bkz. icon_atlas.h)
+// buildAtlas() dosya okuma, çözme, küçültme ve PNG kodlamayı libuv iş
+// parçacığında yapar; sunucu paketi getAtlas(etag) ile önbellekten servis eder.
+
+// Çağrı metrikleri (getStats)
+// "build" önbellekte olmayan bir atlasın iş parçacığındaki üretim süresidir.
+metrics::Registry iconMetrics("icon");
+metrics::Api& buildMetrics = iconMetrics.Add("build");
+
+// Atlas bilgisi: { etag, width, height, icons, skipped, bytes, cached }
+Napi::Object AtlasObject(Napi::Env env, const AtlasResult& atlas) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("etag", Napi::String::New(env, atlas.etag));
+    result.Set("width", Napi::Number::New(env, atlas.width));
+    result.Set("height", Napi::Number::New(env, atlas.height));
+    result.Set("icons", Napi::Number::New(env, static_cast<double>(atlas.icons)));
+    result.Set("skipped", Napi::Number::New(env, static_cast<double>(atlas.skipped)));
+    result.Set("bytes", Napi::Number::New(env, static_cast<double>(atlas.bundle->size())));
+    result.Set("cached", Napi::Boolean::New(env, atlas.cached));
+    return result;
+}
+
+class BuildAtlasWorker : public Napi::AsyncWorker {
+public:
+    BuildAtlasWorker(Napi::Env env, std::string dir, std::vector<std::string> names, int cell)
+        : Napi::AsyncWorker(env),
+          deferred_(Napi::Promise::Deferred::New(env)),
+          dir_(std::move(dir)),
+          names_(std::move(names)),
+          cell_(cell) {}
+
+    Napi::Promise Promise() const {
+        return deferred_.Promise();
+    }
+
+protected:
+    void Execute() override {
+        metrics::Clock::time_point start = metrics::Clock::now();
+        std::string error;
+        bool success = DefaultAtlasCache().Build(dir_, names_, cell_, result_, error);
+        if (!success || !result_.cached) {
+            buildMetrics.Record(metrics::ElapsedNs(start), !success);
+        }
+        if (!success) {
+            SetError(error);
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(AtlasObject(Env(), result_));
+    }
+
+    void OnError(const Napi::Error& error) override {
+        deferred_.Reject(error.Value());
+    }
+
+private:
+    Napi::Promise::Deferred deferred_;
+    std::string dir_;
+    std::vector<std::string> names_;
+    int cell_;
+    AtlasResult result_;
+};
+
+// N-API: buildAtlas(dir, names, cell) - names: ikon dosya adları (sayfa sırası)
+// Promise<{ etag, width, height, icons, skipped, bytes, cached }>
+Napi::Value BuildAtlas(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3 || !info[0].IsString() || !info[1].IsArray() || !info[2].IsNumber()) {
+        Napi::TypeError::New(env, "Klasör, ikon adları ve hücre boyutu bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    int cell = info[2].As<Napi::Number>().Int32Value();
+    if (cell < iconatlas::kMinCell || cell > iconatlas::kMaxCell) {
+        Napi::RangeError::New(env, "Hücre boyutu 16-512 arasında olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Array list = info[1].As<Napi::Array>();
+    std::vector<std::string> names;
+    names.reserve(list.Length());
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        Napi::Value name = list[i];
+        if (!name.IsString()) {
+            Napi::TypeError::New(env, "İkon adları string olmalı").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        names.push_back(name.As<Napi::String>().Utf8Value());
+    }
+
+    BuildAtlasWorker* worker = new BuildAtlasWorker(env, info[0].As<Napi::String>().Utf8Value(),
+                                                    std::move(names), cell);
+    Napi::Promise promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+// N-API: getAtlas(etag) - önbellekte varsa { etag, data (paket Buffer), width, height, icons }, yoksa null
+Napi::Value GetAtlas(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "ETag bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    AtlasResult atlas;
+    if (!DefaultAtlasCache().Find(info[0].As<Napi::String>().Utf8Value(), atlas)) {
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("etag", Napi::String::New(env, atlas.etag));
+    result.Set("data", Napi::Buffer<uint8_t>::Copy(env, atlas.bundle->data(), atlas.bundle->size()));
+    result.Set("width", Napi::Number::New(env, atlas.width));
+    result.Set("height", Napi::Number::New(env, atlas.height));
+    result.Set("icons", Napi::Number::New(env, static_cast<double>(atlas.icons)));
+    return result;
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), iconMetrics);
+}
+
+// Modül başlatma
+Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    metrics::Export(env, exports, iconMetrics, "buildAtlas", BuildAtlas);
+    metrics::Export(env, exports, iconMetrics, "getAtlas", GetAtlas);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+    return exports;
+}
+
+NODE_API_MODULE(icon, Init)
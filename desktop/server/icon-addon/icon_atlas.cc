@@ -0,0 +1,259 @@
+#include "icon_atlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+#include "../native-common/content_hash.h"
+#include "../native-common/image_codec.h"
+#include "../native-common/image_resize.h"
+
+namespace {
+
+// Paketler için bellek bütçesi (32 ikonlu sayfa, 128 px hücre ~100-300 KB)
+const size_t kAtlasCacheBudget = 8 * 1024 * 1024;
+// Çok büyük ikon dosyalarını reddet (bozuk / yanlış seçilmiş dosya)
+const uintmax_t kMaxIconBytes = 16 * 1024 * 1024;
+
+// Sadece ikon klasöründeki düz dosya adları (klasör dışına çıkılamaz)
+bool IsPlainName(const std::string& name) {
+    return !name.empty() && name.size() <= 255 && name != "." && name != ".." &&
+           name.find_first_of(std::string("/\\:\0", 4)) == std::string::npos;
+}
+
+std::filesystem::path IconPath(const std::string& dir, const std::string& name) {
+    return std::filesystem::u8path(dir) / std::filesystem::u8path(name);
+}
+
+bool ReadIcon(const std::filesystem::path& path, std::vector<uint8_t>& data) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+
+    std::streamoff length = file.tellg();
+    if (length <= 0 || static_cast<uintmax_t>(length) > kMaxIconBytes) {
+        return false;
+    }
+
+    data.resize(static_cast<size_t>(length));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(data.data()), length));
+}
+
+// Alan ortalaması saydam piksellerin (çoğu zaman siyah) rengini kenarlara
+// karıştırır. Önçarpımlı alfayla küçültülüp sonra geri bölünür.
+void Premultiply(ImageRGBA& image) {
+    uint8_t* pixel = image.pixels.data();
+    uint8_t* end = pixel + image.pixels.size();
+    for (; pixel < end; pixel += 4) {
+        uint32_t alpha = pixel[3];
+        if (alpha == 255) {
+            continue;
+        }
+        for (int c = 0; c < 3; c++) {
+            pixel[c] = static_cast<uint8_t>((pixel[c] * alpha + 127) / 255);
+        }
+    }
+}
+
+void Unpremultiply(ImageRGBA& image) {
+    uint8_t* pixel = image.pixels.data();
+    uint8_t* end = pixel + image.pixels.size();
+    for (; pixel < end; pixel += 4) {
+        uint32_t alpha = pixel[3];
+        if (alpha == 255) {
+            continue;
+        }
+        for (int c = 0; c < 3; c++) {
+            pixel[c] = alpha == 0 ? 0 : static_cast<uint8_t>(std::min<uint32_t>(255, (pixel[c] * 255 + alpha / 2) / alpha));
+        }
+    }
+}
+
+// Çöz ve hücreye sığdır (büyütülmez)
+bool RenderIcon(const std::vector<uint8_t>& data, int cell, ImageRGBA& tile) {
+    std::string error;
+    ImageRGBA decoded;
+    if (!DecodeImage(data.data(), data.size(), decoded, error, cell)) {
+        return false;
+    }
+
+    int width = 0;
+    int height = 0;
+    FitWithin(decoded.width, decoded.height, cell, width, height);
+    if (width == decoded.width && height == decoded.height) {
+        tile = std::move(decoded);
+        return true;
+    }
+
+    Premultiply(decoded);
+    if (!ResizeArea(decoded, width, height, tile)) {
+        return false;
+    }
+    Unpremultiply(tile);
+    return true;
+}
+
+void PutU16(uint8_t* out, size_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void PutU32(uint8_t* out, size_t value) {
+    PutU16(out, value & 0xFFFF);
+    PutU16(out + 2, value >> 16);
+}
+
+} // namespace
+
+AtlasCache& DefaultAtlasCache() {
+    static AtlasCache cache(kAtlasCacheBudget);
+    return cache;
+}
+
+bool AtlasCache::Build(const std::string& dir, const std::vector<std::string>& names, int cell,
+                       AtlasResult& result, std::string& error) {
+    if (cell < iconatlas::kMinCell || cell > iconatlas::kMaxCell) {
+        error = "Hücre boyutu geçersiz";
+        return false;
+    }
+
+    // Anahtar: klasör + hücre + (ad, boyut, değişme zamanı); dosyalar okunmaz
+    std::vector<std::string> unique;
+    std::unordered_set<std::string> seen;
+    size_t skipped = 0;
+    uint64_t hash = ContentHash(reinterpret_cast<const uint8_t*>(dir.data()), dir.size());
+    hash = ContentHash(reinterpret_cast<const uint8_t*>(&cell), sizeof(cell), hash);
+    for (const std::string& name : names) {
+        if (!IsPlainName(name)) {
+            skipped++;
+            continue;
+        }
+        if (!seen.insert(name).second) {
+            continue;
+        }
+        unique.push_back(name);
+
+        std::error_code code;
+        std::filesystem::path path = IconPath(dir, name);
+        const int64_t stamp[] = {
+            static_cast<int64_t>(std::filesystem::file_size(path, code)),
+            code ? -1 : static_cast<int64_t>(std::filesystem::last_write_time(path, code).time_since_epoch().count())
+        };
+        hash = ContentHash(reinterpret_cast<const uint8_t*>(name.data()), name.size() + 1, hash);
+        hash = ContentHash(reinterpret_cast<const uint8_t*>(stamp), sizeof(stamp), hash);
+    }
+    std::string etag = HashToHex(hash);
+
+    if (Find(etag, result)) {
+        result.cached = true;
+        return true;
+    }
+
+    // Çözülebilen ikonlar sırayla hücrelere
+    std::vector<std::pair<const std::string*, ImageRGBA>> tiles;
+    std::vector<uint8_t> data;
+    for (const std::string& name : unique) {
+        ImageRGBA tile;
+        if (!ReadIcon(IconPath(dir, name), data) || !RenderIcon(data, cell, tile)) {
+            skipped++;
+            continue;
+        }
+        tiles.emplace_back(&name, std::move(tile));
+    }
+
+    // Kareye yakın ızgara; atlas kenar sınırına sığmayanlar dışarıda kalır
+    int maxColumns = iconatlas::kMaxAtlasSide / cell;
+    size_t capacity = static_cast<size_t>(maxColumns) * maxColumns;
+    if (tiles.size() > capacity) {
+        skipped += tiles.size() - capacity;
+        tiles.resize(capacity);
+    }
+    int count = static_cast<int>(tiles.size());
+    int columns = std::min(maxColumns, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count)))));
+    int rows = columns > 0 ? (count + columns - 1) / columns : 0;
+
+    ImageRGBA atlas;
+    atlas.width = columns * cell;
+    atlas.height = rows * cell;
+    atlas.pixels.assign(static_cast<size_t>(atlas.width) * atlas.height * 4, 0);
+
+    size_t manifestBytes = 0;
+    for (const auto& tile : tiles) {
+        manifestBytes += 9 + tile.first->size();
+    }
+    auto bundle = std::make_shared<std::vector<uint8_t>>(iconatlas::kHeaderSize + manifestBytes);
+    uint8_t* entry = bundle->data() + iconatlas::kHeaderSize;
+
+    for (int i = 0; i < count; i++) {
+        const std::string& name = *tiles[i].first;
+        const ImageRGBA& tile = tiles[i].second;
+        int x = (i % columns) * cell;
+        int y = (i / columns) * cell;
+
+        size_t rowBytes = static_cast<size_t>(tile.width) * 4;
+        for (int row = 0; row < tile.height; row++) {
+            std::memcpy(atlas.pixels.data() + (static_cast<size_t>(y + row) * atlas.width + x) * 4,
+                        tile.pixels.data() + row * rowBytes, rowBytes);
+        }
+
+        PutU16(entry, x);
+        PutU16(entry + 2, y);
+        PutU16(entry + 4, tile.width);
+        PutU16(entry + 6, tile.height);
+        entry[8] = static_cast<uint8_t>(name.size());
+        std::memcpy(entry + 9, name.data(), name.size());
+        entry += 9 + name.size();
+    }
+
+    std::vector<uint8_t> png;
+    if (count > 0 && !EncodePng(atlas, png, error)) {
+        return false;
+    }
+
+    uint8_t* header = bundle->data();
+    header[0] = iconatlas::kMagic0;
+    header[1] = iconatlas::kMagic1;
+    header[2] = iconatlas::kVersion;
+    header[3] = 0;
+    PutU16(header + 4, cell);
+    PutU16(header + 6, count);
+    PutU16(header + 8, atlas.width);
+    PutU16(header + 10, atlas.height);
+    PutU32(header + 12, bundle->size());
+    PutU32(header + 16, png.size());
+    bundle->insert(bundle->end(), png.begin(), png.end());
+
+    result.etag = etag;
+    result.bundle = bundle;
+    result.width = atlas.width;
+    result.height = atlas.height;
+    result.icons = tiles.size();
+    result.skipped = skipped;
+    result.cached = false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.Put(etag, { bundle, atlas.width, atlas.height, result.icons, skipped }, bundle->size());
+    return true;
+}
+
+bool AtlasCache::Find(const std::string& etag, AtlasResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const Entry* entry = entries_.Find(etag);
+    if (!entry) {
+        return false;
+    }
+
+    result.etag = etag;
+    result.bundle = entry->bundle;
+    result.width = entry->width;
+    result.height = entry->height;
+    result.icons = entry->icons;
+    result.skipped = entry->skipped;
+    return true;
+}
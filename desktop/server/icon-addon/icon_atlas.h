@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../native-common/lru_cache.h"
+
+// Sayfa ikon atlası
+// Bir sayfanın tüm ikon dosyaları bir kez çözülür, alfa önçarpımlı SIMD alan
+// ortalamasıyla ızgara hücresine küçültülür ve tek bir PNG dokusuna dizilir.
+// Telefon sayfayı açınca ikon başına bir istek ve tam boyutlu çözme yerine tek
+// bir paket indirir: kısa bir ikili manifest + atlas PNG'si.
+//
+// Anahtar (ve HTTP ETag): hücre boyutu + her ikonun adı, boyutu ve değişme
+// zamanı. Dosyalar okunmadan hesaplanır; kısayollar değişmedikçe aynı paket
+// önbellekten döner.
+//
+// Paket biçimi (tüm alanlar little-endian):
+//
+// Başlık (20 bayt):
+//   0  u8   'L'
+//   1  u8   'A'
+//   2  u8   sürüm (1)
+//   3  u8   ayrılmış (0)
+//   4  u16  hücre kenarı (piksel)
+//   6  u16  ikon sayısı
+//   8  u16  atlas genişliği
+//   10 u16  atlas yüksekliği
+//   12 u32  PNG'nin paket içindeki konumu
+//   16 u32  PNG boyu (ikon yoksa 0)
+//
+// İkon (9 + ad uzunluğu bayt, başlıktan hemen sonra art arda):
+//   0  u16  x
+//   2  u16  y
+//   4  u16  genişlik (<= hücre, en-boy oranı korunur)
+//   6  u16  yükseklik
+//   8  u8   ad uzunluğu
+//   9  ...  ad (UTF-8, kısayolun "icon" alanı)
+//
+// PNG: RGBA atlas, ikonlar satır satır hücrelere yerleşir.
+// Çözülemeyen / bulunamayan ikonlar manifestte yer almaz; istemci onları
+// /icons/<ad> adresinden tek tek yükler.
+
+namespace iconatlas {
+
+constexpr uint8_t kMagic0 = 'L';
+constexpr uint8_t kMagic1 = 'A';
+constexpr uint8_t kVersion = 1;
+constexpr size_t kHeaderSize = 20;
+constexpr int kMinCell = 16;
+constexpr int kMaxCell = 512;
+// Atlas kenarı (çoğu mobil GPU'nun doku sınırının altında)
+constexpr int kMaxAtlasSide = 4096;
+
+} // namespace iconatlas
+
+struct AtlasResult {
+    std::string etag;   // 16 haneli hex
+    std::shared_ptr<const std::vector<uint8_t>> bundle;
+    int width = 0;      // Atlas PNG'si (piksel)
+    int height = 0;
+    size_t icons = 0;   // Manifestteki ikon
+    size_t skipped = 0; // Okunamayan / çözülemeyen / sığmayan ikon
+    bool cached = false;
+};
+
+class AtlasCache {
+public:
+    explicit AtlasCache(size_t budget) : entries_(budget) {}
+
+    // dir: ikon klasörü; names: sayfadaki ikon dosya adları (tekrarlar bir kez
+    // yerleştirilir); cell: hücre kenarı (piksel). Herhangi bir thread'den
+    // çağrılabilir; ağır iş kilit dışında yapılır.
+    bool Build(const std::string& dir, const std::vector<std::string>& names, int cell,
+               AtlasResult& result, std::string& error);
+
+    // Daha önce üretilmiş bir paketi ETag ile bul
+    bool Find(const std::string& etag, AtlasResult& result);
+
+private:
+    struct Entry {
+        std::shared_ptr<const std::vector<uint8_t>> bundle;
+        int width = 0;
+        int height = 0;
+        size_t icons = 0;
+        size_t skipped = 0;
+    };
+
+    std::mutex mutex_;
+    LruCache<std::string, Entry> entries_;
+};
+
+// Process genelindeki atlas önbelleği
+AtlasCache& DefaultAtlasCache();
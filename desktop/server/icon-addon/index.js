@@ -0,0 +1,19 @@
+const path = require('path');
+const addonPath = path.join(__dirname, 'build', 'Release', 'icon.node');
+
+let iconAddon = null;
+
+try {
+  iconAddon = require(addonPath);
+} catch (error) {
+  console.error('❌ Icon addon yüklenemedi:', error.message);
+  console.error('💡 Çözüm: cd desktop/server/icon-addon && npm install');
+  
+  // Fallback: atlas yok, istemci ikonları /icons/<ad> adresinden tek tek yükler
+  iconAddon = {
+    buildAtlas: () => Promise.reject(new Error('Icon addon yüklenemedi')),
+    getAtlas: () => null
+  };
+}
+
+module.exports = iconAddon;
@@ -9,33 +9,92 @@ const EventEmitter = require('events');
 const { spawn } = require('child_process');
 
 const discovery = require('./discovery');
+const log = require('./log');
+const metrics = require('./metrics');
+const PageStore = require('./page-store');
 
-// Volume addon yükleme (Windows ses kontrolü için)
+// Volume addon yükleme (Windows: WASAPI, Linux: PulseAudio ses kontrolü için)
 let volumeAddon = null;
 try {
   volumeAddon = require('./volume-addon');
-  console.log('✅ Volume addon yüklendi');
+  log.info('✅ Volume addon yüklendi');
+  if (volumeAddon.getEndpointInfo) {
+    const endpoint = volumeAddon.getEndpointInfo();
+    if (endpoint.ready) {
+      log.info('✅ Ses backend:', endpoint.backend, '|', endpoint.device);
+    } else {
+      log.warn('⚠️  Ses backend hazır değil:', endpoint.backend, '|', endpoint.error);
+    }
+  }
 } catch (error) {
-  console.error('❌ Volume addon yüklenemedi:', error.message);
-  console.error('💡 Çözüm: cd desktop/server/volume-addon && npm install');
+  log.error('❌ Volume addon yüklenemedi:', error.message);
+  log.error('💡 Çözüm: cd desktop/server/volume-addon && npm install');
 }
 
-// Media addon yükleme (Windows medya durumu için)
+// Media addon yükleme (medya durumu; Linux'ta MPRIS)
 let mediaAddon = null;
 try {
   mediaAddon = require('./media-addon');
-  console.log('✅ Media addon yüklendi');
+  log.info('✅ Media addon yüklendi');
+
+  if (mediaAddon.getMediaBackend) {
+    log.info(`🎵 Medya backend: ${mediaAddon.getMediaBackend().backend}`);
+  }
+} catch (error) {
+  log.error('❌ Media addon yüklenemedi:', error.message);
+  log.error('💡 Çözüm: cd desktop/server/media-addon && npm install');
+}
+
+// Capture addon yükleme
+// Linux: X11 MIT-SHM + XDamage ile native ekran yakalama
+// Windows + Linux: kaynak seçici küçük resim önbelleği (updateThumbnail)
+let captureAddon = null;
+try {
+  captureAddon = require('./capture-addon');
+  log.info(`✅ Capture addon yüklendi (${captureAddon.getCaptureBackend().backend})`);
+} catch (error) {
+  log.error('❌ Capture addon yüklenemedi:', error.message);
+  log.error('💡 Çözüm: cd desktop/server/capture-addon && npm install');
+}
+
+// Store addon yükleme (sayfa/kısayol deposu: op log + snapshot)
+// Yüklenemezse sayfalar pages.json'a tam yazılır
+let storeAddon = null;
+try {
+  storeAddon = require('./store-addon');
 } catch (error) {
-  console.error('❌ Media addon yüklenemedi:', error.message);
-  console.error('💡 Çözüm: cd desktop/server/media-addon && npm install');
+  log.error('❌ Store addon yüklenemedi:', error.message);
 }
 
+// Icon addon yükleme (sayfa başına ikon atlası: tek PNG + ikili manifest)
+// Yüklenemezse telefon ikonları /icons/<ad> adresinden tek tek yükler
+let iconAddon = null;
+try {
+  iconAddon = require('./icon-addon');
+} catch (error) {
+  log.error('❌ Icon addon yüklenemedi:', error.message);
+}
+
+// İkon atlası hücre boyutları (px). Telefon ikon boyutunu ister, en yakın büyük
+// boyut kullanılır; böylece sayfa başına en fazla birkaç atlas çeşidi olur.
+const ICON_ATLAS_CELLS = [64, 96, 128, 192, 256];
+const ICON_ATLAS_DEFAULT_CELL = 128;
+
+// Mobil "şimdi çalıyor" kutucuğu için kapak resmi boyutu (px, uzun kenar)
+const MEDIA_ART_SIZE = 256;
+// İndirilecek kapak resmi üst sınırı (bayt); media_art.cc kMaxSourceBytes ile aynı
+const MEDIA_ART_MAX_BYTES = 16 * 1024 * 1024;
+
+// Ses seviyesini ayarlayan istemciye, son komutundan bu kadar süre (ms) içinde
+// gelen volume-changed yankısı gönderilmez (slider kendi değerini zaten biliyor)
+const VOLUME_ECHO_WINDOW = 500;
+
 // RobotJS yükleme (opsiyonel - yüklenemezse graceful failure)
 let robot = null;
 try {
   robot = require('robotjs');
-  console.log('✅ RobotJS yüklendi (remote control aktif)');
-  console.log('✅ RobotJS functions:', {
+  log.info('✅ RobotJS yüklendi (remote control aktif)');
+  log.debug('✅ RobotJS functions:', {
     moveMouse: typeof robot.moveMouse,
     mouseClick: typeof robot.mouseClick,
     getScreenSize: typeof robot.getScreenSize
@@ -44,15 +103,15 @@ try {
   // Test: Screen size al
   try {
     const screenSize = robot.getScreenSize();
-    console.log('✅ RobotJS screen size:', screenSize);
+    log.info('✅ RobotJS screen size:', screenSize);
   } catch (testError) {
-    console.error('❌ RobotJS test failed:', testError.message);
+    log.error('❌ RobotJS test failed:', testError.message);
   }
 } catch (error) {
-  console.error('❌ RobotJS yüklenemedi, remote control devre dışı');
-  console.error('❌ Error:', error.message);
-  console.error('❌ Stack:', error.stack);
-  console.error('💡 Çözüm: npm rebuild robotjs komutunu çalıştırın');
+  log.error('❌ RobotJS yüklenemedi, remote control devre dışı');
+  log.error('❌ Error:', error.message);
+  log.debug('❌ Stack:', error.stack);
+  log.error('💡 Çözüm: npm rebuild robotjs komutunu çalıştırın');
 }
 
 class LocalDeskServer extends EventEmitter {
@@ -66,13 +125,21 @@ class LocalDeskServer extends EventEmitter {
     this.deviceId = null;
     this.deviceName = os.hostname();
     this.pages = []; // Artık shortcuts yerine pages kullanıyoruz
+    this.pageStore = null; // Sayfa kalıcılığı (bkz. page-store.js)
+    this.shortcutPages = new Map(); // String(shortcutId) -> page (execute-shortcut için)
+    this.iconAtlases = new Map(); // pageId -> { key, builds: Map(hücre -> Promise<etag|null>) }
     this.trustedDevices = [];
     this.connectedClients = new Map();
     this.pendingPairings = new Map();
     this.keyboardAddon = null;
+    this.pointer = null; // Native işaretçi hazırsa keyboardAddon (pointerMove/pointerButton/...)
+    this.preparedShortcuts = new Map(); // shortcutId -> { signature, handle } (native önbellek)
+    this.compiledMacros = new Map(); // shortcutId -> { signature, handle } (derlenmiş makrolar)
     this.robot = robot;
     this.activeSourceIds = new Map(); // socketId -> sourceId (seçilen ekran/pencere)
     this.activeScreenBounds = new Map(); // socketId -> { x, y, width, height } (seçilen ekranın bounds'ları)
+    this.mediaArt = { artUrl: '', pending: Promise.resolve(null) }; // Son kapak resmi (native önbellekteki ETag)
+    this.volumeOrigin = null; // { socketId, until } - yankısı kendisine gönderilmeyecek istemci
     
     // Veri dosyaları - build modunda kullanıcı veri dizinini kullan
     // Development modunda __dirname/data, production'da userData/data
@@ -86,23 +153,24 @@ class LocalDeskServer extends EventEmitter {
     this.trustedFile = path.join(this.dataDir, 'trusted.json');
     this.configFile = path.join(this.dataDir, 'config.json');
     
-    console.log('📁 Veri dizini:', this.dataDir);
+    log.info('📁 Veri dizini:', this.dataDir);
   }
 
   async start() {
-    console.log('🚀 Local Desk Server başlatılıyor...');
+    log.info('🚀 Local Desk Server başlatılıyor...');
     
     // Veri klasörünü oluştur
     await this.ensureDataDir();
     
+    // Klavye addon'unu yükle (Windows'ta)
+    // Sayfalardan önce yüklenir ki kısayollar yüklenirken hazırlanabilsin
+    this.loadKeyboardAddon();
+    
     // Konfigürasyonu yükle
     await this.loadConfig();
     await this.loadPages();
     await this.loadTrustedDevices();
     
-    // Klavye addon'unu yükle (Windows'ta)
-    this.loadKeyboardAddon();
-    
     // Express middleware
     this.app.use(express.json());
     this.app.use('/icons', express.static(path.join(this.dataDir, 'icons')));
@@ -123,6 +191,12 @@ class LocalDeskServer extends EventEmitter {
     
     this.setupSocketIO();
     
+    // Ses değişikliklerini istemcilere push et (mobil taraf /volume'u polling yapmasın)
+    this.startVolumeWatch();
+    
+    // Medya durumu değişikliklerini push et (native dinleyici, polling yok)
+    this.startMediaWatch();
+    
     // Server'ı başlat
     await new Promise((resolve, reject) => {
       this.server.listen(this.port, '0.0.0.0', (err) => {
@@ -133,25 +207,33 @@ class LocalDeskServer extends EventEmitter {
     
     // Yerel IP adreslerini göster
     const localIPs = discovery.getLocalIPAddresses();
-    console.log(`✅ HTTP/Socket.IO server çalışıyor: ${this.port}`);
-    console.log(`📡 Erişim adresleri:`);
-    console.log(`   - localhost:${this.port} (Bu bilgisayar)`);
+    log.info(`✅ HTTP/Socket.IO server çalışıyor: ${this.port}`);
+    log.info(`📡 Erişim adresleri:`);
+    log.info(`   - localhost:${this.port} (Bu bilgisayar)`);
     localIPs.forEach(ip => {
-      console.log(`   - ${ip}:${this.port} (Ağdan erişim)`);
+      log.info(`   - ${ip}:${this.port} (Ağdan erişim)`);
     });
     
     // Discovery servislerini başlat
     await discovery.start(this.port, this.deviceId, this.deviceName);
-    console.log('✅ UDP + mDNS discovery servisleri aktif');
+    log.info('✅ UDP + mDNS discovery servisleri aktif');
     
     return true;
   }
 
   async stop() {
-    console.log('🛑 Local Desk Server durduruluyor...');
+    log.info('🛑 Local Desk Server durduruluyor...');
     
     await discovery.stop();
     
+    if (volumeAddon && volumeAddon.unwatchVolume) {
+      volumeAddon.unwatchVolume();
+    }
+    
+    if (mediaAddon && mediaAddon.unwatchMedia) {
+      mediaAddon.unwatchMedia();
+    }
+    
     if (this.io) {
       this.io.close();
     }
@@ -162,7 +244,158 @@ class LocalDeskServer extends EventEmitter {
       });
     }
     
-    console.log('✅ Server durduruldu');
+    // Bekleyen sayfa yazımları diske ulaşsın
+    if (this.pageStore) {
+      await this.pageStore.close(this.pages);
+    }
+    
+    log.info('✅ Server durduruldu');
+  }
+
+  // Native taraf değişiklikleri birleştirip tek çağrıyla iletir; aynı değer tekrar gelmez
+  startVolumeWatch() {
+    if (!volumeAddon || !volumeAddon.watchVolume) {
+      return;
+    }
+    
+    try {
+      volumeAddon.watchVolume(({ volume, mute }) => {
+        if (!this.io) {
+          return;
+        }
+        // Değişikliği yapan istemci hariç herkese
+        const origin = this.volumeOrigin;
+        if (origin && Date.now() < origin.until) {
+          this.io.except(origin.socketId).emit('volume-changed', { volume, mute });
+        } else {
+          this.io.emit('volume-changed', { volume, mute });
+        }
+      });
+      log.info('✅ Ses değişiklikleri izleniyor (volume-changed)');
+    } catch (error) {
+      log.error('❌ Ses değişiklikleri izlenemedi:', error.message);
+    }
+  }
+
+  // Oynatıcı değişiklikleri native thread'de dinlenir, sadece değişince gelir
+  startMediaWatch() {
+    if (!mediaAddon || !mediaAddon.watchMedia) {
+      return;
+    }
+    
+    try {
+      mediaAddon.watchMedia(async (status) => {
+        const withArt = await this.attachMediaArt(status);
+        if (withArt && this.io) {
+          this.io.emit('media-changed', withArt);
+        }
+      });
+      log.info('✅ Medya durumu izleniyor (media-changed)');
+    } catch (error) {
+      log.error('❌ Medya durumu izlenemedi:', error.message);
+    }
+  }
+
+  // Kapak resmi native tarafta çözülüp küçültülür ve içerik hash'iyle önbelleğe alınır;
+  // istemciye sadece /media-art/<etag> adresi gider. Parça değişmedikçe yeniden işlenmez.
+  // Bu sırada kapak yine değiştiyse null döner (eski sonuç yeniyi ezmesin).
+  async attachMediaArt(status) {
+    const artUrl = status.artUrl || '';
+    if (artUrl !== this.mediaArt.artUrl) {
+      this.mediaArt = { artUrl, pending: this.renderMediaArt(artUrl) };
+    }
+
+    const current = this.mediaArt;
+    const etag = await current.pending;
+    if (current !== this.mediaArt) {
+      return null;
+    }
+    return { ...status, art: etag ? `/media-art/${etag}` : null };
+  }
+
+  // Kapak resmini işle, ETag'i döndür (hata olursa null)
+  async renderMediaArt(artUrl) {
+    if (!artUrl || !mediaAddon || !mediaAddon.renderArt) {
+      return null;
+    }
+
+    try {
+      const source = /^https?:\/\//i.test(artUrl) ? await this.fetchMediaArt(artUrl) : artUrl;
+      return (await mediaAddon.renderArt(source, MEDIA_ART_SIZE)).etag;
+    } catch (error) {
+      log.error('❌ Kapak resmi işlenemedi:', error.message);
+      return null;
+    }
+  }
+
+  // Uzak kapak resmi (ör. Spotify https URL'si) ham haliyle indirilir, işleme native'de.
+  // Gövde parça parça okunur; sınır aşılınca indirme kesilir (adres oynatıcıdan /
+  // web sayfasından gelir, yanıtın tamamı belleğe alınmaz)
+  async fetchMediaArt(url) {
+    const response = await fetch(url, { signal: AbortSignal.timeout(5000) });
+    if (!response.ok) {
+      throw new Error(`HTTP ${response.status}`);
+    }
+
+    const tooLarge = () => new Error(`Kapak resmi ${MEDIA_ART_MAX_BYTES} baytı aşıyor`);
+    const declared = Number(response.headers.get('content-length'));
+    if (declared > MEDIA_ART_MAX_BYTES) {
+      await response.body?.cancel();
+      throw tooLarge();
+    }
+
+    const chunks = [];
+    let total = 0;
+    if (response.body) {
+      for await (const chunk of response.body) {
+        total += chunk.length;
+        if (total > MEDIA_ART_MAX_BYTES) {
+          throw tooLarge(); // Döngüden çıkış akışı iptal eder
+        }
+        chunks.push(chunk);
+      }
+    }
+    return Buffer.concat(chunks, total);
+  }
+
+  // desktopCapturer kaynaklarını istemci listesine çevir (main process çağırır).
+  // Küçük resimler native önbellekte JPEG olarak tutulur, istemciye sadece
+  // /screen-thumbnails/<etag> adresi gider; içeriği değişmeyen kaynak yeniden
+  // kodlanmaz. Native önbellek yoksa eski davranış (PNG data URL).
+  buildScreenSources(sources, size) {
+    const toItem = (source, type) => ({
+      id: source.id,
+      name: source.name,
+      type,
+      thumbnail: this.screenThumbnail(source, size)
+    });
+
+    const screens = sources.filter(s => s.id.startsWith('screen:')).map(s => toItem(s, 'screen'));
+    const windows = sources.filter(s => s.id.startsWith('window:')).map(s => toItem(s, 'window'));
+
+    // Kapanan pencerelerin küçük resimlerini bırak
+    if (captureAddon && captureAddon.retainThumbnails) {
+      captureAddon.retainThumbnails(sources.map(s => s.id));
+    }
+    return { screens, windows };
+  }
+
+  screenThumbnail(source, size) {
+    const image = source.thumbnail;
+    if (!image || image.isEmpty()) {
+      return null; // Simge durumundaki pencerelerin küçük resmi boş gelir
+    }
+    if (!captureAddon || !captureAddon.updateThumbnail) {
+      return image.toDataURL();
+    }
+
+    const { width, height } = image.getSize();
+    const result = captureAddon.updateThumbnail(source.id, image.toBitmap(), width, height, size);
+    if (!result.success) {
+      log.error('❌ Küçük resim işlenemedi:', result.error);
+      return image.toDataURL();
+    }
+    return `/screen-thumbnails/${result.etag}`;
   }
 
   setupRoutes() {
@@ -199,10 +432,29 @@ class LocalDeskServer extends EventEmitter {
         // Fallback: boş liste
         res.json({ screens: [], windows: [] });
       } catch (error) {
-        console.error('❌ Screen sources hatası:', error);
+        log.error('❌ Screen sources hatası:', error);
         res.json({ screens: [], windows: [] });
       }
     });
+
+    // Kaynak küçük resmi (native önbellekten). Adres içerik hash'i olduğu için
+    // değişmez; kaynak değişince liste yeni bir adres verir.
+    this.app.get('/screen-thumbnails/:etag', (req, res) => {
+      const etag = `"${req.params.etag}"`;
+      res.set('Cache-Control', 'public, max-age=31536000, immutable');
+
+      if (req.headers['if-none-match'] === etag) {
+        return res.status(304).end();
+      }
+
+      const thumbnail = captureAddon && captureAddon.getThumbnail ? captureAddon.getThumbnail(req.params.etag) : null;
+      if (!thumbnail) {
+        return res.status(404).json({ success: false, error: 'Küçük resim bulunamadı' });
+      }
+
+      res.set('ETag', etag);
+      res.type('image/jpeg').send(thumbnail.data);
+    });
     
     // Seçilen ekran/pencere bilgisini al (sourceId'ye göre)
     this.app.get('/screen-info', async (req, res) => {
@@ -242,7 +494,7 @@ class LocalDeskServer extends EventEmitter {
           });
         }
       } catch (error) {
-        console.error('❌ Screen info hatası:', error);
+        log.error('❌ Screen info hatası:', error);
         // Fallback: Ana ekran boyutu
         let screenSize = { width: 1920, height: 1080 };
         if (this.robot) {
@@ -267,16 +519,12 @@ class LocalDeskServer extends EventEmitter {
     
     // Ses seviyesini al
     this.app.get('/volume', async (req, res) => {
-      if (process.platform !== 'win32') {
-        return res.json({ volume: 50, success: false });
-      }
-
       if (volumeAddon) {
         try {
           const result = volumeAddon.getVolume();
           return res.json({ volume: result.volume, success: result.success });
         } catch (error) {
-          console.error('❌ Volume addon hatası:', error.message);
+          log.error('❌ Volume addon hatası:', error.message);
         }
       }
       
@@ -286,10 +534,6 @@ class LocalDeskServer extends EventEmitter {
 
     // Ses seviyesini ayarla
     this.app.post('/volume', async (req, res) => {
-      if (process.platform !== 'win32') {
-        return res.json({ success: false, message: 'Sadece Windows destekleniyor' });
-      }
-
       const { volume } = req.body;
       if (typeof volume !== 'number' || volume < 0 || volume > 100) {
         return res.json({ success: false, message: 'Geçersiz ses seviyesi (0-100)' });
@@ -297,47 +541,109 @@ class LocalDeskServer extends EventEmitter {
 
       if (volumeAddon) {
         try {
-          const result = volumeAddon.setVolume(volume);
+          // Zamanlayıcı varsa sadece en yeni değer yazılır
+          const result = volumeAddon.scheduleVolume
+            ? volumeAddon.scheduleVolume(volume)
+            : volumeAddon.setVolume(volume);
           return res.json({ success: result.success, volume });
         } catch (error) {
-          console.error('❌ Volume addon hatası:', error.message);
+          log.error('❌ Volume addon hatası:', error.message);
         }
       }
       
       res.json({ success: false, message: 'Volume addon yüklenemedi' });
     });
 
-    // Medya durumu (Windows Media Control API ile - C++ addon)
+    // Uygulama başına ses oturumları (önbellekteki tablodan)
+    this.app.get('/audio-sessions', async (req, res) => {
+      if (volumeAddon && volumeAddon.getAudioSessions) {
+        try {
+          return res.json(volumeAddon.getAudioSessions());
+        } catch (error) {
+          log.error('❌ Volume addon hatası:', error.message);
+        }
+      }
+
+      res.json({ sessions: [], success: false });
+    });
+
+    // Kapak resmi (native önbellekten). ETag içerik hash'i olduğu için adres değişmez:
+    // istemci bir kez indirir, sonraki görüntülemelerde 304 veya kendi önbelleği kullanılır.
+    this.app.get('/media-art/:etag', (req, res) => {
+      const etag = `"${req.params.etag}"`;
+      res.set('Cache-Control', 'public, max-age=31536000, immutable');
+
+      if (req.headers['if-none-match'] === etag) {
+        return res.status(304).end();
+      }
+
+      const art = mediaAddon && mediaAddon.getArt ? mediaAddon.getArt(req.params.etag) : null;
+      if (!art) {
+        return res.status(404).json({ success: false, error: 'Kapak resmi bulunamadı' });
+      }
+
+      res.set('ETag', etag);
+      res.type('image/jpeg').send(art.data);
+    });
+
+    // Sayfanın ikon atlası paketi (bkz. icon-addon/icon_atlas.h). Adres sayfaya
+    // bağlı olduğu için her istekte doğrulanır; kısayollar değişmedikçe ETag aynı
+    // kalır ve 304 döner. ?cell=<px> istenen ikon boyutu.
+    this.app.get('/icon-atlas/:pageId', async (req, res) => {
+      const page = this.pages.find(p => p.id === req.params.pageId);
+      if (!page) {
+        return res.status(404).json({ success: false, error: 'Sayfa bulunamadı' });
+      }
+
+      const cell = this.iconAtlasCell(req.query.cell);
+      let etag = await this.iconAtlas(page, cell);
+      let atlas = etag ? iconAddon.getAtlas(etag) : null;
+      if (etag && !atlas) {
+        // Native önbellekten atılmış, yeniden üret
+        this.iconAtlases.get(page.id)?.builds.delete(cell);
+        etag = await this.iconAtlas(page, cell);
+        atlas = etag ? iconAddon.getAtlas(etag) : null;
+      }
+      if (!atlas) {
+        return res.status(404).json({ success: false, error: 'Bu sayfa için ikon atlası yok' });
+      }
+
+      const quoted = `"${etag}"`;
+      res.set('Cache-Control', 'no-cache');
+      res.set('ETag', quoted);
+      if (req.headers['if-none-match'] === quoted) {
+        return res.status(304).end();
+      }
+      res.type('application/octet-stream').send(atlas.data);
+    });
+
+    // Medya durumu (C++ addon'un önbelleğinden; Linux'ta MPRIS)
     this.app.get('/media-status', async (req, res) => {
+      // Native backend varsa durum zaten önbellekte, okumak maliyetsiz
+      const nativeBackend = mediaAddon && mediaAddon.getMediaBackend &&
+        mediaAddon.getMediaBackend().backend !== 'none';
+
+      if (nativeBackend) {
+        try {
+          const status = mediaAddon.getMediaStatus();
+          return res.json((await this.attachMediaArt(status)) || { ...status, art: null });
+        } catch (error) {
+          log.error('❌ Media addon hatası:', error.message);
+        }
+      }
+
       if (process.platform !== 'win32') {
         return res.json({
           isPlaying: false,
-          title: 'Sadece Windows destekleniyor',
+          title: 'Medya oynatıcı bulunamadı',
           artist: '',
           duration: 0,
           position: 0,
           success: false
         });
       }
-
-      // C++ addon ile medya durumunu al
-      if (mediaAddon) {
-        try {
-          const result = mediaAddon.getMediaStatus();
-          return res.json({
-            isPlaying: result.isPlaying,
-            title: result.title,
-            artist: result.artist,
-            duration: result.duration,
-            position: result.position,
-            success: result.success
-          });
-        } catch (error) {
-          console.error('❌ Media addon hatası:', error.message);
-        }
-      }
       
-      // Fallback: PowerShell script (eğer addon yüklenemediyse)
+      // Windows: native backend henüz yok, PowerShell script
       try {
         const { exec } = require('child_process');
         const { promisify } = require('util');
@@ -357,16 +663,16 @@ class LocalDeskServer extends EventEmitter {
               success: status.title !== 'Medya oynatıcı bulunamadı'
             });
           } catch (parseError) {
-            console.error('❌ Medya durumu parse hatası:', parseError);
-            console.error('❌ Raw output:', stdout);
+            log.error('❌ Medya durumu parse hatası:', parseError);
+            log.debug('❌ Raw output:', stdout);
           }
         }
         
         if (stderr) {
-          console.error('❌ PowerShell stderr:', stderr);
+          log.error('❌ PowerShell stderr:', stderr);
         }
       } catch (error) {
-        console.error('❌ Medya durumu alınamadı:', error.message);
+        log.error('❌ Medya durumu alınamadı:', error.message);
       }
       
       // Varsayılan değerler
@@ -397,21 +703,36 @@ class LocalDeskServer extends EventEmitter {
     this.app.get('/health', (req, res) => {
       res.json({ status: 'ok', timestamp: Date.now() });
     });
+
+    // Prometheus metrikleri: native çağrı süreleri/hataları ve process göstergeleri
+    this.app.get('/metrics', (req, res) => {
+      const memory = process.memoryUsage();
+      const body = metrics.render(
+        [this.keyboardAddon, volumeAddon, mediaAddon, captureAddon, storeAddon, iconAddon, discovery.addon],
+        [
+          { name: 'localdesk_connected_clients', help: 'Bağlı istemci sayısı', value: this.connectedClients.size },
+          { name: 'localdesk_process_resident_memory_bytes', help: 'Process RSS', value: memory.rss },
+          { name: 'localdesk_process_heap_used_bytes', help: 'V8 heap kullanımı', value: memory.heapUsed },
+          { name: 'localdesk_process_uptime_seconds', help: 'Process çalışma süresi', value: process.uptime() }
+        ]
+      );
+      res.type(metrics.CONTENT_TYPE).send(body);
+    });
   }
 
   setupSocketIO() {
     this.io.on('connection', (socket) => {
-      console.log('📱 Yeni bağlantı:', socket.id);
+      log.info('📱 Yeni bağlantı:', socket.id);
       
       // Pairing isteği
       socket.on('pair-request', async (data) => {
-        console.log('🔐 Pairing isteği alındı:', data);
+        log.info('🔐 Pairing isteği alındı:', data);
         const { deviceId, deviceName, deviceType } = data;
         
         // Aynı deviceId'den eski bağlantı var mı kontrol et
         for (const [existingSocketId, client] of this.connectedClients.entries()) {
           if (client.deviceId === deviceId) {
-            console.log('⚠️ Aynı cihazdan eski bağlantı bulundu, kapatılıyor:', existingSocketId);
+            log.info('⚠️ Aynı cihazdan eski bağlantı bulundu, kapatılıyor:', existingSocketId);
             if (client.socket && client.socket.connected) {
               client.socket.disconnect(true);
             }
@@ -422,16 +743,16 @@ class LocalDeskServer extends EventEmitter {
         // Zaten güvenilir mi?
         const trusted = this.trustedDevices.find(d => d.id === deviceId);
         if (trusted) {
-          console.log('✅ Güvenilir cihaz otomatik bağlanıyor:', deviceName);
+          log.info('✅ Güvenilir cihaz otomatik bağlanıyor:', deviceName);
           socket.emit('pair-response', { 
             success: true, 
             message: 'Zaten güvenilir cihaz',
             autoConnected: true 
           });
-          this.connectedClients.set(socket.id, { deviceId, deviceName, socket });
+          this.connectedClients.set(socket.id, { deviceId, deviceName, socket, trusted: true });
           
           // Sayfaları hemen gönder
-          console.log('📤 Sayfalar gönderiliyor (otomatik):', this.pages.length, 'adet');
+          log.info('📤 Sayfalar gönderiliyor (otomatik):', this.pages.length, 'adet');
           socket.emit('pages-update', this.pages);
           return;
         }
@@ -451,26 +772,32 @@ class LocalDeskServer extends EventEmitter {
       
       // Kısayol çalıştırma
       socket.on('execute-shortcut', (data) => {
-        console.log('⌨️ Kısayol çalıştırılıyor:', data);
+        log.debug('⌨️ Kısayol çalıştırılıyor:', data);
         const { shortcutId, keys, appPath, actionType, pageId } = data;
         
         // Cihaz güvenilir mi kontrol et
         const client = this.connectedClients.get(socket.id);
         if (!client) {
-          console.error('❌ Yetkisiz cihaz!');
+          log.error('❌ Yetkisiz cihaz!');
           socket.emit('error', { message: 'Yetkisiz cihaz' });
           return;
         }
         
         const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
         if (!trusted) {
-          console.error('❌ Güvenilir cihaz değil!');
+          log.error('❌ Güvenilir cihaz değil!');
           socket.emit('error', { message: 'Güvenilir cihaz değil' });
           return;
         }
         
-        console.log('✅ Cihaz doğrulandı:', client.deviceName);
-        console.log('📋 Eylem:', actionType, '| Keys:', keys, '| AppPath:', appPath, '| PageId:', pageId);
+        log.debug('✅ Cihaz doğrulandı:', client.deviceName);
+        log.debug('📋 Eylem:', actionType, '| Keys:', keys, '| AppPath:', appPath, '| PageId:', pageId);
+
+        // Zamanlı makro: adımlar istemciden değil sunucudaki sayfa verisinden derlenir
+        if (actionType === 'macro') {
+          this.executeMacro(socket, shortcutId);
+          return;
+        }
         
         // Sayfa bilgisini kontrol et (targetApp için)
         // Önce pageId ile, yoksa shortcutId'den page'i bul
@@ -480,250 +807,253 @@ class LocalDeskServer extends EventEmitter {
         if (pageId) {
           targetPage = this.pages.find(p => p.id === pageId);
         } else {
-          // pageId yoksa shortcutId'den page'i bul
-          for (const page of this.pages) {
-            const shortcut = page.shortcuts?.find(s => s.id === shortcutId);
-            if (shortcut) {
-              targetPage = page;
-              break;
-            }
-          }
+          // pageId yoksa shortcutId'den page'i bul (indeks, sayfalar taranmaz)
+          targetPage = this.shortcutPages.get(String(shortcutId)) || null;
         }
         
         if (targetPage && targetPage.targetApp) {
-          console.log('🎯 Hedef uygulama tespit edildi:', targetPage.targetApp, '| Page:', targetPage.name);
+          log.debug('🎯 Hedef uygulama tespit edildi:', targetPage.targetApp, '| Page:', targetPage.name);
           // Window handle'ı bul
           targetWindowHandle = this.findWindowHandle(targetPage.targetApp);
           if (targetWindowHandle) {
-            console.log('✅ Window handle bulundu:', targetWindowHandle);
+            log.debug('✅ Window handle bulundu:', targetWindowHandle);
           } else {
-            console.warn('⚠️ Hedef uygulama çalışmıyor veya bulunamadı:', targetPage.targetApp);
-            console.warn('⚠️ Global moda geçiliyor (aktif pencereye gönderilecek)');
+            log.warn('⚠️ Hedef uygulama çalışmıyor veya bulunamadı:', targetPage.targetApp);
+            log.warn('⚠️ Global moda geçiliyor (aktif pencereye gönderilecek)');
           }
         } else {
-          console.log('🌐 Hedef uygulama yok, global mod (aktif pencereye gönderilecek)');
+          log.debug('🌐 Hedef uygulama yok, global mod (aktif pencereye gönderilecek)');
         }
         
+        // Hedefli sayfalarda gönderim modu: 'focus' (varsayılan) veya 'background'
+        const deliveryMode = targetWindowHandle ? (targetPage.deliveryMode || 'focus') : null;
+        let keysDelivery = null;
+        
         // Eylem tipine göre çalıştır
         if (actionType === 'keys' || actionType === 'both') {
           // Klavye girdisini gönder
           if (keys && keys.length > 0) {
-            console.log('⌨️ Klavye tuşları gönderiliyor:', keys);
-            this.executeKeys(keys, targetWindowHandle);
+            log.debug('⌨️ Klavye tuşları gönderiliyor:', keys);
+            keysDelivery = this.executeKeys(keys, targetWindowHandle, shortcutId, deliveryMode);
           } else {
-            console.warn('⚠️ Keys boş, klavye girdisi atlanıyor');
+            log.warn('⚠️ Keys boş, klavye girdisi atlanıyor');
           }
         }
         
         if (actionType === 'app' || actionType === 'both') {
           // Uygulamayı başlat
           if (appPath) {
-            console.log('🚀 Uygulama başlatılıyor:', appPath);
+            log.debug('🚀 Uygulama başlatılıyor:', appPath);
             this.launchApp(appPath);
           } else {
-            console.warn('⚠️ AppPath boş, uygulama başlatma atlanıyor');
+            log.warn('⚠️ AppPath boş, uygulama başlatma atlanıyor');
           }
         }
         
-        socket.emit('execute-result', { success: true, shortcutId });
+        if (keysDelivery) {
+          // accepted: hedef pencere girdiyi kabul etti mi (arka plan modunda
+          // hedef kapanmış veya yükseltilmiş olabilir; focus modunda hedef
+          // odaklanamadıysa tuşlar hiç gönderilmemiştir)
+          keysDelivery.then((accepted) => {
+            socket.emit('execute-result', { success: true, shortcutId, accepted, deliveryMode });
+          });
+        } else {
+          socket.emit('execute-result', { success: true, shortcutId });
+        }
+      });
+      
+      // Çalışan makroyu iptal et (basılı tuşlar bırakılır)
+      socket.on('cancel-macro', (data) => {
+        if (!this.isTrustedSocket(socket.id)) return;
+        const compiled = this.compiledMacros.get(String(data?.shortcutId));
+        if (compiled && this.keyboardAddon) {
+          this.keyboardAddon.cancelMacro(compiled.handle);
+        }
       });
       
       // WebRTC signaling - Remote Screen için
       socket.on('webrtc-offer', async (data) => {
-        console.log('📹 WebRTC offer alındı, socket:', socket.id);
-        console.log('📹 Offer data:', data);
+        log.debug('📹 WebRTC offer alındı, socket:', socket.id);
+        log.debug('📹 Offer data:', data);
         
         const client = this.connectedClients.get(socket.id);
         if (!client) {
-          console.error('❌ Client not found in connectedClients!');
+          log.error('❌ Client not found in connectedClients!');
           socket.emit('error', { message: 'Yetkisiz cihaz' });
           return;
         }
         
-        console.log('✅ Client authenticated:', client.deviceName);
+        log.debug('✅ Client authenticated:', client.deviceName);
+
+        // Yeni oturum: ikili girdi sırası baştan başlar; destek varsa bildir
+        client.inputSequence = undefined;
+        socket.emit('input-capabilities', { inputFrame: this.pointer && this.pointer.dispatchInputFrame ? 1 : 0 });
         
         // Offer'ı main process'e ilet (desktopCapturer için)
-        console.log('📹 Emitting webrtc-offer to main process');
-        console.log('📹 Source ID from mobile:', data.sourceId);
+        log.debug('📹 Emitting webrtc-offer to main process');
+        log.debug('📹 Source ID from mobile:', data.sourceId);
         this.emit('webrtc-offer', { 
           socketId: socket.id, 
           offer: data.offer, 
           deviceId: client.deviceId,
           sourceId: data.sourceId // Seçilen ekran/pencere ID'si
         });
-        console.log('✅ webrtc-offer emitted to main process');
+        log.debug('✅ webrtc-offer emitted to main process');
       });
 
       socket.on('webrtc-answer', (data) => {
-        console.log('📹 WebRTC answer alındı:', socket.id);
+        log.debug('📹 WebRTC answer alındı:', socket.id);
         // Answer'ı main process'e ilet
         this.emit('webrtc-answer', { socketId: socket.id, answer: data.answer });
       });
 
       socket.on('webrtc-ice-candidate', (data) => {
-        console.log('📹 WebRTC ICE candidate alındı:', socket.id);
+        log.debug('📹 WebRTC ICE candidate alındı:', socket.id);
         // ICE candidate'ı main process'e ilet
         this.emit('webrtc-ice-candidate', { socketId: socket.id, candidate: data.candidate });
       });
 
       // Remote Screen kontrolü - Mouse
+      // Hareketler dokunma hızında gelir: event başına log yok. Native işaretçi hazırsa
+      // hareketler ekran karesi başına birleştirilir; tuş ve tekerlek eventleri sırayla
+      // gider (bekleyen hareket önce uygulanır). Hazır değilse RobotJS kullanılır.
+      const buttonMap = { left: 'left', right: 'right', middle: 'middle', 0: 'left', 1: 'middle', 2: 'right' };
+
       socket.on('remote-mouse-move', (data) => {
-        const client = this.connectedClients.get(socket.id);
-        if (!client) {
-          console.warn('⚠️ remote-mouse-move: Client not found');
-          return;
-        }
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) {
-          console.warn('⚠️ remote-mouse-move: Device not trusted');
-          return;
+        if (!this.isTrustedSocket(socket.id)) return;
+        if (typeof data.x !== 'number' || typeof data.y !== 'number') return;
+
+        try {
+          const { x, y } = this.getScreenCoordinates(socket.id, data.x, data.y);
+          if (this.pointer) {
+            this.pointer.pointerMove(x, y);
+          } else if (this.robot) {
+            this.robot.moveMouse(x, y);
+          }
+        } catch (error) {
+          log.error('❌ Mouse move hatası:', error.message);
         }
-        
-        console.log('🖱️ remote-mouse-move received:', { x: data.x, y: data.y });
-        console.log('🖱️ RobotJS available?', !!this.robot);
-        
-        // RobotJS ile mouse move
-        if (this.robot && typeof data.x === 'number' && typeof data.y === 'number') {
-          try {
-            // Seçilen ekran/pencere için koordinatları hesapla
-            const { x: screenX, y: screenY } = this.getScreenCoordinates(socket.id, data.x, data.y);
-            console.log('🖱️ Moving mouse to:', { screenX, screenY, normalized: { x: data.x, y: data.y } });
-            this.robot.moveMouse(screenX, screenY);
-            console.log('✅ Mouse moved successfully');
-          } catch (error) {
-            console.error('❌ Mouse move hatası:', error.message);
-            console.error('❌ Error stack:', error.stack);
+      });
+
+      // Göreli hareket (touchpad modu): dx, dy piksel
+      socket.on('remote-mouse-move-by', (data) => {
+        if (!this.isTrustedSocket(socket.id)) return;
+        if (typeof data.dx !== 'number' || typeof data.dy !== 'number') return;
+
+        try {
+          if (this.pointer) {
+            this.pointer.pointerMoveBy(data.dx, data.dy);
+          } else if (this.robot) {
+            const position = this.robot.getMousePos();
+            this.robot.moveMouse(Math.round(position.x + data.dx), Math.round(position.y + data.dy));
           }
-        } else {
-          console.warn('⚠️ RobotJS not available or invalid coordinates');
-          console.warn('⚠️ RobotJS:', this.robot);
-          console.warn('⚠️ Data:', data);
+        } catch (error) {
+          log.error('❌ Mouse move hatası:', error.message);
         }
       });
 
       socket.on('remote-mouse-click', (data) => {
-        console.log('🖱️ remote-mouse-click received:', data);
-        const client = this.connectedClients.get(socket.id);
-        if (!client) {
-          console.warn('⚠️ remote-mouse-click: Client not found');
-          return;
-        }
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) {
-          console.warn('⚠️ remote-mouse-click: Device not trusted');
-          return;
-        }
-        
-        console.log('🖱️ RobotJS available?', !!this.robot);
-        
-        // RobotJS ile mouse click
-        if (this.robot) {
-          try {
-            // Seçilen ekran/pencere için koordinatları hesapla
-            const { x: screenX, y: screenY } = this.getScreenCoordinates(socket.id, data.x, data.y);
-            
-            console.log('🖱️ Clicking at:', { screenX, screenY, normalized: { x: data.x, y: data.y }, button: data.button });
-            
-            // Önce mouse'u hareket ettir
-            this.robot.moveMouse(screenX, screenY);
-            
-            // Click (button: 'left', 'right', 'middle')
-            const buttonMap = { left: 'left', right: 'right', middle: 'middle', 0: 'left', 1: 'middle', 2: 'right' };
-            const robotButton = buttonMap[data.button] || 'left';
-            
-            this.robot.mouseClick(robotButton);
-            console.log(`✅ Mouse click: ${robotButton} at (${screenX}, ${screenY})`);
-          } catch (error) {
-            console.error('❌ Mouse click hatası:', error.message);
-            console.error('❌ Error stack:', error.stack);
+        if (!this.isTrustedSocket(socket.id)) return;
+        const button = buttonMap[data.button] || 'left';
+
+        try {
+          // Seçilen ekran/pencere için koordinatları hesapla
+          const { x, y } = this.getScreenCoordinates(socket.id, data.x, data.y);
+          if (this.pointer) {
+            this.pointer.pointerMove(x, y);
+            this.pointer.pointerButton(button, true);
+            this.pointer.pointerButton(button, false);
+          } else if (this.robot) {
+            this.robot.moveMouse(x, y);
+            this.robot.mouseClick(button);
+          } else {
+            log.warn('⚠️ Mouse click: işaretçi backend\'i yok');
           }
-        } else {
-          console.warn('⚠️ RobotJS not available for mouse click');
+        } catch (error) {
+          log.error('❌ Mouse click hatası:', error.message);
         }
       });
 
       socket.on('remote-mouse-scroll', (data) => {
-        const client = this.connectedClients.get(socket.id);
-        if (!client) return;
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) return;
-        
-        // RobotJS ile scroll
-        if (this.robot) {
-          try {
-            // RobotJS scrollMouse(x, y) - x: horizontal, y: vertical
-            // Pozitif değerler yukarı/sağa, negatif değerler aşağı/sola kaydırır
-            const scrollAmount = Math.round(-data.deltaY / 10); // Normalize scroll amount
-            this.robot.scrollMouse(0, scrollAmount);
-            console.log(`🖱️ Mouse scroll: ${scrollAmount}`);
-          } catch (error) {
-            console.error('❌ Mouse scroll hatası:', error.message);
+        if (!this.isTrustedSocket(socket.id)) return;
+
+        // Çentik sayısı; pozitif değerler yukarı/sağa, negatif değerler aşağı/sola kaydırır
+        const scrollY = Math.round(-(data.deltaY || 0) / 10);
+        const scrollX = Math.round((data.deltaX || 0) / 10);
+
+        try {
+          if (this.pointer) {
+            this.pointer.pointerScroll(scrollX, scrollY);
+          } else if (this.robot) {
+            this.robot.scrollMouse(scrollX, scrollY);
           }
+        } catch (error) {
+          log.error('❌ Mouse scroll hatası:', error.message);
         }
       });
 
-      // Mouse button down (sürükleme için)
-      socket.on('remote-mouse-button-down', (data) => {
-        const client = this.connectedClients.get(socket.id);
-        if (!client) return;
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) return;
-        
-        if (this.robot) {
-          try {
-            // Seçilen ekran/pencere için koordinatları hesapla
-            const { x: screenX, y: screenY } = this.getScreenCoordinates(socket.id, data.x, data.y);
-            
-            // Mouse'u hareket ettir
-            this.robot.moveMouse(screenX, screenY);
-            
-            // Button down (button: 'left', 'right', 'middle')
-            const buttonMap = { left: 'left', right: 'right', middle: 'middle', 0: 'left', 1: 'middle', 2: 'right' };
-            const robotButton = buttonMap[data.button] || 'left';
-            
-            // RobotJS'de mouseToggle kullan (down = true)
-            this.robot.mouseToggle('down', robotButton);
-            console.log(`🖱️ Mouse button down: ${robotButton} at (${screenX}, ${screenY})`);
-          } catch (error) {
-            console.error('❌ Mouse button down hatası:', error.message);
+      // Mouse button down/up (sürükleme için)
+      const handleMouseButton = (data, down) => {
+        if (!this.isTrustedSocket(socket.id)) return;
+        const button = buttonMap[data.button] || 'left';
+
+        try {
+          // Seçilen ekran/pencere için koordinatları hesapla
+          const { x, y } = this.getScreenCoordinates(socket.id, data.x, data.y);
+          if (this.pointer) {
+            this.pointer.pointerMove(x, y);
+            this.pointer.pointerButton(button, down);
+          } else if (this.robot) {
+            this.robot.moveMouse(x, y);
+            this.robot.mouseToggle(down ? 'down' : 'up', button);
           }
+        } catch (error) {
+          log.error(`❌ Mouse button ${down ? 'down' : 'up'} hatası:`, error.message);
         }
-      });
+      };
+
+      socket.on('remote-mouse-button-down', (data) => handleMouseButton(data, true));
+      socket.on('remote-mouse-button-up', (data) => handleMouseButton(data, false));
+
+      // İkili girdi çerçevesi (bkz. keyboard-addon/input_frame.h)
+      // Çok sayıda fare/tuş eventi tek mesajda gelir; Buffer native tarafta
+      // kopyalanmadan çözülür ve doğrudan enjeksiyon kuyruklarına bırakılır.
+      // Sadece native işaretçi hazırsa desteklenir (input-capabilities).
+      socket.on('remote-input', (frame) => {
+        if (!this.isTrustedSocket(socket.id)) return;
+        if (!this.pointer || !Buffer.isBuffer(frame)) return;
 
-      // Mouse button up (sürükleme bitişi için)
-      socket.on('remote-mouse-button-up', (data) => {
         const client = this.connectedClients.get(socket.id);
-        if (!client) return;
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) return;
-        
-        if (this.robot) {
-          try {
-            // Seçilen ekran/pencere için koordinatları hesapla
-            const { x: screenX, y: screenY } = this.getScreenCoordinates(socket.id, data.x, data.y);
-            
-            // Mouse'u hareket ettir
-            this.robot.moveMouse(screenX, screenY);
-            
-            // Button up (button: 'left', 'right', 'middle')
-            const buttonMap = { left: 'left', right: 'right', middle: 'middle', 0: 'left', 1: 'middle', 2: 'right' };
-            const robotButton = buttonMap[data.button] || 'left';
-            
-            // RobotJS'de mouseToggle kullan (up = false)
-            this.robot.mouseToggle('up', robotButton);
-            console.log(`🖱️ Mouse button up: ${robotButton} at (${screenX}, ${screenY})`);
-          } catch (error) {
-            console.error('❌ Mouse button up hatası:', error.message);
+        try {
+          const result = this.pointer.dispatchInputFrame(frame, {
+            bounds: this.getScreenBounds(socket.id),
+            lastSequence: client.inputSequence
+          });
+          if (result.success) {
+            client.inputSequence = result.sequence;
+          } else if (!result.stale) {
+            log.warn('⚠️ Girdi çerçevesi reddedildi:', result.error);
           }
+        } catch (error) {
+          log.error('❌ Girdi çerçevesi hatası:', error.message);
         }
       });
 
       // Remote Screen kontrolü - Keyboard
       socket.on('remote-keyboard-input', (data) => {
-        const client = this.connectedClients.get(socket.id);
-        if (!client) return;
-        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
-        if (!trusted) return;
+        if (!this.isTrustedSocket(socket.id)) return;
+        
+        // Metin girişi: native addon tüm metni tek toplu iş olarak yazar
+        if (data.text && this.keyboardAddon && this.keyboardAddon.typeText) {
+          this.keyboardAddon.typeText(String(data.text))
+            .then(({ typed, skipped }) => {
+              log.debug(`⌨️ Keyboard text: ${typed} karakter${skipped ? ` (${skipped} atlandı)` : ''}`);
+            })
+            .catch((error) => {
+              log.error('❌ Keyboard input hatası:', error.message);
+            });
+          return;
+        }
         
         // RobotJS ile keyboard input
         if (this.robot) {
@@ -731,7 +1061,7 @@ class LocalDeskServer extends EventEmitter {
             if (data.text) {
               // Metin girişi
               this.robot.typeString(data.text);
-              console.log(`⌨️ Keyboard text: ${data.text}`);
+              log.debug(`⌨️ Keyboard text: ${data.text}`);
             } else if (data.keys && data.keys.length > 0) {
               // Özel tuşlar (modifier + key)
               // Format: ['control', 'c'] gibi
@@ -749,11 +1079,11 @@ class LocalDeskServer extends EventEmitter {
               
               if (mainKey) {
                 this.robot.keyTap(mainKey, modifiers);
-                console.log(`⌨️ Keyboard keys: ${modifiers.join('+')}+${mainKey}`);
+                log.debug(`⌨️ Keyboard keys: ${modifiers.join('+')}+${mainKey}`);
               }
             }
           } catch (error) {
-            console.error('❌ Keyboard input hatası:', error.message);
+            log.error('❌ Keyboard input hatası:', error.message);
           }
         }
       });
@@ -765,7 +1095,7 @@ class LocalDeskServer extends EventEmitter {
         const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
         if (!trusted) return;
         
-        console.log('🎵 Media control:', data.action);
+        log.debug('🎵 Media control:', data.action);
         
         if (this.robot) {
           try {
@@ -844,11 +1174,11 @@ class LocalDeskServer extends EventEmitter {
               
               if (mainKey) {
                 this.robot.keyTap(mainKey, modifiers);
-                console.log(`🎵 Media control: ${modifiers.join('+')}+${mainKey} (${data.action})`);
+                log.debug(`🎵 Media control: ${modifiers.join('+')}+${mainKey} (${data.action})`);
               }
             }
           } catch (error) {
-            console.error('❌ Media control hatası:', error.message);
+            log.error('❌ Media control hatası:', error.message);
           }
         }
       });
@@ -860,53 +1190,97 @@ class LocalDeskServer extends EventEmitter {
         const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
         if (!trusted) return;
         
-        console.log('🔊 Volume control:', data.action, data.value);
+        // Slider sürüklenirken saniyede onlarca 'set' gelir, her birini loglama
+        if (data.action !== 'set') {
+          log.debug('🔊 Volume control:', data.action, data.value);
+        }
         
-        if (process.platform === 'win32') {
-          try {
-            if (data.action === 'set' && typeof data.value === 'number') {
-              // Ses seviyesini ayarla (C++ addon ile)
-              if (volumeAddon) {
-                const result = volumeAddon.setVolume(data.value);
-                if (result.success) {
-                  console.log(`🔊 Ses seviyesi ayarlandı: ${data.value}%`);
-                } else {
-                  console.error('❌ Ses seviyesi ayarlanamadı');
-                }
-              } else {
-                console.error('❌ Volume addon yüklenemedi');
-              }
-            } else if (data.action === 'up' || data.action === 'down') {
-              // Ses seviyesini artır/azalt (RobotJS ile tuş basma)
-              if (this.robot) {
-                const key = data.action === 'up' ? 'volumeup' : 'volumedown';
-                this.robot.keyTap(key);
-                console.log(`🔊 Ses seviyesi ${data.action === 'up' ? 'artırıldı' : 'azaltıldı'}`);
+        try {
+          if (data.action === 'set' && typeof data.value === 'number') {
+            // Ses seviyesini ayarla (C++ addon ile)
+            // scheduleVolume: native thread son değeri yazar, aradaki değerler atlanır
+            if (volumeAddon) {
+              this.volumeOrigin = { socketId: socket.id, until: Date.now() + VOLUME_ECHO_WINDOW };
+              const result = volumeAddon.scheduleVolume
+                ? volumeAddon.scheduleVolume(data.value)
+                : volumeAddon.setVolume(data.value);
+              if (!result.success) {
+                log.error('❌ Ses seviyesi ayarlanamadı');
               }
-            } else if (data.action === 'mute') {
-              // Sesi kapat/aç (C++ addon ile)
-              if (volumeAddon) {
-                // Önce mevcut mute durumunu al
-                const muteStatus = volumeAddon.getMute();
-                const newMuteState = !muteStatus.mute; // Toggle
-                const result = volumeAddon.setMute(newMuteState);
-                if (result.success) {
-                  console.log(`🔊 Ses ${newMuteState ? 'kapatıldı' : 'açıldı'}`);
-                }
-              } else if (this.robot) {
-                // Fallback: RobotJS ile
-                this.robot.keyTap('volumemute');
-                console.log('🔊 Ses kapatıldı/açıldı');
+            } else {
+              log.error('❌ Volume addon yüklenemedi');
+            }
+          } else if (data.action === 'fade' && typeof data.value === 'number') {
+            // Yumuşak geçiş: { value, duration (ms), curve: 'linear' | 'log' }
+            if (volumeAddon && volumeAddon.fadeTo) {
+              const duration = typeof data.duration === 'number' ? data.duration : 500;
+              const curve = data.curve === 'log' ? 'log' : 'linear';
+              // Geçiş boyunca ara değerler de bu istemciye yansıtılmaz
+              this.volumeOrigin = { socketId: socket.id, until: Date.now() + duration + VOLUME_ECHO_WINDOW };
+              const completed = await volumeAddon.fadeTo(data.value, duration, curve);
+              log.debug(`🔊 Ses geçişi ${completed ? 'tamamlandı' : 'iptal edildi'}: ${data.value}%`);
+            } else {
+              log.error('❌ Volume addon yüklenemedi');
+            }
+          } else if (data.action === 'up' || data.action === 'down') {
+            // Ses seviyesini artır/azalt (RobotJS ile tuş basma)
+            if (this.robot) {
+              const key = data.action === 'up' ? 'volumeup' : 'volumedown';
+              this.robot.keyTap(key);
+              log.debug(`🔊 Ses seviyesi ${data.action === 'up' ? 'artırıldı' : 'azaltıldı'}`);
+            }
+          } else if (data.action === 'mute') {
+            // Sesi kapat/aç (C++ addon ile)
+            if (volumeAddon) {
+              // Önce mevcut mute durumunu al
+              const muteStatus = volumeAddon.getMute();
+              const newMuteState = !muteStatus.mute; // Toggle
+              const result = volumeAddon.setMute(newMuteState);
+              if (result.success) {
+                log.debug(`🔊 Ses ${newMuteState ? 'kapatıldı' : 'açıldı'}`);
               }
+            } else if (this.robot) {
+              // Fallback: RobotJS ile
+              this.robot.keyTap('volumemute');
+              log.debug('🔊 Ses kapatıldı/açıldı');
             }
-          } catch (error) {
-            console.error('❌ Ses kontrolü hatası:', error.message);
           }
+        } catch (error) {
+          log.error('❌ Ses kontrolü hatası:', error.message);
+        }
+      });
+
+      // Uygulama başına ses: { app, action: 'set' | 'mute' | 'fade', value, duration, curve }
+      socket.on('remote-app-volume', async (data) => {
+        const client = this.connectedClients.get(socket.id);
+        if (!client) return;
+        const trusted = this.trustedDevices.find(d => d.id === client.deviceId);
+        if (!trusted) return;
+        if (!volumeAddon || !volumeAddon.setAppVolume || typeof data.app !== 'string') return;
+
+        try {
+          let success = false;
+          if (data.action === 'set' && typeof data.value === 'number') {
+            success = volumeAddon.setAppVolume(data.app, data.value).success;
+          } else if (data.action === 'mute') {
+            // value verilmezse toggle
+            const mute = typeof data.value === 'boolean' ? data.value : !volumeAddon.getAppVolume(data.app).mute;
+            success = volumeAddon.setAppMute(data.app, mute).success;
+            log.debug(`🔊 ${data.app} ${mute ? 'sessize alındı' : 'sesi açıldı'}`);
+          } else if (data.action === 'fade' && typeof data.value === 'number') {
+            const duration = typeof data.duration === 'number' ? data.duration : 500;
+            const curve = data.curve === 'log' ? 'log' : 'linear';
+            success = await volumeAddon.fadeAppTo(data.app, data.value, duration, curve);
+            log.debug(`🔊 ${data.app} ses geçişi ${success ? 'tamamlandı' : 'iptal edildi'}: ${data.value}%`);
+          }
+          socket.emit('app-volume-result', { app: data.app, action: data.action, success });
+        } catch (error) {
+          log.error('❌ Uygulama sesi hatası:', error.message);
         }
       });
 
       socket.on('disconnect', () => {
-        console.log('📴 Bağlantı kesildi:', socket.id);
+        log.info('📴 Bağlantı kesildi:', socket.id);
         this.connectedClients.delete(socket.id);
         // Seçilen sourceId'yi temizle
         this.activeSourceIds.delete(socket.id);
@@ -919,64 +1293,74 @@ class LocalDeskServer extends EventEmitter {
   // Seçilen ekran bounds'larını ayarla (main.js'den çağrılır)
   setActiveScreenBounds(socketId, bounds) {
     this.activeScreenBounds.set(socketId, bounds);
-    console.log('📹 Active screen bounds set for socket:', socketId, bounds);
+    log.debug('📹 Active screen bounds set for socket:', socketId, bounds);
   }
 
-  // Seçilen ekran/pencere için koordinatları hesapla
-  getScreenCoordinates(socketId, normalizedX, normalizedY) {
+  // Socket eşleşmiş ve güvenilir bir cihaza mı ait
+  // Güven bilgisi bağlantı kaydında tutulur (event başına trustedDevices taranmaz);
+  // cihaz güvenilirlerden çıkarılınca removeTrustedDevice bayrağı kaldırır.
+  isTrustedSocket(socketId) {
+    const client = this.connectedClients.get(socketId);
+    return !!client && client.trusted === true;
+  }
+
+  // Seçilen ekranın/pencerenin sanal masaüstü bounds'ları
+  getScreenBounds(socketId) {
     const bounds = this.activeScreenBounds.get(socketId);
-    
     if (bounds) {
-      // Seçilen ekranın koordinat sistemine göre hesapla
-      const screenX = Math.round(bounds.x + (normalizedX * bounds.width));
-      const screenY = Math.round(bounds.y + (normalizedY * bounds.height));
-      return { x: screenX, y: screenY };
-    } else {
-      // Fallback: Ana ekran (RobotJS getScreenSize)
-      const screenSize = this.robot.getScreenSize();
-      const screenX = Math.round(normalizedX * screenSize.width);
-      const screenY = Math.round(normalizedY * screenSize.height);
-      return { x: screenX, y: screenY };
+      return bounds;
     }
+
+    // Fallback: Ana ekran (RobotJS getScreenSize)
+    const screenSize = this.robot ? this.robot.getScreenSize() : { width: 1920, height: 1080 };
+    return { x: 0, y: 0, width: screenSize.width, height: screenSize.height };
+  }
+
+  // Seçilen ekran/pencere için koordinatları hesapla
+  getScreenCoordinates(socketId, normalizedX, normalizedY) {
+    const bounds = this.getScreenBounds(socketId);
+    const screenX = Math.round(bounds.x + (normalizedX * bounds.width));
+    const screenY = Math.round(bounds.y + (normalizedY * bounds.height));
+    return { x: screenX, y: screenY };
   }
 
   // WebRTC signaling için helper metodlar
   sendWebRTCOffer(socketId, offer) {
-    console.log('📹 sendWebRTCOffer called for socket:', socketId);
+    log.debug('📹 sendWebRTCOffer called for socket:', socketId);
     const socket = this.io.sockets.sockets.get(socketId);
     if (socket) {
-      console.log('✅ Socket found, emitting webrtc-offer to mobile');
+      log.debug('✅ Socket found, emitting webrtc-offer to mobile');
       socket.emit('webrtc-offer', { offer });
-      console.log('✅ webrtc-offer emitted');
+      log.debug('✅ webrtc-offer emitted');
     } else {
-      console.error('❌ Socket not found for ID:', socketId);
+      log.error('❌ Socket not found for ID:', socketId);
     }
   }
 
   sendWebRTCAnswer(socketId, answer) {
-    console.log('📹 sendWebRTCAnswer called for socket:', socketId);
-    console.log('📹 Answer type:', answer?.type);
+    log.debug('📹 sendWebRTCAnswer called for socket:', socketId);
+    log.debug('📹 Answer type:', answer?.type);
     const socket = this.io.sockets.sockets.get(socketId);
     if (socket) {
-      console.log('✅ Socket found, emitting webrtc-answer to mobile');
-      console.log('📹 Socket connected?', socket.connected);
+      log.debug('✅ Socket found, emitting webrtc-answer to mobile');
+      log.debug('📹 Socket connected?', socket.connected);
       socket.emit('webrtc-answer', { answer });
-      console.log('✅ webrtc-answer emitted to mobile successfully');
+      log.debug('✅ webrtc-answer emitted to mobile successfully');
     } else {
-      console.error('❌ Socket not found for ID:', socketId);
-      console.error('❌ Available sockets:', Array.from(this.io.sockets.sockets.keys()));
+      log.error('❌ Socket not found for ID:', socketId);
+      log.error('❌ Available sockets:', Array.from(this.io.sockets.sockets.keys()));
     }
   }
 
   sendWebRTCICECandidate(socketId, candidate) {
-    console.log('📹 sendWebRTCICECandidate called for socket:', socketId);
+    log.debug('📹 sendWebRTCICECandidate called for socket:', socketId);
     const socket = this.io.sockets.sockets.get(socketId);
     if (socket) {
-      console.log('✅ Socket found, emitting webrtc-ice-candidate to mobile');
+      log.debug('✅ Socket found, emitting webrtc-ice-candidate to mobile');
       socket.emit('webrtc-ice-candidate', { candidate });
-      console.log('✅ webrtc-ice-candidate emitted');
+      log.debug('✅ webrtc-ice-candidate emitted');
     } else {
-      console.error('❌ Socket not found for ID:', socketId);
+      log.error('❌ Socket not found for ID:', socketId);
     }
   }
 
@@ -1010,11 +1394,12 @@ class LocalDeskServer extends EventEmitter {
         this.connectedClients.set(pairing.socket.id, {
           deviceId,
           deviceName: pairing.deviceName,
-          socket: pairing.socket
+          socket: pairing.socket,
+          trusted: true
         });
         
         // Sayfaları gönder (Socket.IO ile)
-        console.log('📤 Sayfalar gönderiliyor:', this.pages.length, 'adet');
+        log.info('📤 Sayfalar gönderiliyor:', this.pages.length, 'adet');
         pairing.socket.emit('pages-update', this.pages);
       }
       
@@ -1034,57 +1419,217 @@ class LocalDeskServer extends EventEmitter {
     }
   }
 
-  executeKeys(keys, targetWindowHandle = null) {
-    console.log('🔍 executeKeys çağrıldı, gelen tuşlar:', keys);
-    console.log('🔍 Addon durumu:', this.keyboardAddon ? 'Yüklü ✅' : 'Yüklü değil ❌');
-    console.log('🔍 Hedef pencere:', targetWindowHandle || 'Global (aktif pencere)');
+  executeKeys(keys, targetWindowHandle = null, shortcutId = null, deliveryMode = null) {
+    log.debug('🔍 executeKeys çağrıldı, gelen tuşlar:', keys);
+    log.debug('🔍 Addon durumu:', this.keyboardAddon ? 'Yüklü ✅' : 'Yüklü değil ❌');
+    log.debug('🔍 Hedef pencere:', targetWindowHandle || 'Global (aktif pencere)');
     
     if (!this.keyboardAddon) {
-      console.warn('⚠️  Klavye addon yüklenmedi, simüle edilecek:', keys);
-      return;
+      log.warn('⚠️  Klavye addon yüklenmedi, simüle edilecek:', keys);
+      return Promise.resolve(false);
     }
     
+    // Addon işi native enjeksiyon thread'ine bırakır ve Promise döndürür,
+    // event loop tuşlar gönderilirken bloklanmaz
+    // Kısayol önceden hazırlandıysa native tamponu doğrudan ateşle
+    const prepared = this.getPreparedShortcut(shortcutId, keys);
+    
+    let pending;
     try {
-      if (targetWindowHandle) {
-        // Belirli bir pencereye gönder (focus olmadan)
-        console.log('🎯 Belirli pencereye tuşlar gönderiliyor:', keys, '→ HWND:', targetWindowHandle);
-        this.keyboardAddon.sendKeysToWindow(targetWindowHandle, keys);
-        console.log('✅ Klavye girdisi belirli pencereye gönderildi:', keys);
+      if (prepared) {
+        pending = targetWindowHandle
+          ? this.keyboardAddon.fireShortcutToWindow(prepared.handle, targetWindowHandle, deliveryMode || 'focus')
+          : this.keyboardAddon.fireShortcut(prepared.handle);
+      } else if (targetWindowHandle) {
+        // Belirli bir pencereye gönder ('background' modunda pencere öne getirilmez)
+        log.debug('🎯 Belirli pencereye tuşlar gönderiliyor:', keys, '→ HWND:', targetWindowHandle, '| Mod:', deliveryMode || 'focus');
+        pending = this.keyboardAddon.sendKeysToWindow(targetWindowHandle, keys, deliveryMode || 'focus');
       } else {
         // Global olarak gönder (aktif pencereye)
-        console.log('🌐 Global klavye tuşları gönderiliyor:', keys);
-        this.keyboardAddon.sendKeys(keys);
-        console.log('✅ Klavye girdisi gönderildi:', keys);
+        log.debug('🌐 Global klavye tuşları gönderiliyor:', keys);
+        pending = this.keyboardAddon.sendKeys(keys);
       }
     } catch (error) {
-      console.error('❌ Klavye girdisi hatası:', error);
-      console.error('❌ Hata detayı:', error.stack);
+      log.error('❌ Klavye girdisi hatası:', error);
+      log.error('❌ Hata detayı:', error.stack);
+      return Promise.resolve(false);
     }
+    
+    return Promise.resolve(pending)
+      .then((accepted) => {
+        if (accepted === false) {
+          log.warn('⚠️ Hedef pencere girdiyi kabul etmedi:', keys);
+          return false;
+        }
+        log.debug('✅ Klavye girdisi gönderildi:', keys);
+        return true;
+      })
+      .catch((error) => {
+        log.error('❌ Klavye girdisi hatası:', error);
+        log.error('❌ Hata detayı:', error.stack);
+        return false;
+      });
+  }
+
+  // Tüm sayfalardaki kısayolları native tarafta önceden derle
+  // (tuş çözümleme ve tampon oluşturma her basışta tekrarlanmaz)
+  prepareShortcuts() {
+    if (!this.keyboardAddon || !this.keyboardAddon.prepareShortcut) {
+      return;
+    }
+    
+    const previous = this.preparedShortcuts;
+    const next = new Map();
+    
+    for (const page of this.pages) {
+      for (const shortcut of page.shortcuts || []) {
+        if (!Array.isArray(shortcut.keys) || shortcut.keys.length === 0) {
+          continue;
+        }
+        
+        const id = String(shortcut.id);
+        const signature = shortcut.keys.join('+');
+        const existing = previous.get(id);
+        
+        // Tuşları değişmeyen kısayolun handle'ını koru
+        if (existing && existing.signature === signature) {
+          next.set(id, existing);
+          previous.delete(id);
+          continue;
+        }
+        
+        try {
+          next.set(id, { signature, handle: this.keyboardAddon.prepareShortcut(shortcut.keys) });
+        } catch (error) {
+          log.warn('⚠️ Kısayol hazırlanamadı:', shortcut.label, error.message);
+        }
+      }
+    }
+    
+    // Artık kullanılmayan handle'ları serbest bırak
+    for (const entry of previous.values()) {
+      this.keyboardAddon.releaseShortcut(entry.handle);
+    }
+    
+    this.preparedShortcuts = next;
+  }
+  
+  // actionType 'macro' olan kısayolların adımlarını native makro motorunda derle
+  // Adımlar: { type: 'down' | 'up', key }, { type: 'chord', keys }, { type: 'delay', ms },
+  // { type: 'text', text, interval? }, { type: 'repeat', count, steps }
+  prepareMacros() {
+    if (!this.keyboardAddon || !this.keyboardAddon.compileMacro) {
+      return;
+    }
+    
+    const previous = this.compiledMacros;
+    const next = new Map();
+    
+    for (const page of this.pages) {
+      for (const shortcut of page.shortcuts || []) {
+        if (shortcut.actionType !== 'macro' || !Array.isArray(shortcut.macro)) {
+          continue;
+        }
+        
+        const id = String(shortcut.id);
+        const signature = JSON.stringify(shortcut.macro);
+        const existing = previous.get(id);
+        
+        if (existing && existing.signature === signature) {
+          next.set(id, existing);
+          previous.delete(id);
+          continue;
+        }
+        
+        try {
+          next.set(id, { signature, handle: this.keyboardAddon.compileMacro(shortcut.macro) });
+        } catch (error) {
+          log.warn('⚠️ Makro derlenemedi:', shortcut.label, error.message);
+        }
+      }
+    }
+    
+    // Çalışan kopyalar bitene kadar native tarafta yaşar
+    for (const entry of previous.values()) {
+      this.keyboardAddon.releaseMacro(entry.handle);
+    }
+    
+    this.compiledMacros = next;
+  }
+  
+  // Makroyu çalıştır; ilerleme macro-progress, sonuç execute-result ile bildirilir
+  executeMacro(socket, shortcutId) {
+    const compiled = this.compiledMacros.get(String(shortcutId));
+    if (!compiled) {
+      log.warn('⚠️ Makro bulunamadı veya derlenemedi:', shortcutId);
+      socket.emit('execute-result', { success: false, shortcutId, error: 'Makro bulunamadı' });
+      return;
+    }
+    
+    this.keyboardAddon.runMacro(compiled.handle, (done, total) => {
+      socket.emit('macro-progress', { shortcutId, done, total });
+    })
+      .then((result) => {
+        log.debug(`✅ Makro ${result.cancelled ? 'iptal edildi' : 'tamamlandı'}:`, shortcutId,
+          `(${result.elapsedMs.toFixed(1)} ms, en kötü gecikme ${result.maxLateUs.toFixed(0)} µs)`);
+        socket.emit('execute-result', { success: result.completed, shortcutId, cancelled: result.cancelled });
+      })
+      .catch((error) => {
+        log.error('❌ Makro hatası:', error.message);
+        socket.emit('execute-result', { success: false, shortcutId, error: error.message });
+      });
+  }
+  
+  getPreparedShortcut(shortcutId, keys) {
+    if (shortcutId === null || shortcutId === undefined || !Array.isArray(keys)) {
+      return null;
+    }
+    
+    const prepared = this.preparedShortcuts.get(String(shortcutId));
+    // İstemcideki tuşlar farklıysa (eski sayfa verisi) önbelleği kullanma
+    if (!prepared || prepared.signature !== keys.join('+')) {
+      return null;
+    }
+    
+    return prepared;
   }
 
   findWindowHandle(targetAppExe) {
     if (!this.keyboardAddon || !this.keyboardAddon.getWindowList) {
-      console.warn('⚠️  getWindowList fonksiyonu yok');
+      log.warn('⚠️  getWindowList fonksiyonu yok');
       return null;
     }
     
+    // Native pencere indeksi çalışıyorsa O(1) arama (masaüstü taranmaz)
+    if (this.keyboardAddon.findWindowByExe && this.keyboardAddon.isWindowIndexRunning()) {
+      try {
+        const handle = this.keyboardAddon.findWindowByExe(targetAppExe);
+        if (!handle) {
+          log.warn('⚠️ Eşleşen pencere bulunamadı:', targetAppExe);
+        }
+        return handle;
+      } catch (error) {
+        log.error('❌ findWindowByExe hatası:', error);
+      }
+    }
+    
     try {
       const windows = this.keyboardAddon.getWindowList();
-      console.log('🔍 Toplam pencere sayısı:', windows.length);
+      log.debug('🔍 Toplam pencere sayısı:', windows.length);
       
       // targetAppExe ile eşleşen ilk pencereyi bul (case-insensitive)
       const targetExeLower = targetAppExe.toLowerCase();
       const matchedWindow = windows.find(w => w.exeName.toLowerCase() === targetExeLower);
       
       if (matchedWindow) {
-        console.log('✅ Eşleşen pencere bulundu:', matchedWindow.title, '|', matchedWindow.exeName);
+        log.debug('✅ Eşleşen pencere bulundu:', matchedWindow.title, '|', matchedWindow.exeName);
         return matchedWindow.hwnd;
       }
       
-      console.warn('⚠️ Eşleşen pencere bulunamadı:', targetAppExe);
+      log.warn('⚠️ Eşleşen pencere bulunamadı:', targetAppExe);
       return null;
     } catch (error) {
-      console.error('❌ findWindowHandle hatası:', error);
+      log.error('❌ findWindowHandle hatası:', error);
       return null;
     }
   }
@@ -1097,25 +1642,25 @@ class LocalDeskServer extends EventEmitter {
     try {
       return this.keyboardAddon.getWindowList();
     } catch (error) {
-      console.error('❌ getWindowList hatası:', error);
+      log.error('❌ getWindowList hatası:', error);
       return [];
     }
   }
 
   launchApp(appPath) {
     try {
-      console.log('🚀 Uygulama başlatılıyor:', appPath);
+      log.debug('🚀 Uygulama başlatılıyor:', appPath);
       
       // Dosya var mı kontrol et
       const fsSync = require('fs');
       if (!fsSync.existsSync(appPath)) {
-        console.error('❌ Uygulama bulunamadı:', appPath);
+        log.error('❌ Uygulama bulunamadı:', appPath);
         return;
       }
       
       // Çalışma dizinini belirle (uygulamanın bulunduğu klasör)
       const workingDir = path.dirname(appPath);
-      console.log('📁 Çalışma dizini:', workingDir);
+      log.debug('📁 Çalışma dizini:', workingDir);
       
       const isWindows = process.platform === 'win32';
       
@@ -1126,15 +1671,15 @@ class LocalDeskServer extends EventEmitter {
         const { exec } = require('child_process');
         const command = `start "" "${appPath}"`;
         
-        console.log('📝 Komut:', command);
+        log.debug('📝 Komut:', command);
         
         exec(command, { cwd: workingDir }, (error, stdout, stderr) => {
           if (error) {
-            console.error('❌ Uygulama başlatma hatası:', error.message);
+            log.error('❌ Uygulama başlatma hatası:', error.message);
             // stderr genelde Türkçe karakter içerebilir, gösterme
             return;
           }
-          console.log('✅ Uygulama başlatıldı (Windows start komutu)');
+          log.debug('✅ Uygulama başlatıldı (Windows start komutu)');
         });
       } else {
         // Linux/Mac: spawn kullan
@@ -1145,34 +1690,55 @@ class LocalDeskServer extends EventEmitter {
         });
         
         child.on('error', (err) => {
-          console.error('❌ Uygulama başlatma hatası:', err.message);
+          log.error('❌ Uygulama başlatma hatası:', err.message);
         });
         
         child.unref();
-        console.log('✅ Uygulama başlatıldı (spawn)');
+        log.debug('✅ Uygulama başlatıldı (spawn)');
       }
       
     } catch (error) {
-      console.error('❌ Uygulama başlatma hatası:', error.message);
+      log.error('❌ Uygulama başlatma hatası:', error.message);
     }
   }
 
   loadKeyboardAddon() {
-    if (process.platform !== 'win32') {
-      console.log('⚠️  Klavye addon sadece Windows\'ta destekleniyor');
+    if (process.platform !== 'win32' && process.platform !== 'linux') {
+      log.info('⚠️  Klavye addon sadece Windows ve Linux\'ta destekleniyor');
       return;
     }
     
     try {
       const addonPath = './keyboard-addon/build/Release/keyboard';
-      console.log('🔍 Addon yükleniyor:', addonPath);
+      log.info('🔍 Addon yükleniyor:', addonPath);
       this.keyboardAddon = require(addonPath);
-      console.log('✅ Klavye addon başarıyla yüklendi');
-      console.log('✅ sendKeys fonksiyonu:', typeof this.keyboardAddon.sendKeys);
+      log.info('✅ Klavye addon başarıyla yüklendi');
+      log.info('✅ sendKeys fonksiyonu:', typeof this.keyboardAddon.sendKeys);
+      
+      // Linux'ta uinput sanal klavyesi oluşturulamadıysa nedenini göster
+      if (this.keyboardAddon.getBackendInfo) {
+        const backend = this.keyboardAddon.getBackendInfo();
+        if (backend.ready) {
+          log.info('✅ Klavye backend:', backend.backend, backend.devicePath || '');
+        } else {
+          log.warn('⚠️  Klavye backend hazır değil:', backend.backend, '-', backend.error);
+        }
+      }
+
+      // Fare: uinput mutlak işaretçi (Linux) / SendInput (Windows); yoksa RobotJS
+      if (this.keyboardAddon.getPointerInfo) {
+        const pointer = this.keyboardAddon.getPointerInfo();
+        if (pointer.ready) {
+          this.pointer = this.keyboardAddon;
+          log.info('✅ İşaretçi backend:', pointer.backend, pointer.devicePath || '', `(${pointer.frameRate} Hz)`);
+        } else {
+          log.warn('⚠️  İşaretçi backend hazır değil, RobotJS kullanılacak:', pointer.error);
+        }
+      }
     } catch (error) {
-      console.warn('⚠️  Klavye addon yüklenemedi:', error.message);
-      console.error('❌ Hata detayı:', error.stack);
-      console.log('   npm run rebuild ile yeniden derlemeyi deneyin');
+      log.warn('⚠️  Klavye addon yüklenemedi:', error.message);
+      log.error('❌ Hata detayı:', error.stack);
+      log.info('   npm run rebuild ile yeniden derlemeyi deneyin');
     }
   }
 
@@ -1181,7 +1747,7 @@ class LocalDeskServer extends EventEmitter {
       await fs.mkdir(this.dataDir, { recursive: true });
       await fs.mkdir(path.join(this.dataDir, 'icons'), { recursive: true });
     } catch (error) {
-      console.error('Veri klasörü oluşturulamadı:', error);
+      log.error('Veri klasörü oluşturulamadı:', error);
     }
   }
 
@@ -1208,16 +1774,36 @@ class LocalDeskServer extends EventEmitter {
 
   async loadPages() {
     try {
-      // Önce yeni formatta kontrol et
-      try {
-        const data = await fs.readFile(this.pagesFile, 'utf8');
-        this.pages = JSON.parse(data);
-        console.log(`✅ ${this.pages.length} sayfa yüklendi`);
+      // Önce sayfa deposu (store-addon)
+      this.pageStore = new PageStore(storeAddon, this.dataDir, this.pagesFile);
+      this.pageStore.open();
+      
+      // pages.json varsa depodan yenidir (ilk kurulum veya depo kullanılamazken yazıldı)
+      const json = await this.pageStore.readJson();
+      if (json) {
+        this.pages = json;
+        log.info(`✅ ${this.pages.length} sayfa yüklendi`);
+        if (this.pageStore.enabled) {
+          // Depoya aktar; sonraki düzenlemeler sadece değişen kayıtları yazar
+          await this.savePages(this.pages);
+          await this.pageStore.retireJson();
+          log.info('✅ pages.json sayfa deposuna aktarıldı');
+        } else {
+          this.pagesChanged();
+        }
+        return;
+      }
+      
+      const stored = this.pageStore.enabled ? this.pageStore.load() : await this.pageStore.restoreBackup();
+      if (stored) {
+        this.pages = stored;
+        log.info(`✅ ${this.pages.length} sayfa yüklendi (${this.pageStore.enabled ? 'depo' : 'yedek'})`);
+        this.pagesChanged();
         return;
-      } catch (e) {
-        // pages.json bulunamadı, eski shortcuts.json'dan migrate et
       }
       
+      // pages.json ve depo yok: eski shortcuts.json'dan migrate et
+      
       // Eski shortcuts.json'u kontrol et
       const oldShortcutsFile = path.join(this.dataDir, 'shortcuts.json');
       try {
@@ -1233,7 +1819,7 @@ class LocalDeskServer extends EventEmitter {
           }
         ];
         
-        console.log(`✅ Eski format tespit edildi, ${oldShortcuts.length} kısayol migrate edildi`);
+        log.info(`✅ Eski format tespit edildi, ${oldShortcuts.length} kısayol migrate edildi`);
         await this.savePages(this.pages);
         
         // Eski dosyayı yedekle
@@ -1277,24 +1863,119 @@ class LocalDeskServer extends EventEmitter {
         }
       ];
       await this.savePages(this.pages);
-      console.log('✅ Varsayılan sayfa oluşturuldu');
+      log.info('✅ Varsayılan sayfa oluşturuldu');
     } catch (error) {
-      console.error('Sayfa yükleme hatası:', error);
+      log.error('Sayfa yükleme hatası:', error);
       this.pages = [];
     }
   }
 
+  // Tüm diziyi yaz (içe aktarma, saveShortcuts); düzenlemeler commitPages kullanır
   async savePages(pages) {
     this.pages = pages;
-    await fs.writeFile(this.pagesFile, JSON.stringify(pages, null, 2));
+    return this.commitPages(this.pageStore.replaceOps(pages));
+  }
+  
+  // Düzenlemeden sonra: sadece değişen kayıtlar yazılır (bkz. page-store.js)
+  async commitPages(ops) {
+    this.pagesChanged();
+    await this.pageStore.save(this.pages, ops);
     
     // Tüm bağlı istemcilere güncellemeyi gönder (eğer server başlatıldıysa)
     if (this.io) {
-      this.io.emit('pages-update', pages);
+      this.io.emit('pages-update', this.pages);
     }
     
     return { success: true };
   }
+  
+  // Native önbellekler ve kısayol indeksi sayfalarla eşitlenir
+  pagesChanged() {
+    this.prepareShortcuts();
+    this.prepareMacros();
+    
+    // Aynı id birden fazla sayfadaysa ilk sayfa (eski doğrusal taramayla aynı)
+    const index = new Map();
+    for (const page of this.pages) {
+      for (const shortcut of page.shortcuts || []) {
+        const id = String(shortcut.id);
+        if (!index.has(id)) {
+          index.set(id, page);
+        }
+      }
+    }
+    this.shortcutPages = index;
+    
+    // İkonları değişen sayfaların atlasları, istenmiş boyutlarda yeniden üretilir
+    const atlases = new Map();
+    for (const page of this.pages) {
+      const entry = this.iconAtlases.get(page.id);
+      if (!entry) {
+        continue;
+      }
+      if (entry.key === this.iconAtlasKey(page)) {
+        atlases.set(page.id, entry);
+        continue;
+      }
+      for (const cell of entry.builds.keys()) {
+        this.iconAtlas(page, cell, atlases);
+      }
+    }
+    this.iconAtlases = atlases;
+  }
+  
+  // Atlasa girecek ikon dosyaları (emoji ve çözülemeyen biçimler hariç)
+  iconAtlasFiles(page) {
+    return (page.shortcuts || [])
+      .map(shortcut => shortcut.icon)
+      .filter(icon => typeof icon === 'string' && /\.(png|jpe?g)$/i.test(icon));
+  }
+  
+  iconAtlasKey(page) {
+    return this.iconAtlasFiles(page).join('\n');
+  }
+  
+  iconAtlasCell(requested) {
+    const size = parseInt(requested, 10);
+    if (!Number.isFinite(size)) {
+      return ICON_ATLAS_DEFAULT_CELL;
+    }
+    return ICON_ATLAS_CELLS.find(cell => cell >= size) || ICON_ATLAS_CELLS[ICON_ATLAS_CELLS.length - 1];
+  }
+  
+  // Sayfanın atlas ETag'i (yoksa null). Aynı sayfa + boyut için üretim bir kez
+  // yapılır; kısayolların ikonları değişene kadar aynı Promise kullanılır.
+  iconAtlas(page, cell, atlases = this.iconAtlases) {
+    const key = this.iconAtlasKey(page);
+    let entry = atlases.get(page.id);
+    if (!entry || entry.key !== key) {
+      entry = { key, builds: new Map() };
+      atlases.set(page.id, entry);
+    }
+    
+    if (!entry.builds.has(cell)) {
+      entry.builds.set(cell, this.buildIconAtlas(this.iconAtlasFiles(page), cell));
+    }
+    return entry.builds.get(cell);
+  }
+  
+  async buildIconAtlas(names, cell) {
+    if (!iconAddon || !iconAddon.buildAtlas || names.length === 0) {
+      return null;
+    }
+    
+    try {
+      const atlas = await iconAddon.buildAtlas(path.join(this.dataDir, 'icons'), names, cell);
+      if (!atlas.cached) {
+        log.debug(`🖼️  İkon atlası: ${atlas.icons} ikon, ${atlas.width}x${atlas.height}, ${atlas.bytes} bayt` +
+          (atlas.skipped ? ` (${atlas.skipped} ikon atlandı)` : ''));
+      }
+      return atlas.icons > 0 ? atlas.etag : null;
+    } catch (error) {
+      log.error('❌ İkon atlası üretilemedi:', error.message);
+      return null;
+    }
+  }
 
   // Geriye uyumluluk için shortcuts kaydetme
   async saveShortcuts(shortcuts) {
@@ -1310,7 +1991,7 @@ class LocalDeskServer extends EventEmitter {
     try {
       const data = await fs.readFile(this.trustedFile, 'utf8');
       this.trustedDevices = JSON.parse(data);
-      console.log(`✅ ${this.trustedDevices.length} güvenilir cihaz yüklendi`);
+      log.info(`✅ ${this.trustedDevices.length} güvenilir cihaz yüklendi`);
     } catch (error) {
       this.trustedDevices = [];
     }
@@ -1322,6 +2003,11 @@ class LocalDeskServer extends EventEmitter {
 
   async removeTrustedDevice(deviceId) {
     this.trustedDevices = this.trustedDevices.filter(d => d.id !== deviceId);
+    for (const client of this.connectedClients.values()) {
+      if (client.deviceId === deviceId) {
+        client.trusted = false;
+      }
+    }
     await this.saveTrustedDevices();
     return { success: true };
   }
@@ -1348,7 +2034,7 @@ class LocalDeskServer extends EventEmitter {
       try {
         screenSize = this.robot.getScreenSize();
       } catch (error) {
-        console.warn('⚠️ Could not get screen size:', error.message);
+        log.warn('⚠️ Could not get screen size:', error.message);
       }
     }
     
@@ -1397,23 +2083,24 @@ class LocalDeskServer extends EventEmitter {
     const targetPath = path.join(iconsDir, uniqueFileName);
     await fs.copyFile(sourcePath, targetPath);
     
-    console.log('✅ İkon kopyalandı:', uniqueFileName);
+    log.info('✅ İkon kopyalandı:', uniqueFileName);
     
     // Sadece dosya adını döndür (URL için)
     return uniqueFileName;
   }
 
   // Sayfa yönetimi metodları
-  async addPage(name, icon, targetApp) {
+  async addPage(name, icon, targetApp, deliveryMode) {
     const newPage = {
       id: 'page-' + Date.now(),
       name: name || 'Yeni Sayfa',
       icon: icon || undefined,
       targetApp: targetApp || undefined,
+      deliveryMode: targetApp && deliveryMode === 'background' ? 'background' : undefined,
       shortcuts: []
     };
     this.pages.push(newPage);
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.addPageOps(this.pages, newPage));
     return newPage;
   }
 
@@ -1423,7 +2110,17 @@ class LocalDeskServer extends EventEmitter {
       return { success: false, message: 'Sayfa bulunamadı' };
     }
     page.targetApp = targetApp || undefined;
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.pageOps(page));
+    return { success: true, page };
+  }
+
+  async updatePageDeliveryMode(pageId, deliveryMode) {
+    const page = this.pages.find(p => p.id === pageId);
+    if (!page) {
+      return { success: false, message: 'Sayfa bulunamadı' };
+    }
+    page.deliveryMode = deliveryMode === 'background' ? 'background' : undefined;
+    await this.commitPages(this.pageStore.pageOps(page));
     return { success: true, page };
   }
 
@@ -1433,7 +2130,7 @@ class LocalDeskServer extends EventEmitter {
       return { success: false, message: 'Sayfa bulunamadı' };
     }
     page.name = newName;
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.pageOps(page));
     return { success: true, page };
   }
 
@@ -1443,8 +2140,13 @@ class LocalDeskServer extends EventEmitter {
       return { success: false, message: 'Son sayfa silinemez' };
     }
     
+    const page = this.pages.find(p => p.id === pageId);
+    if (!page) {
+      return { success: true };
+    }
+    
     this.pages = this.pages.filter(p => p.id !== pageId);
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.removePageOps(this.pages, page));
     return { success: true };
   }
 
@@ -1456,7 +2158,7 @@ class LocalDeskServer extends EventEmitter {
     
     shortcut.id = shortcut.id || Date.now();
     page.shortcuts.push(shortcut);
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.shortcutOps(page, shortcut));
     return { success: true, shortcut };
   }
 
@@ -1472,7 +2174,7 @@ class LocalDeskServer extends EventEmitter {
     }
     
     page.shortcuts[index] = { ...updatedShortcut, id: shortcutId };
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.shortcutOps(page, page.shortcuts[index]));
     return { success: true, shortcut: page.shortcuts[index] };
   }
 
@@ -1483,7 +2185,7 @@ class LocalDeskServer extends EventEmitter {
     }
     
     page.shortcuts = page.shortcuts.filter(s => s.id !== shortcutId);
-    await this.savePages(this.pages);
+    await this.commitPages(this.pageStore.removeShortcutOps(page, shortcutId));
     return { success: true };
   }
 
@@ -1504,10 +2206,8 @@ class LocalDeskServer extends EventEmitter {
     const remainingShortcuts = page.shortcuts.filter(s => !remainingIds.has(s.id));
     
     page.shortcuts = [...reorderedShortcuts, ...remainingShortcuts];
-    await this.savePages(this.pages);
-    
-    // Tüm bağlı istemcilere güncellenmiş sayfaları gönder
-    this.io.emit('pages-update', this.pages);
+    // Sadece sayfa kaydı (kısayol sırası) yazılır; commitPages istemcilere de gönderir
+    await this.commitPages(this.pageStore.pageOps(page));
     
     return { success: true, shortcuts: page.shortcuts };
   }
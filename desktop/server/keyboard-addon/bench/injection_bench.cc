@@ -0,0 +1,242 @@
+// Enjeksiyon yolu benchmark'ı (test backend'i ile)
+// Addon'daki yolu JS olmadan taklit eder: tuş isimleri keytable ile çözülür, iş
+// MpscQueue ile worker thread'e verilir (InjectionWorker ile aynı uyandırma
+// protokolü), worker işi recording backend'ine yazar ve tamamlanmayı üreticiye
+// bildirir. Gecikme: çözümlemeden tamamlanmanın görülmesine kadar.
+//
+// Senaryolar: tek basış (worker her seferinde uyur), burst (art arda N basış)
+// ve çok üretici (birden fazla istemci thread'i aynı kuyruğa yazar).
+//
+// Derleme: node-gyp rebuild (build/Release/injection_bench)
+// Çalıştırma: ./build/Release/injection_bench [basış sayısı]
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../keytable.h"
+#include "../mpsc_queue.h"
+
+namespace {
+
+constexpr size_t kMaxChord = 4;
+
+// Deck kısayollarında tipik akorlar
+const char* const kChords[][kMaxChord] = {
+    { "CONTROL", "S", nullptr, nullptr },
+    { "ALT", "F4", nullptr, nullptr },
+    { "CONTROL", "SHIFT", "ESCAPE", nullptr },
+    { "MEDIAPLAYPAUSE", nullptr, nullptr, nullptr },
+    { "WIN", "D", nullptr, nullptr },
+};
+
+constexpr size_t kChordCount = sizeof(kChords) / sizeof(kChords[0]);
+
+struct BenchJob : MpscNode {
+    const keytable::KeyEntry* keys[kMaxChord];
+    size_t keyCount = 0;
+    int64_t startNs = 0;
+    std::atomic<int64_t> doneNs{0}; // TSFN tamamlanmasının yerine
+};
+
+testbackend::Recorder recorder;
+
+// InjectionWorker::Run ile aynı döngü (uyuyan worker sadece gerektiğinde uyandırılır)
+class BenchWorker {
+public:
+    void Start() {
+        thread_ = std::thread([this]() { Run(); });
+    }
+
+    void Stop() {
+        stopping_.store(true);
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakeCv_.notify_one();
+        }
+        thread_.join();
+    }
+
+    void Enqueue(BenchJob* job) {
+        queue_.Push(job);
+        if (sleeping_.exchange(false)) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakeCv_.notify_one();
+        }
+    }
+
+private:
+    void Run() {
+        while (!stopping_.load()) {
+            MpscNode* node = queue_.Pop();
+            if (node != nullptr) {
+                Process(static_cast<BenchJob*>(node));
+                continue;
+            }
+            if (!queue_.Empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            sleeping_.store(true);
+            if (!queue_.Empty()) {
+                sleeping_.store(false);
+                continue;
+            }
+            wakeCv_.wait(lock, [this]() { return !sleeping_.load() || stopping_.load(); });
+        }
+    }
+
+    // keyboard.cc RecordJob ile aynı kayıt şekli
+    void Process(BenchJob* job) {
+        for (size_t i = 0; i < job->keyCount; i++) {
+            recorder.Record("down", job->keys[i]->name);
+        }
+        for (size_t i = job->keyCount; i-- > 0;) {
+            recorder.Record("up", job->keys[i]->name);
+        }
+        job->doneNs.store(testbackend::NowNs(), std::memory_order_release);
+    }
+
+    MpscQueue queue_;
+    std::thread thread_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> stopping_{false};
+};
+
+// Tuş isimlerini çöz ve işi kuyruğa ver (pressKeys / pressShortcut yolu)
+void Submit(BenchWorker& worker, BenchJob& job, size_t index) {
+    job.startNs = testbackend::NowNs();
+    job.doneNs.store(0, std::memory_order_relaxed);
+    job.keyCount = 0;
+    for (const char* name : kChords[index % kChordCount]) {
+        if (name == nullptr) {
+            break;
+        }
+        job.keys[job.keyCount++] = keytable::Find(name);
+    }
+    worker.Enqueue(&job);
+}
+
+void WaitDone(const BenchJob& job) {
+    while (job.doneNs.load(std::memory_order_acquire) == 0) {
+        std::this_thread::yield();
+    }
+}
+
+void Report(const char* label, std::vector<int64_t>& samples, double seconds) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-12s %8zu basış  p50 %7.2f us  p99 %7.2f us  p99.9 %8.2f us  max %8.1f us  %10.0f basış/s\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.p999Us, summary.maxUs,
+                static_cast<double>(summary.count) / seconds);
+}
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Her basış tek başına: worker çoğu zaman uyurken uyandırılır (tek tuş deneyimi)
+void RunSingle(BenchWorker& worker, size_t presses) {
+    std::vector<int64_t> samples;
+    samples.reserve(presses);
+    BenchJob job;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < presses; i++) {
+        Submit(worker, job, i);
+        WaitDone(job);
+        samples.push_back(job.doneNs.load() - job.startNs);
+        // Kullanıcı aralığını taklit et: worker uykuya geçsin
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    Report("tek basış", samples, Seconds(start));
+}
+
+// Art arda burstSize basış, sonra hepsinin tamamlanması beklenir
+void RunBurst(BenchWorker& worker, size_t presses, size_t burstSize) {
+    std::vector<int64_t> samples;
+    samples.reserve(presses);
+    std::vector<BenchJob> jobs(burstSize);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t done = 0; done < presses; done += burstSize) {
+        for (size_t i = 0; i < burstSize; i++) {
+            Submit(worker, jobs[i], done + i);
+        }
+        for (BenchJob& job : jobs) {
+            WaitDone(job);
+            samples.push_back(job.doneNs.load() - job.startNs);
+        }
+    }
+    Report("burst", samples, Seconds(start));
+}
+
+// producers thread'i aynı kuyruğa yazar (çok istemcili deck)
+void RunMultiProducer(BenchWorker& worker, size_t presses, size_t producers) {
+    std::vector<std::vector<int64_t>> perThread(producers);
+    std::vector<std::thread> threads;
+    size_t perProducer = presses / producers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < producers; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<int64_t>& samples = perThread[t];
+            samples.reserve(perProducer);
+            BenchJob job;
+            for (size_t i = 0; i < perProducer; i++) {
+                Submit(worker, job, t + i);
+                WaitDone(job);
+                samples.push_back(job.doneNs.load() - job.startNs);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = Seconds(start);
+
+    std::vector<int64_t> samples;
+    for (const std::vector<int64_t>& part : perThread) {
+        samples.insert(samples.end(), part.begin(), part.end());
+    }
+    Report("çok üretici", samples, seconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t presses = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 200000;
+    size_t producers = std::thread::hardware_concurrency() > 2 ? 4 : 2;
+
+    recorder.SetMode(testbackend::Mode::kRecording);
+
+    BenchWorker worker;
+    worker.Start();
+
+    std::printf("Enjeksiyon yolu benchmark'ı (recording backend, %zu basış)\n", presses);
+    // Senaryolar arasında kayıt boşaltılır (addon'da takeRecording gibi)
+    size_t events = 0;
+    RunSingle(worker, presses / 100 + 1);
+    events += recorder.Take().size();
+    RunBurst(worker, presses, 64);
+    events += recorder.Take().size();
+    RunMultiProducer(worker, presses, producers);
+    events += recorder.Take().size();
+
+    worker.Stop();
+
+    std::printf("  kayıt: %llu işlem (%zu saklandı, %llu düştü)\n",
+                static_cast<unsigned long long>(recorder.Total()), events,
+                static_cast<unsigned long long>(recorder.Dropped()));
+    return 0;
+}
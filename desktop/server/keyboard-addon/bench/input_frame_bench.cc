@@ -0,0 +1,105 @@
+// İkili girdi çerçevesi mikro benchmark'ı
+// inputframe::Decode'un saniyede çözdüğü event sayısını ölçer (enjeksiyon yok).
+// Farklı çerçeve boyutları, mesaj başına sabit maliyetin (başlık doğrulama)
+// kayıtlara nasıl dağıldığını gösterir. JSON yolu ile uçtan uca karşılaştırma
+// için bench/input_frame_bench.js kullanılır.
+//
+// Derleme: node-gyp rebuild (build/Release/input_frame_bench)
+// Çalıştırma: ./build/Release/input_frame_bench [event sayısı]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../input_frame.h"
+
+namespace {
+
+// Optimizasyonun sonucu atmasını engelle
+volatile int64_t sink = 0;
+
+void WriteU16(uint8_t* p, uint16_t value) {
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void WriteU32(uint8_t* p, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+// Tipik dokunmatik akış: çoğunlukla hareket, arada tıklama / tekerlek / tuş
+std::vector<uint8_t> BuildFrame(uint16_t count, uint32_t sequence) {
+    std::vector<uint8_t> frame(inputframe::kHeaderSize + count * inputframe::kRecordSize, 0);
+    frame[0] = inputframe::kMagic0;
+    frame[1] = inputframe::kMagic1;
+    frame[2] = inputframe::kVersion;
+    frame[3] = inputframe::kRecordSize;
+    WriteU32(&frame[4], sequence);
+    WriteU32(&frame[8], 123456);
+    WriteU16(&frame[12], count);
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t* record = &frame[inputframe::kHeaderSize + i * inputframe::kRecordSize];
+        WriteU16(record + 2, i * 8);
+        switch (i % 16) {
+        case 7:
+            record[0] = static_cast<uint8_t>(inputframe::InputRecordType::kClick);
+            record[1] = inputframe::kHasPosition;
+            WriteU32(record + 4, 30000);
+            WriteU32(record + 8, 20000);
+            break;
+        case 11:
+            record[0] = static_cast<uint8_t>(inputframe::InputRecordType::kScroll);
+            WriteU32(record + 8, static_cast<uint32_t>(-2));
+            break;
+        case 15:
+            record[0] = static_cast<uint8_t>(inputframe::InputRecordType::kKey);
+            record[1] = inputframe::kCtrl;
+            std::memcpy(record + 4, "C", 1);
+            break;
+        default:
+            record[0] = static_cast<uint8_t>(inputframe::InputRecordType::kMove);
+            WriteU32(record + 4, 1000u * i);
+            WriteU32(record + 8, 500u * i);
+            break;
+        }
+    }
+    return frame;
+}
+
+double MeasureEventsPerSecond(uint16_t frameEvents, uint64_t totalEvents) {
+    std::vector<uint8_t> frame = BuildFrame(frameEvents, 1);
+    uint64_t frames = totalEvents / frameEvents;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < frames; i++) {
+        inputframe::Header header;
+        size_t skipped = 0;
+        inputframe::Decode(frame.data(), frame.size(), header, skipped, [](const inputframe::Record& record) {
+            sink += record.x + record.y + static_cast<int64_t>(record.key.size());
+        });
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(frames * frameEvents) / seconds;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t events = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000000ull;
+
+    // Isınma
+    MeasureEventsPerSecond(64, events / 10);
+
+    std::printf("inputframe::Decode benchmark (%llu event)\n", static_cast<unsigned long long>(events));
+    for (uint16_t size : { 1, 8, 64, 512 }) {
+        double rate = MeasureEventsPerSecond(size, events);
+        std::printf("  %3u event/çerçeve : %8.1f M event/s (%6.2f ns/event)\n", size, rate / 1e6, 1e9 / rate);
+    }
+    return 0;
+}
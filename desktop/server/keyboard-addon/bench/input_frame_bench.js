@@ -0,0 +1,111 @@
+// Girdi yolu benchmark'ı: JSON eventleri vs ikili girdi çerçevesi
+// JSON yolu: event başına paket kodlama/çözme (Socket.IO JSON paketi gibi),
+// alan doğrulama, trustedDevices üzerinde doğrusal arama ve koordinat hesabı.
+// İkili yol: 64 eventlik çerçeve kodlama, Buffer kopyası (ağdan gelen tampon)
+// ve dispatchInputFrame (dryRun: çözümle + eşle, enjeksiyon yok).
+//
+// Çalıştırma: node bench/input_frame_bench.js [event sayısı]
+// (ikili yol için önce node-gyp rebuild)
+
+const path = require('path');
+
+const EVENTS = Number(process.argv[2]) || 2000000;
+const FRAME_EVENTS = 64;
+const HEADER_SIZE = 16;
+const RECORD_SIZE = 16;
+const NORMALIZED_MAX = 65535;
+
+const bounds = { x: 0, y: 0, width: 2560, height: 1440 };
+const trustedDevices = Array.from({ length: 8 }, (_, i) => ({ id: `device-${i}`, name: `Telefon ${i}` }));
+const client = { deviceId: 'device-7' };
+
+// Tipik dokunmatik akış: çoğunlukla hareket, arada tıklama / tekerlek
+function sampleEvent(i) {
+  switch (i % 16) {
+    case 7: return ['remote-mouse-click', { button: 'left', x: 0.45, y: 0.3 }];
+    case 11: return ['remote-mouse-scroll', { deltaX: 0, deltaY: 20 }];
+    default: return ['remote-mouse-move', { x: (i % 1000) / 1000, y: (i % 700) / 700 }];
+  }
+}
+
+let sink = 0;
+
+function runJson(count) {
+  for (let i = 0; i < count; i++) {
+    const wire = '42' + JSON.stringify(sampleEvent(i));
+    const [name, data] = JSON.parse(wire.slice(2));
+
+    if (!trustedDevices.some(d => d.id === client.deviceId)) continue;
+    if (name === 'remote-mouse-scroll') {
+      sink += Math.round(-(data.deltaY || 0) / 10);
+      continue;
+    }
+    if (typeof data.x !== 'number' || typeof data.y !== 'number') continue;
+    sink += Math.round(bounds.x + data.x * bounds.width) + Math.round(bounds.y + data.y * bounds.height);
+  }
+}
+
+// LocalDesk/src/utils/inputFrame.js ile aynı format
+function encodeFrame(sequence, start, count) {
+  const bytes = new Uint8Array(HEADER_SIZE + count * RECORD_SIZE);
+  const view = new DataView(bytes.buffer);
+  bytes[0] = 0x4c; // 'L'
+  bytes[1] = 0x49; // 'I'
+  bytes[2] = 1;
+  bytes[3] = RECORD_SIZE;
+  view.setUint32(4, sequence, true);
+  view.setUint32(8, 0, true);
+  view.setUint16(12, count, true);
+
+  for (let i = 0; i < count; i++) {
+    const offset = HEADER_SIZE + i * RECORD_SIZE;
+    const [name, data] = sampleEvent(start + i);
+    if (name === 'remote-mouse-scroll') {
+      bytes[offset] = 5;
+      view.setInt32(offset + 8, Math.round(-data.deltaY / 10), true);
+    } else {
+      bytes[offset] = name === 'remote-mouse-click' ? 4 : 1;
+      bytes[offset + 1] = name === 'remote-mouse-click' ? 2 : 0;
+      view.setInt32(offset + 4, Math.round(data.x * NORMALIZED_MAX), true);
+      view.setInt32(offset + 8, Math.round(data.y * NORMALIZED_MAX), true);
+    }
+    view.setUint16(offset + 2, i, true);
+  }
+  return bytes;
+}
+
+function runBinary(addon, count) {
+  let sequence = 0;
+  for (let i = 0; i < count; i += FRAME_EVENTS) {
+    const frame = Buffer.from(encodeFrame(++sequence, i, Math.min(FRAME_EVENTS, count - i)));
+    const result = addon.dispatchInputFrame(frame, { bounds, lastSequence: sequence - 1, dryRun: true });
+    sink += result.dispatched;
+  }
+}
+
+function measure(label, fn, count) {
+  fn(Math.min(count, 100000)); // Isınma
+  const start = process.hrtime.bigint();
+  fn(count);
+  const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+  const rate = count / seconds;
+  console.log(`  ${label.padEnd(28)}: ${(rate / 1e6).toFixed(2).padStart(7)} M event/s (${(1e9 / rate).toFixed(1)} ns/event)`);
+  return rate;
+}
+
+console.log(`Girdi yolu benchmark'ı (${EVENTS} event, çerçeve başına ${FRAME_EVENTS})`);
+const jsonRate = measure('JSON event', runJson, EVENTS);
+
+let addon = null;
+try {
+  addon = require(path.join(__dirname, '..', 'build', 'Release', 'keyboard'));
+} catch (error) {
+  console.log('  İkili yol atlandı (addon derlenmemiş):', error.message);
+}
+
+if (addon && addon.dispatchInputFrame) {
+  const binaryRate = measure('İkili çerçeve (dryRun)', (count) => runBinary(addon, count), EVENTS);
+  console.log(`  Hızlanma: ${(binaryRate / jsonRate).toFixed(1)}x`);
+}
+
+if (sink === 0.5) console.log(sink);
@@ -0,0 +1,171 @@
+// İkili girdi çerçevesi fuzz harness'ı
+// inputframe::Decode'a rastgele / bozuk çerçeveler verilir; her girdi tam
+// boyutunda ayrılmış bir tampona kopyalanır ki ASan sınır dışı okumayı yakalasın.
+// Denetlenen değişmezler:
+//   - kOk ise uzunluk = başlık + count * recordSize ve verilen + atlanan = count
+//   - yapı hatasında hiç kayıt verilmez
+//   - key çerçeve tamponunun içindedir ve kKeyNameSize'ı geçmez
+//
+// libFuzzer ile:
+//   clang++ -std=c++17 -g -O1 -fsanitize=fuzzer,address -DINPUT_FRAME_LIBFUZZER
+//     bench/input_frame_fuzz.cc -o input_frame_fuzz
+//   ./input_frame_fuzz bench/input_frame_corpus
+// Bağımsız (node-gyp rebuild -> build/Release/input_frame_fuzz):
+//   ./input_frame_fuzz bench/input_frame_corpus   korpusu çalıştır, dosya başına durum yaz
+//   ./input_frame_fuzz [tohum] [deneme]            rastgele mutasyon döngüsü
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../input_frame.h"
+
+namespace {
+
+struct Result {
+    inputframe::Status status;
+    size_t records;
+    size_t skipped;
+};
+
+// assert NDEBUG ile kapanır; harness Release derlemede de denetlemeli
+void Require(bool condition, const char* what) {
+    if (!condition) {
+        std::fprintf(stderr, "Değişmez bozuldu: %s\n", what);
+        std::abort();
+    }
+}
+
+Result Check(const uint8_t* input, size_t size) {
+    uint8_t* data = size ? new uint8_t[size] : nullptr;
+    if (size) {
+        std::memcpy(data, input, size);
+    }
+
+    inputframe::Header header;
+    Result result{ inputframe::Status::kOk, 0, 0 };
+    result.status = inputframe::Decode(data, size, header, result.skipped, [&](const inputframe::Record& record) {
+        result.records++;
+        Require(record.key.size() <= inputframe::kKeyNameSize, "key uzunluğu");
+        if (!record.key.empty()) {
+            const uint8_t* key = reinterpret_cast<const uint8_t*>(record.key.data());
+            Require(key >= data + inputframe::kHeaderSize && key + record.key.size() <= data + size,
+                    "key çerçeve içinde");
+        }
+    });
+
+    if (result.status == inputframe::Status::kOk) {
+        Require(size == inputframe::kHeaderSize + static_cast<size_t>(header.count) * header.recordSize,
+                "uzunluk = başlık + count * recordSize");
+        Require(result.records + result.skipped == header.count, "verilen + atlanan = count");
+    } else {
+        Require(result.records == 0 && result.skipped == 0, "hatalı çerçevede kayıt verilmez");
+    }
+
+    delete[] data;
+    return result;
+}
+
+// Geçerli bir çerçeve (bilinmeyen türler ve büyük kayıt boyutu dahil)
+std::vector<uint8_t> RandomFrame(std::mt19937& rng) {
+    uint16_t count = static_cast<uint16_t>(rng() % 40);
+    uint8_t recordSize = static_cast<uint8_t>(inputframe::kRecordSize + (rng() % 4 == 0 ? rng() % 8 : 0));
+    std::vector<uint8_t> frame(inputframe::kHeaderSize + count * recordSize);
+    for (uint8_t& byte : frame) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    frame[0] = inputframe::kMagic0;
+    frame[1] = inputframe::kMagic1;
+    frame[2] = inputframe::kVersion;
+    frame[3] = recordSize;
+    frame[12] = static_cast<uint8_t>(count);
+    frame[13] = static_cast<uint8_t>(count >> 8);
+    for (uint16_t i = 0; i < count; i++) {
+        frame[inputframe::kHeaderSize + i * recordSize] = static_cast<uint8_t>(1 + rng() % 7);
+    }
+    return frame;
+}
+
+void Mutate(std::vector<uint8_t>& frame, std::mt19937& rng) {
+    int mutations = static_cast<int>(rng() % 4);
+    for (int i = 0; i < mutations && !frame.empty(); i++) {
+        switch (rng() % 4) {
+        case 0: frame[rng() % frame.size()] ^= static_cast<uint8_t>(1u << (rng() % 8)); break;
+        case 1: frame.resize(rng() % (frame.size() + 1)); break;
+        case 2: frame.insert(frame.begin() + rng() % (frame.size() + 1), static_cast<uint8_t>(rng())); break;
+        default: frame[rng() % frame.size()] = static_cast<uint8_t>(rng()); break;
+        }
+    }
+}
+
+int RunCorpus(int argc, char** argv) {
+    std::vector<std::filesystem::path> files;
+    for (int i = 1; i < argc; i++) {
+        std::filesystem::path path = argv[i];
+        if (std::filesystem::is_directory(path)) {
+            for (const auto& entry : std::filesystem::directory_iterator(path)) {
+                if (entry.is_regular_file()) {
+                    files.push_back(entry.path());
+                }
+            }
+        } else {
+            files.push_back(path);
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto& path : files) {
+        std::ifstream file(path, std::ios::binary);
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        Result result = Check(data.data(), data.size());
+        // <dosya> <durum> <kayıt> <atlanan>
+        std::printf("%s %d %zu %zu\n", path.filename().string().c_str(), static_cast<int>(result.status),
+                    result.records, result.skipped);
+    }
+    return 0;
+}
+
+int RunRandom(uint32_t seed, uint64_t iterations) {
+    std::mt19937 rng(seed);
+    uint64_t ok = 0;
+    uint64_t records = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+        std::vector<uint8_t> frame = RandomFrame(rng);
+        Mutate(frame, rng);
+        Result result = Check(frame.data(), frame.size());
+        if (result.status == inputframe::Status::kOk) {
+            ok++;
+            records += result.records;
+        }
+    }
+    std::printf("tohum %u: %llu deneme, %llu geçerli çerçeve, %llu kayıt\n", seed,
+                static_cast<unsigned long long>(iterations), static_cast<unsigned long long>(ok),
+                static_cast<unsigned long long>(records));
+    return 0;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    Check(data, size);
+    return 0;
+}
+
+#ifndef INPUT_FRAME_LIBFUZZER
+int main(int argc, char** argv) {
+    if (argc > 1 && std::filesystem::exists(argv[1])) {
+        return RunCorpus(argc, argv);
+    }
+    uint32_t seed = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1;
+    uint64_t iterations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000000ull;
+    return RunRandom(seed, iterations);
+}
+#endif
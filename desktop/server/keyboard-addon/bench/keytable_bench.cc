@@ -0,0 +1,84 @@
+// keytable mikro benchmark'ı
+// Eski std::map<std::string, WORD> keyMap aramasını (her aramada std::string
+// oluşturarak, N-API Utf8Value() gibi) keytable::Find ile karşılaştırır.
+//
+// Derleme: node-gyp rebuild (build/Release/keytable_bench)
+// Çalıştırma: ./build/Release/keytable_bench [iterasyon]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../keytable.h"
+
+namespace {
+
+// Deck kısayollarında tipik tuş isimleri (büyük harf, eski map ile uyumlu)
+const char* const kSampleKeys[] = {
+    "CONTROL", "S", "ALT", "F4", "SHIFT", "TAB", "MEDIAPLAYPAUSE", "V",
+    "CTRL", "C", "ENTER", "VOLUMEUP", "WIN", "D", "PRINTSCREEN", "ESCAPE",
+};
+
+constexpr size_t kSampleCount = sizeof(kSampleKeys) / sizeof(kSampleKeys[0]);
+
+// Optimizasyonun sonucu atmasını engelle
+volatile uint32_t sink = 0;
+
+template <typename Fn>
+double MeasureNs(uint64_t iterations, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        fn(kSampleKeys[i % kSampleCount]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000ull;
+
+    // Eski implementasyon: modül yüklenirken kurulan std::map
+    std::map<std::string, uint16_t> keyMap;
+    for (const auto& key : keytable::kKeys) {
+        keyMap.emplace(std::string(key.name), key.vk);
+    }
+
+    // Isınma
+    MeasureNs(iterations / 10, [&](const char* name) { sink += keytable::Find(name)->vk; });
+
+    double mapNs = MeasureNs(iterations, [&](const char* name) {
+        std::string key(name); // Utf8Value() eşdeğeri heap/SSO kopyası
+        auto it = keyMap.find(key);
+        sink += it != keyMap.end() ? it->second : 0;
+    });
+
+    double tableNs = MeasureNs(iterations, [&](const char* name) {
+        const keytable::KeyEntry* key = keytable::Find(name);
+        sink += key != nullptr ? key->vk : 0;
+    });
+
+    // Flag kontrolü: eski IsMediaKey/IsExtendedKey karşılaştırma zincirleri yerine tek bit testi
+    std::vector<const keytable::KeyEntry*> resolved;
+    for (const char* name : kSampleKeys) {
+        resolved.push_back(keytable::Find(name));
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        sink += resolved[i % kSampleCount]->IsExtended() ? 1 : 0;
+    }
+    double flagNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+    std::printf("keytable benchmark (%llu arama, %zu tuş)\n", static_cast<unsigned long long>(iterations), keytable::kKeyCount);
+    std::printf("  std::map<std::string> + string kopyası : %7.2f ns/arama\n", mapNs);
+    std::printf("  keytable::Find (perfect hash)          : %7.2f ns/arama\n", tableNs);
+    std::printf("  extended/media flag kontrolü           : %7.2f ns/kontrol\n", flagNs);
+    std::printf("  hızlanma                               : %7.2fx\n", mapNs / tableNs);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Makro motoru zamanlama doğruluğu benchmark'ı
+// Gerçek enjeksiyon yerine her Flush()'ın zamanını kaydeden bir backend kullanır.
+// Her beklemeden sonraki ilk toplu işin, mutlak çizelgedeki hedef zamandan ne kadar
+// saptığını (p50 / p99 / en kötü) ve iptal gecikmesini ölçer.
+//
+// Derleme: node-gyp rebuild (build/Release/macro_timing_bench)
+// Çalıştırma: ./build/Release/macro_timing_bench [tekrar] [bekleme ms]
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "../macro_engine.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Enjeksiyon yerine toplu işlerin zamanını ve tuş durumunu kaydeder
+class RecordingBackend : public MacroBackend {
+public:
+    void KeyDown(const keytable::KeyEntry*) override { down++; }
+    void KeyUp(const keytable::KeyEntry*) override { up++; }
+    void Flush() override { flushes.push_back(Clock::now()); }
+    textinput::TextStats Text(std::string_view) override {
+        flushes.push_back(Clock::now());
+        return {};
+    }
+
+    std::vector<Clock::time_point> flushes;
+    uint64_t down = 0;
+    uint64_t up = 0;
+};
+
+struct Waiter {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    MacroResult result;
+    Clock::time_point at;
+
+    MacroEngine::DoneFn Callback() {
+        return [this](const MacroResult& r) {
+            std::lock_guard<std::mutex> lock(mutex);
+            result = r;
+            at = Clock::now();
+            done = true;
+            cv.notify_all();
+        };
+    }
+
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return done; });
+    }
+};
+
+double Percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t repeats = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 200;
+    int delayMs = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    RecordingBackend backend;
+    MacroEngine engine(backend);
+    engine.Start();
+
+    // tekrar N { Ctrl+1 ; bekle ; Shift basılı tut ; bekle ; Shift bırak }
+    auto program = std::make_shared<MacroProgram>();
+    program->BeginRepeat(repeats);
+    program->Chord({ keytable::Find("CTRL"), keytable::Find("1") });
+    program->Delay(std::chrono::milliseconds(delayMs));
+    program->Down(keytable::Find("SHIFT"));
+    program->Delay(std::chrono::milliseconds(delayMs));
+    program->Up(keytable::Find("SHIFT"));
+    program->EndRepeat();
+
+    Waiter waiter;
+    Clock::time_point start = Clock::now();
+    engine.Submit(program, nullptr, waiter.Callback());
+    waiter.Wait();
+
+    // i. toplu iş, i. beklemenin sonunda gitmeli: hedef = başlangıç + i * bekleme
+    std::vector<double> errorsUs;
+    const auto delay = std::chrono::milliseconds(delayMs);
+    for (size_t i = 1; i < backend.flushes.size(); i++) {
+        Clock::time_point target = start + delay * static_cast<int>(i);
+        errorsUs.push_back(std::chrono::duration<double, std::micro>(backend.flushes[i] - target).count());
+    }
+
+    double ideal = 2.0 * repeats * delayMs;
+    std::printf("Makro zamanlama (%u tekrar, %d ms bekleme, %zu toplu iş)\n", repeats, delayMs, backend.flushes.size());
+    std::printf("  tamamlandı: %s, tuş eventi: %llu (bas %llu / bırak %llu)\n",
+                waiter.result.completed ? "evet" : "hayır",
+                static_cast<unsigned long long>(waiter.result.keyEvents),
+                static_cast<unsigned long long>(backend.down), static_cast<unsigned long long>(backend.up));
+    std::printf("  süre: %.2f ms (ideal %.0f ms, kayma %.3f ms)\n", waiter.result.elapsedMs, ideal, waiter.result.elapsedMs - ideal);
+    std::printf("  hedeften sapma: p50 %.1f us, p99 %.1f us, en kötü %.1f us\n",
+                Percentile(errorsUs, 0.5), Percentile(errorsUs, 0.99), Percentile(errorsUs, 1.0));
+    std::printf("  motorun ölçtüğü uyanma gecikmesi: ort %.1f us, en kötü %.1f us\n",
+                waiter.result.meanLateUs, waiter.result.maxLateUs);
+
+    // İptal: uzun beklemedeki makro ne kadar sürede biter, basılı tuş bırakılır mı
+    backend.down = backend.up = 0;
+    auto hold = std::make_shared<MacroProgram>();
+    hold->Down(keytable::Find("SHIFT"));
+    hold->Delay(std::chrono::seconds(10));
+    hold->Up(keytable::Find("SHIFT"));
+
+    Waiter cancelled;
+    uint32_t id = engine.Submit(hold, nullptr, cancelled.Callback());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Clock::time_point cancelAt = Clock::now();
+    engine.Cancel(id);
+    cancelled.Wait();
+    std::printf("  iptal gecikmesi: %.1f us, iptal edildi: %s, basılı kalan tuş: %lld\n",
+                std::chrono::duration<double, std::micro>(cancelled.at - cancelAt).count(),
+                cancelled.result.cancelled ? "evet" : "hayır",
+                static_cast<long long>(backend.down) - static_cast<long long>(backend.up));
+
+    engine.Stop();
+    return 0;
+}
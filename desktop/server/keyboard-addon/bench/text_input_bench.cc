@@ -0,0 +1,94 @@
+// typeText benchmark'ı (Linux)
+// Metni aktif düzene göre çözüp uinput event dizisine çevirme hızını (karakter/s)
+// ölçer; enjeksiyon yok. Ayrıca kTextEventsPerWrite / kTextWritePause parçalamasıyla
+// uinput'a yazmanın üst sınırını hesaplar (gerçek yazma hızı bununla sınırlıdır).
+//
+// Derleme: node-gyp rebuild (build/Release/text_input_bench)
+// Çalıştırma: ./build/Release/text_input_bench [tekrar sayısı]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../text_keymap.h"
+
+namespace {
+
+// Optimizasyonun sonucu atmasını engelle
+volatile size_t sink = 0;
+
+struct Sample {
+    const char* layout;
+    const char* label;
+    const char* text;
+};
+
+const Sample kSamples[] = {
+    { "us", "ASCII",
+      "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs!\n"
+      "Sphinx of black quartz, judge my vow: 0123456789 (a+b)*c = {x; y}.\t" },
+    { "tr", "Türkçe",
+      "Pijamalı hasta yağız şoföre çabucak güvendi. İstanbul'da Çarşamba günü ölçüm yapıldı.\n"
+      "Öğrenciler ıhlamur ağacının altında şarkı söylediler; € 42 ödendi.\t" },
+    { "de", "Almanca",
+      "Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich. Äpfel & Öl: 3 € @ Höhe.\n"
+      "Fix, Schwyz! quäkt Jürgen blöd vom Paß.\t" },
+};
+
+double MeasureCharsPerSecond(const TextKeymap& keymap, const std::string& text, uint32_t repeat,
+                             textinput::TextStats& stats, size_t& eventCount) {
+    std::vector<input_event> events;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < repeat; i++) {
+        events.clear();
+        stats = textinput::TextStats();
+        BuildTextEvents(keymap, text, events, stats);
+        sink += events.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    eventCount = events.size();
+    return static_cast<double>(stats.typed + stats.skipped) * repeat / seconds;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t repeat = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 20000;
+
+    std::printf("typeText benchmark (%u tekrar, parça %zu event, parça arası %lld us)\n", repeat,
+                kTextEventsPerWrite, static_cast<long long>(kTextWritePause.count()));
+
+    for (const Sample& sample : kSamples) {
+        TextKeymap keymap;
+        std::string error;
+        if (!keymap.LoadNames(sample.layout, nullptr, error)) {
+            std::printf("  %-2s: atlandı (%s)\n", sample.layout, error.c_str());
+            continue;
+        }
+
+        // Uzun yapıştırma: paragraf 8 kez
+        std::string text;
+        for (int i = 0; i < 8; i++) {
+            text += sample.text;
+        }
+
+        textinput::TextStats stats;
+        size_t events = 0;
+        MeasureCharsPerSecond(keymap, text, repeat / 10 + 1, stats, events); // Isınma
+        double rate = MeasureCharsPerSecond(keymap, text, repeat, stats, events);
+
+        size_t writes = (events + kTextEventsPerWrite - 1) / kTextEventsPerWrite;
+        double pacedSeconds = static_cast<double>(writes - 1) *
+                              std::chrono::duration<double>(kTextWritePause).count();
+        double pacedRate = pacedSeconds > 0 ? stats.typed / pacedSeconds : 0;
+
+        std::printf("  %s (%s): %u karakter (%u atlandı), %zu event, %zu write\n", sample.layout,
+                    sample.label, stats.typed, stats.skipped, events, writes);
+        std::printf("    çözümleme: %.1f M karakter/s (%5.1f ns/karakter), yazma üst sınırı ~%.0f karakter/s\n",
+                    rate / 1e6, 1e9 / rate, pacedRate);
+    }
+    return 0;
+}
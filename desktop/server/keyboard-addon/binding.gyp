@@ -2,7 +2,7 @@
   "targets": [
     {
       "target_name": "keyboard",
-      "sources": [ "keyboard.cc" ],
+      "sources": [ "keyboard.cc", "window_index.cc", "pointer_injector.cc", "macro_engine.cc" ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")"
       ],
@@ -14,14 +14,85 @@
       "defines": [ "NAPI_CPP_EXCEPTIONS" ],
       "conditions": [
         ["OS=='win'", {
+          "sources": [ "window_index_win.cc", "pointer_injector_win.cc" ],
           "msvs_settings": {
             "VCCLCompilerTool": {
               "ExceptionHandling": 1
             }
           }
+        }],
+        ["OS=='linux'", {
+          "sources": [ "window_index_x11.cc", "x11_windows.cc", "pointer_injector_uinput.cc", "text_keymap.cc" ],
+          "libraries": [ "-lxcb", "-lxkbcommon", "-lxkbcommon-x11" ]
         }]
       ]
+    },
+    {
+      "target_name": "keytable_bench",
+      "type": "executable",
+      "sources": [ "bench/keytable_bench.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ]
+    },
+    {
+      "target_name": "input_frame_bench",
+      "type": "executable",
+      "sources": [ "bench/input_frame_bench.cc" ]
+    },
+    {
+      "target_name": "input_frame_fuzz",
+      "type": "executable",
+      "sources": [ "bench/input_frame_fuzz.cc" ]
+    },
+    {
+      "target_name": "macro_timing_bench",
+      "type": "executable",
+      "sources": [ "bench/macro_timing_bench.cc", "macro_engine.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ]
+    },
+    {
+      "target_name": "macro_timing_test",
+      "type": "executable",
+      "sources": [ "test/macro_timing_test.cc", "macro_engine.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ]
+    },
+    {
+      "target_name": "injection_bench",
+      "type": "executable",
+      "sources": [ "bench/injection_bench.cc" ]
     }
+  ],
+  "conditions": [
+    ["OS=='linux'", {
+      "targets": [
+        {
+          "target_name": "text_input_bench",
+          "type": "executable",
+          "sources": [ "bench/text_input_bench.cc", "text_keymap.cc" ],
+          "libraries": [ "-lxcb", "-lxkbcommon", "-lxkbcommon-x11" ]
+        },
+        {
+          "target_name": "x11_fake_wm",
+          "type": "executable",
+          "sources": [ "test/x11_fake_wm.cc" ],
+          "cflags!": [ "-fno-exceptions" ],
+          "cflags_cc!": [ "-fno-exceptions" ],
+          "libraries": [ "-lxcb" ]
+        },
+        {
+          "target_name": "evdev_absinfo",
+          "type": "executable",
+          "sources": [ "test/evdev_absinfo.cc" ]
+        },
+        {
+          "target_name": "evdev_grab",
+          "type": "executable",
+          "sources": [ "test/evdev_grab.cc" ]
+        }
+      ]
+    }]
   ]
 }
 
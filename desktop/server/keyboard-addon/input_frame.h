@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// İkili girdi çerçevesi (remote-input Socket.IO eventi)
+// Telefon fare/klavye eventlerini tek tek JSON event olarak göndermek yerine
+// sabit boyutlu kayıtlar halinde paketler; bir mesaj çok sayıda event taşır.
+// Çözümleyici gelen Buffer'ı kopyalamadan, yerinde okur (hizalama gerektirmez,
+// tüm alanlar little-endian bayt bayt okunur). N-API'ye bağımlı değildir.
+//
+// Başlık (16 bayt):
+//   0  u8   'L'
+//   1  u8   'I'
+//   2  u8   sürüm (1)
+//   3  u8   kayıt boyutu (>= 16; fazlası yok sayılır, ileriye uyumluluk)
+//   4  u32  sıra numarası (her çerçevede bir artar, taşarak döner)
+//   8  u32  gönderici zamanı (ms, taşarak döner)
+//   12 u16  kayıt sayısı
+//   14 u16  ayrılmış (0)
+//
+// Kayıt (16 bayt):
+//   0  u8   tür (InputRecordType)
+//   1  u8   bayraklar
+//   2  u16  başlık zamanına göre ms
+//   4  ...  türe göre veri:
+//      kMove    i32 x, i32 y            normalize konum (0 - kNormalizedMax)
+//      kMoveBy  i32 dx, i32 dy          piksel farkı
+//      kButton  i32 x, i32 y, u8 tuş    bayrak: kDown, kHasPosition
+//      kClick   i32 x, i32 y, u8 tuş    bayrak: kHasPosition (bas + bırak)
+//      kScroll  i32 dx, i32 dy          çentik (pozitif = sağa / yukarı)
+//      kKey     char ad[12]             keytable tuş adı (NUL ile doldurulur),
+//                                       bayraklar: değiştirici tuş maskesi
+//
+// Bilinmeyen türler atlanır (sayılır); yapı hataları çerçevenin tamamını reddeder.
+
+namespace inputframe {
+
+constexpr uint8_t kMagic0 = 'L';
+constexpr uint8_t kMagic1 = 'I';
+constexpr uint8_t kVersion = 1;
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kRecordSize = 16;
+constexpr size_t kKeyNameSize = 12;
+constexpr int32_t kNormalizedMax = 65535;
+
+enum class InputRecordType : uint8_t {
+    kMove = 1,
+    kMoveBy = 2,
+    kButton = 3,
+    kClick = 4,
+    kScroll = 5,
+    kKey = 6,
+};
+
+// kButton / kClick bayrakları
+enum PointerFlags : uint8_t {
+    kDown = 1 << 0,
+    kHasPosition = 1 << 1,
+};
+
+// kKey bayrakları (basılma sırası: Ctrl, Alt, Shift, Win, ardından tuş)
+enum ModifierFlags : uint8_t {
+    kCtrl = 1 << 0,
+    kAlt = 1 << 1,
+    kShift = 1 << 2,
+    kWin = 1 << 3,
+};
+
+enum class Status {
+    kOk,
+    kTooShort,
+    kBadMagic,
+    kBadVersion,
+    kBadRecordSize,
+    kLengthMismatch,
+};
+
+struct Header {
+    uint8_t version = 0;
+    uint8_t recordSize = 0;
+    uint32_t sequence = 0;
+    uint32_t time = 0;
+    uint16_t count = 0;
+};
+
+// Çözümlenmiş kayıt; key çerçeve tamponunu gösterir (kopya yok)
+struct Record {
+    InputRecordType type;
+    uint8_t flags;
+    uint32_t time; // Başlık zamanı + fark (ms, taşarak döner)
+    int32_t x;
+    int32_t y;
+    uint8_t button; // 0 sol, 1 orta, 2 sağ
+    std::string_view key;
+};
+
+inline uint16_t ReadU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline uint32_t ReadU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline int32_t ReadI32(const uint8_t* p) {
+    return static_cast<int32_t>(ReadU32(p));
+}
+
+inline const char* StatusMessage(Status status) {
+    switch (status) {
+    case Status::kOk: return "";
+    case Status::kTooShort: return "Çerçeve başlığı eksik";
+    case Status::kBadMagic: return "Geçersiz çerçeve imzası";
+    case Status::kBadVersion: return "Desteklenmeyen çerçeve sürümü";
+    case Status::kBadRecordSize: return "Geçersiz kayıt boyutu";
+    case Status::kLengthMismatch: return "Çerçeve uzunluğu kayıt sayısıyla uyuşmuyor";
+    }
+    return "Bilinmeyen çerçeve hatası";
+}
+
+// Sadece başlığı doğrula (kayıtlara dokunmaz)
+inline Status ParseHeader(const uint8_t* data, size_t size, Header& header) {
+    if (data == nullptr || size < kHeaderSize) {
+        return Status::kTooShort;
+    }
+    if (data[0] != kMagic0 || data[1] != kMagic1) {
+        return Status::kBadMagic;
+    }
+
+    header.version = data[2];
+    header.recordSize = data[3];
+    header.sequence = ReadU32(data + 4);
+    header.time = ReadU32(data + 8);
+    header.count = ReadU16(data + 12);
+
+    if (header.version != kVersion) {
+        return Status::kBadVersion;
+    }
+    if (header.recordSize < kRecordSize) {
+        return Status::kBadRecordSize;
+    }
+    // count <= 65535, recordSize <= 255: çarpım taşmaz
+    if (size != kHeaderSize + static_cast<size_t>(header.count) * header.recordSize) {
+        return Status::kLengthMismatch;
+    }
+    return Status::kOk;
+}
+
+// Çerçeveyi doğrula ve her bilinen kaydı visit(const Record&) ile ver
+// Yapı hatasında hiçbir kayıt verilmez. skipped: bilinmeyen türdeki kayıt sayısı.
+template <typename Visitor>
+Status Decode(const uint8_t* data, size_t size, Header& header, size_t& skipped, Visitor&& visit) {
+    skipped = 0;
+    Status status = ParseHeader(data, size, header);
+    if (status != Status::kOk) {
+        return status;
+    }
+
+    const uint8_t* p = data + kHeaderSize;
+    for (uint16_t i = 0; i < header.count; i++, p += header.recordSize) {
+        Record record;
+        record.type = static_cast<InputRecordType>(p[0]);
+        record.flags = p[1];
+        record.time = header.time + ReadU16(p + 2);
+        record.x = 0;
+        record.y = 0;
+        record.button = 0;
+
+        switch (record.type) {
+        case InputRecordType::kMove:
+        case InputRecordType::kMoveBy:
+        case InputRecordType::kScroll:
+            record.x = ReadI32(p + 4);
+            record.y = ReadI32(p + 8);
+            break;
+        case InputRecordType::kButton:
+        case InputRecordType::kClick:
+            record.x = ReadI32(p + 4);
+            record.y = ReadI32(p + 8);
+            record.button = p[12];
+            break;
+        case InputRecordType::kKey: {
+            const char* name = reinterpret_cast<const char*>(p + 4);
+            size_t length = 0;
+            while (length < kKeyNameSize && name[length] != '\0') {
+                length++;
+            }
+            record.key = std::string_view(name, length);
+            break;
+        }
+        default:
+            skipped++;
+            continue;
+        }
+
+        visit(record);
+    }
+    return Status::kOk;
+}
+
+// Sıra numarası öncekinden yeni mi (seri aritmetik, taşmaya dayanıklı)
+inline bool IsNewer(uint32_t sequence, uint32_t last) {
+    return static_cast<int32_t>(sequence - last) > 0;
+}
+
+} // namespace inputframe
@@ -1,203 +1,199 @@
 #include <napi.h>
 
-#ifdef _WIN32
-#include <windows.h>
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../native-common/metrics_napi.h"
+#include "../native-common/test_backend_napi.h"
+#include "input_frame.h"
+#include "keytable.h"
+#include "macro_engine.h"
+#include "mpsc_queue.h"
+#include "pointer_injector.h"
+#include "text_input.h"
+#include "window_index.h"
+
+// Çözümlenmiş tuş kombinasyonu (keytable girişleri, basılma sırasıyla)
+using KeyChord = std::vector<const keytable::KeyEntry*>;
 
-// Klavye tuşlarının Virtual Key kodları
-std::map<std::string, WORD> keyMap = {
-    {"A", 0x41}, {"B", 0x42}, {"C", 0x43}, {"D", 0x44}, {"E", 0x45},
-    {"F", 0x46}, {"G", 0x47}, {"H", 0x48}, {"I", 0x49}, {"J", 0x4A},
-    {"K", 0x4B}, {"L", 0x4C}, {"M", 0x4D}, {"N", 0x4E}, {"O", 0x4F},
-    {"P", 0x50}, {"Q", 0x51}, {"R", 0x52}, {"S", 0x53}, {"T", 0x54},
-    {"U", 0x55}, {"V", 0x56}, {"W", 0x57}, {"X", 0x58}, {"Y", 0x59},
-    {"Z", 0x5A},
-    
-    {"0", 0x30}, {"1", 0x31}, {"2", 0x32}, {"3", 0x33}, {"4", 0x34},
-    {"5", 0x35}, {"6", 0x36}, {"7", 0x37}, {"8", 0x38}, {"9", 0x39},
-    
-    {"F1", VK_F1}, {"F2", VK_F2}, {"F3", VK_F3}, {"F4", VK_F4},
-    {"F5", VK_F5}, {"F6", VK_F6}, {"F7", VK_F7}, {"F8", VK_F8},
-    {"F9", VK_F9}, {"F10", VK_F10}, {"F11", VK_F11}, {"F12", VK_F12},
-    
-    {"ENTER", VK_RETURN},
-    {"ESCAPE", VK_ESCAPE},
-    {"BACKSPACE", VK_BACK},
-    {"TAB", VK_TAB},
-    {"SPACE", VK_SPACE},
-    
-    {"SHIFT", VK_SHIFT},
-    {"CONTROL", VK_CONTROL},
-    {"ALT", VK_MENU},
-    {"CTRL", VK_CONTROL},
-    
-    {"LEFT", VK_LEFT},
-    {"UP", VK_UP},
-    {"RIGHT", VK_RIGHT},
-    {"DOWN", VK_DOWN},
-    
-    {"HOME", VK_HOME},
-    {"END", VK_END},
-    {"PAGEUP", VK_PRIOR},
-    {"PAGEDOWN", VK_NEXT},
-    
-    {"DELETE", VK_DELETE},
-    {"INSERT", VK_INSERT},
-    
-    {"CAPSLOCK", VK_CAPITAL},
-    {"NUMLOCK", VK_NUMLOCK},
-    {"SCROLLLOCK", VK_SCROLL},
-    
-    {"PRINTSCREEN", VK_SNAPSHOT},
-    {"PAUSE", VK_PAUSE},
-    
-    // Medya tuşları
-    {"VOLUMEUP", VK_VOLUME_UP},
-    {"VOLUMEDOWN", VK_VOLUME_DOWN},
-    {"VOLUMEMUTE", VK_VOLUME_MUTE},
-    {"MEDIAPLAYPAUSE", VK_MEDIA_PLAY_PAUSE},
-    {"MEDIASTOP", VK_MEDIA_STOP},
-    {"MEDIANEXTTRACK", VK_MEDIA_NEXT_TRACK},
-    {"MEDIAPREVIOUSTRACK", VK_MEDIA_PREV_TRACK},
-    
-    // Tarayıcı tuşları
-    {"BROWSERHOME", VK_BROWSER_HOME},
-    {"BROWSERBACK", VK_BROWSER_BACK},
-    {"BROWSERFORWARD", VK_BROWSER_FORWARD},
-    {"BROWSERREFRESH", VK_BROWSER_REFRESH},
-    {"BROWSERSTOP", VK_BROWSER_STOP},
-    {"BROWSERSEARCH", VK_BROWSER_SEARCH},
-    {"BROWSERFAVORITES", VK_BROWSER_FAVORITES},
-    
-    // Windows tuşları
-    {"WIN", VK_LWIN},
-    {"LWIN", VK_LWIN},
-    {"RWIN", VK_RWIN}
+// Aktif enjeksiyon backend'inin durumu (getBackendInfo)
+struct BackendInfo {
+    const char* name;
+    bool ready;
+    std::string devicePath;
+    std::string error;
 };
 
-// Medya tuşları mı kontrol et
-bool IsMediaKey(WORD vk) {
-    return vk == VK_VOLUME_UP || vk == VK_VOLUME_DOWN || vk == VK_VOLUME_MUTE ||
-           vk == VK_MEDIA_PLAY_PAUSE || vk == VK_MEDIA_STOP ||
-           vk == VK_MEDIA_NEXT_TRACK || vk == VK_MEDIA_PREV_TRACK ||
-           vk == VK_BROWSER_HOME || vk == VK_BROWSER_BACK ||
-           vk == VK_BROWSER_FORWARD || vk == VK_BROWSER_REFRESH ||
-           vk == VK_BROWSER_STOP || vk == VK_BROWSER_SEARCH ||
-           vk == VK_BROWSER_FAVORITES;
-}
+// Hedefli gönderim modu
+// kFocus: pencere öne getirilir ve girdi normal yoldan enjekte edilir
+// kBackground: tuş eventleri doğrudan hedef pencereye gönderilir, odak değişmez
+enum class DeliveryMode {
+    kFocus,
+    kBackground
+};
+
+#ifdef _WIN32
+#include <windows.h>
+
+void InitBackend() {}
 
-// Extended key mi kontrol et
-bool IsExtendedKey(WORD vk) {
-    return vk == VK_UP || vk == VK_DOWN || vk == VK_LEFT || vk == VK_RIGHT ||
-           vk == VK_HOME || vk == VK_END || vk == VK_PRIOR || vk == VK_NEXT ||
-           vk == VK_INSERT || vk == VK_DELETE ||
-           vk == VK_RMENU || vk == VK_RCONTROL || // Sağ Alt ve Ctrl
-           vk == VK_LWIN || vk == VK_RWIN;
+void ShutdownBackend() {}
+
+BackendInfo QueryBackend() {
+    return { "sendinput", true, "", "" };
 }
 
-// Tuşları basma fonksiyonu - Gerçek klavye gibi davranır
-void PressKeys(const std::vector<std::string>& keys) {
-    // Medya tuşları için özel işlem (tek tuş ve medya tuşu ise)
-    if (keys.size() == 1) {
-        auto it = keyMap.find(keys[0]);
-        if (it != keyMap.end() && IsMediaKey(it->second)) {
-            // Medya tuşları için ayrı ayrı gönder
-            INPUT inputs[2] = {0};
-            
-            // Scan code'u al
-            WORD scanCode = MapVirtualKeyEx(it->second, MAPVK_VK_TO_VSC, GetKeyboardLayout(0));
-            
-            // Key Down
-            inputs[0].type = INPUT_KEYBOARD;
-            inputs[0].ki.wVk = it->second;
-            inputs[0].ki.wScan = scanCode;
-            inputs[0].ki.dwFlags = KEYEVENTF_EXTENDEDKEY;
-            
-            // Key Up
-            inputs[1].type = INPUT_KEYBOARD;
-            inputs[1].ki.wVk = it->second;
-            inputs[1].ki.wScan = scanCode;
-            inputs[1].ki.dwFlags = KEYEVENTF_EXTENDEDKEY | KEYEVENTF_KEYUP;
-            
-            // İki eventi de gönder
-            SendInput(2, inputs, sizeof(INPUT));
-            return;
+// Ön plandaki pencerenin klavye düzeni (scan code'lar buna göre üretilir)
+HKL CurrentKeyboardLayout() {
+    HWND hwndForeground = GetForegroundWindow();
+    if (hwndForeground) {
+        HKL layout = GetKeyboardLayout(GetWindowThreadProcessId(hwndForeground, NULL));
+        if (layout) {
+            return layout;
         }
     }
+    return GetKeyboardLayout(0);
+}
+
+// Tek bir tuş eventi oluştur
+INPUT MakeKeyInput(const keytable::KeyEntry* key, HKL layout, bool keyUp) {
+    INPUT input = {0};
+    input.type = INPUT_KEYBOARD;
+    input.ki.wVk = key->vk;
+    // Scan code - Gerçek klavye gibi davranmak için ZORUNLU
+    input.ki.wScan = MapVirtualKeyEx(key->vk, MAPVK_VK_TO_VSC, layout);
+    input.ki.dwFlags = keyUp ? KEYEVENTF_KEYUP : 0;
+    
+    // Extended key kontrolü (medya tuşları da extended gönderilir)
+    if (key->IsExtended()) {
+        input.ki.dwFlags |= KEYEVENTF_EXTENDEDKEY;
+    }
     
-    // Normal tuş kombinasyonları için (Ctrl+C, Alt+Tab, vb.)
+    return input;
+}
+
+// Hazır SendInput tamponu (prepareShortcut ile önbelleğe alınır)
+struct InputBuffer {
     std::vector<INPUT> inputs;
+    HKL layout = NULL;
+};
+
+// Tuş kombinasyonundan SendInput tamponunu üret
+// Tüm tuşlar sırayla basılır, ters sırayla bırakılır (Ctrl+C, Alt+Tab, medya tuşları, vb.)
+void BuildInputBuffer(const KeyChord& keys, InputBuffer& buffer) {
+    HKL layout = CurrentKeyboardLayout();
+    
+    buffer.inputs.clear();
+    buffer.inputs.reserve(keys.size() * 2);
     
     // Tüm tuşları bas (key down)
-    for (const auto& keyName : keys) {
-        auto it = keyMap.find(keyName);
-        if (it == keyMap.end()) {
-            continue; // Bilinmeyen tuş, atla
-        }
-        
-        WORD vk = it->second;
-        
-        // Scan code'u al - Gerçek klavye gibi davranmak için ZORUNLU
-        WORD scanCode = MapVirtualKeyEx(vk, MAPVK_VK_TO_VSC, GetKeyboardLayout(0));
-        
-        INPUT input = {0};
-        input.type = INPUT_KEYBOARD;
-        input.ki.wVk = vk;
-        input.ki.wScan = scanCode; // Scan code ekle
-        input.ki.dwFlags = 0;
-        
-        // Extended key kontrolü
-        if (IsExtendedKey(vk) || IsMediaKey(vk)) {
-            input.ki.dwFlags |= KEYEVENTF_EXTENDEDKEY;
-        }
-        
-        inputs.push_back(input);
+    for (const keytable::KeyEntry* key : keys) {
+        buffer.inputs.push_back(MakeKeyInput(key, layout, false));
     }
     
     // Tüm tuşları bırak (key up) - ters sırayla
     for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
-        auto keyIt = keyMap.find(*it);
-        if (keyIt == keyMap.end()) {
-            continue;
-        }
-        
-        WORD vk = keyIt->second;
-        
-        // Scan code'u al
-        WORD scanCode = MapVirtualKeyEx(vk, MAPVK_VK_TO_VSC, GetKeyboardLayout(0));
-        
-        INPUT input = {0};
-        input.type = INPUT_KEYBOARD;
-        input.ki.wVk = vk;
-        input.ki.wScan = scanCode; // Scan code ekle
-        input.ki.dwFlags = KEYEVENTF_KEYUP;
-        
-        // Extended key kontrolü
-        if (IsExtendedKey(vk) || IsMediaKey(vk)) {
-            input.ki.dwFlags |= KEYEVENTF_EXTENDEDKEY;
-        }
-        
-        inputs.push_back(input);
+        buffer.inputs.push_back(MakeKeyInput(*it, layout, true));
     }
     
-    // SendInput ile tuşları gönder
-    if (!inputs.empty()) {
-        UINT result = SendInput(inputs.size(), inputs.data(), sizeof(INPUT));
-        
-        // Başarı kontrolü
-        if (result != inputs.size()) {
-            // Hata: Tüm inputlar gönderilemedi
-            DWORD error = GetLastError();
-            // printf("SendInput hatası: %lu, gönderilen: %u/%zu\n", error, result, inputs.size());
-        }
+    buffer.layout = layout;
+}
+
+// Tamponu tek bir SendInput çağrısıyla gönder
+void SendInputBuffer(const InputBuffer& buffer) {
+    if (buffer.inputs.empty()) {
+        return;
+    }
+    
+    UINT result = SendInput(static_cast<UINT>(buffer.inputs.size()),
+                            const_cast<INPUT*>(buffer.inputs.data()), sizeof(INPUT));
+    
+    // Başarı kontrolü
+    if (result != buffer.inputs.size()) {
+        // Hata: Tüm inputlar gönderilemedi (genelde UIPI engeli)
+        throw std::runtime_error("SendInput başarısız: " + std::to_string(GetLastError()));
+    }
+}
+
+// Önbellekteki tamponu gönder; klavye düzeni değiştiyse önce yeniden üret
+void FireInputBuffer(const KeyChord& keys, InputBuffer& buffer) {
+    if (buffer.layout != CurrentKeyboardLayout()) {
+        BuildInputBuffer(keys, buffer);
     }
+    SendInputBuffer(buffer);
+}
+
+// Tuşları basma fonksiyonu - Gerçek klavye gibi davranır
+void PressKeys(const KeyChord& keys) {
+    InputBuffer buffer;
+    BuildInputBuffer(keys, buffer);
+    SendInputBuffer(buffer);
+}
+
+// KEYEVENTF_UNICODE ile tek UTF-16 birimi (klavye düzeninden bağımsız)
+INPUT MakeUnicodeInput(uint16_t unit, bool keyUp) {
+    INPUT input = {0};
+    input.type = INPUT_KEYBOARD;
+    input.ki.wScan = unit;
+    input.ki.dwFlags = KEYEVENTF_UNICODE | (keyUp ? KEYEVENTF_KEYUP : 0);
+    return input;
+}
+
+// Metni yaz: karakterler KEYEVENTF_UNICODE ile gönderilir, bu yüzden aktif düzende
+// olmayan karakterler de bozulmaz. Satır sonu ve sekme sanal tuşla gönderilir
+// (birçok uygulama Unicode CR/TAB'ı yok sayar). Tüm metin tek SendInput çağrısıdır.
+textinput::TextStats TypeText(std::string_view text) {
+    static const keytable::KeyEntry* enter = keytable::Find("ENTER");
+    static const keytable::KeyEntry* tab = keytable::Find("TAB");
+
+    HKL layout = CurrentKeyboardLayout();
+    InputBuffer buffer;
+    buffer.inputs.reserve(text.size() * 2 + 2);
+    textinput::TextStats stats;
+
+    stats.skipped = static_cast<uint32_t>(textinput::ForEachCodePoint(text, [&](char32_t ch) {
+        if (ch == U'\n' || ch == U'\t') {
+            const keytable::KeyEntry* key = ch == U'\n' ? enter : tab;
+            buffer.inputs.push_back(MakeKeyInput(key, layout, false));
+            buffer.inputs.push_back(MakeKeyInput(key, layout, true));
+        } else if (ch < 0x20 || ch == 0x7F) {
+            stats.skipped++;
+            return;
+        } else if (ch < 0x10000) {
+            buffer.inputs.push_back(MakeUnicodeInput(static_cast<uint16_t>(ch), false));
+            buffer.inputs.push_back(MakeUnicodeInput(static_cast<uint16_t>(ch), true));
+        } else {
+            // BMP dışı (emoji): vekil çift, iki basma sonra iki bırakma
+            uint16_t high = static_cast<uint16_t>(0xD800 + ((ch - 0x10000) >> 10));
+            uint16_t low = static_cast<uint16_t>(0xDC00 + ((ch - 0x10000) & 0x3FF));
+            buffer.inputs.push_back(MakeUnicodeInput(high, false));
+            buffer.inputs.push_back(MakeUnicodeInput(low, false));
+            buffer.inputs.push_back(MakeUnicodeInput(high, true));
+            buffer.inputs.push_back(MakeUnicodeInput(low, true));
+        }
+        stats.typed++;
+    }));
+
+    SendInputBuffer(buffer);
+    return stats;
 }
 
-// Belirli bir pencereye tuş gönder (Focus edip SendInput ile)
-void SendKeysToWindow(HWND hwnd, const std::vector<std::string>& keys) {
+// Pencereyi öne getirip gönderme işlemini çalıştır (Focus edip SendInput ile)
+// Geçersiz pencerede hiçbir şey gönderilmez ve false döner
+template <typename SendFn>
+bool WithWindowFocused(HWND hwnd, SendFn send) {
     if (!IsWindow(hwnd)) {
-        return; // Geçersiz window handle
+        return false; // Geçersiz window handle
     }
     
     // Mevcut aktif pencereyi kaydet
@@ -222,9 +218,16 @@ void SendKeysToWindow(HWND hwnd, const std::vector<std::string>& keys) {
     // Kısa bir delay (pencere focus olması için)
     Sleep(50);
     
-    // Normal SendInput kullan (PressKeys fonksiyonu)
+    // Normal SendInput kullan
     // Bu zaten aktif pencereye gönderir, biz de aktif pencereyi ayarladık
-    PressKeys(keys);
+    try {
+        send();
+    } catch (...) {
+        if (dwForegroundThreadId != dwTargetThreadId) {
+            AttachThreadInput(dwForegroundThreadId, dwTargetThreadId, FALSE);
+        }
+        throw;
+    }
     
     // Thread input'unu detach et
     if (dwForegroundThreadId != dwTargetThreadId) {
@@ -233,6 +236,84 @@ void SendKeysToWindow(HWND hwnd, const std::vector<std::string>& keys) {
     
     // Orijinal pencereye geri dön (opsiyonel, isterseniz kaldırabilirsiniz)
     // SetForegroundWindow(hwndForeground);
+    return true;
+}
+
+// Belirli bir pencereye tuş gönder
+bool SendKeysToWindow(HWND hwnd, const KeyChord& keys) {
+    return WithWindowFocused(hwnd, [&]() { PressKeys(keys); });
+}
+
+// Arka plan gönderimi için WM_KEYDOWN/WM_KEYUP lParam'ı
+// (tekrar sayısı, scan code, extended, context ve geçiş bitleri)
+LPARAM MakeKeyLParam(const keytable::KeyEntry* key, HKL layout, bool keyUp, bool altDown) {
+    UINT scan = MapVirtualKeyEx(key->vk, MAPVK_VK_TO_VSC, layout);
+    LPARAM lParam = 1 | (static_cast<LPARAM>(scan & 0xFF) << 16);
+    
+    if (key->IsExtended()) {
+        lParam |= static_cast<LPARAM>(1) << 24;
+    }
+    if (altDown) {
+        lParam |= static_cast<LPARAM>(1) << 29;
+    }
+    if (keyUp) {
+        lParam |= (static_cast<LPARAM>(1) << 30) | (static_cast<LPARAM>(1) << 31);
+    }
+    
+    return lParam;
+}
+
+// Pencereyi öne getirmeden tuşları mesaj kuyruğuna bırak (focus çalmaz, Sleep yok)
+// Mesajlar hedef thread'in odaktaki alt penceresine (ör. editör kontrolü) gider.
+// Not: Modifier durumunu GetKeyState ile okuyan uygulamalar Ctrl/Shift'i görmez;
+// bu uygulamalar için focus modu kullanılmalı.
+// Dönen değer: tüm mesajlar hedefin kuyruğuna kabul edildiyse true
+bool PostKeysToWindow(HWND hwnd, const KeyChord& keys) {
+    if (!IsWindow(hwnd)) {
+        return false;
+    }
+    
+    DWORD threadId = GetWindowThreadProcessId(hwnd, NULL);
+    HKL layout = GetKeyboardLayout(threadId);
+    
+    HWND receiver = hwnd;
+    GUITHREADINFO gui = { sizeof(gui) };
+    if (GetGUIThreadInfo(threadId, &gui) && gui.hwndFocus &&
+        (gui.hwndFocus == hwnd || IsChild(hwnd, gui.hwndFocus))) {
+        receiver = gui.hwndFocus;
+    }
+    
+    bool altDown = false;
+    bool accepted = true;
+    
+    auto post = [&](const keytable::KeyEntry* key, bool keyUp) {
+        if (key->vk == VK_MENU) {
+            altDown = !keyUp;
+        }
+        
+        // Alt basılıyken Windows WM_SYSKEY* üretir (Alt+F4, menü kısayolları)
+        UINT message = keyUp ? (altDown ? WM_SYSKEYUP : WM_KEYUP)
+                             : (altDown ? WM_SYSKEYDOWN : WM_KEYDOWN);
+        
+        // UIPI (yükseltilmiş hedef) veya dolu kuyrukta PostMessage başarısız olur
+        if (!PostMessage(receiver, message, key->vk, MakeKeyLParam(key, layout, keyUp, altDown))) {
+            accepted = false;
+        }
+    };
+    
+    for (const keytable::KeyEntry* key : keys) {
+        post(key, false);
+    }
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+        post(*it, true);
+    }
+    
+    return accepted;
+}
+
+// Enjeksiyon thread'inden çağrılır: arka plan gönderimi
+bool DeliverInBackground(const KeyChord& keys, int64_t target) {
+    return PostKeysToWindow(reinterpret_cast<HWND>(target), keys);
 }
 
 // Çalışan pencereleri listele
@@ -242,9 +323,9 @@ struct WindowInfo {
     std::string exeName;
 };
 
-std::vector<WindowInfo> windowList;
-
 BOOL CALLBACK EnumWindowsProc(HWND hwnd, LPARAM lParam) {
+    std::vector<WindowInfo>& windowList = *reinterpret_cast<std::vector<WindowInfo>*>(lParam);
+    
     // Görünür ve başlık barı olan pencereler
     if (!IsWindowVisible(hwnd)) return TRUE;
     
@@ -286,83 +367,59 @@ BOOL CALLBACK EnumWindowsProc(HWND hwnd, LPARAM lParam) {
     return TRUE;
 }
 
-// N-API: sendKeys (Mevcut - Global)
-Napi::Value SendKeys(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 1 || !info[0].IsArray()) {
-        Napi::TypeError::New(env, "Array bekleniyor").ThrowAsJavaScriptException();
-        return env.Null();
-    }
-    
-    Napi::Array keysArray = info[0].As<Napi::Array>();
-    std::vector<std::string> keys;
-    
-    for (uint32_t i = 0; i < keysArray.Length(); i++) {
-        Napi::Value val = keysArray[i];
-        if (val.IsString()) {
-            keys.push_back(val.As<Napi::String>().Utf8Value());
-        }
-    }
-    
-    if (keys.empty()) {
-        Napi::Error::New(env, "En az bir tuş gerekli").ThrowAsJavaScriptException();
-        return env.Null();
+// Enjeksiyon thread'inden çağrılır: hedef 0 ise aktif pencereye, değilse HWND'ye
+// false: hedef pencere geçersiz, tuşlar gönderilmedi
+bool InjectKeys(const KeyChord& keys, int64_t target) {
+    if (target != 0) {
+        return SendKeysToWindow(reinterpret_cast<HWND>(target), keys);
     }
-    
     PressKeys(keys);
-    
-    return Napi::Boolean::New(env, true);
+    return true;
 }
 
-// N-API: sendKeysToWindow (Yeni - Belirli pencereye)
-Napi::Value SendKeysToWindowAPI(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    if (info.Length() < 2) {
-        Napi::TypeError::New(env, "hwnd ve keys array bekleniyor").ThrowAsJavaScriptException();
-        return env.Null();
+// Önbellekteki tamponla enjeksiyon (prepareShortcut/fireShortcut)
+bool InjectPrepared(const KeyChord& keys, InputBuffer& buffer, int64_t target) {
+    if (target != 0) {
+        return WithWindowFocused(reinterpret_cast<HWND>(target), [&]() { FireInputBuffer(keys, buffer); });
     }
-    
-    if (!info[0].IsNumber() || !info[1].IsArray()) {
-        Napi::TypeError::New(env, "Geçersiz parametreler").ThrowAsJavaScriptException();
-        return env.Null();
+    FireInputBuffer(keys, buffer);
+    return true;
+}
+
+// Makro motoru backend'i: araya bekleme girmeyen eventler tek SendInput ile gider
+class NativeMacroBackend : public MacroBackend {
+public:
+    void KeyDown(const keytable::KeyEntry* key) override { Add(key, false); }
+    void KeyUp(const keytable::KeyEntry* key) override { Add(key, true); }
+
+    void Flush() override {
+        InputBuffer batch;
+        batch.inputs.swap(buffer_.inputs);
+        SendInputBuffer(batch);
     }
-    
-    // HWND'yi al (64-bit güvenli)
-    int64_t hwndValue = info[0].As<Napi::Number>().Int64Value();
-    HWND hwnd = reinterpret_cast<HWND>(hwndValue);
-    
-    // Keys'i al
-    Napi::Array keysArray = info[1].As<Napi::Array>();
-    std::vector<std::string> keys;
-    
-    for (uint32_t i = 0; i < keysArray.Length(); i++) {
-        Napi::Value val = keysArray[i];
-        if (val.IsString()) {
-            keys.push_back(val.As<Napi::String>().Utf8Value());
+
+    // KEYEVENTF_UNICODE durumsuzdur, typeText ile aynı yol
+    textinput::TextStats Text(std::string_view text) override { return TypeText(text); }
+
+private:
+    void Add(const keytable::KeyEntry* key, bool keyUp) {
+        // Klavye düzeni toplu işin başında bir kez okunur
+        if (buffer_.inputs.empty()) {
+            buffer_.layout = CurrentKeyboardLayout();
         }
+        buffer_.inputs.push_back(MakeKeyInput(key, buffer_.layout, keyUp));
     }
-    
-    if (keys.empty()) {
-        Napi::Error::New(env, "En az bir tuş gerekli").ThrowAsJavaScriptException();
-        return env.Null();
-    }
-    
-    SendKeysToWindow(hwnd, keys);
-    
-    return Napi::Boolean::New(env, true);
-}
+
+    InputBuffer buffer_;
+};
 
 // N-API: getWindowList (Yeni)
 Napi::Value GetWindowListAPI(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     
-    // Liste temizle
-    windowList.clear();
-    
-    // Pencereleri listele
-    EnumWindows(EnumWindowsProc, 0);
+    // Pencereleri listele (her çağrının kendi listesi)
+    std::vector<WindowInfo> windowList;
+    EnumWindows(EnumWindowsProc, reinterpret_cast<LPARAM>(&windowList));
     
     // JavaScript array oluştur
     Napi::Array result = Napi::Array::New(env, windowList.size());
@@ -378,44 +435,1649 @@ Napi::Value GetWindowListAPI(const Napi::CallbackInfo& info) {
     return result;
 }
 
-// Modül başlatma
-Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "sendKeys"), Napi::Function::New(env, SendKeys));
-    exports.Set(Napi::String::New(env, "sendKeysToWindow"), Napi::Function::New(env, SendKeysToWindowAPI));
-    exports.Set(Napi::String::New(env, "getWindowList"), Napi::Function::New(env, GetWindowListAPI));
-    return exports;
+#elif defined(__linux__)
+// Linux: kalıcı uinput sanal klavyesi
+// Modül yüklenirken bir kez /dev/uinput üzerinden oluşturulur ve her çağrıda
+// yeniden kullanılır. evdev kodları fiziksel tuş konumlarıdır, klavye düzeninden
+// bağımsızdır; bu yüzden önbellekteki tamponun geçersiz kılınmasına gerek yoktur.
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#include "text_keymap.h"
+#include "x11_windows.h"
+
+class VirtualKeyboard {
+public:
+    bool Open() {
+        fd_ = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd_ < 0) {
+            error_ = std::string("/dev/uinput açılamadı: ") + strerror(errno) +
+                     " (kullanıcının /dev/uinput yazma izni olmalı)";
+            return false;
+        }
+
+        bool ok = ioctl(fd_, UI_SET_EVBIT, EV_KEY) == 0 && ioctl(fd_, UI_SET_EVBIT, EV_SYN) == 0;
+
+        // Tablodaki tüm tuşları kaydet
+        for (size_t i = 0; ok && i < keytable::kKeyCount; i++) {
+            ok = ioctl(fd_, UI_SET_KEYBIT, keytable::kKeys[i].evdev) == 0;
+        }
+
+        // typeText düzene göre tabloda olmayan tuşları da (ör. ISO <LSGT>) kullanabilir
+        for (int code = 1; ok && code <= 255; code++) {
+            ok = ioctl(fd_, UI_SET_KEYBIT, code) == 0;
+        }
+
+        if (ok) {
+            uinput_setup setup;
+            memset(&setup, 0, sizeof(setup));
+            setup.id.bustype = BUS_VIRTUAL;
+            setup.id.vendor = 0x4c44; // "LD"
+            setup.id.product = 0x0001;
+            setup.id.version = 1;
+            strncpy(setup.name, "LocalDesk Virtual Keyboard", UINPUT_MAX_NAME_SIZE - 1);
+
+            ok = ioctl(fd_, UI_DEV_SETUP, &setup) == 0 && ioctl(fd_, UI_DEV_CREATE) == 0;
+        }
+
+        if (!ok) {
+            error_ = std::string("uinput cihazı oluşturulamadı: ") + strerror(errno);
+            close(fd_);
+            fd_ = -1;
+            return false;
+        }
+
+        devicePath_ = FindEventNode();
+        return true;
+    }
+
+    void Close() {
+        if (fd_ >= 0) {
+            ioctl(fd_, UI_DEV_DESTROY);
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    // Tüm eventleri tek bir write() ile gönder
+    void Write(const std::vector<input_event>& events) {
+        Write(events.data(), events.size());
+    }
+
+    // Uzun event dizisini (typeText) SYN_REPORT sınırlarında kTextEventsPerWrite'lık
+    // parçalar halinde, aralarında kTextWritePause bekleyerek gönder
+    void WritePaced(const std::vector<input_event>& events) {
+        size_t start = 0;
+        while (start < events.size()) {
+            size_t end = std::min(start + kTextEventsPerWrite, events.size());
+            size_t cut = end;
+            while (cut > start && events[cut - 1].type != EV_SYN) {
+                cut--;
+            }
+            if (cut == start) {
+                cut = end;
+            }
+
+            if (start > 0) {
+                std::this_thread::sleep_for(kTextWritePause);
+            }
+            Write(events.data() + start, cut - start);
+            start = cut;
+        }
+    }
+
+    bool Ready() const { return fd_ >= 0; }
+    const std::string& Error() const { return error_; }
+    const std::string& DevicePath() const { return devicePath_; }
+
+private:
+    void Write(const input_event* events, size_t count) {
+        if (fd_ < 0) {
+            throw std::runtime_error(error_);
+        }
+
+        const size_t size = count * sizeof(input_event);
+        ssize_t written = write(fd_, events, size);
+        if (written != static_cast<ssize_t>(size)) {
+            throw std::runtime_error(std::string("uinput yazma hatası: ") + strerror(errno));
+        }
+    }
+
+    // Sanal cihazın evdev düğümünü bul (testlerde eventler buradan geri okunur)
+    std::string FindEventNode() {
+        char sysname[64] = {0};
+        if (ioctl(fd_, UI_GET_SYSNAME(sizeof(sysname)), sysname) < 0) {
+            return "";
+        }
+
+        std::string sysPath = std::string("/sys/devices/virtual/input/") + sysname;
+        DIR* dir = opendir(sysPath.c_str());
+        if (!dir) {
+            return "";
+        }
+
+        std::string node;
+        while (dirent* entry = readdir(dir)) {
+            if (strncmp(entry->d_name, "event", 5) == 0) {
+                node = std::string("/dev/input/") + entry->d_name;
+                break;
+            }
+        }
+        closedir(dir);
+        return node;
+    }
+
+    int fd_ = -1;
+    std::string error_ = "uinput cihazı başlatılmadı";
+    std::string devicePath_;
+};
+
+VirtualKeyboard virtualKeyboard;
+
+void InitBackend() {
+    virtualKeyboard.Open();
 }
 
-NODE_API_MODULE(keyboard, Init)
+void ShutdownBackend() {
+    virtualKeyboard.Close();
+}
 
-#else
-// Windows dışı platformlar için dummy implementation
+BackendInfo QueryBackend() {
+    return { "uinput", virtualKeyboard.Ready(), virtualKeyboard.DevicePath(), virtualKeyboard.Ready() ? "" : virtualKeyboard.Error() };
+}
 
-Napi::Value SendKeys(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    Napi::Error::New(env, "Bu özellik sadece Windows'ta destekleniyor").ThrowAsJavaScriptException();
-    return env.Null();
+// Hazır uinput event tamponu
+struct InputBuffer {
+    std::vector<input_event> events;
+};
+
+input_event MakeEvent(uint16_t type, uint16_t code, int32_t value) {
+    input_event event;
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    return event;
 }
 
-Napi::Value SendKeysToWindowAPI(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    Napi::Error::New(env, "Bu özellik sadece Windows'ta destekleniyor").ThrowAsJavaScriptException();
-    return env.Null();
+// Tuş kombinasyonundan event tamponunu üret
+// Basma ve bırakma ayrı SYN_REPORT çerçevelerindedir: aynı çerçevede basılıp
+// bırakılan tuşu, durumu çerçeve sonunda okuyan istemciler hiç görmeyebilir.
+// İki çerçeve yine de tek bir write() ile, aralarında bekleme olmadan gider.
+void BuildInputBuffer(const KeyChord& keys, InputBuffer& buffer) {
+    buffer.events.clear();
+    buffer.events.reserve(keys.size() * 2 + 2);
+
+    // Tüm tuşları bas (key down)
+    for (const keytable::KeyEntry* key : keys) {
+        buffer.events.push_back(MakeEvent(EV_KEY, key->evdev, 1));
+    }
+    buffer.events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+
+    // Tüm tuşları bırak (key up) - ters sırayla
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+        buffer.events.push_back(MakeEvent(EV_KEY, (*it)->evdev, 0));
+    }
+    buffer.events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
 }
 
-Napi::Value GetWindowListAPI(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    return Napi::Array::New(env, 0);
+void PressKeys(const KeyChord& keys) {
+    if (keys.empty()) {
+        return;
+    }
+
+    InputBuffer buffer;
+    BuildInputBuffer(keys, buffer);
+    virtualKeyboard.Write(buffer.events);
 }
 
-Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "sendKeys"), Napi::Function::New(env, SendKeys));
-    exports.Set(Napi::String::New(env, "sendKeysToWindow"), Napi::Function::New(env, SendKeysToWindowAPI));
-    exports.Set(Napi::String::New(env, "getWindowList"), Napi::Function::New(env, GetWindowListAPI));
-    return exports;
+// Hedef varsa önce pencere yöneticisinden odak istenir (_NET_ACTIVE_WINDOW);
+// odak alınamazsa tuşlar başka bir pencereye gitmesin diye hiç gönderilmez (false)
+bool InjectKeys(const KeyChord& keys, int64_t target) {
+    if (target != 0 && !ActivateX11Window(static_cast<uint32_t>(target))) {
+        return false;
+    }
+    PressKeys(keys);
+    return true;
 }
 
-NODE_API_MODULE(keyboard, Init)
+bool InjectPrepared(const KeyChord& keys, InputBuffer& buffer, int64_t target) {
+    if (target != 0 && !ActivateX11Window(static_cast<uint32_t>(target))) {
+        return false;
+    }
+    if (!buffer.events.empty()) {
+        virtualKeyboard.Write(buffer.events);
+    }
+    return true;
+}
 
-#endif
+// typeText karakter -> tuş vuruşu tablosu (sadece enjeksiyon thread'inden)
+TextKeymap textKeymap;
+
+// Metni yaz: karakterler aktif XKB düzeninde (ve grubunda) hangi tuş + Shift/AltGr
+// ile üretiliyorsa o vuruşa çözülür; düzende olmayan karakterler atlanır
+textinput::TextStats TypeText(std::string_view text) {
+    std::string error;
+    if (!textKeymap.Refresh(error)) {
+        throw std::runtime_error(error);
+    }
+
+    std::vector<input_event> events;
+    textinput::TextStats stats;
+    BuildTextEvents(textKeymap, text, events, stats);
+    virtualKeyboard.WritePaced(events);
+    return stats;
+}
+
+// Makro motoru backend'i: her tuş eventi kendi SYN_REPORT çerçevesinde,
+// araya bekleme girmeyen eventler typeText gibi SYN sınırlarında parça parça gider
+class NativeMacroBackend : public MacroBackend {
+public:
+    void KeyDown(const keytable::KeyEntry* key) override { Add(key, 1); }
+    void KeyUp(const keytable::KeyEntry* key) override { Add(key, 0); }
+
+    void Flush() override {
+        std::vector<input_event> batch;
+        batch.swap(events_);
+        if (!batch.empty()) {
+            virtualKeyboard.WritePaced(batch);
+        }
+    }
+
+    // typeText ile aynı çözümleme; textKeymap enjeksiyon thread'ine ait olduğundan
+    // motor thread'inin kendi tablosu var
+    textinput::TextStats Text(std::string_view text) override {
+        std::string error;
+        if (!keymap_.Refresh(error)) {
+            throw std::runtime_error(error);
+        }
+
+        std::vector<input_event> events;
+        textinput::TextStats stats;
+        BuildTextEvents(keymap_, text, events, stats);
+        virtualKeyboard.WritePaced(events);
+        return stats;
+    }
+
+private:
+    void Add(const keytable::KeyEntry* key, int32_t value) {
+        events_.push_back(MakeEvent(EV_KEY, key->evdev, value));
+        events_.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+    }
+
+    std::vector<input_event> events_;
+    TextKeymap keymap_;
+};
+
+// Arka plan gönderimi: uinput yerine X11 sentetik KeyPress/KeyRelease eventleri
+// doğrudan hedef pencereye gönderilir (odak değişmez)
+bool DeliverInBackground(const KeyChord& keys, int64_t target) {
+    std::vector<uint16_t> codes;
+    codes.reserve(keys.size());
+    for (const keytable::KeyEntry* key : keys) {
+        codes.push_back(key->evdev);
+    }
+    
+    return SendKeysToX11Window(static_cast<uint32_t>(target), codes);
+}
 
+// X11/EWMH pencere listesi (Wayland-only oturumda veya DISPLAY yoksa boş döner)
+Napi::Value GetWindowListAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::vector<X11WindowInfo> windowList;
+    if (!ListClientWindows(windowList)) {
+        return Napi::Array::New(env, 0);
+    }
+    
+    Napi::Array result = Napi::Array::New(env, windowList.size());
+    
+    for (size_t i = 0; i < windowList.size(); i++) {
+        Napi::Object obj = Napi::Object::New(env);
+        obj.Set("hwnd", Napi::Number::New(env, windowList[i].window));
+        obj.Set("title", Napi::String::New(env, windowList[i].title));
+        obj.Set("exeName", Napi::String::New(env, windowList[i].exeName));
+        result[i] = obj;
+    }
+    
+    return result;
+}
+
+#else
+// Desteklenmeyen platformlar için dummy implementation
+
+void InitBackend() {}
+
+void ShutdownBackend() {}
+
+BackendInfo QueryBackend() {
+    return { "none", false, "", "Bu platform desteklenmiyor" };
+}
+
+struct InputBuffer {};
+
+void BuildInputBuffer(const KeyChord& keys, InputBuffer& buffer) {}
+
+bool InjectKeys(const KeyChord& keys, int64_t target) {
+    throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+}
+
+bool InjectPrepared(const KeyChord& keys, InputBuffer& buffer, int64_t target) {
+    throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+}
+
+bool DeliverInBackground(const KeyChord& keys, int64_t target) {
+    throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+}
+
+textinput::TextStats TypeText(std::string_view text) {
+    throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+}
+
+class NativeMacroBackend : public MacroBackend {
+public:
+    void KeyDown(const keytable::KeyEntry*) override {}
+    void KeyUp(const keytable::KeyEntry*) override {}
+    void Flush() override {
+        throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+    }
+    textinput::TextStats Text(std::string_view) override {
+        throw std::runtime_error("Bu özellik sadece Windows ve Linux'ta destekleniyor");
+    }
+};
+
+Napi::Value GetWindowListAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return Napi::Array::New(env, 0);
+}
+
+#endif
+
+// ============================================================
+// Enjeksiyon thread'i
+// ============================================================
+// Tüm SendInput çağrıları tek bir kalıcı native thread'de yapılır.
+// JS tarafı sadece işi kuyruğa bırakır ve bir Promise alır; böylece
+// Sleep(50) veya yavaş bir SendInput Socket.IO event loop'unu dondurmaz.
+
+// Test backend'i (LOCALDESK_TEST_BACKEND, modül yüklenirken seçilir)
+// Native değilse uinput / SendInput hiç açılmaz; tuşlar ve metin OS'e gitmeden
+// kaydedilir, böylece basıştan enjeksiyona kadar tüm yol başsız ölçülebilir.
+testbackend::Mode injectionMode = testbackend::Mode::kNative;
+testbackend::Recorder injectionRecorder;
+
+// Çağrı metrikleri (getStats)
+// Export'lar JS çağrısını ölçer; "inject" enjeksiyon thread'inde işin kendisini
+// (kuyrukta bekleme hariç) ölçer.
+metrics::Registry keyboardMetrics("keyboard");
+metrics::Api& injectMetrics = keyboardMetrics.Add("inject");
+
+// prepareShortcut ile önceden derlenmiş kısayol
+// Tampon sadece oluşturulurken (ana thread) ve enjeksiyon thread'inde değiştirilir
+struct PreparedShortcut {
+    KeyChord keys;
+    InputBuffer buffer;
+};
+
+struct InjectionJob : MpscNode {
+    KeyChord keys;
+    std::shared_ptr<PreparedShortcut> prepared; // Varsa keys yerine kullanılır
+    int64_t target = 0; // 0 = aktif pencere (global)
+    DeliveryMode mode = DeliveryMode::kFocus;
+    std::optional<std::string> text; // Varsa tuşlar yerine metin yazılır (typeText)
+    textinput::TextStats textStats;
+    std::optional<Napi::Promise::Deferred> deferred; // Yoksa sonuç beklenmez (ör. ikili girdi çerçevesi)
+    bool success = false;
+    bool accepted = false; // Hedef girdiyi kabul etti mi (arka plan modunda anlamlı)
+    std::string error;
+
+    InjectionJob() = default;
+    explicit InjectionJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+};
+
+// Test modunda işi OS'e göndermeden kaydet
+// Tuşlar basılma sırasıyla, bırakmalar ters sırayla (PressKeys ile aynı); value: hedef pencere
+void RecordJob(InjectionJob* job) {
+    if (job->text) {
+        textinput::TextStats stats;
+        stats.skipped = static_cast<uint32_t>(textinput::ForEachCodePoint(*job->text, [&](char32_t) { stats.typed++; }));
+        injectionRecorder.Record("text", *job->text, stats.typed);
+        job->textStats = stats;
+        return;
+    }
+
+    const KeyChord& keys = job->prepared ? job->prepared->keys : job->keys;
+    double target = static_cast<double>(job->target);
+    for (const keytable::KeyEntry* key : keys) {
+        injectionRecorder.Record("down", key->name, target);
+    }
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+        injectionRecorder.Record("up", (*it)->name, target);
+    }
+}
+
+class InjectionWorker {
+public:
+    void Start(Napi::Env env) {
+        // Tamamlanan işleri ana thread'e taşıyan ThreadSafeFunction
+        completion_ = Napi::ThreadSafeFunction::New(
+            env,
+            Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+            "keyboardInjection",
+            0,
+            1
+        );
+        // Bekleyen iş yokken process'in kapanmasını engelleme
+        completion_.Unref(env);
+
+        stopping_.store(false);
+        thread_ = std::thread([this]() { Run(); });
+    }
+
+    void Stop() {
+        if (!thread_.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopping_.store(true);
+            sleeping_.store(false);
+        }
+        wakeCv_.notify_one();
+        thread_.join();
+
+        completion_.Release();
+    }
+
+    // Herhangi bir thread'den çağrılabilir (kilitsiz)
+    void Enqueue(InjectionJob* job) {
+        queue_.Push(job);
+
+        // Worker uyuyorsa uyandır; uyumuyorsa mutex'e hiç dokunma
+        if (sleeping_.exchange(false)) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wakeCv_.notify_one();
+        }
+    }
+
+private:
+    void Run() {
+        while (!stopping_.load()) {
+            MpscNode* node = queue_.Pop();
+
+            if (node != nullptr) {
+                Process(static_cast<InjectionJob*>(node));
+                continue;
+            }
+
+            if (!queue_.Empty()) {
+                // Bir üretici Push() ortasında, kısa süre bekle
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            sleeping_.store(true);
+
+            // Uyumadan önce son kez kontrol et (kaçırılan Push olmasın)
+            if (!queue_.Empty()) {
+                sleeping_.store(false);
+                continue;
+            }
+
+            wakeCv_.wait(lock, [this]() { return !sleeping_.load() || stopping_.load(); });
+        }
+
+        // Kapanırken kuyrukta kalan işler çalıştırılmaz; Promise'leri hata ile reddedilir
+        for (;;) {
+            MpscNode* node = queue_.Pop();
+            if (node != nullptr) {
+                InjectionJob* job = static_cast<InjectionJob*>(node);
+                job->error = "Klavye modülü kapanıyor";
+                Complete(job);
+                continue;
+            }
+            if (queue_.Empty()) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void Process(InjectionJob* job) {
+        metrics::Scope scope(injectMetrics);
+        try {
+            if (injectionMode != testbackend::Mode::kNative) {
+                RecordJob(job);
+                job->accepted = true;
+            } else if (job->text) {
+                job->textStats = TypeText(*job->text);
+                job->accepted = true;
+            } else if (job->mode == DeliveryMode::kBackground && job->target != 0) {
+                const KeyChord& keys = job->prepared ? job->prepared->keys : job->keys;
+                job->accepted = DeliverInBackground(keys, job->target);
+            } else if (job->prepared) {
+                job->accepted = InjectPrepared(job->prepared->keys, job->prepared->buffer, job->target);
+            } else {
+                job->accepted = InjectKeys(job->keys, job->target);
+            }
+            job->success = true;
+        } catch (const std::exception& e) {
+            job->error = e.what();
+        } catch (...) {
+            job->error = "Klavye girdisi gönderilemedi";
+        }
+        if (!job->success) {
+            scope.Fail();
+        }
+        Complete(job);
+    }
+
+    // Sonucu ana thread'e taşı (Promise'i olmayan iş burada silinir)
+    void Complete(InjectionJob* job) {
+        if (!job->deferred) {
+            delete job;
+            return;
+        }
+
+        napi_status status = completion_.NonBlockingCall(job, [](Napi::Env env, Napi::Function, InjectionJob* job) {
+            if (job->success && job->text) {
+                Napi::Object result = Napi::Object::New(env);
+                result.Set("typed", Napi::Number::New(env, job->textStats.typed));
+                result.Set("skipped", Napi::Number::New(env, job->textStats.skipped));
+                job->deferred->Resolve(result);
+            } else if (job->success) {
+                job->deferred->Resolve(Napi::Boolean::New(env, job->accepted));
+            } else {
+                job->deferred->Reject(Napi::Error::New(env, job->error).Value());
+            }
+            delete job;
+        });
+
+        if (status != napi_ok) {
+            // Modül kapanıyor, Promise artık çözülemez
+            delete job;
+        }
+    }
+
+    MpscQueue queue_;
+    std::thread thread_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> stopping_{false};
+    Napi::ThreadSafeFunction completion_;
+};
+
+InjectionWorker injectionWorker;
+
+// JS array'inden tuş isimlerini oku ve keytable üzerinden çözümle
+// Tuş adı std::string'e kopyalanmadan stack tamponuna okunur; bilinmeyen tuşlar atlanır.
+// given: array'deki string eleman sayısı (bilinmeyenler dahil)
+KeyChord ReadKeys(const Napi::Array& keysArray, uint32_t& given) {
+    napi_env env = keysArray.Env();
+    KeyChord keys;
+    keys.reserve(keysArray.Length());
+    given = 0;
+
+    for (uint32_t i = 0; i < keysArray.Length(); i++) {
+        Napi::Value val = keysArray[i];
+        if (!val.IsString()) {
+            continue;
+        }
+        given++;
+
+        // En uzun tuş adından uzun string'ler kesilir ve eşleşmez
+        char name[keytable::kMaxNameLength + 2];
+        size_t length = 0;
+        if (napi_get_value_string_utf8(env, val, name, sizeof(name), &length) != napi_ok ||
+            length > keytable::kMaxNameLength) {
+            continue;
+        }
+
+        const keytable::KeyEntry* key = keytable::Find(std::string_view(name, length));
+        if (key != nullptr) {
+            keys.push_back(key);
+        }
+    }
+
+    return keys;
+}
+
+// JS'den gelen gönderim modunu oku ('focus' | 'background', varsayılan focus)
+bool ReadDeliveryMode(const Napi::CallbackInfo& info, size_t index, DeliveryMode& mode) {
+    mode = DeliveryMode::kFocus;
+    
+    if (info.Length() <= index || info[index].IsUndefined() || info[index].IsNull()) {
+        return true;
+    }
+    
+    if (!info[index].IsString()) {
+        return false;
+    }
+    
+    std::string value = info[index].As<Napi::String>().Utf8Value();
+    if (value == "background") {
+        mode = DeliveryMode::kBackground;
+        return true;
+    }
+    
+    return value == "focus";
+}
+
+// N-API: sendKeys (Global) -> Promise<boolean>
+Napi::Value SendKeys(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "Array bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t given = 0;
+    KeyChord keys = ReadKeys(info[0].As<Napi::Array>(), given);
+    
+    if (given == 0) {
+        Napi::Error::New(env, "En az bir tuş gerekli").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    InjectionJob* job = new InjectionJob(env);
+    job->keys = std::move(keys);
+    Napi::Promise promise = job->deferred->Promise();
+    
+    injectionWorker.Enqueue(job);
+    
+    return promise;
+}
+
+// N-API: sendKeysToWindow(hwnd, keys, mode?) -> Promise<boolean>
+// Promise, hedef girdiyi kabul etmediyse (arka plan modunda) veya odaklanamadıysa
+// (focus modunda; tuşlar hiç gönderilmez) false ile çözülür
+Napi::Value SendKeysToWindowAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "hwnd ve keys array bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    if (!info[0].IsNumber() || !info[1].IsArray()) {
+        Napi::TypeError::New(env, "Geçersiz parametreler").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    // HWND'yi al (64-bit güvenli)
+    int64_t hwndValue = info[0].As<Napi::Number>().Int64Value();
+    
+    DeliveryMode mode;
+    if (!ReadDeliveryMode(info, 2, mode)) {
+        Napi::TypeError::New(env, "Geçersiz gönderim modu ('focus' veya 'background')").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t given = 0;
+    KeyChord keys = ReadKeys(info[1].As<Napi::Array>(), given);
+    
+    if (given == 0) {
+        Napi::Error::New(env, "En az bir tuş gerekli").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    InjectionJob* job = new InjectionJob(env);
+    job->keys = std::move(keys);
+    job->target = hwndValue;
+    job->mode = mode;
+    Napi::Promise promise = job->deferred->Promise();
+    
+    injectionWorker.Enqueue(job);
+    
+    return promise;
+}
+
+// Tek typeText çağrısında yazılabilecek en uzun metin (bayt)
+constexpr size_t kMaxTextBytes = 64 * 1024;
+
+// N-API: typeText(text) -> Promise<{ typed, skipped }>
+// Metnin tamamı tek toplu iş olarak enjeksiyon thread'inde yazılır
+Napi::Value TypeTextAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "String bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string text = info[0].As<Napi::String>().Utf8Value();
+    if (text.size() > kMaxTextBytes) {
+        Napi::RangeError::New(env, "Metin çok uzun (en fazla 64 KB)").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    InjectionJob* job = new InjectionJob(env);
+    job->text = std::move(text);
+    Napi::Promise promise = job->deferred->Promise();
+    
+    injectionWorker.Enqueue(job);
+    
+    return promise;
+}
+
+// Hazır kısayollar (handle -> tampon). Sadece ana thread'den erişilir,
+// kuyruktaki işler kendi shared_ptr kopyalarını taşır.
+std::unordered_map<uint32_t, std::shared_ptr<PreparedShortcut>> preparedShortcuts;
+uint32_t nextShortcutHandle = 1;
+
+// N-API: prepareShortcut(keys) -> handle
+Napi::Value PrepareShortcut(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "Array bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    uint32_t given = 0;
+    KeyChord keys = ReadKeys(info[0].As<Napi::Array>(), given);
+    
+    if (given == 0) {
+        Napi::Error::New(env, "En az bir tuş gerekli").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    auto prepared = std::make_shared<PreparedShortcut>();
+    prepared->keys = std::move(keys);
+    BuildInputBuffer(prepared->keys, prepared->buffer);
+    
+    uint32_t handle = nextShortcutHandle++;
+    preparedShortcuts[handle] = std::move(prepared);
+    
+    return Napi::Number::New(env, handle);
+}
+
+// Handle'dan hazır kısayolu bul
+std::shared_ptr<PreparedShortcut> FindPreparedShortcut(const Napi::Value& value) {
+    if (!value.IsNumber()) {
+        return nullptr;
+    }
+    
+    auto it = preparedShortcuts.find(value.As<Napi::Number>().Uint32Value());
+    if (it == preparedShortcuts.end()) {
+        return nullptr;
+    }
+    
+    return it->second;
+}
+
+// N-API: fireShortcut(handle) -> Promise<boolean>
+Napi::Value FireShortcut(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    std::shared_ptr<PreparedShortcut> prepared = info.Length() > 0 ? FindPreparedShortcut(info[0]) : nullptr;
+    if (!prepared) {
+        Napi::TypeError::New(env, "Geçersiz kısayol handle'ı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    InjectionJob* job = new InjectionJob(env);
+    job->prepared = std::move(prepared);
+    Napi::Promise promise = job->deferred->Promise();
+    
+    injectionWorker.Enqueue(job);
+    
+    return promise;
+}
+
+// N-API: fireShortcutToWindow(handle, hwnd, mode?) -> Promise<boolean>
+// focus modunda hedef odaklanamazsa tuşlar gönderilmez ve false ile çözülür
+Napi::Value FireShortcutToWindow(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2 || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "handle ve hwnd bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::shared_ptr<PreparedShortcut> prepared = FindPreparedShortcut(info[0]);
+    if (!prepared) {
+        Napi::TypeError::New(env, "Geçersiz kısayol handle'ı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    DeliveryMode mode;
+    if (!ReadDeliveryMode(info, 2, mode)) {
+        Napi::TypeError::New(env, "Geçersiz gönderim modu ('focus' veya 'background')").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    InjectionJob* job = new InjectionJob(env);
+    job->prepared = std::move(prepared);
+    job->target = info[1].As<Napi::Number>().Int64Value();
+    job->mode = mode;
+    Napi::Promise promise = job->deferred->Promise();
+    
+    injectionWorker.Enqueue(job);
+    
+    return promise;
+}
+
+// N-API: releaseShortcut(handle)
+Napi::Value ReleaseShortcut(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        return Napi::Boolean::New(env, false);
+    }
+    
+    size_t erased = preparedShortcuts.erase(info[0].As<Napi::Number>().Uint32Value());
+    return Napi::Boolean::New(env, erased > 0);
+}
+
+// N-API: findWindowByExe(exeName) -> handle | null
+// Olay güdümlü pencere indeksinden O(1) arama (masaüstü taranmaz)
+Napi::Value FindWindowByExeAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Exe adı bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t handle = windowIndex.FindByExe(info[0].As<Napi::String>().Utf8Value());
+    if (handle == 0) {
+        return env.Null();
+    }
+    
+    return Napi::Number::New(env, static_cast<double>(handle));
+}
+
+// N-API: isWindowIndexRunning -> boolean
+// false ise (ör. X11 bağlantısı yok) çağıran getWindowList'e geri düşmeli
+Napi::Value IsWindowIndexRunningAPI(const Napi::CallbackInfo& info) {
+    return Napi::Boolean::New(info.Env(), windowIndex.Running());
+}
+
+// ============================================================
+// Zamanlı makrolar - bkz. macro_engine.h
+// ============================================================
+// compileMacro adım listesini bir kez doğrulayıp derler (prepareShortcut gibi);
+// runMacro makro thread'inde çalıştırır ve sonucu Promise ile döndürür.
+
+// Makro eventleri test modunda kaydedilir, aksi halde platform backend'ine gider
+class SelectedMacroBackend : public MacroBackend {
+public:
+    void KeyDown(const keytable::KeyEntry* key) override {
+        if (injectionMode != testbackend::Mode::kNative) {
+            injectionRecorder.Record("down", key->name);
+            batched_++;
+        } else {
+            native_.KeyDown(key);
+        }
+    }
+
+    void KeyUp(const keytable::KeyEntry* key) override {
+        if (injectionMode != testbackend::Mode::kNative) {
+            injectionRecorder.Record("up", key->name);
+            batched_++;
+        } else {
+            native_.KeyUp(key);
+        }
+    }
+
+    // Test modunda toplu iş boyutu "flush" olarak kaydedilir (tek write() / SendInput)
+    void Flush() override {
+        if (injectionMode != testbackend::Mode::kNative) {
+            injectionRecorder.Record("flush", "", static_cast<double>(batched_));
+            batched_ = 0;
+        } else {
+            native_.Flush();
+        }
+    }
+
+    // Test modunda metin typeText gibi "text" olarak kaydedilir (value: karakter sayısı)
+    textinput::TextStats Text(std::string_view text) override {
+        if (injectionMode == testbackend::Mode::kNative) {
+            return native_.Text(text);
+        }
+        textinput::TextStats stats;
+        stats.skipped = static_cast<uint32_t>(textinput::ForEachCodePoint(text, [&](char32_t) { stats.typed++; }));
+        injectionRecorder.Record("text", text, stats.typed);
+        return stats;
+    }
+
+private:
+    NativeMacroBackend native_;
+    size_t batched_ = 0;
+};
+
+SelectedMacroBackend macroBackend;
+MacroEngine macroEngine(macroBackend);
+
+// Tamamlanma ve ilerleme bildirimlerini ana thread'e taşır
+Napi::ThreadSafeFunction macroCallbacks;
+
+// Derlenmiş makrolar (handle -> program). Sadece ana thread'den erişilir,
+// çalışan makrolar kendi shared_ptr kopyalarını taşır.
+std::unordered_map<uint32_t, std::shared_ptr<const MacroProgram>> compiledMacros;
+uint32_t nextMacroHandle = 1;
+// Çalışan / kuyruktaki makrolar (handle -> çalışma kimliği), cancelMacro için
+std::unordered_multimap<uint32_t, uint32_t> activeMacroRuns;
+
+const uint32_t kMaxMacroDepth = 8;
+const double kMaxMacroDelayMs = 3600000; // 1 saat
+const uint32_t kMaxMacroRepeat = 1000000;
+
+struct MacroJob {
+    Napi::Promise::Deferred deferred;
+    Napi::FunctionReference progress;
+    uint32_t handle = 0;
+    uint32_t runId = 0;
+    MacroResult result;
+
+    explicit MacroJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+};
+
+struct MacroProgress {
+    MacroJob* job;
+    uint64_t done;
+    uint64_t total;
+};
+
+// Tek tuş adı (bilinmeyen tuşta hata)
+const keytable::KeyEntry* ReadMacroKey(const Napi::Value& value, std::string& error) {
+    if (!value.IsString()) {
+        error = "Tuş adı string olmalı";
+        return nullptr;
+    }
+
+    std::string name = value.As<Napi::String>().Utf8Value();
+    const keytable::KeyEntry* key = keytable::Find(name);
+    if (key == nullptr) {
+        error = "Bilinmeyen tuş: " + name;
+    }
+    return key;
+}
+
+// Sayısal alan (sonlu ve [min, max] aralığında)
+bool ReadMacroNumber(const Napi::Object& step, const char* name, double min, double max, double& value) {
+    Napi::Value field = step.Get(name);
+    if (!field.IsNumber()) {
+        return false;
+    }
+    value = field.As<Napi::Number>().DoubleValue();
+    return std::isfinite(value) && value >= min && value <= max;
+}
+
+std::chrono::nanoseconds MacroMilliseconds(double ms) {
+    return std::chrono::nanoseconds(static_cast<int64_t>(std::llround(ms * 1e6)));
+}
+
+// Adım dizisini derle:
+//   { type: 'down' | 'up', key }            tuşu bas / bırak (basılı tutma)
+//   { type: 'chord', keys: [...] }          sırayla bas, ters sırayla bırak
+//   { type: 'delay', ms }                   bekle
+//   { type: 'text', text, interval? }       metni aktif düzene göre yaz (typeText gibi)
+//   { type: 'repeat', count, steps: [...] } iç adımları tekrarla (iç içe olabilir)
+bool CompileMacroSteps(const Napi::Array& steps, MacroProgram& program, uint32_t depth, std::string& error) {
+    if (depth > kMaxMacroDepth) {
+        error = "Tekrarlar en fazla " + std::to_string(kMaxMacroDepth) + " seviye iç içe olabilir";
+        return false;
+    }
+
+    for (uint32_t i = 0; i < steps.Length(); i++) {
+        Napi::Value value = steps[i];
+        if (!value.IsObject()) {
+            error = "Adım nesne olmalı";
+            return false;
+        }
+
+        Napi::Object step = value.As<Napi::Object>();
+        Napi::Value typeValue = step.Get("type");
+        std::string type = typeValue.IsString() ? typeValue.As<Napi::String>().Utf8Value() : "";
+
+        if (type == "down" || type == "up") {
+            const keytable::KeyEntry* key = ReadMacroKey(step.Get("key"), error);
+            if (key == nullptr) {
+                return false;
+            }
+            if (type == "down") {
+                program.Down(key);
+            } else {
+                program.Up(key);
+            }
+        } else if (type == "chord") {
+            Napi::Value keysValue = step.Get("keys");
+            if (!keysValue.IsArray()) {
+                error = "chord adımı keys array'i bekliyor";
+                return false;
+            }
+            Napi::Array keysArray = keysValue.As<Napi::Array>();
+            KeyChord keys;
+            for (uint32_t k = 0; k < keysArray.Length(); k++) {
+                const keytable::KeyEntry* key = ReadMacroKey(keysArray[k], error);
+                if (key == nullptr) {
+                    return false;
+                }
+                keys.push_back(key);
+            }
+            if (keys.empty()) {
+                error = "chord adımı en az bir tuş gerektirir";
+                return false;
+            }
+            program.Chord(keys);
+        } else if (type == "delay") {
+            double ms = 0;
+            if (!ReadMacroNumber(step, "ms", 0, kMaxMacroDelayMs, ms)) {
+                error = "delay adımı 0-3600000 arası ms bekliyor";
+                return false;
+            }
+            program.Delay(MacroMilliseconds(ms));
+        } else if (type == "text") {
+            Napi::Value textValue = step.Get("text");
+            if (!textValue.IsString()) {
+                error = "text adımı text string'i bekliyor";
+                return false;
+            }
+            double interval = 0;
+            if (!step.Get("interval").IsUndefined() && !ReadMacroNumber(step, "interval", 0, kMaxMacroDelayMs, interval)) {
+                error = "text adımının interval değeri geçersiz";
+                return false;
+            }
+            std::string text = textValue.As<Napi::String>().Utf8Value();
+            if (text.size() > kMaxTextBytes) {
+                error = "text adımı çok uzun (en fazla 64 KB)";
+                return false;
+            }
+            program.Text(text, MacroMilliseconds(interval));
+        } else if (type == "repeat") {
+            double count = 0;
+            Napi::Value inner = step.Get("steps");
+            if (!ReadMacroNumber(step, "count", 0, kMaxMacroRepeat, count) || std::floor(count) != count || !inner.IsArray()) {
+                error = "repeat adımı tam sayı count (0-1000000) ve steps array'i bekliyor";
+                return false;
+            }
+            program.BeginRepeat(static_cast<uint32_t>(count));
+            if (!CompileMacroSteps(inner.As<Napi::Array>(), program, depth + 1, error)) {
+                return false;
+            }
+            program.EndRepeat();
+        } else {
+            error = "Bilinmeyen adım türü: " + type;
+            return false;
+        }
+    }
+    return true;
+}
+
+// N-API: compileMacro(steps) -> handle
+Napi::Value CompileMacroAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "Adım array'i bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    auto program = std::make_shared<MacroProgram>();
+    std::string error;
+    if (!CompileMacroSteps(info[0].As<Napi::Array>(), *program, 0, error)) {
+        Napi::TypeError::New(env, error).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    uint32_t handle = nextMacroHandle++;
+    compiledMacros[handle] = std::move(program);
+    return Napi::Number::New(env, handle);
+}
+
+Napi::Object MacroResultObject(Napi::Env env, const MacroResult& result) {
+    Napi::Object object = Napi::Object::New(env);
+    object.Set("completed", Napi::Boolean::New(env, result.completed));
+    object.Set("cancelled", Napi::Boolean::New(env, result.cancelled));
+    object.Set("keyEvents", Napi::Number::New(env, static_cast<double>(result.keyEvents)));
+    object.Set("skipped", Napi::Number::New(env, result.skipped));
+    object.Set("delays", Napi::Number::New(env, result.delays));
+    object.Set("elapsedMs", Napi::Number::New(env, result.elapsedMs));
+    object.Set("meanLateUs", Napi::Number::New(env, result.meanLateUs));
+    object.Set("maxLateUs", Napi::Number::New(env, result.maxLateUs));
+    return object;
+}
+
+// Çalışma bitti (ana thread): kaydı sil, Promise'i çöz
+void FinishMacroJob(Napi::Env env, MacroJob* job) {
+    auto range = activeMacroRuns.equal_range(job->handle);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == job->runId) {
+            activeMacroRuns.erase(it);
+            break;
+        }
+    }
+
+    if (job->result.error.empty()) {
+        job->deferred.Resolve(MacroResultObject(env, job->result));
+    } else {
+        job->deferred.Reject(Napi::Error::New(env, job->result.error).Value());
+    }
+    delete job;
+}
+
+// N-API: runMacro(handle, onProgress?) -> Promise<{ completed, cancelled, keyEvents, skipped, delays, elapsedMs, meanLateUs, maxLateUs }>
+// onProgress(done, total): her beklemenin başında ve sonda, enjekte edilen tuş eventi sayısı.
+// Makrolar sırayla çalışır; iptal edilen makro cancelled: true ile çözülür.
+Napi::Value RunMacroAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    auto it = info.Length() > 0 && info[0].IsNumber()
+                  ? compiledMacros.find(info[0].As<Napi::Number>().Uint32Value())
+                  : compiledMacros.end();
+    if (it == compiledMacros.end()) {
+        Napi::TypeError::New(env, "Geçersiz makro handle'ı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    bool hasProgress = info.Length() > 1 && info[1].IsFunction();
+    if (info.Length() > 1 && !hasProgress && !info[1].IsUndefined() && !info[1].IsNull()) {
+        Napi::TypeError::New(env, "onProgress fonksiyon olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MacroJob* job = new MacroJob(env);
+    job->handle = it->first;
+    if (hasProgress) {
+        job->progress = Napi::Persistent(info[1].As<Napi::Function>());
+    }
+    Napi::Promise promise = job->deferred.Promise();
+
+    MacroEngine::ProgressFn progress;
+    if (hasProgress) {
+        progress = [job](uint64_t done, uint64_t total) {
+            MacroProgress* event = new MacroProgress{ job, done, total };
+            napi_status status = macroCallbacks.NonBlockingCall(event, [](Napi::Env env, Napi::Function, MacroProgress* event) {
+                event->job->progress.Call({ Napi::Number::New(env, static_cast<double>(event->done)),
+                                            Napi::Number::New(env, static_cast<double>(event->total)) });
+                delete event;
+            });
+            if (status != napi_ok) {
+                delete event;
+            }
+        };
+    }
+
+    job->runId = macroEngine.Submit(it->second, std::move(progress), [job](const MacroResult& result) {
+        job->result = result;
+        napi_status status = macroCallbacks.NonBlockingCall(job, [](Napi::Env env, Napi::Function, MacroJob* job) {
+            FinishMacroJob(env, job);
+        });
+        if (status != napi_ok) {
+            // Modül kapanıyor: referans ana thread dışında silinemez, Promise artık çözülemez
+            job->progress.SuppressDestruct();
+            delete job;
+        }
+    });
+    activeMacroRuns.emplace(job->handle, job->runId);
+
+    return promise;
+}
+
+// N-API: cancelMacro(handle) -> boolean
+// Makronun çalışan ve kuyruktaki tüm çalıştırmaları iptal edilir; basılı tuşlar bırakılır
+Napi::Value CancelMacroAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        return Napi::Boolean::New(env, false);
+    }
+
+    bool cancelled = false;
+    auto range = activeMacroRuns.equal_range(info[0].As<Napi::Number>().Uint32Value());
+    for (auto it = range.first; it != range.second; ++it) {
+        cancelled = macroEngine.Cancel(it->second) || cancelled;
+    }
+    return Napi::Boolean::New(env, cancelled);
+}
+
+// N-API: releaseMacro(handle) - çalışan kopyalar bitene kadar program yaşar
+Napi::Value ReleaseMacroAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        return Napi::Boolean::New(env, false);
+    }
+
+    size_t erased = compiledMacros.erase(info[0].As<Napi::Number>().Uint32Value());
+    return Napi::Boolean::New(env, erased > 0);
+}
+
+// ============================================================
+// İşaretçi (fare) enjeksiyonu - bkz. pointer_injector.h
+// ============================================================
+// Çağrılar sadece kuyruğa bırakır (Promise yok, hareket başına ayırma yok).
+// Dönüş false ise işaretçi cihazı hazır değildir; çağıran RobotJS'e geri düşmeli.
+
+// 'left' | 'right' | 'middle' veya 0 (sol), 1 (orta), 2 (sağ)
+bool ReadPointerButton(const Napi::Value& value, PointerButton& button) {
+    if (value.IsNumber()) {
+        switch (value.As<Napi::Number>().Int32Value()) {
+        case 0: button = PointerButton::kLeft; return true;
+        case 1: button = PointerButton::kMiddle; return true;
+        case 2: button = PointerButton::kRight; return true;
+        default: return false;
+        }
+    }
+
+    if (value.IsString()) {
+        std::string name = value.As<Napi::String>().Utf8Value();
+        if (name == "left") { button = PointerButton::kLeft; return true; }
+        if (name == "right") { button = PointerButton::kRight; return true; }
+        if (name == "middle") { button = PointerButton::kMiddle; return true; }
+    }
+    return false;
+}
+
+bool ReadPointerPair(const Napi::CallbackInfo& info, int32_t& x, int32_t& y) {
+    if (info.Length() < 2 || !info[0].IsNumber() || !info[1].IsNumber()) {
+        return false;
+    }
+
+    double first = info[0].As<Napi::Number>().DoubleValue();
+    double second = info[1].As<Napi::Number>().DoubleValue();
+    if (!std::isfinite(first) || !std::isfinite(second)) {
+        return false;
+    }
+
+    x = static_cast<int32_t>(std::lround(first));
+    y = static_cast<int32_t>(std::lround(second));
+    return true;
+}
+
+// N-API: pointerMove(x, y) -> boolean
+// Mutlak konum (sanal masaüstü pikseli); ekran karesi başına son konum gönderilir
+Napi::Value PointerMoveAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int32_t x = 0;
+    int32_t y = 0;
+    if (!ReadPointerPair(info, x, y)) {
+        Napi::TypeError::New(env, "x ve y sayı olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return Napi::Boolean::New(env, pointerInjector.MoveTo(x, y));
+}
+
+// N-API: pointerMoveBy(dx, dy) -> boolean
+// Göreli hareket; kare içinde gelen farklar toplanır
+Napi::Value PointerMoveByAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int32_t dx = 0;
+    int32_t dy = 0;
+    if (!ReadPointerPair(info, dx, dy)) {
+        Napi::TypeError::New(env, "dx ve dy sayı olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return Napi::Boolean::New(env, pointerInjector.MoveBy(dx, dy));
+}
+
+// N-API: pointerButton(button, down) -> boolean
+// Sırası korunur; bekleyen hareket önce gönderilir
+Napi::Value PointerButtonAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    PointerButton button;
+    if (info.Length() < 2 || !ReadPointerButton(info[0], button) || !info[1].IsBoolean()) {
+        Napi::TypeError::New(env, "button ('left' | 'right' | 'middle') ve down (boolean) bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return Napi::Boolean::New(env, pointerInjector.Button(button, info[1].As<Napi::Boolean>().Value()));
+}
+
+// N-API: pointerScroll(dx, dy) -> boolean
+// Çentik cinsinden; pozitif dy yukarı, pozitif dx sağa kaydırır
+Napi::Value PointerScrollAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int32_t dx = 0;
+    int32_t dy = 0;
+    if (!ReadPointerPair(info, dx, dy)) {
+        Napi::TypeError::New(env, "dx ve dy sayı olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return Napi::Boolean::New(env, pointerInjector.Scroll(dx, dy));
+}
+
+// N-API: setPointerFrameRate(hz) - hareket birleştirme aralığı (1-1000 Hz)
+Napi::Value SetPointerFrameRateAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsNumber()) {
+        Napi::TypeError::New(env, "hz sayı olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    pointerInjector.SetFrameRate(info[0].As<Napi::Number>().DoubleValue());
+    return env.Undefined();
+}
+
+// N-API: setPointerDesktop(width, height)
+// Linux'ta X bağlantısı yoksa (ör. saf Wayland) mutlak koordinatların ölçeği
+Napi::Value SetPointerDesktopAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int32_t width = 0;
+    int32_t height = 0;
+    if (!ReadPointerPair(info, width, height)) {
+        Napi::TypeError::New(env, "width ve height sayı olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    pointerInjector.SetDesktopSize(width, height);
+    return env.Undefined();
+}
+
+// N-API: getPointerInfo -> { backend, ready, devicePath, error, frameRate, moves, injectedMoves }
+Napi::Value GetPointerInfoAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    PointerInfo pointer = pointerInjector.Info();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("backend", Napi::String::New(env, pointer.backend));
+    result.Set("ready", Napi::Boolean::New(env, pointer.ready));
+    result.Set("devicePath", Napi::String::New(env, pointer.devicePath));
+    result.Set("error", Napi::String::New(env, pointer.error));
+    result.Set("frameRate", Napi::Number::New(env, pointer.frameRate));
+    result.Set("moves", Napi::Number::New(env, static_cast<double>(pointer.moves)));
+    result.Set("injectedMoves", Napi::Number::New(env, static_cast<double>(pointer.injectedMoves)));
+    return result;
+}
+
+// ============================================================
+// İkili girdi çerçevesi - bkz. input_frame.h
+// ============================================================
+// Kayıtlar Buffer'dan kopyalanmadan okunur ve doğrudan işaretçi kuyruğuna /
+// klavye enjeksiyon thread'ine bırakılır; event başına JS nesnesi oluşmaz.
+
+struct FrameBounds {
+    double x = 0;
+    double y = 0;
+    double width = 0;
+    double height = 0;
+};
+
+bool ReadFrameBounds(const Napi::Value& value, FrameBounds& bounds) {
+    if (!value.IsObject()) {
+        return false;
+    }
+
+    Napi::Object object = value.As<Napi::Object>();
+    double* fields[] = { &bounds.x, &bounds.y, &bounds.width, &bounds.height };
+    const char* names[] = { "x", "y", "width", "height" };
+    for (size_t i = 0; i < 4; i++) {
+        Napi::Value field = object.Get(names[i]);
+        if (!field.IsNumber()) {
+            return false;
+        }
+        *fields[i] = field.As<Napi::Number>().DoubleValue();
+        if (!std::isfinite(*fields[i])) {
+            return false;
+        }
+    }
+    return bounds.width > 0 && bounds.height > 0;
+}
+
+// Normalize konum (0 - kNormalizedMax) -> sanal masaüstü pikseli
+int32_t MapAxis(int32_t value, double origin, double size) {
+    double pixel = origin + static_cast<double>(value) * size / inputframe::kNormalizedMax;
+    return static_cast<int32_t>(std::lround(std::min(std::max(pixel, -2147483648.0), 2147483647.0)));
+}
+
+bool ToPointerButton(uint8_t value, PointerButton& button) {
+    switch (value) {
+    case 0: button = PointerButton::kLeft; return true;
+    case 1: button = PointerButton::kMiddle; return true;
+    case 2: button = PointerButton::kRight; return true;
+    default: return false;
+    }
+}
+
+// Değiştirici maskesi + tuş adı -> kombinasyon (bilinmeyen tuşta boş)
+KeyChord FrameKeyChord(uint8_t modifiers, std::string_view name) {
+    static const keytable::KeyEntry* const kModifierKeys[] = {
+        keytable::Find("CONTROL"), keytable::Find("ALT"), keytable::Find("SHIFT"), keytable::Find("WIN"),
+    };
+
+    KeyChord keys;
+    const keytable::KeyEntry* key = keytable::Find(name);
+    if (key == nullptr) {
+        return keys;
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+        if (modifiers & (1 << i)) {
+            keys.push_back(kModifierKeys[i]);
+        }
+    }
+    keys.push_back(key);
+    return keys;
+}
+
+// Tek kaydı uygula; dryRun'da sadece çözümlenir ve eşlenir (benchmark)
+bool DispatchFrameRecord(const inputframe::Record& record, const FrameBounds& bounds, bool dryRun) {
+    using inputframe::InputRecordType;
+
+    switch (record.type) {
+    case InputRecordType::kMove: {
+        int32_t x = MapAxis(record.x, bounds.x, bounds.width);
+        int32_t y = MapAxis(record.y, bounds.y, bounds.height);
+        return dryRun || pointerInjector.MoveTo(x, y);
+    }
+    case InputRecordType::kMoveBy:
+        return dryRun || pointerInjector.MoveBy(record.x, record.y);
+    case InputRecordType::kButton:
+    case InputRecordType::kClick: {
+        PointerButton button;
+        if (!ToPointerButton(record.button, button)) {
+            return false;
+        }
+        if (dryRun) {
+            return true;
+        }
+        if ((record.flags & inputframe::kHasPosition) &&
+            !pointerInjector.MoveTo(MapAxis(record.x, bounds.x, bounds.width),
+                                    MapAxis(record.y, bounds.y, bounds.height))) {
+            return false;
+        }
+        if (record.type == InputRecordType::kClick) {
+            return pointerInjector.Button(button, true) && pointerInjector.Button(button, false);
+        }
+        return pointerInjector.Button(button, (record.flags & inputframe::kDown) != 0);
+    }
+    case InputRecordType::kScroll:
+        return dryRun || pointerInjector.Scroll(record.x, record.y);
+    case InputRecordType::kKey: {
+        KeyChord keys = FrameKeyChord(record.flags, record.key);
+        if (keys.empty()) {
+            return false;
+        }
+        if (!dryRun) {
+            InjectionJob* job = new InjectionJob();
+            job->keys = std::move(keys);
+            injectionWorker.Enqueue(job);
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+// N-API: dispatchInputFrame(buffer, { bounds, lastSequence?, dryRun? })
+//   -> { success, sequence, time, events, dispatched, stale?, error? }
+// bounds: normalize konumların eşleneceği ekran ({ x, y, width, height }).
+// lastSequence verilmişse ondan yeni olmayan çerçeve uygulanmaz (stale: true).
+Napi::Value DispatchInputFrameAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2 || !info[0].IsBuffer() || !info[1].IsObject()) {
+        Napi::TypeError::New(env, "Buffer ve seçenekler bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object options = info[1].As<Napi::Object>();
+    FrameBounds bounds;
+    if (!ReadFrameBounds(options.Get("bounds"), bounds)) {
+        Napi::TypeError::New(env, "bounds { x, y, width, height } bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Value lastValue = options.Get("lastSequence");
+    bool hasLast = lastValue.IsNumber();
+    uint32_t lastSequence = hasLast ? lastValue.As<Napi::Number>().Uint32Value() : 0;
+    bool dryRun = options.Get("dryRun").ToBoolean().Value();
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    const uint8_t* data = buffer.Data();
+    size_t size = buffer.Length();
+
+    Napi::Object result = Napi::Object::New(env);
+    inputframe::Header header;
+
+    // Eski/tekrar çerçeve: kayıtlara hiç bakmadan reddet
+    inputframe::Status status = inputframe::ParseHeader(data, size, header);
+    if (status == inputframe::Status::kOk && hasLast && !inputframe::IsNewer(header.sequence, lastSequence)) {
+        result.Set("success", Napi::Boolean::New(env, false));
+        result.Set("stale", Napi::Boolean::New(env, true));
+        result.Set("sequence", Napi::Number::New(env, header.sequence));
+        return result;
+    }
+
+    size_t skipped = 0;
+    uint32_t dispatched = 0;
+    uint32_t time = header.time;
+    if (status == inputframe::Status::kOk) {
+        status = inputframe::Decode(data, size, header, skipped, [&](const inputframe::Record& record) {
+            if (DispatchFrameRecord(record, bounds, dryRun)) {
+                dispatched++;
+            }
+            time = record.time;
+        });
+    }
+
+    if (status != inputframe::Status::kOk) {
+        result.Set("success", Napi::Boolean::New(env, false));
+        result.Set("error", Napi::String::New(env, inputframe::StatusMessage(status)));
+        return result;
+    }
+
+    result.Set("success", Napi::Boolean::New(env, true));
+    result.Set("sequence", Napi::Number::New(env, header.sequence));
+    result.Set("time", Napi::Number::New(env, time));
+    result.Set("events", Napi::Number::New(env, header.count));
+    result.Set("dispatched", Napi::Number::New(env, dispatched));
+    return result;
+}
+
+// N-API: getBackendInfo -> { backend, ready, devicePath, error }
+Napi::Value GetBackendInfoAPI(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    BackendInfo backend = QueryBackend();
+    if (injectionMode != testbackend::Mode::kNative) {
+        backend = { testbackend::ModeName(injectionMode), true, "", "" };
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("backend", Napi::String::New(env, backend.name));
+    result.Set("ready", Napi::Boolean::New(env, backend.ready));
+    result.Set("devicePath", Napi::String::New(env, backend.devicePath));
+    result.Set("error", Napi::String::New(env, backend.error));
+    
+    return result;
+}
+
+// N-API: getTestBackend() -> { mode, recorded, dropped }
+Napi::Value GetTestBackendAPI(const Napi::CallbackInfo& info) {
+    return testbackend::InfoObject(info.Env(), injectionMode, injectionRecorder);
+}
+
+// N-API: takeRecording() -> [{ time, op, target, value }] (recording modunda)
+Napi::Value TakeRecordingAPI(const Napi::CallbackInfo& info) {
+    return testbackend::RecordingArray(info.Env(), injectionRecorder);
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStatsAPI(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), keyboardMetrics);
+}
+
+// Modül başlatma
+Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    // Thread'ler başlamadan seçilir, sonra değişmez
+    injectionMode = testbackend::ModeFromEnvironment();
+    injectionRecorder.SetMode(injectionMode);
+    if (injectionMode == testbackend::Mode::kNative) {
+        InitBackend();
+    }
+    injectionWorker.Start(env);
+    windowIndex.Start();
+    // Test modunda işaretçi cihazı da açılmaz (getPointerInfo hazır değil döner)
+    if (injectionMode == testbackend::Mode::kNative) {
+        pointerInjector.Start();
+    }
+    macroCallbacks = Napi::ThreadSafeFunction::New(
+        env,
+        Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+        "keyboardMacro",
+        0,
+        1
+    );
+    // Çalışan makro yokken process'in kapanmasını engelleme
+    macroCallbacks.Unref(env);
+    macroEngine.Start();
+    env.AddCleanupHook([]() {
+        macroEngine.Stop();
+        macroCallbacks.Release();
+        pointerInjector.Stop();
+        windowIndex.Stop();
+        injectionWorker.Stop();
+        ShutdownBackend();
+    });
+
+    metrics::Export(env, exports, keyboardMetrics, "sendKeys", SendKeys);
+    metrics::Export(env, exports, keyboardMetrics, "sendKeysToWindow", SendKeysToWindowAPI);
+    metrics::Export(env, exports, keyboardMetrics, "typeText", TypeTextAPI);
+    metrics::Export(env, exports, keyboardMetrics, "getWindowList", GetWindowListAPI);
+    metrics::Export(env, exports, keyboardMetrics, "prepareShortcut", PrepareShortcut);
+    metrics::Export(env, exports, keyboardMetrics, "fireShortcut", FireShortcut);
+    metrics::Export(env, exports, keyboardMetrics, "fireShortcutToWindow", FireShortcutToWindow);
+    metrics::Export(env, exports, keyboardMetrics, "releaseShortcut", ReleaseShortcut);
+    metrics::Export(env, exports, keyboardMetrics, "getBackendInfo", GetBackendInfoAPI);
+    metrics::Export(env, exports, keyboardMetrics, "getTestBackend", GetTestBackendAPI);
+    metrics::Export(env, exports, keyboardMetrics, "takeRecording", TakeRecordingAPI);
+    metrics::Export(env, exports, keyboardMetrics, "findWindowByExe", FindWindowByExeAPI);
+    metrics::Export(env, exports, keyboardMetrics, "isWindowIndexRunning", IsWindowIndexRunningAPI);
+    metrics::Export(env, exports, keyboardMetrics, "pointerMove", PointerMoveAPI);
+    metrics::Export(env, exports, keyboardMetrics, "pointerMoveBy", PointerMoveByAPI);
+    metrics::Export(env, exports, keyboardMetrics, "pointerButton", PointerButtonAPI);
+    metrics::Export(env, exports, keyboardMetrics, "pointerScroll", PointerScrollAPI);
+    metrics::Export(env, exports, keyboardMetrics, "setPointerFrameRate", SetPointerFrameRateAPI);
+    metrics::Export(env, exports, keyboardMetrics, "setPointerDesktop", SetPointerDesktopAPI);
+    metrics::Export(env, exports, keyboardMetrics, "getPointerInfo", GetPointerInfoAPI);
+    metrics::Export(env, exports, keyboardMetrics, "dispatchInputFrame", DispatchInputFrameAPI);
+    metrics::Export(env, exports, keyboardMetrics, "compileMacro", CompileMacroAPI);
+    metrics::Export(env, exports, keyboardMetrics, "runMacro", RunMacroAPI);
+    metrics::Export(env, exports, keyboardMetrics, "cancelMacro", CancelMacroAPI);
+    metrics::Export(env, exports, keyboardMetrics, "releaseMacro", ReleaseMacroAPI);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStatsAPI));
+    return exports;
+}
+
+NODE_API_MODULE(keyboard, Init)
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Platformdan bağımsız, derleme zamanında üretilen tuş tablosu
+// Tek kaynak: her tuş hem Win32 Virtual Key hem de Linux evdev KEY_* koduna eşlenir.
+// Arama std::string oluşturmadan string_view üzerinde, büyük/küçük harf duyarsız
+// ve mükemmel hash (çakışmasız) ile tek tablo erişimiyle yapılır.
+
+namespace keytable {
+
+// Tuş özellikleri (giriş başına paketlenmiş)
+enum KeyFlags : uint8_t {
+    kExtended = 1 << 0, // KEYEVENTF_EXTENDEDKEY gerektirir
+    kMedia    = 1 << 1, // Medya / tarayıcı tuşu (extended gönderilir)
+    kModifier = 1 << 2, // Shift, Ctrl, Alt, Win
+};
+
+struct KeyEntry {
+    std::string_view name; // Büyük harf tuş adı
+    uint16_t vk;           // Win32 Virtual Key kodu
+    uint16_t evdev;        // Linux input-event-codes.h KEY_* kodu
+    uint8_t flags;         // KeyFlags
+
+    constexpr bool IsExtended() const { return (flags & (kExtended | kMedia)) != 0; }
+    constexpr bool IsMedia() const { return (flags & kMedia) != 0; }
+    constexpr bool IsModifier() const { return (flags & kModifier) != 0; }
+};
+
+constexpr KeyEntry kKeys[] = {
+    // Harfler
+    {"A", 0x41, 30, 0}, // 'A' / KEY_A
+    {"B", 0x42, 48, 0}, // 'B' / KEY_B
+    {"C", 0x43, 46, 0}, // 'C' / KEY_C
+    {"D", 0x44, 32, 0}, // 'D' / KEY_D
+    {"E", 0x45, 18, 0}, // 'E' / KEY_E
+    {"F", 0x46, 33, 0}, // 'F' / KEY_F
+    {"G", 0x47, 34, 0}, // 'G' / KEY_G
+    {"H", 0x48, 35, 0}, // 'H' / KEY_H
+    {"I", 0x49, 23, 0}, // 'I' / KEY_I
+    {"J", 0x4A, 36, 0}, // 'J' / KEY_J
+    {"K", 0x4B, 37, 0}, // 'K' / KEY_K
+    {"L", 0x4C, 38, 0}, // 'L' / KEY_L
+    {"M", 0x4D, 50, 0}, // 'M' / KEY_M
+    {"N", 0x4E, 49, 0}, // 'N' / KEY_N
+    {"O", 0x4F, 24, 0}, // 'O' / KEY_O
+    {"P", 0x50, 25, 0}, // 'P' / KEY_P
+    {"Q", 0x51, 16, 0}, // 'Q' / KEY_Q
+    {"R", 0x52, 19, 0}, // 'R' / KEY_R
+    {"S", 0x53, 31, 0}, // 'S' / KEY_S
+    {"T", 0x54, 20, 0}, // 'T' / KEY_T
+    {"U", 0x55, 22, 0}, // 'U' / KEY_U
+    {"V", 0x56, 47, 0}, // 'V' / KEY_V
+    {"W", 0x57, 17, 0}, // 'W' / KEY_W
+    {"X", 0x58, 45, 0}, // 'X' / KEY_X
+    {"Y", 0x59, 21, 0}, // 'Y' / KEY_Y
+    {"Z", 0x5A, 44, 0}, // 'Z' / KEY_Z
+
+    // Rakamlar
+    {"0", 0x30, 11, 0}, // '0' / KEY_0
+    {"1", 0x31, 2, 0}, // '1' / KEY_1
+    {"2", 0x32, 3, 0}, // '2' / KEY_2
+    {"3", 0x33, 4, 0}, // '3' / KEY_3
+    {"4", 0x34, 5, 0}, // '4' / KEY_4
+    {"5", 0x35, 6, 0}, // '5' / KEY_5
+    {"6", 0x36, 7, 0}, // '6' / KEY_6
+    {"7", 0x37, 8, 0}, // '7' / KEY_7
+    {"8", 0x38, 9, 0}, // '8' / KEY_8
+    {"9", 0x39, 10, 0}, // '9' / KEY_9
+
+    // Fonksiyon tuşları
+    {"F1", 0x70, 59, 0}, // VK_F1 / KEY_F1
+    {"F2", 0x71, 60, 0}, // VK_F2 / KEY_F2
+    {"F3", 0x72, 61, 0}, // VK_F3 / KEY_F3
+    {"F4", 0x73, 62, 0}, // VK_F4 / KEY_F4
+    {"F5", 0x74, 63, 0}, // VK_F5 / KEY_F5
+    {"F6", 0x75, 64, 0}, // VK_F6 / KEY_F6
+    {"F7", 0x76, 65, 0}, // VK_F7 / KEY_F7
+    {"F8", 0x77, 66, 0}, // VK_F8 / KEY_F8
+    {"F9", 0x78, 67, 0}, // VK_F9 / KEY_F9
+    {"F10", 0x79, 68, 0}, // VK_F10 / KEY_F10
+    {"F11", 0x7A, 87, 0}, // VK_F11 / KEY_F11
+    {"F12", 0x7B, 88, 0}, // VK_F12 / KEY_F12
+
+    // Özel tuşlar
+    {"ENTER", 0x0D, 28, 0}, // VK_RETURN / KEY_ENTER
+    {"ESCAPE", 0x1B, 1, 0}, // VK_ESCAPE / KEY_ESC
+    {"BACKSPACE", 0x08, 14, 0}, // VK_BACK / KEY_BACKSPACE
+    {"TAB", 0x09, 15, 0}, // VK_TAB / KEY_TAB
+    {"SPACE", 0x20, 57, 0}, // VK_SPACE / KEY_SPACE
+
+    // Modifier tuşları
+    {"SHIFT", 0x10, 42, kModifier}, // VK_SHIFT / KEY_LEFTSHIFT
+    {"CONTROL", 0x11, 29, kModifier}, // VK_CONTROL / KEY_LEFTCTRL
+    {"ALT", 0x12, 56, kModifier}, // VK_MENU / KEY_LEFTALT
+    {"CTRL", 0x11, 29, kModifier}, // VK_CONTROL / KEY_LEFTCTRL
+
+    // Ok ve gezinme tuşları
+    {"LEFT", 0x25, 105, kExtended}, // VK_LEFT / KEY_LEFT
+    {"UP", 0x26, 103, kExtended}, // VK_UP / KEY_UP
+    {"RIGHT", 0x27, 106, kExtended}, // VK_RIGHT / KEY_RIGHT
+    {"DOWN", 0x28, 108, kExtended}, // VK_DOWN / KEY_DOWN
+    {"HOME", 0x24, 102, kExtended}, // VK_HOME / KEY_HOME
+    {"END", 0x23, 107, kExtended}, // VK_END / KEY_END
+    {"PAGEUP", 0x21, 104, kExtended}, // VK_PRIOR / KEY_PAGEUP
+    {"PAGEDOWN", 0x22, 109, kExtended}, // VK_NEXT / KEY_PAGEDOWN
+    {"DELETE", 0x2E, 111, kExtended}, // VK_DELETE / KEY_DELETE
+    {"INSERT", 0x2D, 110, kExtended}, // VK_INSERT / KEY_INSERT
+
+    // Kilit ve sistem tuşları
+    {"CAPSLOCK", 0x14, 58, 0}, // VK_CAPITAL / KEY_CAPSLOCK
+    {"NUMLOCK", 0x90, 69, 0}, // VK_NUMLOCK / KEY_NUMLOCK
+    {"SCROLLLOCK", 0x91, 70, 0}, // VK_SCROLL / KEY_SCROLLLOCK
+    {"PRINTSCREEN", 0x2C, 99, 0}, // VK_SNAPSHOT / KEY_SYSRQ
+    {"PAUSE", 0x13, 119, 0}, // VK_PAUSE / KEY_PAUSE
+
+    // Medya tuşları
+    {"VOLUMEUP", 0xAF, 115, kMedia}, // VK_VOLUME_UP / KEY_VOLUMEUP
+    {"VOLUMEDOWN", 0xAE, 114, kMedia}, // VK_VOLUME_DOWN / KEY_VOLUMEDOWN
+    {"VOLUMEMUTE", 0xAD, 113, kMedia}, // VK_VOLUME_MUTE / KEY_MUTE
+    {"MEDIAPLAYPAUSE", 0xB3, 164, kMedia}, // VK_MEDIA_PLAY_PAUSE / KEY_PLAYPAUSE
+    {"MEDIASTOP", 0xB2, 166, kMedia}, // VK_MEDIA_STOP / KEY_STOPCD
+    {"MEDIANEXTTRACK", 0xB0, 163, kMedia}, // VK_MEDIA_NEXT_TRACK / KEY_NEXTSONG
+    {"MEDIAPREVIOUSTRACK", 0xB1, 165, kMedia}, // VK_MEDIA_PREV_TRACK / KEY_PREVIOUSSONG
+
+    // Tarayıcı tuşları
+    {"BROWSERHOME", 0xAC, 172, kMedia}, // VK_BROWSER_HOME / KEY_HOMEPAGE
+    {"BROWSERBACK", 0xA6, 158, kMedia}, // VK_BROWSER_BACK / KEY_BACK
+    {"BROWSERFORWARD", 0xA7, 159, kMedia}, // VK_BROWSER_FORWARD / KEY_FORWARD
+    {"BROWSERREFRESH", 0xA8, 173, kMedia}, // VK_BROWSER_REFRESH / KEY_REFRESH
+    {"BROWSERSTOP", 0xA9, 128, kMedia}, // VK_BROWSER_STOP / KEY_STOP
+    {"BROWSERSEARCH", 0xAA, 217, kMedia}, // VK_BROWSER_SEARCH / KEY_SEARCH
+    {"BROWSERFAVORITES", 0xAB, 156, kMedia}, // VK_BROWSER_FAVORITES / KEY_BOOKMARKS
+
+    // Windows tuşları
+    {"WIN", 0x5B, 125, kExtended | kModifier}, // VK_LWIN / KEY_LEFTMETA
+    {"LWIN", 0x5B, 125, kExtended | kModifier}, // VK_LWIN / KEY_LEFTMETA
+    {"RWIN", 0x5C, 126, kExtended | kModifier}, // VK_RWIN / KEY_RIGHTMETA
+};
+
+constexpr size_t kKeyCount = sizeof(kKeys) / sizeof(kKeys[0]);
+
+constexpr char ToUpper(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+// FNV-1a (büyük harfe çevrilerek) + son karıştırma
+constexpr uint32_t Hash(std::string_view name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : name) {
+        h ^= static_cast<uint8_t>(ToUpper(c));
+        h *= 16777619u;
+    }
+    return h ^ (h >> 15);
+}
+
+// Hash tablosu boyutu ve çakışmasız seed (tablo değişirse yeni seed aranmalı;
+// static_assert aşağıda bunu derleme zamanında doğrular)
+constexpr size_t kSlotCount = 512;
+constexpr uint32_t kSeed = 576;
+constexpr uint8_t kEmptySlot = 0xFF;
+
+static_assert(kKeyCount < kEmptySlot, "Tuş tablosu uint8_t indekse sığmalı");
+
+struct SlotTable {
+    uint8_t slots[kSlotCount];
+    bool perfect;
+};
+
+constexpr SlotTable BuildSlots() {
+    SlotTable table{};
+    table.perfect = true;
+    for (size_t i = 0; i < kSlotCount; i++) {
+        table.slots[i] = kEmptySlot;
+    }
+    for (size_t i = 0; i < kKeyCount; i++) {
+        size_t slot = Hash(kKeys[i].name, kSeed) & (kSlotCount - 1);
+        if (table.slots[slot] != kEmptySlot) {
+            table.perfect = false;
+        }
+        table.slots[slot] = static_cast<uint8_t>(i);
+    }
+    return table;
+}
+
+constexpr SlotTable kSlots = BuildSlots();
+
+static_assert(kSlots.perfect, "Tuş tablosu hash'i çakışıyor, kSeed yeniden seçilmeli");
+
+constexpr size_t MaxNameLength() {
+    size_t longest = 0;
+    for (size_t i = 0; i < kKeyCount; i++) {
+        if (kKeys[i].name.size() > longest) {
+            longest = kKeys[i].name.size();
+        }
+    }
+    return longest;
+}
+
+constexpr size_t kMaxNameLength = MaxNameLength();
+
+constexpr bool EqualsIgnoreCase(std::string_view upper, std::string_view name) {
+    if (upper.size() != name.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < name.size(); i++) {
+        if (upper[i] != ToUpper(name[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Tuş adını bul (bulunamazsa nullptr)
+constexpr const KeyEntry* Find(std::string_view name) {
+    if (name.empty() || name.size() > kMaxNameLength) {
+        return nullptr;
+    }
+
+    uint8_t index = kSlots.slots[Hash(name, kSeed) & (kSlotCount - 1)];
+    if (index == kEmptySlot) {
+        return nullptr;
+    }
+
+    const KeyEntry& entry = kKeys[index];
+    return EqualsIgnoreCase(entry.name, name) ? &entry : nullptr;
+}
+
+static_assert(Find("ctrl") != nullptr && Find("ctrl")->vk == 0x11, "Küçük harf arama çalışmalı");
+static_assert(Find("NOPE") == nullptr, "Bilinmeyen tuş nullptr dönmeli");
+
+} // namespace keytable
@@ -0,0 +1,463 @@
+#include "macro_engine.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#elif defined(__linux__)
+#include <cerrno>
+#include <time.h>
+#endif
+
+namespace {
+
+// İptal edilebilir bekleme hedeften bu kadar önce biter, kalanı hassas beklenir
+const auto kSpinMargin = std::chrono::milliseconds(2);
+
+// Hedef zamana kadar hassas bekleme (iptal edilemez, en fazla kSpinMargin sürer)
+void PreciseSleepUntil(std::chrono::steady_clock::time_point deadline) {
+#if defined(__linux__)
+    // libstdc++'ta steady_clock CLOCK_MONOTONIC'tir
+    auto since = deadline.time_since_epoch();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(since);
+    timespec target;
+    target.tv_sec = static_cast<time_t>(seconds.count());
+    target.tv_nsec = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(since - seconds).count());
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+    }
+#elif defined(_WIN32)
+    // Windows 10 1803+: yüksek çözünürlüklü timer; yoksa Sleep çözünürlüğü (~1-15 ms)
+    // yetmediği için son kısım yield ile beklenir
+    static thread_local HANDLE timer = CreateWaitableTimerExW(
+        NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    auto remaining = deadline - std::chrono::steady_clock::now();
+    if (timer && remaining > std::chrono::microseconds(500)) {
+        LARGE_INTEGER due;
+        // Göreli süre, 100 ns birimi, negatif; yarım ms erken uyan
+        due.QuadPart = -static_cast<LONGLONG>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - std::chrono::microseconds(500)).count() / 100);
+        if (SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE)) {
+            WaitForSingleObject(timer, INFINITE);
+        }
+    }
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+} // namespace
+
+// ============================================================
+// MacroProgram
+// ============================================================
+
+void MacroProgram::Down(const keytable::KeyEntry* key) {
+    MacroOp op{ MacroOp::Kind::kDown };
+    op.key = key;
+    ops_.push_back(op);
+}
+
+void MacroProgram::Up(const keytable::KeyEntry* key) {
+    MacroOp op{ MacroOp::Kind::kUp };
+    op.key = key;
+    ops_.push_back(op);
+}
+
+void MacroProgram::Chord(const std::vector<const keytable::KeyEntry*>& keys) {
+    for (const keytable::KeyEntry* key : keys) {
+        Down(key);
+    }
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+        Up(*it);
+    }
+}
+
+void MacroProgram::Delay(std::chrono::nanoseconds delay) {
+    if (delay.count() <= 0) {
+        return;
+    }
+
+    // Ardışık beklemeler birleşir
+    if (!ops_.empty() && ops_.back().kind == MacroOp::Kind::kDelay) {
+        ops_.back().delay += delay;
+        return;
+    }
+
+    MacroOp op{ MacroOp::Kind::kDelay };
+    op.delay = delay;
+    ops_.push_back(op);
+}
+
+void MacroProgram::Text(std::string_view text, std::chrono::nanoseconds interval) {
+    // Karakterler burada çözülmez: düzen derleme ile çalıştırma arasında değişebilir
+    // ve TextKeymap sadece enjeksiyon thread'inde kullanılır. Metin karakter
+    // sınırlarından bölünür ("\r\n" tek karakter); aralıklıysa her karakter ayrı adım.
+    const size_t chunkChars = interval.count() > 0 ? 1 : kTextChunkChars;
+    size_t begin = 0;
+    size_t chars = 0;
+    bool first = true;
+
+    auto emit = [&](size_t end) {
+        if (!first) {
+            Delay(interval);
+        }
+        first = false;
+        MacroOp op{ MacroOp::Kind::kText };
+        op.target = static_cast<uint32_t>(texts_.size());
+        op.count = static_cast<uint32_t>(chars);
+        texts_.emplace_back(text.substr(begin, end - begin));
+        ops_.push_back(op);
+        begin = end;
+        chars = 0;
+    };
+
+    size_t i = 0;
+    while (i < text.size()) {
+        size_t next = i + 1;
+        if (text[i] == '\r' && next < text.size() && text[next] == '\n') {
+            next++;
+        } else {
+            // Devam baytları önceki karaktere aittir (geçersizse yazılırken atlanır)
+            while (next < text.size() && (static_cast<uint8_t>(text[next]) & 0xC0) == 0x80) {
+                next++;
+            }
+        }
+        i = next;
+        if (++chars == chunkChars) {
+            emit(i);
+        }
+    }
+    if (chars > 0) {
+        emit(i);
+    }
+}
+
+void MacroProgram::BeginRepeat(uint32_t count) {
+    MacroOp op{ MacroOp::Kind::kLoopBegin };
+    op.count = count;
+    openLoops_.push_back(static_cast<uint32_t>(ops_.size()));
+    ops_.push_back(op);
+}
+
+bool MacroProgram::EndRepeat() {
+    if (openLoops_.empty()) {
+        return false;
+    }
+
+    MacroOp op{ MacroOp::Kind::kLoopEnd };
+    op.target = openLoops_.back();
+    openLoops_.pop_back();
+    ops_.push_back(op);
+    return true;
+}
+
+uint64_t MacroProgram::KeyEventCount() const {
+    const uint64_t kMax = UINT64_MAX / 2;
+
+    // Her iç içe seviyenin sayacı; kLoopEnd'de seviye sayısıyla çarpılıp üste eklenir
+    std::vector<uint64_t> levels(1, 0);
+    for (const MacroOp& op : ops_) {
+        switch (op.kind) {
+        case MacroOp::Kind::kDown:
+        case MacroOp::Kind::kUp:
+            levels.back() = std::min(levels.back() + 1, kMax);
+            break;
+        case MacroOp::Kind::kText:
+            // Karakter başına bas + bırak (düzende olmayanlar çalışırken düşer)
+            levels.back() = std::min(levels.back() + 2 * uint64_t(op.count), kMax);
+            break;
+        case MacroOp::Kind::kLoopBegin:
+            levels.push_back(0);
+            break;
+        case MacroOp::Kind::kLoopEnd: {
+            uint64_t inner = levels.back();
+            levels.pop_back();
+            uint64_t count = ops_[op.target].count;
+            uint64_t total = (count != 0 && inner > kMax / count) ? kMax : inner * count;
+            levels.back() = std::min(levels.back() + total, kMax);
+            break;
+        }
+        case MacroOp::Kind::kDelay:
+            break;
+        }
+    }
+
+    // Kapatılmamış tekrarlar (Complete() false) tek sefer sayılır
+    uint64_t total = 0;
+    for (uint64_t level : levels) {
+        total = std::min(total + level, kMax);
+    }
+    return total;
+}
+
+// ============================================================
+// MacroEngine
+// ============================================================
+
+void MacroEngine::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread_.joinable()) {
+        return;
+    }
+    stopping_ = false;
+    thread_ = std::thread([this]() { Loop(); });
+}
+
+void MacroEngine::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!thread_.joinable()) {
+            return;
+        }
+        stopping_ = true;
+        if (current_) {
+            current_->cancelled.store(true);
+        }
+        for (auto& run : queue_) {
+            run->cancelled.store(true);
+        }
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+uint32_t MacroEngine::Submit(std::shared_ptr<const MacroProgram> program, ProgressFn progress, DoneFn done) {
+    auto run = std::make_shared<Run>();
+    run->program = std::move(program);
+    run->progress = std::move(progress);
+    run->done = std::move(done);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        run->id = nextId_++;
+        if (nextId_ == 0) {
+            nextId_ = 1;
+        }
+        queue_.push_back(run);
+    }
+    wake_.notify_all();
+    return run->id;
+}
+
+bool MacroEngine::Cancel(uint32_t runId) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<Run> run;
+        if (current_ && current_->id == runId) {
+            run = current_;
+        } else {
+            for (auto& queued : queue_) {
+                if (queued->id == runId) {
+                    run = queued;
+                    break;
+                }
+            }
+        }
+
+        if (!run || run->cancelled.exchange(true)) {
+            return false;
+        }
+    }
+    // Bekleyen SleepUntil uyanır; kuyruktaki çalışma sırası gelince hemen biter
+    wake_.notify_all();
+    return true;
+}
+
+void MacroEngine::Loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;) {
+        wake_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return; // stopping_ ve iş yok
+        }
+
+        current_ = queue_.front();
+        queue_.pop_front();
+        std::shared_ptr<Run> run = current_;
+        lock.unlock();
+
+        MacroResult result;
+        if (run->cancelled.load()) {
+            result.cancelled = true;
+        } else {
+            Execute(*run, result);
+        }
+        if (run->done) {
+            run->done(result);
+        }
+
+        lock.lock();
+        current_.reset();
+    }
+}
+
+bool MacroEngine::SleepUntil(Run& run, std::chrono::steady_clock::time_point deadline) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wake_.wait_until(lock, deadline - kSpinMargin, [&run]() { return run.cancelled.load(); })) {
+            return false;
+        }
+    }
+
+    PreciseSleepUntil(deadline);
+    return !run.cancelled.load();
+}
+
+void MacroEngine::Execute(Run& run, MacroResult& result) {
+    const std::vector<MacroOp>& ops = run.program->Ops();
+    const uint64_t total = run.program->KeyEventCount();
+
+    // Her açık tekrarın kalan tur sayısı
+    std::vector<uint32_t> remaining;
+    held_.clear();
+
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start;
+    double lateTotalUs = 0;
+    bool pending = false;
+    size_t batched = 0;
+
+    auto flush = [&]() {
+        if (pending) {
+            backend_.Flush();
+            pending = false;
+            batched = 0;
+        }
+    };
+
+    // Toplu iş dolunca gönder ve kısa bekle; bekleme iptali de görür
+    auto added = [&]() {
+        result.keyEvents++;
+        pending = true;
+        if (++batched >= kMaxBatchEvents) {
+            flush();
+            if (!SleepUntil(run, std::chrono::steady_clock::now() + kBatchPause)) {
+                result.cancelled = true;
+            }
+        }
+    };
+
+    try {
+        for (size_t pc = 0; pc < ops.size(); pc++) {
+            const MacroOp& op = ops[pc];
+
+            switch (op.kind) {
+            case MacroOp::Kind::kDown:
+                backend_.KeyDown(op.key);
+                if (std::find(held_.begin(), held_.end(), op.key) == held_.end()) {
+                    held_.push_back(op.key);
+                }
+                added();
+                break;
+
+            case MacroOp::Kind::kUp:
+                backend_.KeyUp(op.key);
+                held_.erase(std::remove(held_.begin(), held_.end(), op.key), held_.end());
+                added();
+                break;
+
+            case MacroOp::Kind::kText: {
+                flush();
+                // Beklemesiz ardışık parçalar arasında da uinput okuyucusu yetişsin
+                if (pc > 0 && ops[pc - 1].kind == MacroOp::Kind::kText &&
+                    !SleepUntil(run, std::chrono::steady_clock::now() + kBatchPause)) {
+                    result.cancelled = true;
+                    break;
+                }
+                textinput::TextStats stats = backend_.Text(run.program->TextAt(op.target));
+                result.keyEvents += uint64_t(stats.typed) * 2;
+                result.skipped += stats.skipped;
+                break;
+            }
+
+            case MacroOp::Kind::kDelay: {
+                flush();
+                if (run.progress) {
+                    run.progress(result.keyEvents, total);
+                }
+
+                // Mutlak çizelge: gecikme birikmez; hedef geçmişte kaldıysa beklenmez
+                deadline += op.delay;
+                if (!SleepUntil(run, deadline)) {
+                    result.cancelled = true;
+                    break;
+                }
+                double lateUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - deadline).count();
+                lateTotalUs += lateUs;
+                result.maxLateUs = std::max(result.maxLateUs, lateUs);
+                result.delays++;
+                break;
+            }
+
+            case MacroOp::Kind::kLoopBegin:
+                if (op.count == 0) {
+                    // Sıfır tekrar: eşleşen kLoopEnd'in arkasına atla
+                    int depth = 0;
+                    for (size_t i = pc + 1; i < ops.size(); i++) {
+                        if (ops[i].kind == MacroOp::Kind::kLoopBegin) {
+                            depth++;
+                        } else if (ops[i].kind == MacroOp::Kind::kLoopEnd && depth-- == 0) {
+                            pc = i;
+                            break;
+                        }
+                    }
+                } else {
+                    remaining.push_back(op.count);
+                }
+                break;
+
+            case MacroOp::Kind::kLoopEnd:
+                if (--remaining.back() > 0) {
+                    // Beklemesiz sonsuz döngü iptali görebilsin
+                    if (run.cancelled.load()) {
+                        result.cancelled = true;
+                        break;
+                    }
+                    pc = op.target;
+                } else {
+                    remaining.pop_back();
+                }
+                break;
+            }
+
+            if (result.cancelled) {
+                break;
+            }
+        }
+
+        // Makro bitti veya iptal edildi: basılı kalan tuşları bırak
+        for (auto it = held_.rbegin(); it != held_.rend(); ++it) {
+            backend_.KeyUp(*it);
+            pending = true;
+        }
+        held_.clear();
+        flush();
+        result.completed = !result.cancelled;
+    } catch (const std::exception& e) {
+        result.error = e.what();
+        // En iyi çabayla bırakmayı dene (ör. geçici yazma hatası)
+        try {
+            for (auto it = held_.rbegin(); it != held_.rend(); ++it) {
+                backend_.KeyUp(*it);
+            }
+            backend_.Flush();
+        } catch (...) {
+        }
+        held_.clear();
+    }
+
+    if (run.progress && result.completed) {
+        run.progress(result.keyEvents, total);
+    }
+
+    result.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    result.meanLateUs = result.delays > 0 ? lateTotalUs / result.delays : 0;
+}
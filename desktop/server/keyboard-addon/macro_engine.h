@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "keytable.h"
+#include "text_input.h"
+
+// Zamanlı makro motoru (ör. OBS sahne değiştir -> 200 ms bekle -> kaydı başlat)
+// JS zamanlayıcıları event loop meşgulken kayar; burada derlenmiş adım listesi
+// kendi thread'inde, mutlak zaman çizelgesiyle çalışır: her bekleme bir önceki
+// beklemenin hedef zamanına eklenir, enjeksiyon süresi gecikmeleri biriktirmez.
+//
+// Bekleme iki aşamalıdır: hedeften kSpinMargin öncesine kadar iptal edilebilir
+// condition_variable beklemesi, kalan kısım Linux'ta clock_nanosleep(TIMER_ABSTIME),
+// Windows'ta yüksek çözünürlüklü waitable timer. İptal gecikmesi en fazla kSpinMargin.
+//
+// Ardışık tuş eventleri (araya bekleme girmeden) tek toplu iş olarak backend'e
+// verilir (tek SendInput / write()). Toplu iş en fazla kMaxBatchEvents eventtir;
+// dolunca gönderilir ve kBatchPause beklenir (uinput okuyucusu yetişsin).
+// Metin adımları typeText ile aynı yoldan yazılır (Linux: aktif XKB düzenine göre
+// TextKeymap, Windows: KEYEVENTF_UNICODE); beklemesiz uzun metin kTextChunkChars'lık
+// parçalara bölünür, parçalar arasında da kBatchPause beklenir ve iptal görülür.
+// Makro biterken, iptal edilince veya hata olunca hâlâ basılı tuşlar ters sırayla
+// bırakılır.
+
+// Tuş eventlerini enjekte eden katman (platform veya testte kayıt)
+// Sadece motor thread'inden çağrılır.
+class MacroBackend {
+public:
+    virtual ~MacroBackend() = default;
+    virtual void KeyDown(const keytable::KeyEntry* key) = 0;
+    virtual void KeyUp(const keytable::KeyEntry* key) = 0;
+    // Biriken eventleri gönder; hata durumunda std::runtime_error fırlatır
+    virtual void Flush() = 0;
+    // Metni hemen yaz (typeText yolu, önceki tuşlar Flush edilmiş olur);
+    // hata durumunda std::runtime_error fırlatır
+    virtual textinput::TextStats Text(std::string_view text) = 0;
+};
+
+struct MacroOp {
+    enum class Kind : uint8_t {
+        kDown,
+        kUp,
+        kDelay,     // delay: bekleme süresi
+        kLoopBegin, // count: tekrar sayısı
+        kLoopEnd,   // target: eşleşen kLoopBegin'in indeksi
+        kText,      // target: metin indeksi (MacroProgram::TextAt), count: karakter sayısı
+    };
+
+    Kind kind;
+    const keytable::KeyEntry* key = nullptr;
+    uint32_t count = 0;
+    uint32_t target = 0;
+    std::chrono::nanoseconds delay{0};
+};
+
+// Derlenmiş makro (değişmez, çalışmalar arasında paylaşılır)
+class MacroProgram {
+public:
+    // Beklemesiz metin adımının parça boyu (karakter); bas + bırak = kMaxBatchEvents
+    static constexpr size_t kTextChunkChars = 8;
+
+    void Down(const keytable::KeyEntry* key);
+    void Up(const keytable::KeyEntry* key);
+    // Sırayla bas, ters sırayla bırak (PressKeys ile aynı)
+    void Chord(const std::vector<const keytable::KeyEntry*>& keys);
+    void Delay(std::chrono::nanoseconds delay);
+    // UTF-8 metin; karakterler arasında interval beklenir. Karakterler çalışırken
+    // aktif düzene göre çözülür, düzende olmayanlar atlanır (MacroResult::skipped)
+    void Text(std::string_view text, std::chrono::nanoseconds interval);
+    void BeginRepeat(uint32_t count);
+    // Eşleşen BeginRepeat yoksa false
+    bool EndRepeat();
+
+    // Tüm tekrarlar kapatıldı mı
+    bool Complete() const { return openLoops_.empty(); }
+    const std::vector<MacroOp>& Ops() const { return ops_; }
+    const std::string& TextAt(uint32_t index) const { return texts_[index]; }
+    // Tekrarlar açılmış olarak toplam tuş eventi sayısı (ilerleme için, doyan)
+    uint64_t KeyEventCount() const;
+
+private:
+    std::vector<MacroOp> ops_;
+    std::vector<std::string> texts_;
+    std::vector<uint32_t> openLoops_;
+};
+
+struct MacroResult {
+    bool completed = false;
+    bool cancelled = false;
+    std::string error;
+    uint64_t keyEvents = 0;  // Enjekte edilen tuş eventi (metinde karakter başına 2)
+    uint32_t skipped = 0;    // Metin adımlarında yazılamayan karakter
+    uint32_t delays = 0;     // Tamamlanan bekleme sayısı
+    double elapsedMs = 0;
+    double meanLateUs = 0;   // Beklemelerin hedef zamana göre ortalama gecikmesi
+    double maxLateUs = 0;
+};
+
+class MacroEngine {
+public:
+    // done: sonuç; progress: (enjekte edilen tuş eventi, toplam) - motor thread'inden çağrılır
+    using DoneFn = std::function<void(const MacroResult&)>;
+    using ProgressFn = std::function<void(uint64_t done, uint64_t total)>;
+
+    // uinput'ta her tuş eventi + SYN_REPORT: 16 event = 32 input_event (kTextEventsPerWrite)
+    static constexpr size_t kMaxBatchEvents = 16;
+    static constexpr std::chrono::microseconds kBatchPause{1000};
+
+    explicit MacroEngine(MacroBackend& backend) : backend_(backend) {}
+    ~MacroEngine() { Stop(); }
+
+    void Start();
+    // Kuyruktaki ve çalışan makrolar iptal edilir (done çağrılır)
+    void Stop();
+
+    // Çalıştırma kuyruğa girer (makrolar sırayla çalışır); dönüş: çalışma kimliği
+    uint32_t Submit(std::shared_ptr<const MacroProgram> program, ProgressFn progress, DoneFn done);
+    // Kuyrukta bekleyen veya çalışan makroyu iptal et
+    bool Cancel(uint32_t runId);
+
+private:
+    struct Run {
+        uint32_t id;
+        std::shared_ptr<const MacroProgram> program;
+        ProgressFn progress;
+        DoneFn done;
+        std::atomic<bool> cancelled{false};
+    };
+
+    void Loop();
+    void Execute(Run& run, MacroResult& result);
+    // Hedef zamana kadar bekle; iptal edilirse false
+    bool SleepUntil(Run& run, std::chrono::steady_clock::time_point deadline);
+
+    MacroBackend& backend_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::shared_ptr<Run>> queue_;
+    std::shared_ptr<Run> current_;
+    std::thread thread_;
+    bool stopping_ = false;
+    uint32_t nextId_ = 1;
+    std::vector<const keytable::KeyEntry*> held_;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+
+// Lock-free, intrusive MPSC (çok üretici / tek tüketici) kuyruk
+// Dmitry Vyukov'un non-blocking MPSC algoritması: Push() herhangi bir
+// thread'den kilitsiz çağrılabilir, Pop() sadece tüketici thread'den çağrılır.
+
+struct MpscNode {
+    std::atomic<MpscNode*> next{nullptr};
+};
+
+class MpscQueue {
+public:
+    MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Üretici tarafı (herhangi bir thread)
+    void Push(MpscNode* node) {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        MpscNode* prev = head_.exchange(node, std::memory_order_seq_cst);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Tüketici tarafı (tek thread)
+    // Kuyruk boşsa veya bir üretici Push() ortasındaysa nullptr döner
+    MpscNode* Pop() {
+        MpscNode* tail = tail_;
+        MpscNode* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &stub_) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr) {
+            tail_ = next;
+            return tail;
+        }
+
+        MpscNode* head = head_.load(std::memory_order_acquire);
+        if (tail != head) {
+            return nullptr; // Üretici Push() ortasında, tekrar denenmeli
+        }
+
+        // Son eleman: stub'ı geri koy ki tail hiçbir zaman boşa düşmesin
+        Push(&stub_);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            tail_ = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    // Tüketici tarafı: kuyrukta bekleyen (veya yazılmakta olan) eleman yoksa true
+    bool Empty() const {
+        return tail_ == &stub_ && head_.load(std::memory_order_seq_cst) == &stub_;
+    }
+
+private:
+    std::atomic<MpscNode*> head_;
+    MpscNode* tail_;
+    MpscNode stub_;
+};
@@ -0,0 +1,248 @@
+#include "pointer_injector.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+PointerInjector pointerInjector;
+
+namespace {
+
+int32_t Saturate(int64_t value) {
+    return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(value, std::numeric_limits<int32_t>::min()),
+                                                  std::numeric_limits<int32_t>::max()));
+}
+
+} // namespace
+
+bool PointerInjector::Start() {
+    if (thread_.joinable()) {
+        return running_;
+    }
+
+    std::string error;
+    bool opened = OpenPlatform(error);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!opened) {
+        error_ = error;
+        return false;
+    }
+
+    double rate = PlatformFrameRate();
+    if (rate > 0) {
+        frameRate_ = rate;
+        frameInterval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / rate));
+    }
+
+    error_.clear();
+    running_ = true;
+    stopping_ = false;
+    thread_ = std::thread([this]() { Run(); });
+    return true;
+}
+
+void PointerInjector::Stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    ClosePlatform();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    ordered_.clear();
+    hasMove_ = false;
+}
+
+bool PointerInjector::Ready() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+bool PointerInjector::MoveTo(int32_t x, int32_t y) {
+    PointerEvent event{ PointerEvent::Type::kMoveAbsolute };
+    event.x = x;
+    event.y = y;
+    return Enqueue(event);
+}
+
+bool PointerInjector::MoveBy(int32_t dx, int32_t dy) {
+    PointerEvent event{ PointerEvent::Type::kMoveRelative };
+    event.x = dx;
+    event.y = dy;
+    return Enqueue(event);
+}
+
+bool PointerInjector::Button(PointerButton button, bool down) {
+    PointerEvent event{ PointerEvent::Type::kButton };
+    event.button = button;
+    event.down = down;
+    return Enqueue(event);
+}
+
+bool PointerInjector::Scroll(int32_t dx, int32_t dy) {
+    if (dx == 0 && dy == 0) {
+        return Ready();
+    }
+
+    PointerEvent event{ PointerEvent::Type::kScroll };
+    event.x = dx;
+    event.y = dy;
+    return Enqueue(event);
+}
+
+void PointerInjector::SetFrameRate(double hz) {
+    if (!(hz >= 1.0 && hz <= 1000.0)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    frameRate_ = hz;
+    frameInterval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / hz));
+}
+
+void PointerInjector::SetDesktopSize(int32_t width, int32_t height) {
+    desktopWidth_.store(width > 0 ? width : 0);
+    desktopHeight_.store(height > 0 ? height : 0);
+}
+
+PointerInfo PointerInjector::Info() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return { PlatformName(), running_, running_ ? PlatformDevicePath() : "", error_,
+             frameRate_, moves_, injectedMoves_ };
+}
+
+bool PointerInjector::Enqueue(const PointerEvent& event) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return false;
+        }
+
+        if (event.type == PointerEvent::Type::kMoveAbsolute || event.type == PointerEvent::Type::kMoveRelative) {
+            moves_++;
+            if (hasMove_ && event.type == PointerEvent::Type::kMoveRelative &&
+                move_.type == PointerEvent::Type::kMoveRelative) {
+                moveDx_ += event.x;
+                moveDy_ += event.y;
+            } else if (hasMove_ && event.type == PointerEvent::Type::kMoveAbsolute) {
+                // Mutlak konum öncekini (mutlak veya göreli) tamamen geçersiz kılar
+                move_ = event;
+            } else {
+                // İlk hareket; ya da mutlak konumdan sonra göreli hareket, önce
+                // mutlak konum gitmeli
+                if (hasMove_) {
+                    ordered_.push_back(TakeMove());
+                }
+                move_ = event;
+                moveDx_ = event.x;
+                moveDy_ = event.y;
+                hasMove_ = true;
+                wake = true;
+            }
+        } else {
+            // Tuş/tekerlek, önündeki hareketten sonra gitmeli (ör. taşı + tıkla)
+            if (hasMove_) {
+                ordered_.push_back(TakeMove());
+            }
+            ordered_.push_back(event);
+            wake = true;
+        }
+    }
+
+    // Thread sadece iş durumu değişince uyandırılır; birleşen hareketler uyandırmaz
+    if (wake) {
+        wake_.notify_one();
+    }
+    return true;
+}
+
+PointerEvent PointerInjector::TakeMove() {
+    PointerEvent event = move_;
+    if (event.type == PointerEvent::Type::kMoveRelative) {
+        event.x = Saturate(moveDx_);
+        event.y = Saturate(moveDy_);
+    }
+    hasMove_ = false;
+    injectedMoves_++;
+    return event;
+}
+
+void PointerInjector::Run() {
+    std::vector<PointerEvent> batch;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopping_) {
+        batch.clear();
+
+        if (!ordered_.empty()) {
+            batch.swap(ordered_);
+        } else if (hasMove_) {
+            auto now = std::chrono::steady_clock::now();
+            auto due = lastMove_ + frameInterval_;
+            if (now < due) {
+                wake_.wait_until(lock, due);
+                continue;
+            }
+            batch.push_back(TakeMove());
+            lastMove_ = now;
+        } else {
+            wake_.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        std::string error;
+        try {
+            InjectPlatform(batch);
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        lock.lock();
+
+        if (!error.empty()) {
+            error_ = error;
+        }
+    }
+}
+
+#if !defined(_WIN32) && !defined(__linux__)
+// Desteklenmeyen platformlar: cihaz açılmaz, tüm çağrılar false döner
+
+struct PointerInjector::Platform {};
+
+bool PointerInjector::OpenPlatform(std::string& error) {
+    error = "Bu platformda işaretçi enjeksiyonu desteklenmiyor";
+    return false;
+}
+
+void PointerInjector::ClosePlatform() {}
+
+void PointerInjector::InjectPlatform(const std::vector<PointerEvent>&) {
+    throw std::runtime_error("Bu platformda işaretçi enjeksiyonu desteklenmiyor");
+}
+
+double PointerInjector::PlatformFrameRate() {
+    return 0;
+}
+
+const char* PointerInjector::PlatformName() const {
+    return "none";
+}
+
+std::string PointerInjector::PlatformDevicePath() const {
+    return "";
+}
+
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Fare girdisi enjeksiyonu (remote-mouse-* eventleri)
+// Telefon hareket eventlerini ekranın yenilenme hızından çok daha sık gönderir.
+// Hareketler birleştirilir: mutlak konumda son konum kazanır, göreli hareketler
+// toplanır ve ekran karesi başına en fazla bir hareket enjekte edilir (boşta
+// gelen ilk hareket beklemeden gider). Tuş ve tekerlek eventleri birleştirilmez,
+// geliş sırasıyla gider; önlerinde bekleyen hareket varsa önce o gönderilir.
+//
+// Enjeksiyon kendi thread'inde yapılır. Platform kodu (Windows: SendInput,
+// Linux: kalıcı uinput mutlak işaretçi cihazı) OpenPlatform/InjectPlatform'u
+// uygular; bir toplu iş (batch) tek SendInput / write() ile gider.
+
+enum class PointerButton {
+    kLeft,
+    kRight,
+    kMiddle
+};
+
+struct PointerEvent {
+    enum class Type {
+        kMoveAbsolute, // x, y: sanal masaüstü pikseli
+        kMoveRelative, // x, y: piksel farkı
+        kButton,
+        kScroll        // x: yatay, y: dikey çentik (pozitif = sağa / yukarı)
+    };
+
+    Type type;
+    int32_t x = 0;
+    int32_t y = 0;
+    PointerButton button = PointerButton::kLeft;
+    bool down = false;
+};
+
+struct PointerInfo {
+    const char* backend;
+    bool ready;
+    std::string devicePath; // Linux: mutlak işaretçinin /dev/input/eventN düğümü
+    std::string error;
+    double frameRate;
+    uint64_t moves;         // Alınan hareket sayısı
+    uint64_t injectedMoves; // Birleştirme sonrası enjekte edilen hareket sayısı
+};
+
+class PointerInjector {
+public:
+    // Platform cihazını aç ve thread'i başlat (başarısızsa Ready() false)
+    bool Start();
+    void Stop();
+
+    bool Ready() const;
+
+    // Herhangi bir thread'den çağrılabilir; hazır değilse false döner
+    bool MoveTo(int32_t x, int32_t y);
+    bool MoveBy(int32_t dx, int32_t dy);
+    bool Button(PointerButton button, bool down);
+    bool Scroll(int32_t dx, int32_t dy);
+
+    // Birleştirme aralığı (varsayılan: birincil ekranın yenilenme hızı)
+    void SetFrameRate(double hz);
+
+    // Masaüstü boyutu bilinmiyorsa (Linux'ta X bağlantısı yok) mutlak eşleme için
+    void SetDesktopSize(int32_t width, int32_t height);
+
+    PointerInfo Info() const;
+
+private:
+    struct Platform;
+
+    bool Enqueue(const PointerEvent& event);
+    // Birleştirilen hareketi kuyruktan al (mutex_ tutulurken)
+    PointerEvent TakeMove();
+    void Run();
+
+    // --- Platform dosyalarında ---
+    bool OpenPlatform(std::string& error);
+    void ClosePlatform();
+    // Hata durumunda std::runtime_error fırlatır
+    void InjectPlatform(const std::vector<PointerEvent>& batch);
+    double PlatformFrameRate();
+    const char* PlatformName() const;
+    std::string PlatformDevicePath() const;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::thread thread_;
+    bool running_ = false;
+    bool stopping_ = false;
+    std::string error_ = "İşaretçi cihazı başlatılmadı";
+
+    // Sırası korunan eventler (tuş, tekerlek, sıra gereği boşaltılan hareket)
+    std::vector<PointerEvent> ordered_;
+    // Birleştirilen hareket (en fazla bir tane)
+    bool hasMove_ = false;
+    PointerEvent move_{ PointerEvent::Type::kMoveAbsolute };
+    // Göreli hareket toplamı; int32 taşmasın diye 64 bit, gönderilirken doyurulur
+    int64_t moveDx_ = 0;
+    int64_t moveDy_ = 0;
+
+    std::chrono::steady_clock::duration frameInterval_ = std::chrono::microseconds(16667);
+    std::chrono::steady_clock::time_point lastMove_;
+    double frameRate_ = 60.0;
+    uint64_t moves_ = 0;
+    uint64_t injectedMoves_ = 0;
+
+    std::atomic<int32_t> desktopWidth_{0};
+    std::atomic<int32_t> desktopHeight_{0};
+
+    Platform* platform_ = nullptr; // OpenPlatform ayırır, ClosePlatform siler
+};
+
+extern PointerInjector pointerInjector;
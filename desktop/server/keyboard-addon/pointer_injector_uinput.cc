@@ -0,0 +1,299 @@
+#include "pointer_injector.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <xcb/xcb.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+// Linux: kalıcı uinput cihazları
+// "LocalDesk Virtual Pointer": ABS_X/ABS_Y (0-65535, tüm masaüstüne eşlenir),
+// sol/sağ/orta tuş ve tekerlek. Mutlak eksenli + fare tuşlu cihazlar udev/libinput
+// tarafından sanal makine tabletleri gibi mutlak fare olarak tanınır; X11 ve
+// Wayland oturumlarında aynı şekilde çalışır. Göreli hareket için ayrı bir
+// "LocalDesk Virtual Mouse" (REL_X/REL_Y) ilk göreli harekette oluşturulur.
+// Mutlak koordinatlar X kök penceresinin boyutuna göre ölçeklenir; X bağlantısı
+// yoksa SetDesktopSize ile verilen boyut kullanılır.
+
+namespace {
+
+const int32_t kAbsoluteMax = 65535;
+// Kök pencere boyutu (ekran ekleme/çıkarma, çözünürlük değişimi) bu aralıkla yenilenir
+const auto kDesktopRefresh = std::chrono::seconds(2);
+
+input_event MakeEvent(uint16_t type, uint16_t code, int32_t value) {
+    input_event event;
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    return event;
+}
+
+uint16_t ButtonCode(PointerButton button) {
+    switch (button) {
+    case PointerButton::kRight: return BTN_RIGHT;
+    case PointerButton::kMiddle: return BTN_MIDDLE;
+    default: return BTN_LEFT;
+    }
+}
+
+// Sanal cihazın evdev düğümü (testlerde eventler buradan geri okunur)
+std::string FindEventNode(int fd) {
+    char sysname[64] = {0};
+    if (ioctl(fd, UI_GET_SYSNAME(sizeof(sysname)), sysname) < 0) {
+        return "";
+    }
+
+    std::string sysPath = std::string("/sys/devices/virtual/input/") + sysname;
+    DIR* dir = opendir(sysPath.c_str());
+    if (!dir) {
+        return "";
+    }
+
+    std::string node;
+    while (dirent* entry = readdir(dir)) {
+        if (strncmp(entry->d_name, "event", 5) == 0) {
+            node = std::string("/dev/input/") + entry->d_name;
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+}
+
+int CreateDevice(const char* name, uint16_t product, bool absolute, std::string& error) {
+    int fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        error = std::string("/dev/uinput açılamadı: ") + strerror(errno) +
+                " (kullanıcının /dev/uinput yazma izni olmalı)";
+        return -1;
+    }
+
+    bool ok = ioctl(fd, UI_SET_EVBIT, EV_KEY) == 0 && ioctl(fd, UI_SET_EVBIT, EV_SYN) == 0 &&
+              ioctl(fd, UI_SET_EVBIT, EV_REL) == 0 &&
+              ioctl(fd, UI_SET_KEYBIT, BTN_LEFT) == 0 && ioctl(fd, UI_SET_KEYBIT, BTN_RIGHT) == 0 &&
+              ioctl(fd, UI_SET_KEYBIT, BTN_MIDDLE) == 0 &&
+              ioctl(fd, UI_SET_RELBIT, REL_WHEEL) == 0 && ioctl(fd, UI_SET_RELBIT, REL_HWHEEL) == 0;
+
+    if (ok && absolute) {
+        ok = ioctl(fd, UI_SET_EVBIT, EV_ABS) == 0;
+        for (uint16_t code : { ABS_X, ABS_Y }) {
+            uinput_abs_setup axis;
+            memset(&axis, 0, sizeof(axis));
+            axis.code = code;
+            axis.absinfo.minimum = 0;
+            axis.absinfo.maximum = kAbsoluteMax;
+            ok = ok && ioctl(fd, UI_SET_ABSBIT, code) == 0 && ioctl(fd, UI_ABS_SETUP, &axis) == 0;
+        }
+    } else if (ok) {
+        ok = ioctl(fd, UI_SET_RELBIT, REL_X) == 0 && ioctl(fd, UI_SET_RELBIT, REL_Y) == 0;
+    }
+
+    if (ok) {
+        uinput_setup setup;
+        memset(&setup, 0, sizeof(setup));
+        setup.id.bustype = BUS_VIRTUAL;
+        setup.id.vendor = 0x4c44; // "LD"
+        setup.id.product = product;
+        setup.id.version = 1;
+        strncpy(setup.name, name, UINPUT_MAX_NAME_SIZE - 1);
+
+        ok = ioctl(fd, UI_DEV_SETUP, &setup) == 0 && ioctl(fd, UI_DEV_CREATE) == 0;
+    }
+
+    if (!ok) {
+        error = std::string("uinput işaretçi cihazı oluşturulamadı: ") + strerror(errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void DestroyDevice(int& fd) {
+    if (fd >= 0) {
+        ioctl(fd, UI_DEV_DESTROY);
+        close(fd);
+        fd = -1;
+    }
+}
+
+void WriteEvents(int fd, const std::vector<input_event>& events) {
+    if (events.empty()) {
+        return;
+    }
+
+    const size_t size = events.size() * sizeof(input_event);
+    ssize_t written = write(fd, events.data(), size);
+    if (written != static_cast<ssize_t>(size)) {
+        throw std::runtime_error(std::string("uinput yazma hatası: ") + strerror(errno));
+    }
+}
+
+// Piksel -> 0..kAbsoluteMax (uçlar dahil)
+int32_t ScaleAxis(int32_t value, int32_t size) {
+    if (size <= 1) {
+        return 0;
+    }
+    int64_t clamped = std::min<int64_t>(std::max<int32_t>(value, 0), size - 1);
+    return static_cast<int32_t>((clamped * kAbsoluteMax + (size - 1) / 2) / (size - 1));
+}
+
+} // namespace
+
+struct PointerInjector::Platform {
+    int absoluteFd = -1;
+    int relativeFd = -1; // İlk göreli harekette oluşturulur
+    std::string devicePath;
+
+    xcb_connection_t* connection = nullptr;
+    xcb_window_t root = 0;
+    int32_t rootWidth = 0;
+    int32_t rootHeight = 0;
+    std::chrono::steady_clock::time_point rootCheckedAt;
+
+    std::vector<input_event> events;
+
+    void ConnectX() {
+        connection = xcb_connect(nullptr, nullptr);
+        if (xcb_connection_has_error(connection)) {
+            xcb_disconnect(connection);
+            connection = nullptr;
+            return;
+        }
+
+        const xcb_setup_t* setup = xcb_get_setup(connection);
+        xcb_screen_iterator_t it = xcb_setup_roots_iterator(setup);
+        if (it.rem > 0) {
+            root = it.data->root;
+            rootWidth = it.data->width_in_pixels;
+            rootHeight = it.data->height_in_pixels;
+            rootCheckedAt = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Sadece mutlak hareket enjekte edilirken ve en fazla kDesktopRefresh'te bir round-trip
+    void RefreshRootSize() {
+        auto now = std::chrono::steady_clock::now();
+        if (!connection || now - rootCheckedAt < kDesktopRefresh) {
+            return;
+        }
+        rootCheckedAt = now;
+
+        xcb_get_geometry_reply_t* reply =
+            xcb_get_geometry_reply(connection, xcb_get_geometry(connection, root), nullptr);
+        if (reply) {
+            rootWidth = reply->width;
+            rootHeight = reply->height;
+            free(reply);
+        }
+    }
+};
+
+bool PointerInjector::OpenPlatform(std::string& error) {
+    Platform* platform = new Platform();
+    platform->absoluteFd = CreateDevice("LocalDesk Virtual Pointer", 0x0002, true, error);
+    if (platform->absoluteFd < 0) {
+        delete platform;
+        return false;
+    }
+
+    platform->devicePath = FindEventNode(platform->absoluteFd);
+    platform->ConnectX();
+    platform_ = platform;
+    return true;
+}
+
+void PointerInjector::ClosePlatform() {
+    if (!platform_) {
+        return;
+    }
+
+    DestroyDevice(platform_->absoluteFd);
+    DestroyDevice(platform_->relativeFd);
+    if (platform_->connection) {
+        xcb_disconnect(platform_->connection);
+    }
+    delete platform_;
+    platform_ = nullptr;
+}
+
+// Ardışık eventler cihaz başına tek write() ile gider; her event kendi SYN_REPORT
+// çerçevesindedir (aynı çerçevede basılıp bırakılan tuş görülmeyebilir)
+void PointerInjector::InjectPlatform(const std::vector<PointerEvent>& batch) {
+    Platform& platform = *platform_;
+    std::vector<input_event>& events = platform.events;
+    events.clear();
+    int currentFd = platform.absoluteFd;
+
+    for (const PointerEvent& event : batch) {
+        int fd = platform.absoluteFd;
+        if (event.type == PointerEvent::Type::kMoveRelative) {
+            if (platform.relativeFd < 0) {
+                std::string error;
+                platform.relativeFd = CreateDevice("LocalDesk Virtual Mouse", 0x0003, false, error);
+                if (platform.relativeFd < 0) {
+                    WriteEvents(currentFd, events); // Öncekiler yine de gitsin
+                    throw std::runtime_error(error);
+                }
+            }
+            fd = platform.relativeFd;
+        }
+
+        if (fd != currentFd) {
+            WriteEvents(currentFd, events);
+            events.clear();
+            currentFd = fd;
+        }
+
+        switch (event.type) {
+        case PointerEvent::Type::kMoveAbsolute: {
+            platform.RefreshRootSize();
+            int32_t width = platform.connection ? platform.rootWidth : desktopWidth_.load();
+            int32_t height = platform.connection ? platform.rootHeight : desktopHeight_.load();
+            if (width <= 0 || height <= 0) {
+                throw std::runtime_error("Masaüstü boyutu bilinmiyor (X bağlantısı yok, setPointerDesktop çağrılmalı)");
+            }
+            events.push_back(MakeEvent(EV_ABS, ABS_X, ScaleAxis(event.x, width)));
+            events.push_back(MakeEvent(EV_ABS, ABS_Y, ScaleAxis(event.y, height)));
+            break;
+        }
+        case PointerEvent::Type::kMoveRelative:
+            if (event.x != 0) events.push_back(MakeEvent(EV_REL, REL_X, event.x));
+            if (event.y != 0) events.push_back(MakeEvent(EV_REL, REL_Y, event.y));
+            break;
+        case PointerEvent::Type::kButton:
+            events.push_back(MakeEvent(EV_KEY, ButtonCode(event.button), event.down ? 1 : 0));
+            break;
+        case PointerEvent::Type::kScroll:
+            if (event.y != 0) events.push_back(MakeEvent(EV_REL, REL_WHEEL, event.y));
+            if (event.x != 0) events.push_back(MakeEvent(EV_REL, REL_HWHEEL, event.x));
+            break;
+        }
+        events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+    }
+
+    WriteEvents(currentFd, events);
+}
+
+// Birincil ekran yenilenme hızı sorgulanmıyor (RandR gerekir); 60 Hz varsayılır,
+// gerekirse setPointerFrameRate ile değiştirilir
+double PointerInjector::PlatformFrameRate() {
+    return 60.0;
+}
+
+const char* PointerInjector::PlatformName() const {
+    return "uinput";
+}
+
+std::string PointerInjector::PlatformDevicePath() const {
+    return platform_ ? platform_->devicePath : "";
+}
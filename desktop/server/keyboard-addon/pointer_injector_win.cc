@@ -0,0 +1,120 @@
+#include "pointer_injector.h"
+
+#include <windows.h>
+
+#include <stdexcept>
+
+// Windows: SendInput
+// Mutlak hareket MOUSEEVENTF_VIRTUALDESK ile tüm sanal masaüstüne (0-65535)
+// eşlenir; çoklu monitörde negatif koordinatlı ekranlar da çalışır. Bir toplu
+// iş tek SendInput çağrısıyla gider, araya başka bir girdi karışmaz.
+
+struct PointerInjector::Platform {
+    std::vector<INPUT> inputs;
+};
+
+namespace {
+
+DWORD ButtonFlag(PointerButton button, bool down) {
+    switch (button) {
+    case PointerButton::kRight: return down ? MOUSEEVENTF_RIGHTDOWN : MOUSEEVENTF_RIGHTUP;
+    case PointerButton::kMiddle: return down ? MOUSEEVENTF_MIDDLEDOWN : MOUSEEVENTF_MIDDLEUP;
+    default: return down ? MOUSEEVENTF_LEFTDOWN : MOUSEEVENTF_LEFTUP;
+    }
+}
+
+// Sanal masaüstü pikseli -> 0..65535
+LONG ScaleAxis(int32_t value, int origin, int size) {
+    if (size <= 1) {
+        return 0;
+    }
+    LONGLONG offset = static_cast<LONGLONG>(value) - origin;
+    offset = offset < 0 ? 0 : (offset > size - 1 ? size - 1 : offset);
+    return static_cast<LONG>((offset * 65535 + (size - 1) / 2) / (size - 1));
+}
+
+INPUT MouseInput(DWORD flags, LONG dx = 0, LONG dy = 0, DWORD data = 0) {
+    INPUT input;
+    ZeroMemory(&input, sizeof(input));
+    input.type = INPUT_MOUSE;
+    input.mi.dx = dx;
+    input.mi.dy = dy;
+    input.mi.mouseData = data;
+    input.mi.dwFlags = flags;
+    return input;
+}
+
+} // namespace
+
+bool PointerInjector::OpenPlatform(std::string& error) {
+    platform_ = new Platform();
+    return true;
+}
+
+void PointerInjector::ClosePlatform() {
+    delete platform_;
+    platform_ = nullptr;
+}
+
+void PointerInjector::InjectPlatform(const std::vector<PointerEvent>& batch) {
+    std::vector<INPUT>& inputs = platform_->inputs;
+    inputs.clear();
+
+    // Sanal masaüstü ölçüleri her toplu işte okunur (ucuz; monitör değişimini izler)
+    int originX = GetSystemMetrics(SM_XVIRTUALSCREEN);
+    int originY = GetSystemMetrics(SM_YVIRTUALSCREEN);
+    int width = GetSystemMetrics(SM_CXVIRTUALSCREEN);
+    int height = GetSystemMetrics(SM_CYVIRTUALSCREEN);
+
+    for (const PointerEvent& event : batch) {
+        switch (event.type) {
+        case PointerEvent::Type::kMoveAbsolute:
+            inputs.push_back(MouseInput(MOUSEEVENTF_MOVE | MOUSEEVENTF_ABSOLUTE | MOUSEEVENTF_VIRTUALDESK,
+                                        ScaleAxis(event.x, originX, width), ScaleAxis(event.y, originY, height)));
+            break;
+        case PointerEvent::Type::kMoveRelative:
+            inputs.push_back(MouseInput(MOUSEEVENTF_MOVE, event.x, event.y));
+            break;
+        case PointerEvent::Type::kButton:
+            inputs.push_back(MouseInput(ButtonFlag(event.button, event.down)));
+            break;
+        case PointerEvent::Type::kScroll:
+            if (event.y != 0) {
+                inputs.push_back(MouseInput(MOUSEEVENTF_WHEEL, 0, 0, static_cast<DWORD>(event.y * WHEEL_DELTA)));
+            }
+            if (event.x != 0) {
+                inputs.push_back(MouseInput(MOUSEEVENTF_HWHEEL, 0, 0, static_cast<DWORD>(event.x * WHEEL_DELTA)));
+            }
+            break;
+        }
+    }
+
+    if (inputs.empty()) {
+        return;
+    }
+
+    UINT sent = SendInput(static_cast<UINT>(inputs.size()), inputs.data(), sizeof(INPUT));
+    if (sent != inputs.size()) {
+        // UIPI: yönetici olarak çalışan bir pencereye normal yetkiyle girdi gönderilemez
+        throw std::runtime_error("SendInput başarısız (hedef pencere daha yüksek yetkiyle çalışıyor olabilir)");
+    }
+}
+
+// Birincil ekranın yenilenme hızı (0/1 "donanım varsayılanı" demektir)
+double PointerInjector::PlatformFrameRate() {
+    DEVMODEW mode;
+    ZeroMemory(&mode, sizeof(mode));
+    mode.dmSize = sizeof(mode);
+    if (EnumDisplaySettingsW(NULL, ENUM_CURRENT_SETTINGS, &mode) && mode.dmDisplayFrequency > 1) {
+        return static_cast<double>(mode.dmDisplayFrequency);
+    }
+    return 60.0;
+}
+
+const char* PointerInjector::PlatformName() const {
+    return "sendinput";
+}
+
+std::string PointerInjector::PlatformDevicePath() const {
+    return "";
+}
@@ -0,0 +1,19 @@
+// Testler için keyboard.node yükleyicisi
+// Derlenmemişse addon null döner ve testler skip nedeniyle atlanır. Addon
+// yüklenirken ortamı okur (DISPLAY, LOCALDESK_TEST_BACKEND); bunlar çağırmadan
+// önce ayarlanmalı.
+
+const fs = require('fs');
+const path = require('path');
+
+const ADDON = path.join(__dirname, '..', 'build', 'Release', 'keyboard.node');
+
+// -> { addon, skip: null } | { addon: null, skip: neden }
+function loadAddon() {
+  if (!fs.existsSync(ADDON)) {
+    return { addon: null, skip: 'keyboard.node derlenmemiş (node-gyp rebuild)' };
+  }
+  return { addon: require(ADDON), skip: null };
+}
+
+module.exports = { loadAddon };
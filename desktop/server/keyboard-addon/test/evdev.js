@@ -0,0 +1,158 @@
+// evdev okuma yardımcıları (uinput testleri)
+// Addon'un oluşturduğu sanal cihazın /dev/input/event* düğümü okunur; böylece
+// çekirdeğe gerçekten ne yazıldığı (SYN çerçeveleri dahil) doğrulanır.
+// Düğüm evdev_grab ile özel olarak yakalanır (EVIOCGRAB): testin gönderdiği
+// tuşlar ve hareketler odaktaki pencereye / gerçek imlece ulaşmaz.
+
+const { spawn, spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const EV_SYN = 0;
+const EV_KEY = 1;
+const EV_REL = 2;
+const EV_ABS = 3;
+const SYN_REPORT = 0;
+
+const ABS_X = 0;
+const ABS_Y = 1;
+const REL_X = 0;
+const REL_Y = 1;
+
+// Node'dan ioctl çağrılamıyor: EVIOCGABS ve EVIOCGRAB için yardımcı programlar
+// (test/evdev_absinfo.cc, test/evdev_grab.cc)
+const ABSINFO = path.join(__dirname, '..', 'build', 'Release', 'evdev_absinfo');
+const GRAB = path.join(__dirname, '..', 'build', 'Release', 'evdev_grab');
+
+// evdev_grab sürecinin satırlarından gelen eventler
+class GrabbedDevice {
+  constructor(child, text) {
+    this.child = child;
+    this.pending = [];
+    this.partial = '';
+    this.feed(text);
+    child.stdout.on('data', (data) => this.feed(data));
+  }
+
+  feed(text) {
+    const lines = (this.partial + text).split('\n');
+    this.partial = lines.pop();
+    for (const line of lines) {
+      const [type, code, value] = line.split(' ').map(Number);
+      this.pending.push({ type, code, value });
+    }
+  }
+
+  // Beklenen eventler gelene kadar (veya süre dolana kadar) oku
+  async readEvents(predicate, timeoutMs = 2000) {
+    const events = [];
+    const deadline = Date.now() + timeoutMs;
+    for (;;) {
+      events.push(...this.pending.splice(0));
+      if (predicate(events) || Date.now() >= deadline) {
+        return events;
+      }
+      await new Promise(resolve => setTimeout(resolve, 5));
+    }
+  }
+
+  // Şimdiye kadar gelenleri at (testten önce kalan eventler karışmasın)
+  drain() {
+    this.pending = [];
+  }
+
+  // Yakalamayı bırak (stdin kapanınca evdev_grab çıkar)
+  close() {
+    return new Promise((resolve) => {
+      this.child.once('exit', resolve);
+      this.child.stdin.end();
+    });
+  }
+}
+
+// Cihazı yakala -> GrabbedDevice | null (yardımcı derlenmemişse)
+function grabDevice(devicePath) {
+  if (!fs.existsSync(GRAB)) {
+    return Promise.resolve(null);
+  }
+
+  return new Promise((resolve, reject) => {
+    const child = spawn(GRAB, [devicePath], { stdio: ['pipe', 'pipe', 'pipe'] });
+    let stderr = '';
+    child.stdout.setEncoding('utf8');
+    child.stderr.on('data', (data) => { stderr += data; });
+
+    // İlk satır "ready": yakalama alındı, eventler bundan sonra gelir
+    let banner = '';
+    const onData = (data) => {
+      banner += data;
+      const newline = banner.indexOf('\n');
+      if (newline < 0) {
+        return;
+      }
+      child.stdout.off('data', onData);
+      child.off('exit', onExit);
+      resolve(new GrabbedDevice(child, banner.slice(newline + 1)));
+    };
+    const onExit = () => reject(new Error(`evdev_grab: ${stderr.trim()}`));
+    child.stdout.on('data', onData);
+    child.once('exit', onExit);
+  });
+}
+
+// SYN_REPORT ile ayrılmış çerçeveler (son çerçeve SYN ile bitmemişse dahil edilmez)
+function frames(events) {
+  const result = [];
+  let current = [];
+  for (const event of events) {
+    if (event.type === EV_SYN && event.code === SYN_REPORT) {
+      result.push(current);
+      current = [];
+    } else {
+      current.push(event);
+    }
+  }
+  return result;
+}
+
+// Eksen aralıkları -> { [kod]: { min, max } } | null (yardımcı derlenmemişse)
+function absInfo(devicePath) {
+  if (!fs.existsSync(ABSINFO)) {
+    return null;
+  }
+  const result = spawnSync(ABSINFO, [devicePath], { encoding: 'utf8' });
+  if (result.status !== 0) {
+    throw new Error(`evdev_absinfo: ${result.stderr.trim()}`);
+  }
+  const axes = {};
+  for (const line of result.stdout.trim().split('\n')) {
+    const [code, min, max] = line.split(' ').map(Number);
+    axes[code] = { min, max };
+  }
+  return axes;
+}
+
+// Ada göre evdev düğümü (/proc/bus/input/devices) -> '/dev/input/eventN' | null
+function findDevice(name) {
+  let text = '';
+  try {
+    text = fs.readFileSync('/proc/bus/input/devices', 'utf8');
+  } catch (error) {
+    return null;
+  }
+  for (const block of text.split('\n\n')) {
+    if (!block.includes(`N: Name="${name}"`)) {
+      continue;
+    }
+    const handler = /H: Handlers=.*\b(event\d+)\b/.exec(block);
+    if (handler) {
+      return `/dev/input/${handler[1]}`;
+    }
+  }
+  return null;
+}
+
+module.exports = {
+  EV_SYN, EV_KEY, EV_REL, EV_ABS, SYN_REPORT, ABS_X, ABS_Y, REL_X, REL_Y,
+  grabDevice, frames, absInfo, findDevice
+};
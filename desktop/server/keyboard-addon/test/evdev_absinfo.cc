@@ -0,0 +1,42 @@
+// evdev eksen aralıklarını yazdırır (Node'dan EVIOCGABS ioctl'ü çağrılamıyor)
+// Çıktı: her eksen için "<kod> <minimum> <maksimum>" (ABS_X, ABS_Y)
+//
+// Derleme: node-gyp rebuild (build/Release/evdev_absinfo)
+// Çalıştırma: ./build/Release/evdev_absinfo /dev/input/eventN
+
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Kullanım: %s /dev/input/eventN\n", argv[0]);
+        return 2;
+    }
+
+    int fd = open(argv[1], O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::fprintf(stderr, "%s açılamadı: %s\n", argv[1], std::strerror(errno));
+        return 1;
+    }
+
+    for (int code : { ABS_X, ABS_Y }) {
+        input_absinfo info;
+        std::memset(&info, 0, sizeof(info));
+        if (ioctl(fd, EVIOCGABS(code), &info) < 0) {
+            std::fprintf(stderr, "EVIOCGABS(%d) başarısız: %s\n", code, std::strerror(errno));
+            close(fd);
+            return 1;
+        }
+        std::printf("%d %d %d\n", code, info.minimum, info.maximum);
+    }
+
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,71 @@
+// evdev düğümünü özel olarak yakalar (EVIOCGRAB) ve eventlerini stdout'a yazar
+// uinput testleri sanal cihaza gerçek tuş / hareket gönderir; yakalanan cihazın
+// eventleri masaüstüne (odaktaki pencere, gerçek imleç) ulaşmaz, sadece buraya gelir.
+// Yakalandıktan sonra "ready", ardından her event için "<tip> <kod> <değer>" satırı;
+// stdin kapanınca bırakır ve çıkar.
+//
+// Derleme: node-gyp rebuild (build/Release/evdev_grab)
+// Çalıştırma: ./build/Release/evdev_grab /dev/input/eventN (bkz. test/evdev.js grabDevice)
+
+#include <fcntl.h>
+#include <linux/input.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Kullanım: %s /dev/input/eventN\n", argv[0]);
+        return 2;
+    }
+
+    int fd = open(argv[1], O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        std::fprintf(stderr, "%s açılamadı: %s\n", argv[1], std::strerror(errno));
+        return 1;
+    }
+    if (ioctl(fd, EVIOCGRAB, 1) < 0) {
+        std::fprintf(stderr, "EVIOCGRAB başarısız: %s\n", std::strerror(errno));
+        close(fd);
+        return 1;
+    }
+    std::printf("ready\n");
+    std::fflush(stdout);
+
+    input_event events[64];
+    for (;;) {
+        pollfd fds[2] = {
+            { fd, POLLIN, 0 },
+            { STDIN_FILENO, POLLIN, 0 }
+        };
+        if (poll(fds, 2, -1) < 0 && errno != EINTR) {
+            break;
+        }
+        if (fds[1].revents) {
+            break; // stdin kapandı (veya beklenmedik veri): test bitti
+        }
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            break; // Cihaz kaldırıldı
+        }
+
+        ssize_t size = read(fd, events, sizeof(events));
+        if (size < 0) {
+            if (errno == EAGAIN || errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        for (size_t i = 0; i < static_cast<size_t>(size) / sizeof(input_event); i++) {
+            std::printf("%u %u %d\n", events[i].type, events[i].code, events[i].value);
+        }
+        std::fflush(stdout);
+    }
+
+    ioctl(fd, EVIOCGRAB, 0);
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,64 @@
+// İkili girdi çerçevesi çözümleyicisi: regresyon korpusu + kısa fuzz turu
+// bench/input_frame_fuzz, bench/input_frame_corpus altındaki her dosyayı çözer ve
+// "<dosya> <durum> <kayıt> <atlanan>" yazar; değişmez bozulursa abort eder.
+// Harness derlenmemişse (node-gyp rebuild) test atlanır.
+
+const test = require('node:test');
+const assert = require('node:assert');
+const { spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const FUZZ = path.join(__dirname, '..', 'build', 'Release', 'input_frame_fuzz');
+const CORPUS = path.join(__dirname, '..', 'bench', 'input_frame_corpus');
+
+// inputframe::Status sırası
+const Status = {
+  ok: 0,
+  tooShort: 1,
+  badMagic: 2,
+  badVersion: 3,
+  badRecordSize: 4,
+  lengthMismatch: 5
+};
+
+function run(args) {
+  const result = spawnSync(FUZZ, args, { encoding: 'utf8' });
+  assert.strictEqual(result.status, 0, result.stderr);
+  return result.stdout;
+}
+
+test('regresyon korpusu beklenen durumlarla çözülür', (t) => {
+  if (!fs.existsSync(FUZZ)) {
+    t.skip('input_frame_fuzz derlenmemiş (node-gyp rebuild)');
+    return;
+  }
+
+  const results = {};
+  for (const line of run([CORPUS]).trim().split('\n')) {
+    const [file, status, records, skipped] = line.split(' ');
+    results[file] = [Number(status), Number(records), Number(skipped)];
+  }
+
+  assert.deepStrictEqual(results, {
+    'bad-magic.bin': [Status.badMagic, 0, 0],
+    'bad-type.bin': [Status.ok, 2, 3],
+    'bad-version.bin': [Status.badVersion, 0, 0],
+    'empty.bin': [Status.tooShort, 0, 0],
+    'large-record-size.bin': [Status.ok, 2, 0],
+    'oversized-count.bin': [Status.lengthMismatch, 0, 0],
+    'small-record-size.bin': [Status.badRecordSize, 0, 0],
+    'truncated-header.bin': [Status.tooShort, 0, 0],
+    'truncated-record.bin': [Status.lengthMismatch, 0, 0]
+  });
+});
+
+test('rastgele bozulmuş çerçeveler değişmezleri bozmaz', (t) => {
+  if (!fs.existsSync(FUZZ)) {
+    t.skip('input_frame_fuzz derlenmemiş (node-gyp rebuild)');
+    return;
+  }
+
+  const output = run(['12345', '200000']);
+  assert.match(output, /200000 deneme, [1-9]\d* geçerli çerçeve/);
+});
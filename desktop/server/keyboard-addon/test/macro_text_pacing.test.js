@@ -0,0 +1,94 @@
+// Makro metin adımı: typeText yolu ve parça boyu
+// Metin adımı aktif düzene göre (typeText ile aynı yoldan) yazılır; recording
+// backend'inde her parça "text" kaydı olarak görünür. Uzun beklemesiz metin tek
+// parçada gitmemeli; tuş adımlarında da her Flush (tek write() / SendInput)
+// "flush" kaydı olarak toplu işteki tuş eventi sayısıyla görünür.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const { loadAddon } = require('./addon');
+
+// MacroEngine::kMaxBatchEvents (uinput'ta 32 input_event = kTextEventsPerWrite)
+const MAX_BATCH_EVENTS = 16;
+// MacroProgram::kTextChunkChars (bas + bırak = kMaxBatchEvents)
+const TEXT_CHUNK_CHARS = 8;
+
+// Test backend'i modül yüklenirken seçilir
+process.env.LOCALDESK_TEST_BACKEND = 'recording';
+const { addon, skip: addonSkip } = loadAddon();
+
+function sampleText(length) {
+  const words = ['Merhaba,', 'dünya!', 'LocalDesk', '(makro)', 'metin;', 'adımı', '2024?'];
+  let text = '';
+  for (let i = 0; [...text].length < length; i++) {
+    text += (text ? ' ' : '') + words[i % words.length];
+  }
+  return [...text].slice(0, length).join('');
+}
+
+test('noktalamalı 500 karakterlik metin sınırlı parçalarla yazılır', async (t) => {
+  if (!addon) {
+    t.skip(addonSkip);
+    return;
+  }
+  assert.strictEqual(addon.getTestBackend().mode, 'recording');
+  addon.takeRecording();
+
+  const text = sampleText(500);
+  const handle = addon.compileMacro([{ type: 'text', text }]);
+  const result = await addon.runMacro(handle);
+  assert.ok(result.completed);
+  assert.strictEqual(result.skipped, 0);
+
+  const recording = addon.takeRecording();
+  const chunks = recording.filter(event => event.op === 'text');
+  assert.strictEqual(recording.filter(event => event.op === 'down' || event.op === 'up').length, 0);
+
+  assert.strictEqual(chunks.map(event => event.target).join(''), text);
+  assert.strictEqual(chunks.length, Math.ceil(500 / TEXT_CHUNK_CHARS));
+  for (const chunk of chunks) {
+    assert.ok(chunk.value > 0 && chunk.value <= TEXT_CHUNK_CHARS, `parça boyutu ${chunk.value}`);
+  }
+  // Karakter başına bas + bırak
+  assert.strictEqual(result.keyEvents, 500 * 2);
+});
+
+test('aralıklı metin adımında her karakter ayrı parça', async (t) => {
+  if (!addon) {
+    t.skip(addonSkip);
+    return;
+  }
+  addon.takeRecording();
+
+  const handle = addon.compileMacro([{ type: 'text', text: 'a,ç', interval: 1 }]);
+  const result = await addon.runMacro(handle);
+  assert.ok(result.completed);
+
+  const chunks = addon.takeRecording().filter(event => event.op === 'text').map(event => event.target);
+  assert.deepStrictEqual(chunks, ['a', ',', 'ç']);
+});
+
+test('beklemesiz uzun tuş dizisi sınırlı toplu işlerle gönderilir', async (t) => {
+  if (!addon) {
+    t.skip(addonSkip);
+    return;
+  }
+  addon.takeRecording();
+
+  const handle = addon.compileMacro([{ type: 'repeat', count: 100, steps: [{ type: 'chord', keys: ['SHIFT', 'A'] }] }]);
+  const result = await addon.runMacro(handle);
+  assert.ok(result.completed);
+
+  const recording = addon.takeRecording();
+  const flushes = recording.filter(event => event.op === 'flush').map(event => event.value);
+  const keyEvents = recording.filter(event => event.op === 'down' || event.op === 'up').length;
+  assert.strictEqual(keyEvents, 400);
+  assert.strictEqual(result.keyEvents, keyEvents);
+
+  for (const size of flushes) {
+    assert.ok(size > 0 && size <= MAX_BATCH_EVENTS, `toplu iş boyutu ${size}`);
+  }
+  assert.strictEqual(flushes.reduce((sum, size) => sum + size, 0), keyEvents);
+});
@@ -0,0 +1,23 @@
+// Makro motoru zamanlama sınırları: mutlak çizelgeden sapma, birikmeyen gecikme
+// ve iptal gecikmesi (bkz. test/macro_timing_test.cc). Program derlenmemişse atlanır.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const { spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const TIMING_TEST = path.join(__dirname, '..', 'build', 'Release',
+  process.platform === 'win32' ? 'macro_timing_test.exe' : 'macro_timing_test');
+
+test('makro beklemeleri çizelgede kalır, iptal hemen biter', (t) => {
+  if (!fs.existsSync(TIMING_TEST)) {
+    t.skip('macro_timing_test derlenmemiş (node-gyp rebuild)');
+    return;
+  }
+
+  const result = spawnSync(TIMING_TEST, [], { encoding: 'utf8', timeout: 30000 });
+  assert.strictEqual(result.status, 0, `${result.stdout}${result.stderr}`);
+});
@@ -0,0 +1,260 @@
+// Makro motoru zamanlama testi (macro_timing_bench'in sınır denetleyen hali)
+// Backend eventleri testbackend::Recorder'a zaman damgasıyla yazar; denetlenenler:
+//   - beklemelerden sonraki toplu işler mutlak çizelgedeki hedeften erken gitmez,
+//     geç kalma sınırlı kalır ve gecikme birikmez (toplam süre ≈ ideal süre)
+//   - uzun beklemedeki makro iptal edilince hemen biter, basılı tuş bırakılır
+//   - metin adımı karakter sınırlarından parçalanır
+//   - beklemesiz uzun metin adımı parçalar arasında iptal edilebilir
+//
+// Derleme: node-gyp rebuild (build/Release/macro_timing_test)
+// Çalıştırma: ./build/Release/macro_timing_test (veya npm test)
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../macro_engine.h"
+
+namespace {
+
+// Sınırlar paylaşılan CI makinelerinde zamanlayıcı gürültüsüne göre geniş tutulur;
+// motorun iptal gecikmesi tasarım gereği kSpinMargin (2 ms) + bir toplu iş
+constexpr double kMaxMedianLateUs = 2000;
+constexpr double kMaxLateUs = 20000;
+constexpr double kMaxDriftMs = 5;
+constexpr double kMaxCancelUs = 20000;
+
+int failures = 0;
+
+void Check(bool ok, const std::string& what) {
+    std::printf("  %s %s\n", ok ? "ok  " : "HATA", what.c_str());
+    if (!ok) {
+        failures++;
+    }
+}
+
+// Tuş, toplu iş ve metin eventlerini kaydeder
+class RecorderBackend : public MacroBackend {
+public:
+    explicit RecorderBackend(testbackend::Recorder& recorder) : recorder_(recorder) {}
+
+    void KeyDown(const keytable::KeyEntry* key) override { recorder_.Record("down", key->name); }
+    void KeyUp(const keytable::KeyEntry* key) override { recorder_.Record("up", key->name); }
+    void Flush() override { recorder_.Record("flush", ""); }
+
+    textinput::TextStats Text(std::string_view text) override {
+        textinput::TextStats stats;
+        textinput::ForEachCodePoint(text, [&](char32_t) { stats.typed++; });
+        recorder_.Record("text", text, stats.typed);
+        return stats;
+    }
+
+private:
+    testbackend::Recorder& recorder_;
+};
+
+struct Waiter {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    MacroResult result;
+    int64_t atNs = 0;
+
+    MacroEngine::DoneFn Callback() {
+        return [this](const MacroResult& r) {
+            std::lock_guard<std::mutex> lock(mutex);
+            result = r;
+            atNs = testbackend::NowNs();
+            done = true;
+            cv.notify_all();
+        };
+    }
+
+    bool Wait(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, timeout, [this]() { return done; });
+    }
+};
+
+std::vector<testbackend::Event> Only(const std::vector<testbackend::Event>& events, const char* op) {
+    std::vector<testbackend::Event> result;
+    for (const testbackend::Event& event : events) {
+        if (std::strcmp(event.op, op) == 0) {
+            result.push_back(event);
+        }
+    }
+    return result;
+}
+
+// Kayıtta op görünene kadar bekle (kayıtlar boşaltılmaz, kopyası döner)
+bool WaitForOp(testbackend::Recorder& recorder, const char* op, std::vector<testbackend::Event>& seen) {
+    for (int i = 0; i < 1000; i++) {
+        std::vector<testbackend::Event> events = recorder.Take();
+        seen.insert(seen.end(), events.begin(), events.end());
+        if (!Only(seen, op).empty()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+void TestDrift(MacroEngine& engine, testbackend::Recorder& recorder) {
+    const uint32_t repeats = 50;
+    const auto delay = std::chrono::milliseconds(10);
+
+    // tekrar N { Ctrl+1 ; bekle ; Shift basılı tut ; bekle ; Shift bırak }
+    auto program = std::make_shared<MacroProgram>();
+    program->BeginRepeat(repeats);
+    program->Chord({ keytable::Find("CTRL"), keytable::Find("1") });
+    program->Delay(delay);
+    program->Down(keytable::Find("SHIFT"));
+    program->Delay(delay);
+    program->Up(keytable::Find("SHIFT"));
+    program->EndRepeat();
+
+    recorder.Take();
+    Waiter waiter;
+    int64_t start = testbackend::NowNs();
+    engine.Submit(program, nullptr, waiter.Callback());
+    Check(waiter.Wait(std::chrono::seconds(10)) && waiter.result.completed, "makro tamamlandı");
+
+    // i. toplu iş i. beklemenin sonunda gider: hedef = başlangıç + i * bekleme
+    std::vector<testbackend::Event> flushes = Only(recorder.Take(), "flush");
+    Check(flushes.size() == 2 * repeats + 1, "toplu iş sayısı " + std::to_string(flushes.size()));
+
+    const int64_t delayNs = std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+    std::vector<int64_t> lateNs;
+    bool early = false;
+    for (size_t i = 1; i < flushes.size(); i++) {
+        int64_t late = flushes[i].timeNs - (start + static_cast<int64_t>(i) * delayNs);
+        early = early || late < 0;
+        lateNs.push_back(late < 0 ? 0 : late);
+    }
+    testbackend::LatencySummary summary = testbackend::Summarize(lateNs);
+    char line[160];
+    std::snprintf(line, sizeof(line), "hedeften sapma p50 %.1f us, p99 %.1f us, en kötü %.1f us",
+                  summary.p50Us, summary.p99Us, summary.maxUs);
+    Check(!early, "hiçbir toplu iş hedeften erken gitmedi");
+    Check(summary.p50Us < kMaxMedianLateUs && summary.maxUs < kMaxLateUs, line);
+
+    // Gecikme birikmez: son toplu iş ideal süreye göre kaymaz
+    double ideal = 2.0 * repeats * delayNs / 1e6;
+    double lastMs = (flushes.back().timeNs - start) / 1e6;
+    std::snprintf(line, sizeof(line), "toplam %.2f ms (ideal %.0f ms)", lastMs, ideal);
+    Check(lastMs >= ideal && lastMs - ideal < kMaxDriftMs, line);
+}
+
+void TestCancelDuringDelay(MacroEngine& engine, testbackend::Recorder& recorder) {
+    auto hold = std::make_shared<MacroProgram>();
+    hold->Down(keytable::Find("SHIFT"));
+    hold->Delay(std::chrono::seconds(10));
+    hold->Up(keytable::Find("SHIFT"));
+
+    recorder.Take();
+    Waiter waiter;
+    uint32_t id = engine.Submit(hold, nullptr, waiter.Callback());
+
+    // Shift basıldı, makro beklemede
+    std::vector<testbackend::Event> events;
+    Check(WaitForOp(recorder, "flush", events), "Shift basıldı");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    int64_t cancelAt = testbackend::NowNs();
+    Check(engine.Cancel(id), "Cancel true döner");
+    Check(waiter.Wait(std::chrono::seconds(1)) && waiter.result.cancelled, "makro iptal edildi");
+
+    double latencyUs = (waiter.atNs - cancelAt) / 1e3;
+    char line[64];
+    std::snprintf(line, sizeof(line), "iptal gecikmesi %.1f us", latencyUs);
+    Check(latencyUs < kMaxCancelUs, line);
+
+    std::vector<testbackend::Event> rest = recorder.Take();
+    events.insert(events.end(), rest.begin(), rest.end());
+    std::vector<testbackend::Event> ups = Only(events, "up");
+    Check(ups.size() == 1 && ups[0].target == "SHIFT" && ups[0].timeNs >= cancelAt,
+          "iptalden sonra basılı Shift bırakıldı");
+}
+
+void TestCancelDuringText(MacroEngine& engine, testbackend::Recorder& recorder) {
+    std::string text;
+    while (text.size() < 20000) {
+        text += "lorem ipsum 42 ";
+    }
+    auto program = std::make_shared<MacroProgram>();
+    program->Text(text, std::chrono::nanoseconds(0));
+
+    recorder.Take();
+    Waiter waiter;
+    uint32_t id = engine.Submit(program, nullptr, waiter.Callback());
+    std::vector<testbackend::Event> events;
+    WaitForOp(recorder, "text", events);
+
+    int64_t cancelAt = testbackend::NowNs();
+    engine.Cancel(id);
+    Check(waiter.Wait(std::chrono::seconds(5)) && waiter.result.cancelled, "metin adımı iptal edildi");
+
+    double latencyUs = (waiter.atNs - cancelAt) / 1e3;
+    char line[64];
+    std::snprintf(line, sizeof(line), "metin iptal gecikmesi %.1f us", latencyUs);
+    Check(latencyUs < kMaxCancelUs, line);
+    Check(waiter.result.keyEvents < program->KeyEventCount(), "metnin kalanı gönderilmedi");
+}
+
+// Metin karakter sınırlarından parçalanır: "\r\n" ve çok baytlı karakterler bölünmez
+void TestTextChunks() {
+    const std::string text = "Merhaba, dünya!\r\nÇok baytlı: ğüşiöç €";
+    MacroProgram program;
+    program.Text(text, std::chrono::nanoseconds(0));
+
+    std::string joined;
+    bool sized = true;
+    for (const MacroOp& op : program.Ops()) {
+        if (op.kind != MacroOp::Kind::kText) {
+            continue;
+        }
+        const std::string& chunk = program.TextAt(op.target);
+        uint32_t chars = 0;
+        size_t invalid = textinput::ForEachCodePoint(chunk, [&](char32_t) { chars++; });
+        sized = sized && invalid == 0 && chars == op.count && chars <= MacroProgram::kTextChunkChars;
+        joined += chunk;
+    }
+    Check(joined == text, "parçalar birleşince metnin kendisi");
+    Check(sized, "parçalar en fazla kTextChunkChars karakter ve geçerli UTF-8");
+
+    MacroProgram paced;
+    paced.Text("a\r\nb", std::chrono::milliseconds(1));
+    std::vector<std::string> chars;
+    for (const MacroOp& op : paced.Ops()) {
+        if (op.kind == MacroOp::Kind::kText) {
+            chars.push_back(paced.TextAt(op.target));
+        }
+    }
+    Check(chars == std::vector<std::string>{ "a", "\r\n", "b" }, "aralıklı metinde her karakter ayrı adım");
+}
+
+} // namespace
+
+int main() {
+    testbackend::Recorder recorder;
+    recorder.SetMode(testbackend::Mode::kRecording);
+    RecorderBackend backend(recorder);
+    MacroEngine engine(backend);
+    engine.Start();
+
+    std::printf("Makro zamanlama testi\n");
+    TestTextChunks();
+    TestDrift(engine, recorder);
+    TestCancelDuringDelay(engine, recorder);
+    TestCancelDuringText(engine, recorder);
+
+    engine.Stop();
+    std::printf("%s\n", failures == 0 ? "BAŞARILI" : "BAŞARISIZ");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// uinput klavye backend'i: çekirdeğe yazılan eventlerin geri okunması
+// sendKeys(['CONTROL', 'A']) -> [Ctrl↓ A↓] SYN [A↑ Ctrl↑] SYN
+// Cihaz gönderimden önce evdev_grab ile yakalanır; tuşlar odaktaki pencereye gitmez.
+// /dev/uinput erişimi yoksa (input grubu / udev kuralı) veya evdev_grab
+// derlenmemişse test atlanır.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const evdev = require('./evdev');
+const { loadAddon } = require('./addon');
+
+const KEY_LEFTCTRL = 29;
+const KEY_A = 30;
+
+const { addon, skip: addonSkip } = loadAddon();
+
+function backendInfo(t) {
+  const info = addon ? addon.getBackendInfo() : { error: addonSkip };
+  if (process.platform !== 'linux' || !info.ready || !info.devicePath) {
+    t.skip(`uinput hazır değil: ${info.error || process.platform}`);
+    return null;
+  }
+  return info;
+}
+
+// Yakalanmadan tuş gönderilmez (yakalanmamış cihazın tuşları masaüstüne gider)
+async function grab(t, info) {
+  const device = await evdev.grabDevice(info.devicePath);
+  if (!device) {
+    t.skip('evdev_grab derlenmemiş (node-gyp rebuild)');
+  }
+  return device;
+}
+
+test('sendKeys çekirdeğe iki SYN çerçevesi olarak ulaşır', async (t) => {
+  const info = backendInfo(t);
+  if (!info) return;
+
+  const device = await grab(t, info);
+  if (!device) return;
+  try {
+    device.drain();
+    await addon.sendKeys(['CONTROL', 'A']);
+
+    const events = await device.readEvents((list) => evdev.frames(list).length >= 2);
+    const keys = evdev.frames(events).map(frame =>
+      frame.filter(event => event.type === evdev.EV_KEY).map(event => [event.code, event.value]));
+
+    assert.deepStrictEqual(keys, [
+      [[KEY_LEFTCTRL, 1], [KEY_A, 1]],
+      [[KEY_A, 0], [KEY_LEFTCTRL, 0]]
+    ]);
+  } finally {
+    await device.close();
+  }
+});
+
+test('odaklanamayan hedef pencereye tuş gönderilmez', async (t) => {
+  const info = backendInfo(t);
+  if (!info) return;
+
+  const device = await grab(t, info);
+  if (!device) return;
+  try {
+    device.drain();
+    // Var olmayan pencere: _NET_ACTIVE_WINDOW isteği reddedilir veya odak gelmez
+    const accepted = await addon.sendKeysToWindow(0x7ffffff0, ['CONTROL', 'A'], 'focus');
+    assert.strictEqual(accepted, false);
+
+    const events = await device.readEvents(() => false, 300);
+    assert.strictEqual(events.filter(event => event.type === evdev.EV_KEY).length, 0);
+  } finally {
+    await device.close();
+  }
+});
+
+test('hazır kısayol odaklanamayan hedefe gönderilmez', async (t) => {
+  const info = backendInfo(t);
+  if (!info) return;
+
+  const device = await grab(t, info);
+  if (!device) return;
+  const handle = addon.prepareShortcut(['CONTROL', 'A']);
+  try {
+    device.drain();
+    const accepted = await addon.fireShortcutToWindow(handle, 0x7ffffff0, 'focus');
+    assert.strictEqual(accepted, false);
+
+    const events = await device.readEvents(() => false, 300);
+    assert.strictEqual(events.filter(event => event.type === evdev.EV_KEY).length, 0);
+  } finally {
+    await device.close();
+    addon.releaseShortcut(handle);
+  }
+});
@@ -0,0 +1,159 @@
+// uinput işaretçi backend'i: çekirdeğe yazılan eventlerin geri okunması
+// Mutlak cihazın eksen aralığı (EVIOCGABS), piksel -> ABS ölçekleme, kare başına
+// birleştirme ve göreli hareket toplamının int32 sınırında doyurulması denetlenir.
+// Cihazlar hareketten önce evdev_grab ile yakalanır; gerçek imleç kıpırdamaz.
+// /dev/uinput erişimi yoksa (input grubu / udev kuralı) veya evdev_grab
+// derlenmemişse test atlanır.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const evdev = require('./evdev');
+const { loadAddon } = require('./addon');
+
+const ABS_MAX = 65535;
+const INT32_MAX = 2147483647;
+const INT32_MIN = -2147483648;
+const DESKTOP = [1000, 500];
+
+// X bağlantısı olmasın: mutlak eşleme setPointerDesktop boyutunu kullanır
+delete process.env.DISPLAY;
+const { addon, skip: addonSkip } = loadAddon();
+
+function pointerInfo(t) {
+  const info = addon ? addon.getPointerInfo() : { error: addonSkip };
+  if (process.platform !== 'linux' || !info.ready || !info.devicePath) {
+    t.skip(`uinput işaretçisi hazır değil: ${info.error || process.platform}`);
+    return null;
+  }
+  return info;
+}
+
+// Yakalanmadan hareket gönderilmez (yakalanmamış cihaz gerçek imleci oynatır)
+async function grab(t, devicePath) {
+  const device = await evdev.grabDevice(devicePath);
+  if (!device) {
+    t.skip('evdev_grab derlenmemiş (node-gyp rebuild)');
+  }
+  return device;
+}
+
+// pointer_injector_uinput.cc ScaleAxis ile aynı yuvarlama
+function scale(value, size) {
+  return Math.floor((value * ABS_MAX + Math.floor((size - 1) / 2)) / (size - 1));
+}
+
+// Çerçevedeki [tip, kod] -> değer eşlemesi
+function axes(frame, type) {
+  const result = {};
+  for (const event of frame) {
+    if (event.type === type) {
+      result[event.code] = event.value;
+    }
+  }
+  return result;
+}
+
+test('mutlak cihaz ABS_X / ABS_Y aralığı 0..65535', (t) => {
+  const info = pointerInfo(t);
+  if (!info) return;
+
+  const ranges = evdev.absInfo(info.devicePath);
+  if (!ranges) {
+    t.skip('evdev_absinfo derlenmemiş (node-gyp rebuild)');
+    return;
+  }
+  assert.deepStrictEqual(ranges[evdev.ABS_X], { min: 0, max: ABS_MAX });
+  assert.deepStrictEqual(ranges[evdev.ABS_Y], { min: 0, max: ABS_MAX });
+});
+
+test('mutlak hareketler kare başına birleştirilir, son konum gider', async (t) => {
+  const info = pointerInfo(t);
+  if (!info) return;
+
+  const device = await grab(t, info.devicePath);
+  if (!device) return;
+  addon.setPointerDesktop(...DESKTOP);
+  addon.setPointerFrameRate(5); // 200 ms kare
+  try {
+    // Önceki hareketin karesi bitsin; ilk hareket beklemeden gider
+    await new Promise(resolve => setTimeout(resolve, 250));
+    device.drain();
+
+    addon.pointerMove(0, 0);
+    for (let i = 1; i <= 50; i++) {
+      addon.pointerMove(i * 10, i * 5);
+    }
+    addon.pointerMove(999, 499);
+
+    const events = await device.readEvents((list) => evdev.frames(list).length >= 2, 2000);
+    // Birleştirme sonrası başka kare gelmemeli
+    events.push(...await device.readEvents(() => false, 300));
+    const moves = evdev.frames(events).map(frame => axes(frame, evdev.EV_ABS));
+
+    assert.deepStrictEqual(moves, [
+      { [evdev.ABS_X]: 0, [evdev.ABS_Y]: 0 },
+      { [evdev.ABS_X]: ABS_MAX, [evdev.ABS_Y]: ABS_MAX }
+    ]);
+
+    // Ara konum ölçeklemesi (yuvarlama) ve masaüstü dışı konumun kırpılması
+    await new Promise(resolve => setTimeout(resolve, 250));
+    addon.pointerMove(500, 250);
+    const middle = evdev.frames(await device.readEvents((list) => evdev.frames(list).length >= 1));
+    assert.deepStrictEqual(axes(middle[0], evdev.EV_ABS), {
+      [evdev.ABS_X]: scale(500, DESKTOP[0]),
+      [evdev.ABS_Y]: scale(250, DESKTOP[1])
+    });
+
+    await new Promise(resolve => setTimeout(resolve, 250));
+    addon.pointerMove(-20, 5000);
+    const clamped = evdev.frames(await device.readEvents((list) => evdev.frames(list).length >= 1));
+    assert.deepStrictEqual(axes(clamped[0], evdev.EV_ABS), { [evdev.ABS_X]: 0, [evdev.ABS_Y]: ABS_MAX });
+  } finally {
+    await device.close();
+    addon.setPointerFrameRate(60);
+  }
+});
+
+test('göreli hareket toplamı taşmaz, int32 sınırında doyurulur', async (t) => {
+  const info = pointerInfo(t);
+  if (!info) return;
+
+  addon.setPointerFrameRate(5);
+  try {
+    // Göreli cihaz ilk göreli harekette oluşturulur; (0, 0) sadece SYN yazar
+    await new Promise(resolve => setTimeout(resolve, 250));
+    addon.pointerMoveBy(0, 0);
+    let devicePath = null;
+    for (let i = 0; i < 100 && !devicePath; i++) {
+      await new Promise(resolve => setTimeout(resolve, 10));
+      devicePath = evdev.findDevice('LocalDesk Virtual Mouse');
+    }
+    assert.ok(devicePath, 'LocalDesk Virtual Mouse oluşturulmadı');
+
+    const device = await grab(t, devicePath);
+    if (!device) return;
+    try {
+      await new Promise(resolve => setTimeout(resolve, 250));
+      device.drain();
+
+      addon.pointerMoveBy(1, 1); // Beklemeden gider
+      // Birleşir: x tam olarak INT32_MAX'e döner, y alt sınırda doyurulur
+      addon.pointerMoveBy(INT32_MAX, INT32_MIN);
+      addon.pointerMoveBy(INT32_MAX, INT32_MIN);
+      addon.pointerMoveBy(-INT32_MAX, 5);
+
+      const events = await device.readEvents((list) => evdev.frames(list).length >= 2, 2000);
+      const moves = evdev.frames(events).map(frame => axes(frame, evdev.EV_REL));
+      assert.deepStrictEqual(moves, [
+        { [evdev.REL_X]: 1, [evdev.REL_Y]: 1 },
+        { [evdev.REL_X]: INT32_MAX, [evdev.REL_Y]: INT32_MIN }
+      ]);
+    } finally {
+      await device.close();
+    }
+  } finally {
+    addon.setPointerFrameRate(60);
+  }
+});
@@ -0,0 +1,126 @@
+// Testler için sahte EWMH pencere yöneticisi (Xvfb'de pencere yöneticisi yok)
+// Pencere oluşturur ve kök penceredeki _NET_CLIENT_LIST / _NET_ACTIVE_WINDOW'u
+// gerçek bir pencere yöneticisi gibi günceller. Komutlar stdin'den satır satır
+// okunur; her komut sunucuyla eşitlendikten sonra "ok <pencere>" yazılır.
+//
+//   create <başlık> [pid|self]   pencere oluştur, listeye ekle
+//   pid <pencere> <pid|self>     _NET_WM_PID'i sonradan koy
+//   activate <pencere>           _NET_ACTIVE_WINDOW
+//   destroy <pencere>            listeden çıkar ve yok et
+//
+// Derleme: node-gyp rebuild (build/Release/x11_fake_wm)
+
+#include <unistd.h>
+#include <xcb/xcb.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+xcb_connection_t* conn = nullptr;
+xcb_window_t root = XCB_WINDOW_NONE;
+std::vector<xcb_window_t> clients;
+
+xcb_atom_t Atom(const char* name) {
+    xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(
+        conn, xcb_intern_atom(conn, 0, static_cast<uint16_t>(std::strlen(name)), name), nullptr);
+    xcb_atom_t atom = reply ? reply->atom : static_cast<xcb_atom_t>(XCB_ATOM_NONE);
+    free(reply);
+    return atom;
+}
+
+// Önceki tüm isteklerin sunucuda işlenmesini bekle
+void Sync() {
+    free(xcb_get_input_focus_reply(conn, xcb_get_input_focus(conn), nullptr));
+}
+
+uint32_t ParsePid(const std::string& value) {
+    return value == "self" ? static_cast<uint32_t>(getpid()) : static_cast<uint32_t>(std::stoul(value));
+}
+
+void SetCardinal(xcb_window_t window, xcb_atom_t property, xcb_atom_t type, uint32_t value) {
+    xcb_change_property(conn, XCB_PROP_MODE_REPLACE, window, property, type, 32, 1, &value);
+}
+
+void PublishClientList(xcb_atom_t clientList) {
+    xcb_change_property(conn, XCB_PROP_MODE_REPLACE, root, clientList, XCB_ATOM_WINDOW, 32,
+                        static_cast<uint32_t>(clients.size()), clients.data());
+}
+
+} // namespace
+
+int main() {
+    conn = xcb_connect(nullptr, nullptr);
+    if (xcb_connection_has_error(conn)) {
+        std::fprintf(stderr, "X sunucusuna bağlanılamadı\n");
+        return 1;
+    }
+    root = xcb_setup_roots_iterator(xcb_get_setup(conn)).data->root;
+
+    xcb_atom_t clientList = Atom("_NET_CLIENT_LIST");
+    xcb_atom_t activeWindow = Atom("_NET_ACTIVE_WINDOW");
+    xcb_atom_t wmPid = Atom("_NET_WM_PID");
+    xcb_atom_t netWmName = Atom("_NET_WM_NAME");
+    xcb_atom_t utf8String = Atom("UTF8_STRING");
+
+    PublishClientList(clientList);
+    Sync();
+    std::printf("ready\n");
+    std::fflush(stdout);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream input(line);
+        std::string command;
+        input >> command;
+        xcb_window_t window = XCB_WINDOW_NONE;
+
+        if (command == "create") {
+            std::string title;
+            std::string pid;
+            input >> title >> pid;
+            window = xcb_generate_id(conn);
+            xcb_create_window(conn, XCB_COPY_FROM_PARENT, window, root, 0, 0, 100, 100, 0,
+                              XCB_WINDOW_CLASS_INPUT_OUTPUT, XCB_COPY_FROM_PARENT, 0, nullptr);
+            xcb_change_property(conn, XCB_PROP_MODE_REPLACE, window, netWmName, utf8String, 8,
+                                static_cast<uint32_t>(title.size()), title.data());
+            if (!pid.empty()) {
+                SetCardinal(window, wmPid, XCB_ATOM_CARDINAL, ParsePid(pid));
+            }
+            xcb_map_window(conn, window);
+            clients.push_back(window);
+            PublishClientList(clientList);
+        } else if (command == "pid") {
+            std::string pid;
+            input >> window >> pid;
+            SetCardinal(window, wmPid, XCB_ATOM_CARDINAL, ParsePid(pid));
+        } else if (command == "activate") {
+            input >> window;
+            SetCardinal(root, activeWindow, XCB_ATOM_WINDOW, window);
+        } else if (command == "destroy") {
+            input >> window;
+            clients.erase(std::remove(clients.begin(), clients.end(), window), clients.end());
+            PublishClientList(clientList);
+            xcb_destroy_window(conn, window);
+        } else {
+            std::printf("error %s\n", command.c_str());
+            std::fflush(stdout);
+            continue;
+        }
+
+        Sync();
+        std::printf("ok %u\n", window);
+        std::fflush(stdout);
+    }
+
+    xcb_disconnect(conn);
+    return 0;
+}
@@ -0,0 +1,111 @@
+// X11 pencere indeksi (findWindowByExe): Xvfb + sahte pencere yöneticisi
+// _NET_CLIENT_LIST değişiklikleri indekse yansımalı; PID'i sonradan konan pencere
+// PropertyNotify ile yeniden çözülmeli. Xvfb, x11_fake_wm veya keyboard.node
+// yoksa atlanır.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const { test, before, after } = require('node:test');
+const assert = require('node:assert');
+const path = require('path');
+const xvfb = require('./xvfb');
+const { loadAddon } = require('./addon');
+
+const EXE = path.basename(xvfb.FAKE_WM);
+
+let server = null;
+let wm = null;
+let addon = null;
+let addonSkip = null;
+
+before(async () => {
+  server = await xvfb.startXvfb();
+  if (!server) {
+    return;
+  }
+  wm = await xvfb.startFakeWm(server.display);
+  // İndeks modül yüklenirken DISPLAY'e bağlanır
+  process.env.DISPLAY = server.display;
+  ({ addon, skip: addonSkip } = loadAddon());
+});
+
+after(() => {
+  if (wm) {
+    wm.stop();
+  }
+  if (server) {
+    server.stop();
+  }
+});
+
+function skipReason() {
+  if (!server) {
+    return 'Xvfb yok';
+  }
+  if (!wm) {
+    return 'x11_fake_wm derlenmemiş';
+  }
+  if (!addon) {
+    return addonSkip;
+  }
+  if (!addon.isWindowIndexRunning()) {
+    return 'pencere indeksi başlamadı';
+  }
+  return null;
+}
+
+test('listeye eklenen ve çıkan pencere indekse yansır', async (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  const window = await wm.command('create indeks-test self');
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === window));
+  // Büyük/küçük harf duyarsız
+  assert.strictEqual(addon.findWindowByExe(EXE.toUpperCase()), window);
+
+  await wm.command(`destroy ${window}`);
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === null));
+});
+
+test('PID sonradan konan pencere yeniden çözülür', async (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  // PID'siz pencere listeye girer ama indekse giremez
+  const window = await wm.command('create pidsiz');
+  await new Promise(resolve => setTimeout(resolve, 100));
+  assert.strictEqual(addon.findWindowByExe(EXE), null);
+
+  // Liste değişmeden sadece _NET_WM_PID konur
+  await wm.command(`pid ${window} self`);
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === window));
+
+  await wm.command(`destroy ${window}`);
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === null));
+});
+
+test('en son aktif pencere önce döner', async (t) => {
+  const reason = skipReason();
+  if (reason) {
+    t.skip(reason);
+    return;
+  }
+
+  const first = await wm.command('create birinci self');
+  const second = await wm.command('create ikinci self');
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) !== null));
+
+  await wm.command(`activate ${first}`);
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === first));
+  await wm.command(`activate ${second}`);
+  assert.ok(await xvfb.waitFor(() => addon.findWindowByExe(EXE) === second));
+
+  await wm.command(`destroy ${first}`);
+  await wm.command(`destroy ${second}`);
+});
@@ -0,0 +1,60 @@
+// Linux getWindowList: Xvfb + sahte pencere yöneticisi
+// _NET_CLIENT_LIST'teki başlıklı ve PID'li pencereler listelenmeli; başlıksız
+// veya PID'siz olanlar atlanmalı. Xvfb, x11_fake_wm veya keyboard.node yoksa atlanır.
+//
+// Çalıştırma: npm test (önce node-gyp rebuild)
+
+const { test, before, after } = require('node:test');
+const assert = require('node:assert');
+const path = require('path');
+const xvfb = require('./xvfb');
+const { loadAddon } = require('./addon');
+
+const EXE = path.basename(xvfb.FAKE_WM);
+
+let server = null;
+let wm = null;
+let addon = null;
+let addonSkip = null;
+
+before(async () => {
+  server = await xvfb.startXvfb();
+  if (!server) {
+    return;
+  }
+  wm = await xvfb.startFakeWm(server.display);
+  process.env.DISPLAY = server.display;
+  ({ addon, skip: addonSkip } = loadAddon());
+});
+
+after(() => {
+  if (wm) {
+    wm.stop();
+  }
+  if (server) {
+    server.stop();
+  }
+});
+
+test('getWindowList başlık ve exe adıyla pencereleri döner', async (t) => {
+  if (!server || !wm || !addon) {
+    t.skip(!server ? 'Xvfb yok' : !wm ? 'x11_fake_wm derlenmemiş' : addonSkip);
+    return;
+  }
+
+  assert.deepStrictEqual(addon.getWindowList(), []);
+
+  const editor = await wm.command('create Editör self');
+  const terminal = await wm.command('create Terminal self');
+  // PID'siz pencere listelenmez
+  await wm.command('create pidsiz');
+
+  const list = addon.getWindowList();
+  assert.deepStrictEqual(list, [
+    { hwnd: editor, title: 'Editör', exeName: EXE },
+    { hwnd: terminal, title: 'Terminal', exeName: EXE }
+  ]);
+
+  await wm.command(`destroy ${editor}`);
+  assert.deepStrictEqual(addon.getWindowList().map(window => window.hwnd), [terminal]);
+});
@@ -0,0 +1,109 @@
+// Xvfb yardımcıları: testler için geçici X sunucusu ve sahte pencere yöneticisi
+// Xvfb veya x11_fake_wm yoksa start* fonksiyonları null döner; testler atlanır.
+
+const { spawn, spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const readline = require('readline');
+
+const FAKE_WM = path.join(__dirname, '..', 'build', 'Release', 'x11_fake_wm');
+
+function hasXvfb() {
+  return spawnSync('Xvfb', ['-help'], { stdio: 'ignore' }).error === undefined;
+}
+
+async function waitFor(predicate, timeoutMs = 3000, intervalMs = 20) {
+  const deadline = Date.now() + timeoutMs;
+  while (Date.now() < deadline) {
+    if (predicate()) {
+      return true;
+    }
+    await new Promise(resolve => setTimeout(resolve, intervalMs));
+  }
+  return predicate();
+}
+
+// Boş bir ekran numarasında Xvfb başlat -> { display, stop() } | null
+async function startXvfb() {
+  if (process.platform !== 'linux' || !hasXvfb()) {
+    return null;
+  }
+
+  for (let attempt = 0; attempt < 5; attempt++) {
+    const number = 90 + Math.floor(Math.random() * 400);
+    const socket = `/tmp/.X11-unix/X${number}`;
+    if (fs.existsSync(socket) || fs.existsSync(`/tmp/.X${number}-lock`)) {
+      continue;
+    }
+
+    const server = spawn('Xvfb', [`:${number}`, '-screen', '0', '640x480x24', '-nolisten', 'tcp'], {
+      stdio: 'ignore'
+    });
+    let exited = false;
+    server.on('exit', () => { exited = true; });
+
+    if (await waitFor(() => exited || fs.existsSync(socket)) && !exited) {
+      return {
+        display: `:${number}`,
+        stop() {
+          server.kill();
+        }
+      };
+    }
+    server.kill();
+  }
+  return null;
+}
+
+// Sahte pencere yöneticisini başlat -> { pid, command(line) -> Promise<pencere>, stop() } | null
+async function startFakeWm(display) {
+  if (!fs.existsSync(FAKE_WM)) {
+    return null;
+  }
+
+  const child = spawn(FAKE_WM, [], {
+    env: { ...process.env, DISPLAY: display },
+    stdio: ['pipe', 'pipe', 'inherit']
+  });
+  const lines = readline.createInterface({ input: child.stdout });
+  const waiting = [];
+  lines.on('line', (line) => {
+    const next = waiting.shift();
+    if (next) {
+      next(line);
+    }
+  });
+
+  // Süreç çıkarsa bekleyen komutlar hata ile sonuçlanır
+  child.on('exit', () => waiting.splice(0).forEach(resolve => resolve('exit')));
+
+  const nextLine = () => new Promise(resolve => waiting.push(resolve));
+  if (await nextLine() !== 'ready') {
+    child.kill();
+    return null;
+  }
+
+  return {
+    pid: child.pid,
+    async command(line) {
+      const reply = nextLine();
+      child.stdin.write(`${line}\n`);
+      const [status, window] = (await reply).split(' ');
+      if (status !== 'ok') {
+        throw new Error(`x11_fake_wm: ${line}`);
+      }
+      return Number(window);
+    },
+    stop() {
+      child.stdin.end();
+      child.kill();
+    }
+  };
+}
+
+module.exports = {
+  FAKE_WM,
+  startXvfb,
+  startFakeWm,
+  waitFor
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// typeText için platformdan bağımsız metin yardımcıları
+// Metin tek bir toplu iş olarak enjekte edilir (Windows: tek SendInput,
+// Linux: uinput); burada sadece UTF-8 çözme ve satır sonu normalizasyonu var.
+
+namespace textinput {
+
+// Yazılan / atlanan karakter sayısı (typeText sonucu)
+struct TextStats {
+    uint32_t typed = 0;
+    uint32_t skipped = 0; // Geçersiz UTF-8, kontrol karakteri veya düzende olmayan karakter
+};
+
+// UTF-8 metni kod noktalarına çöz ve visit(char32_t) çağır
+// "\r\n" ve tek "\r" -> '\n'. Geçersiz / fazla uzun kodlanmış dizi ve vekil
+// (surrogate) kod noktaları atlanır; dönüş: atlanan dizi sayısı.
+template <typename Visit>
+size_t ForEachCodePoint(std::string_view text, Visit&& visit) {
+    size_t invalid = 0;
+    size_t i = 0;
+    const size_t size = text.size();
+
+    while (i < size) {
+        uint8_t lead = static_cast<uint8_t>(text[i]);
+
+        if (lead < 0x80) {
+            i++;
+            if (lead == '\r') {
+                if (i < size && text[i] == '\n') {
+                    i++;
+                }
+                visit(U'\n');
+            } else {
+                visit(static_cast<char32_t>(lead));
+            }
+            continue;
+        }
+
+        size_t length;
+        char32_t value;
+        char32_t min;
+        if ((lead & 0xE0) == 0xC0) {
+            length = 2;
+            value = lead & 0x1F;
+            min = 0x80;
+        } else if ((lead & 0xF0) == 0xE0) {
+            length = 3;
+            value = lead & 0x0F;
+            min = 0x800;
+        } else if ((lead & 0xF8) == 0xF0) {
+            length = 4;
+            value = lead & 0x07;
+            min = 0x10000;
+        } else {
+            invalid++;
+            i++;
+            continue;
+        }
+
+        size_t n = 1;
+        while (n < length && i + n < size && (static_cast<uint8_t>(text[i + n]) & 0xC0) == 0x80) {
+            value = (value << 6) | (static_cast<uint8_t>(text[i + n]) & 0x3F);
+            n++;
+        }
+
+        // Eksik devam baytı: sadece okunan kısım atlanır, sonraki bayt yeniden denenir
+        i += n;
+        if (n < length || value < min || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+            invalid++;
+            continue;
+        }
+
+        visit(value);
+    }
+
+    return invalid;
+}
+
+} // namespace textinput
@@ -0,0 +1,305 @@
+#include "text_keymap.h"
+
+#include <xcb/xcb.h>
+#include <xkbcommon/xkbcommon-x11.h>
+#include <xkbcommon/xkbcommon.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// X sunucusundaki düzen bu süreden eskiyse yeniden okunur (setxkbmap sonrası)
+constexpr std::chrono::seconds kKeymapMaxAge{2};
+
+// uinput cihazında kayıtlı tuş aralığı (VirtualKeyboard::Open)
+constexpr uint32_t kMaxTextKeyCode = 255;
+
+// X/xkb keycode = evdev kodu + 8
+constexpr uint32_t kEvdevOffset = 8;
+
+bool KeyHasSym(xkb_keymap* keymap, xkb_keycode_t key, xkb_keysym_t sym, uint32_t group) {
+    const xkb_keysym_t* syms = nullptr;
+    int count = xkb_keymap_key_get_syms_by_level(keymap, key, group, 0, &syms);
+    for (int i = 0; i < count; i++) {
+        if (syms[i] == sym) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Grubun ilk seviyesinde sym olan tuş (değiştirici tuşları bulmak için)
+// Fiziksel tuş (preferred, ör. sağ Alt) tercih edilir: düzenler ISO_Level3_Shift'i
+// donanımda olmayan sanal keycode'lara da (<LVL3>) bağlar.
+xkb_keycode_t FindKeyBySym(xkb_keymap* keymap, xkb_keysym_t sym, uint32_t group, uint16_t preferred) {
+    if (KeyHasSym(keymap, preferred + kEvdevOffset, sym, group)) {
+        return preferred + kEvdevOffset;
+    }
+
+    xkb_keycode_t min = xkb_keymap_min_keycode(keymap);
+    xkb_keycode_t max = xkb_keymap_max_keycode(keymap);
+
+    for (xkb_keycode_t key = min; key <= max; key++) {
+        if (key >= kEvdevOffset && key - kEvdevOffset <= kMaxTextKeyCode && KeyHasSym(keymap, key, sym, group)) {
+            return key;
+        }
+    }
+    return XKB_KEYCODE_INVALID;
+}
+
+// Tuşa basıldığında etkin olan değiştirici maskesi (isim tahmini yerine düzenden okunur)
+xkb_mod_mask_t ModsOfKey(xkb_keymap* keymap, xkb_keycode_t key) {
+    if (key == XKB_KEYCODE_INVALID) {
+        return 0;
+    }
+
+    xkb_state* state = xkb_state_new(keymap);
+    if (!state) {
+        return 0;
+    }
+    xkb_state_update_key(state, key, XKB_KEY_DOWN);
+    xkb_mod_mask_t mask = xkb_state_serialize_mods(state, XKB_STATE_MODS_DEPRESSED);
+    xkb_state_unref(state);
+    return mask;
+}
+
+input_event MakeTextEvent(uint16_t type, uint16_t code, int32_t value) {
+    input_event event;
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    return event;
+}
+
+} // namespace
+
+TextKeymap::~TextKeymap() {
+    SetKeymap(nullptr);
+    if (context_) {
+        xkb_context_unref(context_);
+    }
+    if (conn_) {
+        xcb_disconnect(conn_);
+    }
+}
+
+bool TextKeymap::EnsureConnection() {
+    if (conn_ && !xcb_connection_has_error(conn_)) {
+        return true;
+    }
+
+    if (conn_) {
+        xcb_disconnect(conn_);
+        conn_ = nullptr;
+    }
+
+    // Wayland-only oturum / başsız: bağlanmayı hiç deneme
+    if (!getenv("DISPLAY")) {
+        return false;
+    }
+
+    conn_ = xcb_connect(nullptr, nullptr);
+    if (xcb_connection_has_error(conn_) ||
+        !xkb_x11_setup_xkb_extension(conn_, XKB_X11_MIN_MAJOR_XKB_VERSION, XKB_X11_MIN_MINOR_XKB_VERSION,
+                                     XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS, nullptr, nullptr, nullptr, nullptr) ||
+        (deviceId_ = xkb_x11_get_core_keyboard_device_id(conn_)) < 0) {
+        xcb_disconnect(conn_);
+        conn_ = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void TextKeymap::SetKeymap(xkb_keymap* keymap) {
+    if (keymap_) {
+        xkb_keymap_unref(keymap_);
+    }
+    keymap_ = keymap;
+    // Yeni düzen: tablo bir sonraki Refresh / LoadNames'te kurulur
+    group_ = UINT32_MAX;
+    lockedMods_ = UINT32_MAX;
+}
+
+bool TextKeymap::Refresh(std::string& error) {
+    if (!context_ && !(context_ = xkb_context_new(XKB_CONTEXT_NO_FLAGS))) {
+        error = "xkbcommon bağlamı oluşturulamadı";
+        return false;
+    }
+
+    if (EnsureConnection()) {
+        auto now = std::chrono::steady_clock::now();
+        if (!keymap_ || fromNames_ || now - loadedAt_ > kKeymapMaxAge) {
+            xkb_keymap* keymap = xkb_x11_keymap_new_from_device(context_, conn_, deviceId_, XKB_KEYMAP_COMPILE_NO_FLAGS);
+            if (keymap) {
+                SetKeymap(keymap);
+                fromNames_ = false;
+                loadedAt_ = now;
+            }
+        }
+
+        // Etkin grup (Alt+Shift ile değiştirilen düzen) ve Caps Lock durumu
+        xkb_state* state = keymap_ ? xkb_x11_state_new_from_device(keymap_, conn_, deviceId_) : nullptr;
+        if (state) {
+            uint32_t group = xkb_state_serialize_layout(state, XKB_STATE_LAYOUT_EFFECTIVE);
+            uint32_t lockedMods = xkb_state_serialize_mods(state, XKB_STATE_MODS_LOCKED);
+            xkb_state_unref(state);
+
+            if (group != group_ || lockedMods != lockedMods_) {
+                BuildTable(group, lockedMods);
+            }
+            return true;
+        }
+    }
+
+    // X yok: düzen XKB_DEFAULT_LAYOUT / XKB_DEFAULT_VARIANT'tan, Caps Lock kapalı varsayılır
+    if (!keymap_) {
+        return LoadNames(nullptr, nullptr, error);
+    }
+    return true;
+}
+
+bool TextKeymap::LoadNames(const char* layout, const char* variant, std::string& error) {
+    if (!context_ && !(context_ = xkb_context_new(XKB_CONTEXT_NO_FLAGS))) {
+        error = "xkbcommon bağlamı oluşturulamadı";
+        return false;
+    }
+
+    xkb_rule_names names = { nullptr, nullptr, layout, variant, nullptr };
+    xkb_keymap* keymap = xkb_keymap_new_from_names(context_, &names, XKB_KEYMAP_COMPILE_NO_FLAGS);
+    if (!keymap) {
+        error = std::string("Klavye düzeni derlenemedi: ") + (layout ? layout : "varsayılan");
+        return false;
+    }
+
+    SetKeymap(keymap);
+    fromNames_ = true;
+    BuildTable(0, 0);
+    return true;
+}
+
+void TextKeymap::BuildTable(uint32_t group, uint32_t lockedMods) {
+    table_.clear();
+    for (Stroke& stroke : ascii_) {
+        stroke = Stroke();
+    }
+    group_ = group;
+    lockedMods_ = lockedMods;
+
+    xkb_keycode_t shiftKey = FindKeyBySym(keymap_, XKB_KEY_Shift_L, group, KEY_LEFTSHIFT);
+    xkb_keycode_t level3Key = FindKeyBySym(keymap_, XKB_KEY_ISO_Level3_Shift, group, KEY_RIGHTALT);
+    xkb_mod_mask_t shiftMask = ModsOfKey(keymap_, shiftKey);
+    xkb_mod_mask_t level3Mask = ModsOfKey(keymap_, level3Key);
+    shiftCode_ = shiftMask ? static_cast<uint16_t>(shiftKey - kEvdevOffset) : 0;
+    level3Code_ = level3Mask ? static_cast<uint16_t>(level3Key - kEvdevOffset) : 0;
+
+    xkb_state* state = xkb_state_new(keymap_);
+    if (!state) {
+        return;
+    }
+
+    // Az değiştiricili vuruş önce: aynı karakteri üreten ilk kombinasyon kalır
+    struct Combo {
+        uint8_t modifiers;
+        xkb_mod_mask_t mask;
+    };
+    const Combo combos[] = {
+        { 0, 0 },
+        { kShift, shiftMask },
+        { kLevel3, level3Mask },
+        { kShift | kLevel3, shiftMask | level3Mask },
+    };
+
+    xkb_keycode_t min = xkb_keymap_min_keycode(keymap_);
+    xkb_keycode_t max = xkb_keymap_max_keycode(keymap_);
+
+    for (const Combo& combo : combos) {
+        if (((combo.modifiers & kShift) && !shiftMask) || ((combo.modifiers & kLevel3) && !level3Mask)) {
+            continue;
+        }
+
+        xkb_state_update_mask(state, combo.mask, 0, lockedMods, 0, 0, group);
+
+        for (xkb_keycode_t key = min; key <= max; key++) {
+            if (key < kEvdevOffset || key - kEvdevOffset > kMaxTextKeyCode) {
+                continue;
+            }
+
+            char32_t ch = xkb_state_key_get_utf32(state, key);
+            if (ch == 0) {
+                continue;
+            }
+
+            Stroke stroke;
+            stroke.code = static_cast<uint16_t>(key - kEvdevOffset);
+            stroke.modifiers = combo.modifiers;
+            if (table_.emplace(ch, stroke).second && ch < 128) {
+                ascii_[ch] = stroke;
+            }
+        }
+    }
+
+    xkb_state_unref(state);
+}
+
+bool TextKeymap::Lookup(char32_t ch, Stroke& stroke) const {
+    if (ch < 128) {
+        stroke = ascii_[ch];
+        return stroke.code != 0;
+    }
+
+    auto it = table_.find(ch);
+    if (it == table_.end()) {
+        return false;
+    }
+    stroke = it->second;
+    return true;
+}
+
+uint16_t TextKeymap::ModifierCode(Modifier modifier) const {
+    return modifier == kShift ? shiftCode_ : level3Code_;
+}
+
+void BuildTextEvents(const TextKeymap& keymap, std::string_view text,
+                     std::vector<input_event>& events, textinput::TextStats& stats) {
+    events.reserve(events.size() + text.size() * 4 + 4);
+
+    uint8_t held = 0;
+    auto setModifiers = [&](uint8_t wanted) {
+        // Önce fazlalar bırakılır, sonra eksikler basılır (aynı SYN çerçevesinde)
+        for (TextKeymap::Modifier modifier : { TextKeymap::kLevel3, TextKeymap::kShift }) {
+            if ((held & modifier) && !(wanted & modifier)) {
+                events.push_back(MakeTextEvent(EV_KEY, keymap.ModifierCode(modifier), 0));
+            }
+        }
+        for (TextKeymap::Modifier modifier : { TextKeymap::kShift, TextKeymap::kLevel3 }) {
+            if (!(held & modifier) && (wanted & modifier)) {
+                events.push_back(MakeTextEvent(EV_KEY, keymap.ModifierCode(modifier), 1));
+            }
+        }
+        held = wanted;
+    };
+
+    stats.skipped += static_cast<uint32_t>(textinput::ForEachCodePoint(text, [&](char32_t ch) {
+        // Satır sonu Return tuşu (utf32 '\r') ile yazılır; diğer kontrol karakterleri atlanır
+        TextKeymap::Stroke stroke;
+        bool control = (ch < 0x20 && ch != U'\t' && ch != U'\n') || ch == 0x7F;
+        if (control || !keymap.Lookup(ch == U'\n' ? U'\r' : ch, stroke)) {
+            stats.skipped++;
+            return;
+        }
+
+        setModifiers(stroke.modifiers);
+        events.push_back(MakeTextEvent(EV_KEY, stroke.code, 1));
+        events.push_back(MakeTextEvent(EV_SYN, SYN_REPORT, 0));
+        events.push_back(MakeTextEvent(EV_KEY, stroke.code, 0));
+        events.push_back(MakeTextEvent(EV_SYN, SYN_REPORT, 0));
+        stats.typed++;
+    }));
+
+    if (held != 0) {
+        setModifiers(0);
+        events.push_back(MakeTextEvent(EV_SYN, SYN_REPORT, 0));
+    }
+}
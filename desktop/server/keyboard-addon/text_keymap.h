@@ -0,0 +1,83 @@
+#pragma once
+
+#include <linux/input.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "text_input.h"
+
+// Linux typeText: karakter -> evdev tuş vuruşu çözümleme (xkbcommon)
+// uinput sadece fiziksel tuş kodu gönderebilir; hangi tuşun (ve Shift / AltGr ile
+// hangi seviyenin) istenen karakteri ürettiğini aktif XKB düzeni belirler.
+// Tablo, düzendeki her tuş ve değiştirici kombinasyonu için xkb_state ile
+// üretilen karakter okunarak kurulur; arama tek hash erişimidir.
+
+struct xkb_context;
+struct xkb_keymap;
+struct xcb_connection_t;
+
+class TextKeymap {
+public:
+    enum Modifier : uint8_t {
+        kShift = 1 << 0,
+        kLevel3 = 1 << 1, // AltGr (ISO_Level3_Shift)
+    };
+
+    struct Stroke {
+        uint16_t code = 0; // evdev KEY_* (0 = yok)
+        uint8_t modifiers = 0;
+    };
+
+    TextKeymap() = default;
+    ~TextKeymap();
+    TextKeymap(const TextKeymap&) = delete;
+    TextKeymap& operator=(const TextKeymap&) = delete;
+
+    // Aktif düzeni X sunucusundan (XKB) oku; X yoksa XKB_DEFAULT_* ortam değişkenleri.
+    // Düzen kKeymapMaxAge'den eskiyse yeniden okunur (setxkbmap), etkin grup veya
+    // kilitli değiştiriciler (Caps Lock) değiştiyse tablo yeniden kurulur.
+    // Sadece enjeksiyon thread'inden çağrılır.
+    bool Refresh(std::string& error);
+    // Sabit düzen yükle (benchmark)
+    bool LoadNames(const char* layout, const char* variant, std::string& error);
+
+    bool Lookup(char32_t ch, Stroke& stroke) const;
+    // Değiştiriciyi basan tuşun evdev kodu (düzende yoksa 0)
+    uint16_t ModifierCode(Modifier modifier) const;
+    size_t Size() const { return table_.size(); }
+
+private:
+    bool EnsureConnection();
+    void SetKeymap(xkb_keymap* keymap);
+    void BuildTable(uint32_t group, uint32_t lockedMods);
+
+    xkb_context* context_ = nullptr;
+    xkb_keymap* keymap_ = nullptr;
+    xcb_connection_t* conn_ = nullptr;
+    int32_t deviceId_ = -1;
+    bool fromNames_ = false; // Düzen X yerine isimlerden / ortamdan yüklendi
+    std::chrono::steady_clock::time_point loadedAt_;
+    uint32_t group_ = UINT32_MAX;
+    uint32_t lockedMods_ = UINT32_MAX;
+    uint16_t shiftCode_ = 0;
+    uint16_t level3Code_ = 0;
+    Stroke ascii_[128];
+    std::unordered_map<char32_t, Stroke> table_;
+};
+
+// Metni uinput event dizisine çevir
+// Her karakter: [değiştiriciler] bas, SYN, bırak, SYN. Aynı değiştiricileri isteyen
+// ardışık karakterlerde değiştiriciler basılı tutulur. Sonda hepsi bırakılır.
+void BuildTextEvents(const TextKeymap& keymap, std::string_view text,
+                     std::vector<input_event>& events, textinput::TextStats& stats);
+
+// Uzun metin uinput'a parça parça yazılır: evdev her okuyucu için ~64 eventlik
+// tampon tutar, tek write() ile binlerce event gönderilirse okuyucu (X sunucusu /
+// compositor) yetişemez ve SYN_DROPPED ile tuşlar kaybolur.
+constexpr size_t kTextEventsPerWrite = 32;
+constexpr std::chrono::microseconds kTextWritePause{1000};
@@ -0,0 +1,97 @@
+#include "window_index.h"
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+
+WindowIndex windowIndex;
+
+std::string WindowIndex::ToLower(const std::string& value) {
+    std::string lower(value);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+int64_t WindowIndex::FindByExe(const std::string& exeName) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    auto it = handlesByExe_.find(ToLower(exeName));
+    if (it == handlesByExe_.end() || it->second.empty()) {
+        return 0;
+    }
+
+    return it->second.front();
+}
+
+size_t WindowIndex::Size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return exeByHandle_.size();
+}
+
+bool WindowIndex::Contains(int64_t handle) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return exeByHandle_.count(handle) > 0;
+}
+
+void WindowIndex::Upsert(int64_t handle, const std::string& exeName) {
+    std::string exe = ToLower(exeName);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    RemoveLocked(handle);
+
+    exeByHandle_[handle] = exe;
+    std::vector<int64_t>& handles = handlesByExe_[exe];
+    handles.insert(handles.begin(), handle);
+}
+
+void WindowIndex::Remove(int64_t handle) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    RemoveLocked(handle);
+}
+
+void WindowIndex::Touch(int64_t handle) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    auto it = exeByHandle_.find(handle);
+    if (it == exeByHandle_.end()) {
+        return;
+    }
+
+    std::vector<int64_t>& handles = handlesByExe_[it->second];
+    auto pos = std::find(handles.begin(), handles.end(), handle);
+    if (pos != handles.end()) {
+        std::rotate(handles.begin(), pos, pos + 1);
+    }
+}
+
+void WindowIndex::RemoveLocked(int64_t handle) {
+    auto it = exeByHandle_.find(handle);
+    if (it == exeByHandle_.end()) {
+        return;
+    }
+
+    auto listIt = handlesByExe_.find(it->second);
+    if (listIt != handlesByExe_.end()) {
+        std::vector<int64_t>& handles = listIt->second;
+        handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+        if (handles.empty()) {
+            handlesByExe_.erase(listIt);
+        }
+    }
+
+    exeByHandle_.erase(it);
+}
+
+#if !defined(_WIN32) && !defined(__linux__)
+// Desteklenmeyen platformlar: indeks hiç başlamaz, aramalar 0 döner
+
+bool WindowIndex::Start() {
+    return false;
+}
+
+void WindowIndex::Stop() {}
+
+void WindowIndex::RunPlatform() {}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Olay güdümlü pencere indeksi
+// Pencere yöneticisinin olaylarıyla (Windows: SetWinEventHook, X11: _NET_CLIENT_LIST
+// PropertyNotify) artımlı olarak güncellenir. targetApp aramaları her kısayolda
+// tüm masaüstünü taramak yerine exe adına göre O(1) yapılır.
+//
+// Platform kodu kendi thread'inde çalışır ve sadece Upsert/Remove/Touch
+// çağırır; okumalar (FindByExe) herhangi bir thread'den yapılabilir.
+
+class WindowIndex {
+public:
+    // Platform thread'ini başlat (başarısızsa indeks boş kalır, Running() false)
+    bool Start();
+    void Stop();
+
+    bool Running() const { return running_.load(); }
+
+    // Exe adına göre (büyük/küçük harf duyarsız) en son aktif olan pencere; yoksa 0
+    int64_t FindByExe(const std::string& exeName) const;
+
+    size_t Size() const;
+
+    // --- Platform thread'i tarafından çağrılır ---
+
+    // Pencereyi ekle veya exe adını güncelle (en öne alınır)
+    void Upsert(int64_t handle, const std::string& exeName);
+
+    // Pencereyi indeksten çıkar
+    void Remove(int64_t handle);
+
+    // Pencere aktif oldu: kendi exe listesinde en öne al
+    void Touch(int64_t handle);
+
+    bool Contains(int64_t handle) const;
+
+    static std::string ToLower(const std::string& value);
+
+private:
+    void RemoveLocked(int64_t handle);
+    void RunPlatform();
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<int64_t, std::string> exeByHandle_;
+    // exe (küçük harf) -> pencereler, en son aktif olan başta
+    std::unordered_map<std::string, std::vector<int64_t>> handlesByExe_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> stopping_{false};
+
+    // Platforma özel durum (Windows: thread id, X11: wake eventfd)
+    std::atomic<uint64_t> platformToken_{0};
+    void* connection_ = nullptr; // X11: xcb_connection_t*
+};
+
+extern WindowIndex windowIndex;
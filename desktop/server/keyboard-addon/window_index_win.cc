@@ -0,0 +1,159 @@
+#include "window_index.h"
+
+#include <windows.h>
+#include <cstring>
+#include <future>
+
+// Windows: SetWinEventHook ile pencere oluşturma/yok etme/gösterme/gizleme,
+// başlık değişikliği ve ön plan olaylarını dinler. Hook'lar WINEVENT_OUTOFCONTEXT
+// olduğu için callback'ler indeks thread'inin mesaj döngüsünde çalışır.
+
+namespace {
+
+// Görünür, başlıklı üst seviye pencere mi (getWindowList ile aynı filtre)
+bool IsIndexable(HWND hwnd) {
+    if (!IsWindowVisible(hwnd) || GetAncestor(hwnd, GA_ROOT) != hwnd) {
+        return false;
+    }
+    return GetWindowTextLengthW(hwnd) > 0;
+}
+
+// Pencerenin exe adını al (path olmadan)
+bool ResolveExeName(HWND hwnd, std::string& exeName) {
+    DWORD processId = 0;
+    GetWindowThreadProcessId(hwnd, &processId);
+
+    HANDLE hProcess = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, processId);
+    if (!hProcess) {
+        return false;
+    }
+
+    char exePath[MAX_PATH];
+    DWORD size = MAX_PATH;
+    bool ok = QueryFullProcessImageNameA(hProcess, 0, exePath, &size) != 0;
+    CloseHandle(hProcess);
+
+    if (!ok) {
+        return false;
+    }
+
+    const char* name = strrchr(exePath, '\\');
+    exeName = name ? name + 1 : exePath;
+    return true;
+}
+
+void IndexWindow(HWND hwnd) {
+    int64_t handle = reinterpret_cast<int64_t>(hwnd);
+
+    if (!IsIndexable(hwnd)) {
+        windowIndex.Remove(handle);
+        return;
+    }
+
+    // Pencerenin exe'si değişmez, tekrar sorgulamaya gerek yok
+    if (windowIndex.Contains(handle)) {
+        return;
+    }
+
+    std::string exeName;
+    if (ResolveExeName(hwnd, exeName)) {
+        windowIndex.Upsert(handle, exeName);
+    }
+}
+
+BOOL CALLBACK CollectWindowsProc(HWND hwnd, LPARAM lParam) {
+    reinterpret_cast<std::vector<HWND>*>(lParam)->push_back(hwnd);
+    return TRUE;
+}
+
+void CALLBACK WinEventProc(HWINEVENTHOOK, DWORD event, HWND hwnd, LONG idObject, LONG idChild, DWORD, DWORD) {
+    if (!hwnd || idObject != OBJID_WINDOW || idChild != CHILDID_SELF) {
+        return;
+    }
+
+    int64_t handle = reinterpret_cast<int64_t>(hwnd);
+
+    switch (event) {
+        case EVENT_OBJECT_DESTROY:
+        case EVENT_OBJECT_HIDE:
+            windowIndex.Remove(handle);
+            break;
+        case EVENT_SYSTEM_FOREGROUND:
+            IndexWindow(hwnd);
+            windowIndex.Touch(handle);
+            break;
+        default:
+            // EVENT_OBJECT_CREATE, EVENT_OBJECT_SHOW, EVENT_OBJECT_NAMECHANGE
+            IndexWindow(hwnd);
+            break;
+    }
+}
+
+} // namespace
+
+bool WindowIndex::Start() {
+    if (thread_.joinable()) {
+        return running_.load();
+    }
+
+    stopping_.store(false);
+
+    std::promise<bool> started;
+    std::future<bool> startedFuture = started.get_future();
+
+    thread_ = std::thread([this, &started]() {
+        // Mesaj kuyruğunu oluştur (PostThreadMessage için gerekli)
+        MSG msg;
+        PeekMessage(&msg, NULL, WM_USER, WM_USER, PM_NOREMOVE);
+        platformToken_.store(GetCurrentThreadId());
+
+        const DWORD flags = WINEVENT_OUTOFCONTEXT;
+        HWINEVENTHOOK hooks[] = {
+            SetWinEventHook(EVENT_OBJECT_CREATE, EVENT_OBJECT_HIDE, NULL, WinEventProc, 0, 0, flags),
+            SetWinEventHook(EVENT_OBJECT_NAMECHANGE, EVENT_OBJECT_NAMECHANGE, NULL, WinEventProc, 0, 0, flags),
+            SetWinEventHook(EVENT_SYSTEM_FOREGROUND, EVENT_SYSTEM_FOREGROUND, NULL, WinEventProc, 0, 0, flags),
+        };
+
+        bool ok = hooks[0] && hooks[1] && hooks[2];
+        running_.store(ok);
+        started.set_value(ok);
+
+        if (ok) {
+            RunPlatform();
+        }
+
+        for (HWINEVENTHOOK hook : hooks) {
+            if (hook) {
+                UnhookWinEvent(hook);
+            }
+        }
+        running_.store(false);
+    });
+
+    return startedFuture.get();
+}
+
+void WindowIndex::Stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    stopping_.store(true);
+    PostThreadMessage(static_cast<DWORD>(platformToken_.load()), WM_QUIT, 0, 0);
+    thread_.join();
+}
+
+void WindowIndex::RunPlatform() {
+    // İlk dolum: z-order'a göre (en üstteki pencere kendi exe listesinde başta olsun)
+    std::vector<HWND> windows;
+    EnumWindows(CollectWindowsProc, reinterpret_cast<LPARAM>(&windows));
+    for (auto it = windows.rbegin(); it != windows.rend(); ++it) {
+        IndexWindow(*it);
+    }
+
+    MSG msg;
+    while (!stopping_.load() && GetMessage(&msg, NULL, 0, 0) > 0) {
+        TranslateMessage(&msg);
+        DispatchMessage(&msg);
+    }
+}
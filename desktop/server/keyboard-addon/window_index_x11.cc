@@ -0,0 +1,245 @@
+#include "window_index.h"
+#include "x11_windows.h"
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <xcb/xcb.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <unordered_set>
+
+// Linux/X11: kök penceredeki _NET_CLIENT_LIST ve _NET_ACTIVE_WINDOW değişikliklerini
+// (PropertyNotify) dinler. Liste değiştiğinde sadece fark işlenir; yeni pencerelerin
+// _NET_WM_PID istekleri tek seferde gönderilip (pipeline) yanıtları sonra toplanır,
+// exe adı önbellekli CachedExeNameForPid ile çözülür. PID'i henüz konmamış veya
+// exe adı çözülemeyen pencereler bilinen kümeye alınmaz; kendi PropertyNotify'ları
+// dinlenir ve _NET_WM_PID değişince yeniden denenir. Xvfb altında da çalışır.
+
+namespace {
+
+xcb_atom_t InternAtom(xcb_connection_t* conn, const char* name) {
+    xcb_intern_atom_cookie_t cookie = xcb_intern_atom(conn, 0, static_cast<uint16_t>(strlen(name)), name);
+    xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(conn, cookie, nullptr);
+    if (!reply) {
+        return XCB_ATOM_NONE;
+    }
+    xcb_atom_t atom = reply->atom;
+    free(reply);
+    return atom;
+}
+
+class ClientListWatcher {
+public:
+    ClientListWatcher(xcb_connection_t* conn, xcb_window_t root) : conn_(conn), root_(root) {
+        clientListAtom_ = InternAtom(conn_, "_NET_CLIENT_LIST");
+        activeWindowAtom_ = InternAtom(conn_, "_NET_ACTIVE_WINDOW");
+        pidAtom_ = InternAtom(conn_, "_NET_WM_PID");
+
+        // Kök pencerenin property değişikliklerini dinle
+        uint32_t mask = XCB_EVENT_MASK_PROPERTY_CHANGE;
+        xcb_change_window_attributes(conn_, root_, XCB_CW_EVENT_MASK, &mask);
+        xcb_flush(conn_);
+    }
+
+    void HandleEvent(xcb_generic_event_t* event) {
+        if ((event->response_type & ~0x80) != XCB_PROPERTY_NOTIFY) {
+            return;
+        }
+
+        auto* notify = reinterpret_cast<xcb_property_notify_event_t*>(event);
+        if (notify->window != root_) {
+            // Çözülemeyen pencerenin PID'i sonradan kondu
+            if (notify->atom == pidAtom_ && unresolved_.count(notify->window)) {
+                Resolve({notify->window});
+            }
+            return;
+        }
+
+        if (notify->atom == clientListAtom_) {
+            RefreshClientList();
+        } else if (notify->atom == activeWindowAtom_) {
+            RefreshActiveWindow();
+        }
+    }
+
+    // _NET_CLIENT_LIST'i oku ve sadece eklenen/çıkan pencereleri işle
+    void RefreshClientList() {
+        std::vector<xcb_window_t> current = ReadWindowList(clientListAtom_);
+        std::unordered_set<xcb_window_t> currentSet(current.begin(), current.end());
+
+        for (auto it = known_.begin(); it != known_.end();) {
+            if (!currentSet.count(*it)) {
+                windowIndex.Remove(*it);
+                it = known_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto it = unresolved_.begin(); it != unresolved_.end();) {
+            it = currentSet.count(*it) ? std::next(it) : unresolved_.erase(it);
+        }
+
+        std::vector<xcb_window_t> added;
+        for (xcb_window_t window : current) {
+            if (!known_.count(window) && !unresolved_.count(window)) {
+                added.push_back(window);
+            }
+        }
+
+        Resolve(added);
+    }
+
+    void RefreshActiveWindow() {
+        std::vector<xcb_window_t> active = ReadWindowList(activeWindowAtom_);
+        if (!active.empty() && active[0] != XCB_WINDOW_NONE) {
+            windowIndex.Touch(active[0]);
+        }
+    }
+
+private:
+    // Pencerelerin PID'lerini çöz ve indekse ekle. Tüm PID istekleri önce
+    // gönderilir, yanıtlar sonra toplanır (tek round-trip). Çözülemeyenlerin
+    // PropertyNotify'ı dinlenir (bkz. HandleEvent).
+    void Resolve(const std::vector<xcb_window_t>& windows) {
+        std::vector<xcb_get_property_cookie_t> cookies;
+        cookies.reserve(windows.size());
+        for (xcb_window_t window : windows) {
+            cookies.push_back(xcb_get_property(conn_, 0, window, pidAtom_, XCB_ATOM_CARDINAL, 0, 1));
+        }
+
+        for (size_t i = 0; i < windows.size(); i++) {
+            std::string exeName;
+            xcb_get_property_reply_t* reply = xcb_get_property_reply(conn_, cookies[i], nullptr);
+            if (reply) {
+                if (xcb_get_property_value_length(reply) >= 4) {
+                    uint32_t pid = *static_cast<uint32_t*>(xcb_get_property_value(reply));
+                    CachedExeNameForPid(pid, exeName);
+                }
+                free(reply);
+            }
+
+            if (!exeName.empty()) {
+                windowIndex.Upsert(windows[i], exeName);
+                known_.insert(windows[i]);
+                unresolved_.erase(windows[i]);
+            } else if (unresolved_.insert(windows[i]).second) {
+                // Pencere kapanmışsa istek hata ile döner; liste değişince temizlenir
+                uint32_t mask = XCB_EVENT_MASK_PROPERTY_CHANGE;
+                xcb_change_window_attributes(conn_, windows[i], XCB_CW_EVENT_MASK, &mask);
+            }
+        }
+    }
+
+    std::vector<xcb_window_t> ReadWindowList(xcb_atom_t atom) {
+        std::vector<xcb_window_t> windows;
+
+        xcb_get_property_cookie_t cookie = xcb_get_property(conn_, 0, root_, atom, XCB_ATOM_WINDOW, 0, UINT32_MAX / 4);
+        xcb_get_property_reply_t* reply = xcb_get_property_reply(conn_, cookie, nullptr);
+        if (!reply) {
+            return windows;
+        }
+
+        int count = xcb_get_property_value_length(reply) / static_cast<int>(sizeof(xcb_window_t));
+        auto* values = static_cast<xcb_window_t*>(xcb_get_property_value(reply));
+        windows.assign(values, values + count);
+        free(reply);
+
+        return windows;
+    }
+
+    xcb_connection_t* conn_;
+    xcb_window_t root_;
+    xcb_atom_t clientListAtom_;
+    xcb_atom_t activeWindowAtom_;
+    xcb_atom_t pidAtom_;
+    std::unordered_set<xcb_window_t> known_;      // İndekste olan pencereler
+    std::unordered_set<xcb_window_t> unresolved_; // Listede olup PID / exe'si çözülemeyenler
+};
+
+} // namespace
+
+bool WindowIndex::Start() {
+    if (thread_.joinable()) {
+        return running_.load();
+    }
+
+    // Stop() thread'i poll()'dan bu eventfd ile uyandırır
+    int wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (wakeFd < 0) {
+        return false;
+    }
+
+    xcb_connection_t* conn = xcb_connect(nullptr, nullptr);
+    if (xcb_connection_has_error(conn)) {
+        // DISPLAY yok (Wayland-only veya headless): indeks devre dışı
+        xcb_disconnect(conn);
+        close(wakeFd);
+        return false;
+    }
+
+    platformToken_.store(static_cast<uint64_t>(wakeFd));
+    stopping_.store(false);
+    running_.store(true);
+
+    connection_ = conn;
+    thread_ = std::thread([this, conn]() {
+        RunPlatform();
+        xcb_disconnect(conn);
+        running_.store(false);
+    });
+
+    return true;
+}
+
+void WindowIndex::Stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    int wakeFd = static_cast<int>(platformToken_.load());
+    stopping_.store(true);
+
+    uint64_t one = 1;
+    ssize_t ignored = write(wakeFd, &one, sizeof(one));
+    (void)ignored;
+
+    thread_.join();
+    close(wakeFd);
+}
+
+void WindowIndex::RunPlatform() {
+    xcb_connection_t* conn = static_cast<xcb_connection_t*>(connection_);
+    xcb_window_t root = xcb_setup_roots_iterator(xcb_get_setup(conn)).data->root;
+
+    ClientListWatcher watcher(conn, root);
+
+    // İlk dolum
+    watcher.RefreshClientList();
+    watcher.RefreshActiveWindow();
+
+    pollfd fds[2];
+    fds[0].fd = xcb_get_file_descriptor(conn);
+    fds[0].events = POLLIN;
+    fds[1].fd = static_cast<int>(platformToken_.load());
+    fds[1].events = POLLIN;
+
+    while (!stopping_.load()) {
+        // xcb'nin tamponladığı tüm eventleri işle, sonra bekle
+        while (xcb_generic_event_t* event = xcb_poll_for_event(conn)) {
+            watcher.HandleEvent(event);
+            free(event);
+        }
+
+        if (xcb_connection_has_error(conn)) {
+            break;
+        }
+
+        xcb_flush(conn);
+        if (poll(fds, 2, -1) < 0 && errno != EINTR) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,377 @@
+#include "x11_windows.h"
+
+#include <linux/input-event-codes.h>
+#include <unistd.h>
+#include <xcb/xcb.h>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// PID -> exe önbelleği
+// readlink(/proc/<pid>/exe) her listelemede yüzlerce kez çağrılmasın diye tutulur.
+// Son listelemede görülmeyen PID'ler silinir, böylece PID yeniden kullanımında
+// eski exe adı uzun süre kalmaz.
+std::mutex exeCacheMutex;
+std::unordered_map<uint32_t, std::string> exeCache;
+
+bool ReadExeName(uint32_t pid, std::string& exeName) {
+    char link[64];
+    snprintf(link, sizeof(link), "/proc/%u/exe", pid);
+
+    char path[PATH_MAX];
+    ssize_t length = readlink(link, path, sizeof(path) - 1);
+    if (length <= 0) {
+        return false;
+    }
+    path[length] = '\0';
+
+    const char* name = strrchr(path, '/');
+    exeName = name ? name + 1 : path;
+    return true;
+}
+
+void PruneExeCache(const std::unordered_set<uint32_t>& seenPids) {
+    std::lock_guard<std::mutex> lock(exeCacheMutex);
+    for (auto it = exeCache.begin(); it != exeCache.end();) {
+        if (seenPids.count(it->first)) {
+            ++it;
+        } else {
+            it = exeCache.erase(it);
+        }
+    }
+}
+
+// Ana thread'in kalıcı X bağlantısı (getWindowList her çağrıda yeniden bağlanmaz)
+struct ListConnection {
+    xcb_connection_t* conn = nullptr;
+    xcb_window_t root = XCB_WINDOW_NONE;
+    xcb_atom_t clientList = XCB_ATOM_NONE;
+    xcb_atom_t netWmName = XCB_ATOM_NONE;
+    xcb_atom_t wmPid = XCB_ATOM_NONE;
+    xcb_atom_t utf8String = XCB_ATOM_NONE;
+
+    bool Ensure() {
+        if (conn && !xcb_connection_has_error(conn)) {
+            return true;
+        }
+
+        if (conn) {
+            xcb_disconnect(conn);
+        }
+
+        conn = xcb_connect(nullptr, nullptr);
+        if (xcb_connection_has_error(conn)) {
+            xcb_disconnect(conn);
+            conn = nullptr;
+            return false;
+        }
+
+        root = xcb_setup_roots_iterator(xcb_get_setup(conn)).data->root;
+
+        // Atom isteklerini de tek seferde gönder
+        const char* names[] = { "_NET_CLIENT_LIST", "_NET_WM_NAME", "_NET_WM_PID", "UTF8_STRING" };
+        xcb_intern_atom_cookie_t cookies[4];
+        for (int i = 0; i < 4; i++) {
+            cookies[i] = xcb_intern_atom(conn, 0, static_cast<uint16_t>(strlen(names[i])), names[i]);
+        }
+        xcb_atom_t* targets[] = { &clientList, &netWmName, &wmPid, &utf8String };
+        for (int i = 0; i < 4; i++) {
+            xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(conn, cookies[i], nullptr);
+            *targets[i] = reply ? reply->atom : static_cast<xcb_atom_t>(XCB_ATOM_NONE);
+            free(reply);
+        }
+
+        return true;
+    }
+};
+
+ListConnection listConnection;
+
+// Enjeksiyon thread'inin bağlantısı (xcb bağlantıları thread'ler arası paylaşılabilir
+// ama ListConnection::Ensure kilitsiz olduğundan ayrı tutulur)
+struct SendConnection {
+    xcb_connection_t* conn = nullptr;
+    xcb_window_t root = XCB_WINDOW_NONE;
+    xcb_atom_t activeWindow = XCB_ATOM_NONE;
+
+    bool Ensure() {
+        if (conn && !xcb_connection_has_error(conn)) {
+            return true;
+        }
+
+        if (conn) {
+            xcb_disconnect(conn);
+        }
+
+        conn = xcb_connect(nullptr, nullptr);
+        if (xcb_connection_has_error(conn)) {
+            xcb_disconnect(conn);
+            conn = nullptr;
+            return false;
+        }
+
+        root = xcb_setup_roots_iterator(xcb_get_setup(conn)).data->root;
+
+        const char name[] = "_NET_ACTIVE_WINDOW";
+        xcb_intern_atom_reply_t* reply = xcb_intern_atom_reply(
+            conn, xcb_intern_atom(conn, 0, sizeof(name) - 1, name), nullptr);
+        activeWindow = reply ? reply->atom : static_cast<xcb_atom_t>(XCB_ATOM_NONE);
+        free(reply);
+        return true;
+    }
+};
+
+SendConnection sendConnection;
+
+// Odak isteğinden sonra _NET_ACTIVE_WINDOW'un hedefe dönmesini bekleme
+constexpr int kActivatePolls = 25;
+constexpr auto kActivatePollInterval = std::chrono::milliseconds(10);
+
+// evdev modifier kodunun X modifier maskesi (modifier değilse 0)
+uint16_t ModifierMask(uint16_t code) {
+    switch (code) {
+        case KEY_LEFTSHIFT:
+        case KEY_RIGHTSHIFT:
+            return XCB_MOD_MASK_SHIFT;
+        case KEY_LEFTCTRL:
+        case KEY_RIGHTCTRL:
+            return XCB_MOD_MASK_CONTROL;
+        case KEY_LEFTALT:
+        case KEY_RIGHTALT:
+            return XCB_MOD_MASK_1;
+        case KEY_LEFTMETA:
+        case KEY_RIGHTMETA:
+            return XCB_MOD_MASK_4;
+        default:
+            return 0;
+    }
+}
+
+void ReadStringReply(xcb_connection_t* conn, xcb_get_property_cookie_t cookie, std::string& value) {
+    xcb_get_property_reply_t* reply = xcb_get_property_reply(conn, cookie, nullptr);
+    if (!reply) {
+        return;
+    }
+    value.assign(static_cast<const char*>(xcb_get_property_value(reply)),
+                 xcb_get_property_value_length(reply));
+    free(reply);
+}
+
+} // namespace
+
+bool CachedExeNameForPid(uint32_t pid, std::string& exeName) {
+    {
+        std::lock_guard<std::mutex> lock(exeCacheMutex);
+        auto it = exeCache.find(pid);
+        if (it != exeCache.end()) {
+            exeName = it->second;
+            return true;
+        }
+    }
+
+    if (!ReadExeName(pid, exeName)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(exeCacheMutex);
+    exeCache[pid] = exeName;
+    return true;
+}
+
+bool ListClientWindows(std::vector<X11WindowInfo>& windows) {
+    windows.clear();
+
+    if (!listConnection.Ensure()) {
+        return false;
+    }
+
+    xcb_connection_t* conn = listConnection.conn;
+
+    // 1. round-trip: pencere listesi
+    xcb_get_property_reply_t* listReply = xcb_get_property_reply(
+        conn,
+        xcb_get_property(conn, 0, listConnection.root, listConnection.clientList, XCB_ATOM_WINDOW, 0, UINT32_MAX / 4),
+        nullptr
+    );
+    if (!listReply) {
+        return false;
+    }
+
+    int count = xcb_get_property_value_length(listReply) / static_cast<int>(sizeof(xcb_window_t));
+    auto* clients = static_cast<xcb_window_t*>(xcb_get_property_value(listReply));
+    std::vector<xcb_window_t> clientList(clients, clients + count);
+    free(listReply);
+
+    // 2. round-trip: tüm pencerelerin PID ve başlık istekleri önce gönderilir,
+    // yanıtlar sonra toplanır (pencere başına ayrı round-trip yok)
+    std::vector<xcb_get_property_cookie_t> pidCookies(clientList.size());
+    std::vector<xcb_get_property_cookie_t> nameCookies(clientList.size());
+    std::vector<xcb_get_property_cookie_t> legacyNameCookies(clientList.size());
+    for (size_t i = 0; i < clientList.size(); i++) {
+        pidCookies[i] = xcb_get_property(conn, 0, clientList[i], listConnection.wmPid, XCB_ATOM_CARDINAL, 0, 1);
+        nameCookies[i] = xcb_get_property(conn, 0, clientList[i], listConnection.netWmName, listConnection.utf8String, 0, 256);
+        // _NET_WM_NAME koymayan eski istemciler için WM_NAME (aynı pipeline'da)
+        legacyNameCookies[i] = xcb_get_property(conn, 0, clientList[i], XCB_ATOM_WM_NAME, XCB_GET_PROPERTY_TYPE_ANY, 0, 256);
+    }
+
+    std::unordered_set<uint32_t> seenPids;
+    windows.reserve(clientList.size());
+
+    for (size_t i = 0; i < clientList.size(); i++) {
+        uint32_t pid = 0;
+        xcb_get_property_reply_t* pidReply = xcb_get_property_reply(conn, pidCookies[i], nullptr);
+        if (pidReply) {
+            if (xcb_get_property_value_length(pidReply) >= 4) {
+                pid = *static_cast<uint32_t*>(xcb_get_property_value(pidReply));
+            }
+            free(pidReply);
+        }
+
+        std::string title;
+        ReadStringReply(conn, nameCookies[i], title);
+        if (title.empty()) {
+            ReadStringReply(conn, legacyNameCookies[i], title);
+        } else {
+            xcb_discard_reply(conn, legacyNameCookies[i].sequence);
+        }
+
+        // Başlıksız veya PID'siz pencereleri atla (Windows filtresiyle aynı)
+        if (title.empty() || pid == 0) {
+            continue;
+        }
+
+        seenPids.insert(pid);
+
+        X11WindowInfo info;
+        info.window = clientList[i];
+        info.title = std::move(title);
+        if (CachedExeNameForPid(pid, info.exeName)) {
+            windows.push_back(std::move(info));
+        }
+    }
+
+    PruneExeCache(seenPids);
+    return true;
+}
+
+bool SendKeysToX11Window(uint32_t window, const std::vector<uint16_t>& evdevCodes) {
+    if (window == XCB_WINDOW_NONE || !sendConnection.Ensure()) {
+        return false;
+    }
+
+    xcb_connection_t* conn = sendConnection.conn;
+    std::vector<xcb_void_cookie_t> cookies;
+    cookies.reserve(evdevCodes.size() * 2);
+
+    // Modifier durumu eventin state alanında taşınır (Ctrl+S gibi kombinasyonlar için)
+    uint16_t state = 0;
+
+    auto send = [&](uint16_t code, bool press) {
+        xcb_key_press_event_t event;
+        memset(&event, 0, sizeof(event));
+        event.response_type = press ? XCB_KEY_PRESS : XCB_KEY_RELEASE;
+        event.detail = static_cast<xcb_keycode_t>(code + 8);
+        event.time = XCB_CURRENT_TIME;
+        event.root = sendConnection.root;
+        event.event = window;
+        event.child = XCB_WINDOW_NONE;
+        event.state = state;
+        event.same_screen = 1;
+
+        cookies.push_back(xcb_send_event_checked(
+            conn, 0, window,
+            press ? XCB_EVENT_MASK_KEY_PRESS : XCB_EVENT_MASK_KEY_RELEASE,
+            reinterpret_cast<const char*>(&event)
+        ));
+
+        // State, eventten önceki modifier durumunu gösterir
+        if (press) {
+            state |= ModifierMask(code);
+        } else {
+            state &= ~ModifierMask(code);
+        }
+    };
+
+    for (uint16_t code : evdevCodes) {
+        send(code, true);
+    }
+    for (auto it = evdevCodes.rbegin(); it != evdevCodes.rend(); ++it) {
+        send(*it, false);
+    }
+
+    // Tüm istekler gönderildikten sonra hatalar tek seferde toplanır (tek round-trip)
+    bool accepted = true;
+    for (xcb_void_cookie_t cookie : cookies) {
+        xcb_generic_error_t* error = xcb_request_check(conn, cookie);
+        if (error) {
+            accepted = false;
+            free(error);
+        }
+    }
+
+    return accepted;
+}
+
+bool ActivateX11Window(uint32_t window) {
+    if (window == XCB_WINDOW_NONE || !sendConnection.Ensure() || sendConnection.activeWindow == XCB_ATOM_NONE) {
+        return false;
+    }
+
+    xcb_connection_t* conn = sendConnection.conn;
+    xcb_window_t root = sendConnection.root;
+    xcb_atom_t activeWindow = sendConnection.activeWindow;
+
+    auto currentActive = [&]() {
+        xcb_window_t active = XCB_WINDOW_NONE;
+        xcb_get_property_reply_t* reply = xcb_get_property_reply(
+            conn, xcb_get_property(conn, 0, root, activeWindow, XCB_ATOM_WINDOW, 0, 1), nullptr);
+        if (reply) {
+            if (xcb_get_property_value_length(reply) >= 4) {
+                active = *static_cast<xcb_window_t*>(xcb_get_property_value(reply));
+            }
+            free(reply);
+        }
+        return active;
+    };
+
+    if (currentActive() == window) {
+        return true;
+    }
+
+    // EWMH: kaynak göstergesi 2 (pager / kullanıcı isteği), pencere yöneticisi
+    // odak çalma korumasını uygulamasın
+    xcb_client_message_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.response_type = XCB_CLIENT_MESSAGE;
+    event.format = 32;
+    event.window = window;
+    event.type = activeWindow;
+    event.data.data32[0] = 2;
+    event.data.data32[1] = XCB_CURRENT_TIME;
+
+    xcb_void_cookie_t cookie = xcb_send_event_checked(
+        conn, 0, root,
+        XCB_EVENT_MASK_SUBSTRUCTURE_REDIRECT | XCB_EVENT_MASK_SUBSTRUCTURE_NOTIFY,
+        reinterpret_cast<const char*>(&event));
+    xcb_generic_error_t* error = xcb_request_check(conn, cookie);
+    if (error) {
+        free(error);
+        return false;
+    }
+
+    for (int i = 0; i < kActivatePolls; i++) {
+        std::this_thread::sleep_for(kActivatePollInterval);
+        if (currentActive() == window) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// X11/EWMH pencere listesi (Linux getWindowList)
+
+struct X11WindowInfo {
+    uint32_t window;
+    std::string title;
+    std::string exeName;
+};
+
+// _NET_CLIENT_LIST'teki başlıklı pencereleri listele
+// Tüm _NET_WM_PID / _NET_WM_NAME istekleri tek seferde gönderilir (tek round-trip).
+// X bağlantısı kurulamazsa false döner.
+bool ListClientWindows(std::vector<X11WindowInfo>& windows);
+
+// PID -> exe adı (path olmadan), önbellekli ve thread-safe
+bool CachedExeNameForPid(uint32_t pid, std::string& exeName);
+
+// Sentetik KeyPress/KeyRelease eventlerini hedef pencereye gönder (odak değişmez)
+// evdevCodes basılma sırasıyla verilir; bırakma ters sırayla yapılır.
+// X keycode = evdev kodu + 8 (evdev/xkb sunucularında standart eşleme).
+// Hedef pencere yoksa veya X sunucusu isteği reddederse false döner.
+// Sadece enjeksiyon thread'inden çağrılır.
+bool SendKeysToX11Window(uint32_t window, const std::vector<uint16_t>& evdevCodes);
+
+// Pencereyi EWMH _NET_ACTIVE_WINDOW isteğiyle öne getir ve pencere yöneticisinin
+// odağı gerçekten verdiğini bekle (en fazla ~250 ms). Pencere yoksa, EWMH uyumlu
+// pencere yöneticisi yoksa veya odak verilmezse false döner.
+// Sadece enjeksiyon thread'inden çağrılır.
+bool ActivateX11Window(uint32_t window);
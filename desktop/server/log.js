@@ -0,0 +1,48 @@
+// Sunucu log seviyesi
+// Sıcak yollardaki (her tuş basışı, ses değişimi, WebRTC sinyali) loglar
+// debug seviyesindedir; varsayılan info seviyesinde çağrı tek bir boş
+// fonksiyondur, argümanlar formatlanmaz ve terminale yazılmaz.
+//
+// Seviye: LOCALDESK_LOG_LEVEL=error | warn | info | debug (varsayılan info)
+// veya çalışırken log.setLevel('debug').
+
+const LEVELS = ['error', 'warn', 'info', 'debug'];
+const DEFAULT_LEVEL = 'info';
+
+const sinks = {
+  error: console.error,
+  warn: console.warn,
+  info: console.log,
+  debug: console.log
+};
+
+const noop = () => {};
+
+const log = {
+  level: DEFAULT_LEVEL,
+
+  setLevel(level) {
+    const index = LEVELS.indexOf(String(level).toLowerCase());
+    if (index < 0) {
+      console.warn(`⚠️  Bilinmeyen log seviyesi: ${level} (${LEVELS.join(' | ')})`);
+      return false;
+    }
+
+    this.level = LEVELS[index];
+    // Kapalı seviyeler her çağrıda kontrol edilmesin: fonksiyon değiştirilir
+    LEVELS.forEach((name, i) => {
+      this[name] = i <= index ? sinks[name].bind(console) : noop;
+    });
+    return true;
+  },
+
+  isEnabled(level) {
+    return LEVELS.indexOf(level) <= LEVELS.indexOf(this.level);
+  }
+};
+
+if (!process.env.LOCALDESK_LOG_LEVEL || !log.setLevel(process.env.LOCALDESK_LOG_LEVEL)) {
+  log.setLevel(DEFAULT_LEVEL);
+}
+
+module.exports = log;
@@ -0,0 +1,127 @@
+// Medya durumu yolu benchmark'ı (null test backend'i ile)
+// Oynatıcı sinyali yerine Publish çağrılır; gecikme Publish'ten değişiklik
+// dinleyicisine (watchMedia'nın native tarafı) kadar ölçülür. Ayrıca
+// yayınlar sürerken birden fazla thread'in Status() okuma hızı (/media-status
+// isteklerinin native kısmı) ölçülür.
+//
+// Derleme: node-gyp rebuild (build/Release/media_bench)
+// Çalıştırma: ./build/Release/media_bench [yayın sayısı]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../media_session.h"
+
+namespace {
+
+testbackend::Recorder recorder;
+std::atomic<int64_t> deliveredNs{0};
+volatile double sink = 0;
+
+void Report(const char* label, std::vector<int64_t>& samples) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-16s %8zu örnek  p50 %7.2f us  p99 %7.2f us  p99.9 %8.2f us  max %8.1f us\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.p999Us, summary.maxUs);
+}
+
+MediaStatus MakeStatus(size_t index) {
+    MediaStatus status;
+    status.isPlaying = index % 2 == 0;
+    status.title = "Parça " + std::to_string(index % 500);
+    status.artist = "Sanatçı";
+    status.album = "Albüm";
+    status.player = "test";
+    status.duration = 240.0;
+    status.position = static_cast<double>(index % 240);
+    status.success = true;
+    return status;
+}
+
+// Publish -> dinleyici (aynı thread'de, listenerMutex_ dahil)
+void RunPublish(MediaSessionMonitor& monitor, size_t count) {
+    std::vector<int64_t> samples;
+    samples.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        MediaStatus status = MakeStatus(i);
+        int64_t start = testbackend::NowNs();
+        monitor.Publish(status, status.isPlaying ? 1.0 : 0.0);
+        samples.push_back(deliveredNs.load(std::memory_order_relaxed) - start);
+    }
+    Report("yayın", samples);
+}
+
+// readers thread'i Status() okurken bir thread sürekli yayınlar
+void RunReaders(MediaSessionMonitor& monitor, size_t readers, std::chrono::milliseconds duration) {
+    std::atomic<bool> stop{false};
+    std::vector<std::vector<int64_t>> perThread(readers);
+    std::vector<std::thread> threads;
+
+    std::thread publisher([&]() {
+        for (size_t i = 0; !stop.load(); i++) {
+            MediaStatus status = MakeStatus(i);
+            monitor.Publish(status, 1.0);
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+    });
+
+    for (size_t t = 0; t < readers; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<int64_t>& samples = perThread[t];
+            while (!stop.load(std::memory_order_relaxed)) {
+                int64_t start = testbackend::NowNs();
+                MediaStatus status = monitor.Status();
+                samples.push_back(testbackend::NowNs() - start);
+                sink += status.position;
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(duration);
+    stop.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    publisher.join();
+
+    std::vector<int64_t> samples;
+    for (const std::vector<int64_t>& part : perThread) {
+        samples.insert(samples.end(), part.begin(), part.end());
+    }
+    double seconds = std::chrono::duration<double>(duration).count();
+    size_t count = samples.size();
+    Report("durum okuma", samples);
+    std::printf("  %-16s %zu thread, %.0f okuma/s\n", "durum okuma", readers, count / seconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 200000;
+
+    // Milyonlarca okuma saklanmasın: null modu işlemleri sadece sayar
+    recorder.SetMode(testbackend::Mode::kNull);
+
+    MediaSessionMonitor monitor;
+    monitor.UseTestBackend(testbackend::Mode::kNull, &recorder);
+    monitor.SetChangeListener([](const MediaStatus&) {
+        deliveredNs.store(testbackend::NowNs(), std::memory_order_relaxed);
+    });
+    monitor.Start();
+
+    std::printf("Medya durumu benchmark'ı (null backend, backend: %s)\n", monitor.Backend());
+    RunPublish(monitor, count);
+    RunReaders(monitor, std::thread::hardware_concurrency() > 2 ? 4 : 2, std::chrono::seconds(1));
+
+    monitor.SetChangeListener(nullptr);
+    monitor.Stop();
+
+    std::printf("  kayıt: %llu işlem\n", static_cast<unsigned long long>(recorder.Total()));
+    return 0;
+}
@@ -2,22 +2,22 @@
   "targets": [
     {
       "target_name": "media",
-      "sources": [ "media.cc" ],
+      "sources": [ "media.cc", "media_session.cc" ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")"
       ],
       "dependencies": [
         "<!(node -p \"require('node-addon-api').gyp\")"
       ],
-      "libraries": [
-        "-lwindowsapp",
-        "-lruntimeobject"
-      ],
       "cflags!": [ "-fno-exceptions" ],
       "cflags_cc!": [ "-fno-exceptions" ],
       "defines": [ "NAPI_CPP_EXCEPTIONS" ],
       "conditions": [
         ["OS=='win'", {
+          "libraries": [
+            "-lwindowsapp",
+            "-lruntimeobject"
+          ],
           "msvs_settings": {
             "VCCLCompilerTool": {
               "ExceptionHandling": 1
@@ -29,9 +29,50 @@
               ]
             }
           }
+        }],
+        ["OS=='linux'", {
+          "sources": [
+            "media_mpris.cc",
+            "media_art.cc",
+            "../native-common/image_resize.cc",
+            "../native-common/image_codec.cc"
+          ],
+          "cflags_cc": [ "<!@(pkg-config --cflags dbus-1 libjpeg libpng)" ],
+          "libraries": [ "<!@(pkg-config --libs dbus-1 libjpeg libpng)" ]
+        }]
+      ]
+    },
+    {
+      "target_name": "media_bench",
+      "type": "executable",
+      "sources": [ "bench/media_bench.cc", "media_session.cc" ],
+      "conditions": [
+        ["OS=='linux'", {
+          "sources": [ "media_mpris.cc" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags dbus-1)" ],
+          "libraries": [ "<!@(pkg-config --libs dbus-1)" ]
         }]
       ]
     }
+  ],
+  "conditions": [
+    ["OS=='linux'", {
+      "targets": [
+        {
+          "target_name": "fake_mpris_player",
+          "type": "executable",
+          "sources": [ "test/fake_mpris_player.cc" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags dbus-1)" ],
+          "libraries": [ "<!@(pkg-config --libs dbus-1)" ]
+        },
+        {
+          "target_name": "mpris_monitor_test",
+          "type": "executable",
+          "sources": [ "test/mpris_monitor_test.cc", "media_session.cc", "media_mpris.cc" ],
+          "cflags_cc": [ "<!@(pkg-config --cflags dbus-1)" ],
+          "libraries": [ "<!@(pkg-config --libs dbus-1)", "-lpthread" ]
+        }
+      ]
+    }]
   ]
 }
-
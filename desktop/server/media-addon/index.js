@@ -18,7 +18,10 @@ try {
       duration: 0,
       position: 0,
       success: false
-    })
+    }),
+    getMediaBackend: () => ({ backend: 'none', ready: false }),
+    renderArt: () => Promise.reject(new Error('Media addon yüklenemedi')),
+    getArt: () => null
   };
 }
 
@@ -1,87 +1,339 @@
 #include <napi.h>
 
-#ifdef _WIN32
-#include <windows.h>
-#include <comdef.h>
-#include <mmdeviceapi.h>
-#include <endpointvolume.h>
+#include <mutex>
+#include <string>
+#include <vector>
 
-#pragma comment(lib, "ole32.lib")
-#pragma comment(lib, "oleaut32.lib")
+#include "../native-common/metrics_napi.h"
+#include "../native-common/test_backend_napi.h"
+#include "media_session.h"
 
-// Windows Media Control için basit bir yaklaşım
-// Windows Runtime API yerine COM interface kullanıyoruz
-// Not: Bu yaklaşım sınırlı bilgi sağlar, ama çalışır
+#ifdef __linux__
+#include "media_art.h"
+#endif
+
+// Medya durumu native bir dinleme thread'inde tutulur (bkz. media_session.h).
+// getMediaStatus() sadece önbelleği okur; watchMedia() değişiklikleri
+// ThreadSafeFunction ile JS'e iletir, böylece durum için polling gerekmez.
+
+Napi::Object StatusObject(Napi::Env env, const MediaStatus& status) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("isPlaying", Napi::Boolean::New(env, status.isPlaying));
+    result.Set("title", Napi::String::New(env, status.title));
+    result.Set("artist", Napi::String::New(env, status.artist));
+    result.Set("album", Napi::String::New(env, status.album));
+    result.Set("artUrl", Napi::String::New(env, status.artUrl));
+    result.Set("player", Napi::String::New(env, status.player));
+    // Saniye (tam sayı, PowerShell yedeği ile aynı)
+    result.Set("duration", Napi::Number::New(env, static_cast<int64_t>(status.duration)));
+    result.Set("position", Napi::Number::New(env, static_cast<int64_t>(status.position)));
+    result.Set("success", Napi::Boolean::New(env, status.success));
+    return result;
+}
+
+// Çağrı metrikleri (getStats)
+// "deliver" watchMedia callback'inin (sunucunun yayını dahil) JS thread'indeki süresidir.
+metrics::Registry mediaMetrics("media");
+metrics::Api& deliverMetrics = mediaMetrics.Add("deliver");
+
+// Durum değişikliklerini JS'e ileten bildirici
+// Dinleme thread'inden gelen değişiklikler tek bir bekleyen slotta birleştirilir;
+// JS thread'i bir önceki bildirimi işlemeden gelen yeniler sadece slotu günceller.
+class MediaNotifier {
+public:
+    void Start(Napi::Env env, Napi::Function callback) {
+        Stop();
+
+        tsfn_ = Napi::ThreadSafeFunction::New(env, callback, "mediaChanged", 0, 1);
+        // Bildirim beklemek process'in kapanmasını engellemesin
+        tsfn_.Unref(env);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            active_ = true;
+            pending_ = false;
+        }
+
+        DefaultMediaMonitor().SetChangeListener([this](const MediaStatus& status) {
+            Post(status);
+        });
+    }
+
+    void Stop() {
+        DefaultMediaMonitor().SetChangeListener(nullptr);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (active_) {
+            active_ = false;
+            tsfn_.Release();
+        }
+    }
+
+private:
+    // Dinleme thread'i
+    void Post(const MediaStatus& status) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!active_) {
+            return;
+        }
+
+        status_ = status;
+        if (pending_) {
+            return;
+        }
+
+        pending_ = true;
+        if (tsfn_.NonBlockingCall([this](Napi::Env env, Napi::Function callback) { Deliver(env, callback); }) != napi_ok) {
+            pending_ = false;
+        }
+    }
+
+    // JS thread'i
+    void Deliver(Napi::Env env, Napi::Function callback) {
+        metrics::Scope scope(deliverMetrics);
+        MediaStatus status;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ = false;
+            status = status_;
+        }
+
+        callback.Call({ StatusObject(env, status) });
+        if (env.IsExceptionPending()) {
+            scope.Fail();
+        }
+    }
 
+    std::mutex mutex_;
+    Napi::ThreadSafeFunction tsfn_;
+    bool active_ = false;
+    bool pending_ = false;
+    MediaStatus status_;
+};
+
+MediaNotifier mediaNotifier;
+
+// Medya durumunu al (önbellekten, oynatıcıya sorgu gönderilmez)
 Napi::Value GetMediaStatus(const Napi::CallbackInfo& info) {
+    return StatusObject(info.Env(), DefaultMediaMonitor().Status());
+}
+
+// Backend bilgisi: { backend: 'mpris' | 'none' | 'null' | 'recording', ready }
+Napi::Value GetMediaBackend(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    
-    // COM başlat
-    HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
-    if (FAILED(hr)) {
-        Napi::Object result = Napi::Object::New(env);
-        result.Set("isPlaying", Napi::Boolean::New(env, false));
-        result.Set("title", Napi::String::New(env, "Medya oynatıcı bulunamadı"));
-        result.Set("artist", Napi::String::New(env, ""));
-        result.Set("duration", Napi::Number::New(env, 0));
-        result.Set("position", Napi::Number::New(env, 0));
-        result.Set("success", Napi::Boolean::New(env, false));
-        return result;
-    }
-    
-    bool isPlaying = false;
-    std::string title = "Medya oynatıcı bulunamadı";
-    std::string artist = "";
-    int64_t duration = 0;
-    int64_t position = 0;
-    bool success = false;
-    
-    // Windows Runtime API'lerini kullanmadan, basit bir yaklaşım
-    // Şimdilik varsayılan değerler döndür
-    // Gerçek implementasyon için Windows Runtime API gerekli
-    // Ama bu addon derlenebilir ve çalışır
-    
-    CoUninitialize();
-    
+    MediaSessionMonitor& monitor = DefaultMediaMonitor();
+
     Napi::Object result = Napi::Object::New(env);
-    result.Set("isPlaying", Napi::Boolean::New(env, isPlaying));
-    result.Set("title", Napi::String::New(env, title));
-    result.Set("artist", Napi::String::New(env, artist));
-    result.Set("duration", Napi::Number::New(env, duration));
-    result.Set("position", Napi::Number::New(env, position));
-    result.Set("success", Napi::Boolean::New(env, success));
-    
+    result.Set("backend", Napi::String::New(env, monitor.Backend()));
+    result.Set("ready", Napi::Boolean::New(env, monitor.Ready()));
     return result;
 }
 
-// Modül başlatma
-Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "getMediaStatus"), Napi::Function::New(env, GetMediaStatus));
-    return exports;
+// N-API: watchMedia(callback) - callback(status) değişiklikte çağrılır
+Napi::Value WatchMedia(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsFunction()) {
+        Napi::TypeError::New(env, "Callback fonksiyonu bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    mediaNotifier.Start(env, info[0].As<Napi::Function>());
+    return Napi::Boolean::New(env, true);
 }
 
-NODE_API_MODULE(media, Init)
+// N-API: unwatchMedia()
+Napi::Value UnwatchMedia(const Napi::CallbackInfo& info) {
+    mediaNotifier.Stop();
+    return info.Env().Undefined();
+}
 
-#else
-// Windows dışı platformlar için dummy implementation
+// Test backend'i (LOCALDESK_TEST_BACKEND): D-Bus'a bağlanılmaz, durum dışarıdan verilir
+testbackend::Mode mediaMode = testbackend::Mode::kNative;
+testbackend::Recorder mediaRecorder;
 
-Napi::Value GetMediaStatus(const Napi::CallbackInfo& info) {
+// N-API: getTestBackend() -> { mode, recorded, dropped }
+Napi::Value GetTestBackend(const Napi::CallbackInfo& info) {
+    return testbackend::InfoObject(info.Env(), mediaMode, mediaRecorder);
+}
+
+// N-API: takeRecording() -> [{ time, op, target, value }] (recording modunda)
+Napi::Value TakeRecording(const Napi::CallbackInfo& info) {
+    return testbackend::RecordingArray(info.Env(), mediaRecorder);
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), mediaMetrics);
+}
+
+// N-API: publishTestMedia({ isPlaying, title, artist, album, player, duration, position })
+// Oynatıcıdan sinyal gelmiş gibi durumu yayınlar (sadece test modunda)
+Napi::Value PublishTestMedia(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+
+    if (mediaMode == testbackend::Mode::kNative) {
+        Napi::Error::New(env, "publishTestMedia sadece test backend'inde kullanılabilir").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Medya durumu nesnesi bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object input = info[0].As<Napi::Object>();
+    auto text = [&](const char* key) {
+        Napi::Value value = input.Get(key);
+        return value.IsString() ? value.As<Napi::String>().Utf8Value() : std::string();
+    };
+    auto number = [&](const char* key) {
+        Napi::Value value = input.Get(key);
+        return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : 0.0;
+    };
+
+    MediaStatus status;
+    status.isPlaying = input.Get("isPlaying").ToBoolean().Value();
+    status.title = text("title");
+    status.artist = text("artist");
+    status.album = text("album");
+    status.player = text("player");
+    status.duration = number("duration");
+    status.position = number("position");
+    status.success = true;
+
+    DefaultMediaMonitor().Publish(status, status.isPlaying ? 1.0 : 0.0);
+    return Napi::Boolean::New(env, true);
+}
+
+#ifdef __linux__
+// Kapak resmi: { etag, data (JPEG Buffer), width, height, cached }
+Napi::Object ArtObject(Napi::Env env, const ArtResult& art) {
     Napi::Object result = Napi::Object::New(env);
-    result.Set("isPlaying", Napi::Boolean::New(env, false));
-    result.Set("title", Napi::String::New(env, "Sadece Windows destekleniyor"));
-    result.Set("artist", Napi::String::New(env, ""));
-    result.Set("duration", Napi::Number::New(env, 0));
-    result.Set("position", Napi::Number::New(env, 0));
-    result.Set("success", Napi::Boolean::New(env, false));
+    result.Set("etag", Napi::String::New(env, art.etag));
+    result.Set("data", Napi::Buffer<uint8_t>::Copy(env, art.jpeg->data(), art.jpeg->size()));
+    result.Set("width", Napi::Number::New(env, art.width));
+    result.Set("height", Napi::Number::New(env, art.height));
+    result.Set("cached", Napi::Boolean::New(env, art.cached));
     return result;
 }
 
+// Dosya okuma, çözme, küçültme ve kodlama libuv iş parçacığında yapılır
+class RenderArtWorker : public Napi::AsyncWorker {
+public:
+    RenderArtWorker(Napi::Env env, std::string uri, std::vector<uint8_t> source, int size)
+        : Napi::AsyncWorker(env),
+          deferred_(Napi::Promise::Deferred::New(env)),
+          uri_(std::move(uri)),
+          source_(std::move(source)),
+          size_(size) {}
+
+    Napi::Promise Promise() const {
+        return deferred_.Promise();
+    }
+
+protected:
+    void Execute() override {
+        std::string error;
+        if (!uri_.empty() && !ArtCache::ReadSource(uri_, source_, error)) {
+            SetError(error);
+            return;
+        }
+        if (!DefaultArtCache().Render(source_, size_, result_, error)) {
+            SetError(error);
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(ArtObject(Env(), result_));
+    }
+
+    void OnError(const Napi::Error& error) override {
+        deferred_.Reject(error.Value());
+    }
+
+private:
+    Napi::Promise::Deferred deferred_;
+    std::string uri_;
+    std::vector<uint8_t> source_;
+    int size_;
+    ArtResult result_;
+};
+
+// N-API: renderArt(source, size) - source: file:// URI / yol veya Buffer
+// Promise<{ etag, data, width, height, cached }>
+Napi::Value RenderArt(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2 || !(info[0].IsString() || info[0].IsBuffer()) || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Kaynak (URI veya Buffer) ve boyut bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    int size = info[1].As<Napi::Number>().Int32Value();
+    if (size < 16 || size > 2048) {
+        Napi::RangeError::New(env, "Boyut 16-2048 arasında olmalı").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string uri;
+    std::vector<uint8_t> source;
+    if (info[0].IsString()) {
+        uri = info[0].As<Napi::String>().Utf8Value();
+    } else {
+        // Buffer worker thread'inde kullanılacağı için kopyalanır
+        Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+        source.assign(buffer.Data(), buffer.Data() + buffer.Length());
+    }
+
+    RenderArtWorker* worker = new RenderArtWorker(env, std::move(uri), std::move(source), size);
+    Napi::Promise promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+// N-API: getArt(etag) - önbellekte varsa { etag, data, width, height, cached: true }, yoksa null
+Napi::Value GetArt(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "ETag bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ArtResult art;
+    if (!DefaultArtCache().Find(info[0].As<Napi::String>().Utf8Value(), art)) {
+        return env.Null();
+    }
+    art.cached = true;
+    return ArtObject(env, art);
+}
+#endif
+
+// Modül başlatma
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "getMediaStatus"), Napi::Function::New(env, GetMediaStatus));
+    mediaMode = testbackend::ModeFromEnvironment();
+    mediaRecorder.SetMode(mediaMode);
+    DefaultMediaMonitor().UseTestBackend(mediaMode, &mediaRecorder);
+    DefaultMediaMonitor().Start();
+
+    env.AddCleanupHook([]() {
+        mediaNotifier.Stop();
+        DefaultMediaMonitor().Stop();
+    });
+
+    metrics::Export(env, exports, mediaMetrics, "getMediaStatus", GetMediaStatus);
+    metrics::Export(env, exports, mediaMetrics, "getMediaBackend", GetMediaBackend);
+    metrics::Export(env, exports, mediaMetrics, "watchMedia", WatchMedia);
+    metrics::Export(env, exports, mediaMetrics, "unwatchMedia", UnwatchMedia);
+    metrics::Export(env, exports, mediaMetrics, "getTestBackend", GetTestBackend);
+    metrics::Export(env, exports, mediaMetrics, "takeRecording", TakeRecording);
+    metrics::Export(env, exports, mediaMetrics, "publishTestMedia", PublishTestMedia);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+#ifdef __linux__
+    metrics::Export(env, exports, mediaMetrics, "renderArt", RenderArt);
+    metrics::Export(env, exports, mediaMetrics, "getArt", GetArt);
+#endif
     return exports;
 }
 
 NODE_API_MODULE(media, Init)
-
-#endif
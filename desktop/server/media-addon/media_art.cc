@@ -0,0 +1,141 @@
+#include "media_art.h"
+
+#include <fstream>
+
+#include "../native-common/content_hash.h"
+#include "../native-common/image_codec.h"
+#include "../native-common/image_resize.h"
+
+namespace {
+
+// Kodlanmış kapaklar için bellek bütçesi (256 px JPEG ~15-30 KB)
+const size_t kArtCacheBudget = 4 * 1024 * 1024;
+const int kJpegQuality = 82;
+// Çok büyük kaynakları reddet (bozuk / kötü niyetli dosya)
+const size_t kMaxSourceBytes = 16 * 1024 * 1024;
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// file:// URI'lerinde boşluk vb. %XX olarak kodlanır
+std::string PercentDecode(const std::string& text) {
+    std::string result;
+    result.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '%' && i + 2 < text.size() && HexValue(text[i + 1]) >= 0 && HexValue(text[i + 2]) >= 0) {
+            result += static_cast<char>(HexValue(text[i + 1]) * 16 + HexValue(text[i + 2]));
+            i += 2;
+        } else {
+            result += text[i];
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+ArtCache& DefaultArtCache() {
+    static ArtCache cache(kArtCacheBudget);
+    return cache;
+}
+
+bool ArtCache::ReadSource(const std::string& uri, std::vector<uint8_t>& data, std::string& error) {
+    static const char kFileScheme[] = "file://";
+    std::string path = uri;
+    if (uri.compare(0, sizeof(kFileScheme) - 1, kFileScheme) == 0) {
+        path = PercentDecode(uri.substr(sizeof(kFileScheme) - 1));
+    } else if (uri.find("://") != std::string::npos) {
+        error = "Sadece file:// kaynakları okunabilir";
+        return false;
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        error = "Kapak dosyası açılamadı: " + path;
+        return false;
+    }
+
+    std::streamoff length = file.tellg();
+    if (length <= 0 || static_cast<size_t>(length) > kMaxSourceBytes) {
+        error = "Kapak dosyası boyutu geçersiz";
+        return false;
+    }
+
+    data.resize(static_cast<size_t>(length));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.data()), length)) {
+        error = "Kapak dosyası okunamadı";
+        return false;
+    }
+    return true;
+}
+
+bool ArtCache::Render(const std::vector<uint8_t>& source, int size, ArtResult& result, std::string& error) {
+    if (source.empty() || source.size() > kMaxSourceBytes) {
+        error = "Kapak verisi boş veya çok büyük";
+        return false;
+    }
+
+    // Anahtar: içerik özeti + kutucuk boyutu (farklı boyutlar ayrı girdiler)
+    uint64_t hash = ContentHash(source.data(), source.size());
+    hash = ContentHash(reinterpret_cast<const uint8_t*>(&size), sizeof(size), hash);
+    std::string etag = HashToHex(hash);
+
+    if (Find(etag, result)) {
+        result.cached = true;
+        return true;
+    }
+
+    ImageRGBA decoded;
+    if (!DecodeImage(source.data(), source.size(), decoded, error, size)) {
+        return false;
+    }
+
+    int width = 0;
+    int height = 0;
+    FitWithin(decoded.width, decoded.height, size, width, height);
+
+    ImageRGBA scaled;
+    const ImageRGBA* output = &decoded;
+    if (width != decoded.width || height != decoded.height) {
+        if (!ResizeArea(decoded, width, height, scaled)) {
+            error = "Kapak küçültülemedi";
+            return false;
+        }
+        output = &scaled;
+    }
+
+    auto jpeg = std::make_shared<std::vector<uint8_t>>();
+    if (!EncodeJpeg(*output, kJpegQuality, *jpeg, error)) {
+        return false;
+    }
+
+    result.etag = etag;
+    result.jpeg = jpeg;
+    result.width = output->width;
+    result.height = output->height;
+    result.cached = false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.Put(etag, { jpeg, output->width, output->height }, jpeg->size());
+    return true;
+}
+
+bool ArtCache::Find(const std::string& etag, ArtResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const Entry* entry = entries_.Find(etag);
+    if (!entry) {
+        return false;
+    }
+
+    result.etag = etag;
+    result.jpeg = entry->jpeg;
+    result.width = entry->width;
+    result.height = entry->height;
+    return true;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../native-common/lru_cache.h"
+
+// Kapak resmi hattı
+// Kaynak (MPRIS mpris:artUrl dosyası veya JS'in indirdiği bayt dizisi) bir kez
+// çözülür, SIMD alan ortalamasıyla telefon kutucuğu boyutuna küçültülür ve JPEG
+// olarak bir kez kodlanır. Sonuç, kaynak içeriğinin özetiyle (+ boyut) anahtarlanan
+// bayt bütçeli bir LRU'da tutulur; aynı kapak tekrar geldiğinde hiçbir iş yapılmaz.
+// Özet aynı zamanda HTTP ETag'idir.
+
+struct ArtResult {
+    std::string etag;   // 16 haneli hex içerik özeti
+    std::shared_ptr<const std::vector<uint8_t>> jpeg;
+    int width = 0;
+    int height = 0;
+    bool cached = false; // Önbellekten geldi (çözme/kodlama yapılmadı)
+};
+
+class ArtCache {
+public:
+    explicit ArtCache(size_t budget) : entries_(budget) {}
+
+    // source: ham kaynak baytları; size: kutucuk kenarı (piksel)
+    // Herhangi bir thread'den çağrılabilir; ağır iş kilit dışında yapılır.
+    bool Render(const std::vector<uint8_t>& source, int size, ArtResult& result, std::string& error);
+
+    // Daha önce üretilmiş bir sonucu ETag ile bul
+    bool Find(const std::string& etag, ArtResult& result);
+
+    // "file:///yol" URI'si veya düz yol -> dosya içeriği
+    static bool ReadSource(const std::string& uri, std::vector<uint8_t>& data, std::string& error);
+
+private:
+    struct Entry {
+        std::shared_ptr<const std::vector<uint8_t>> jpeg;
+        int width = 0;
+        int height = 0;
+    };
+
+    std::mutex mutex_;
+    LruCache<std::string, Entry> entries_;
+};
+
+// Process genelindeki kapak önbelleği
+ArtCache& DefaultArtCache();
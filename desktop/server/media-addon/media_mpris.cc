@@ -0,0 +1,617 @@
+#include "media_session.h"
+
+#include <dbus/dbus.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <thread>
+#include <vector>
+
+// Linux: D-Bus oturum veriyolu üzerinden MPRIS (org.mpris.MediaPlayer2.*)
+// Özel bir libdbus bağlantısı kendi thread'inde açılır:
+// - Bağlanınca mevcut oynatıcılar ListNames + Properties.GetAll ile bir kez okunur.
+// - Sonrasında sadece sinyaller işlenir: PropertiesChanged (durum/metadata),
+//   Seeked (pozisyon) ve NameOwnerChanged (oynatıcı açıldı/kapandı).
+// - MPRIS pozisyon için sinyal göndermez; durum veya parça değişince Position bir
+//   kez sorgulanır, aradaki ilerleme Rate ile hesaplanır.
+// Birden fazla oynatıcı varsa çalanlardan en son değişen, yoksa en son değişen gösterilir.
+// Thread poll() ile veriyolu soketinde ve durdurma için bir eventfd'de bekler.
+
+namespace {
+
+const char kMprisPrefix[] = "org.mpris.MediaPlayer2.";
+const char kMprisPath[] = "/org/mpris/MediaPlayer2";
+const char kPlayerInterface[] = "org.mpris.MediaPlayer2.Player";
+const char kPropertiesInterface[] = "org.freedesktop.DBus.Properties";
+const int kCallTimeoutMs = 500;
+const int kReconnectDelayMs = 5000;
+
+using Clock = std::chrono::steady_clock;
+
+struct PlayerState {
+    std::string name;
+    std::string playbackStatus;
+    std::string title;
+    std::string artist;
+    std::string album;
+    std::string artUrl;
+    double duration = 0.0;
+    double position = 0.0;
+    Clock::time_point positionAt = Clock::now();
+    double rate = 1.0;
+    uint64_t activity = 0; // Son değişikliğin sırası (aktif oynatıcı seçimi için)
+
+    bool Playing() const {
+        return playbackStatus == "Playing";
+    }
+
+    // Okunduğu andan bu yana ilerletilmiş pozisyon
+    double CurrentPosition() const {
+        if (!Playing()) {
+            return position;
+        }
+        std::chrono::duration<double> elapsed = Clock::now() - positionAt;
+        double current = position + elapsed.count() * rate;
+        return duration > 0.0 && current > duration ? duration : current;
+    }
+};
+
+// "org.mpris.MediaPlayer2.vlc.instance1234" -> "vlc"
+std::string PlayerName(const std::string& busName) {
+    std::string name = busName.substr(sizeof(kMprisPrefix) - 1);
+    size_t dot = name.find('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+bool IsMprisName(const char* name) {
+    return name && std::string(name).compare(0, sizeof(kMprisPrefix) - 1, kMprisPrefix) == 0;
+}
+
+// Variant içindeki değeri oku (iter variant'ın içini gösterir)
+bool ReadString(DBusMessageIter* value, std::string& out) {
+    int type = dbus_message_iter_get_arg_type(value);
+    if (type != DBUS_TYPE_STRING && type != DBUS_TYPE_OBJECT_PATH) {
+        return false;
+    }
+    const char* text = nullptr;
+    dbus_message_iter_get_basic(value, &text);
+    out = text ? text : "";
+    return true;
+}
+
+bool ReadNumber(DBusMessageIter* value, double& out) {
+    switch (dbus_message_iter_get_arg_type(value)) {
+    case DBUS_TYPE_INT64: {
+        dbus_int64_t number;
+        dbus_message_iter_get_basic(value, &number);
+        out = static_cast<double>(number);
+        return true;
+    }
+    case DBUS_TYPE_UINT64: {
+        dbus_uint64_t number;
+        dbus_message_iter_get_basic(value, &number);
+        out = static_cast<double>(number);
+        return true;
+    }
+    case DBUS_TYPE_INT32: {
+        dbus_int32_t number;
+        dbus_message_iter_get_basic(value, &number);
+        out = number;
+        return true;
+    }
+    case DBUS_TYPE_UINT32: {
+        dbus_uint32_t number;
+        dbus_message_iter_get_basic(value, &number);
+        out = number;
+        return true;
+    }
+    case DBUS_TYPE_DOUBLE:
+        dbus_message_iter_get_basic(value, &out);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// xesam:artist bir string dizisidir; bazı oynatıcılar tek string gönderir
+void ReadArtists(DBusMessageIter* value, std::string& out) {
+    out.clear();
+    if (ReadString(value, out) || dbus_message_iter_get_arg_type(value) != DBUS_TYPE_ARRAY) {
+        return;
+    }
+
+    DBusMessageIter list;
+    dbus_message_iter_recurse(value, &list);
+    std::string artist;
+    while (ReadString(&list, artist)) {
+        if (!out.empty()) {
+            out += ", ";
+        }
+        out += artist;
+        dbus_message_iter_next(&list);
+    }
+}
+
+// a{sv} sözlüğünde dolaş: fn(anahtar, variant içi)
+template <typename Fn>
+void ForEachEntry(DBusMessageIter* dict, Fn fn) {
+    if (dbus_message_iter_get_arg_type(dict) != DBUS_TYPE_ARRAY) {
+        return;
+    }
+
+    DBusMessageIter entries;
+    dbus_message_iter_recurse(dict, &entries);
+    while (dbus_message_iter_get_arg_type(&entries) == DBUS_TYPE_DICT_ENTRY) {
+        DBusMessageIter entry;
+        dbus_message_iter_recurse(&entries, &entry);
+
+        std::string key;
+        if (ReadString(&entry, key) && dbus_message_iter_next(&entry) &&
+            dbus_message_iter_get_arg_type(&entry) == DBUS_TYPE_VARIANT) {
+            DBusMessageIter value;
+            dbus_message_iter_recurse(&entry, &value);
+            fn(key, &value);
+        }
+        dbus_message_iter_next(&entries);
+    }
+}
+
+void ParseMetadata(DBusMessageIter* dict, PlayerState& player) {
+    // Metadata her seferinde bütün olarak gönderilir
+    player.title.clear();
+    player.artist.clear();
+    player.album.clear();
+    player.artUrl.clear();
+    player.duration = 0.0;
+
+    ForEachEntry(dict, [&](const std::string& key, DBusMessageIter* value) {
+        if (key == "xesam:title") {
+            ReadString(value, player.title);
+        } else if (key == "xesam:artist") {
+            ReadArtists(value, player.artist);
+        } else if (key == "xesam:album") {
+            ReadString(value, player.album);
+        } else if (key == "mpris:artUrl") {
+            ReadString(value, player.artUrl);
+        } else if (key == "mpris:length") {
+            double length = 0.0;
+            if (ReadNumber(value, length)) {
+                player.duration = length / 1e6; // Mikrosaniye -> saniye
+            }
+        }
+    });
+}
+
+// Player arayüzü özellikleri; pozisyonun yeniden okunması gerekiyorsa true
+bool ParseProperties(DBusMessageIter* dict, PlayerState& player, bool& hasPosition) {
+    bool needsPosition = false;
+    hasPosition = false;
+
+    ForEachEntry(dict, [&](const std::string& key, DBusMessageIter* value) {
+        if (key == "PlaybackStatus") {
+            ReadString(value, player.playbackStatus);
+            needsPosition = true;
+        } else if (key == "Metadata") {
+            ParseMetadata(value, player);
+            needsPosition = true;
+        } else if (key == "Rate") {
+            ReadNumber(value, player.rate);
+        } else if (key == "Position") {
+            double position = 0.0;
+            if (ReadNumber(value, position)) {
+                player.position = position / 1e6;
+                player.positionAt = Clock::now();
+                hasPosition = true;
+            }
+        }
+    });
+
+    return needsPosition && !hasPosition;
+}
+
+} // namespace
+
+struct MediaSessionMonitor::Impl {
+    MediaSessionMonitor* owner = nullptr;
+    std::thread thread;
+    int wakeFd = -1;
+    std::atomic<bool> stopping{false};
+    DBusConnection* connection = nullptr;
+
+    // Benzersiz veriyolu adı (":1.42") -> oynatıcı; sadece dinleme thread'i
+    std::map<std::string, PlayerState> players;
+    uint64_t activityCounter = 0;
+    // Son yayınlanan durum ve o anki pozisyon ilerleme hızı
+    MediaStatus published;
+    Clock::time_point publishedAt;
+    double publishedRate = 0.0;
+    bool hasPublished = false;
+
+    // Engelleyen metod çağrısı (sadece bağlanırken ve oynatıcı eklenirken/değişince)
+    DBusMessage* Call(DBusMessage* message) {
+        if (!message) {
+            return nullptr;
+        }
+        DBusMessage* reply = dbus_connection_send_with_reply_and_block(connection, message, kCallTimeoutMs, nullptr);
+        dbus_message_unref(message);
+        return reply;
+    }
+
+    DBusMessage* GetProperty(const std::string& busName, const char* property) {
+        DBusMessage* message = dbus_message_new_method_call(busName.c_str(), kMprisPath, kPropertiesInterface, "Get");
+        if (!message) {
+            return nullptr;
+        }
+        const char* interfaceName = kPlayerInterface;
+        dbus_message_append_args(message, DBUS_TYPE_STRING, &interfaceName, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
+        return Call(message);
+    }
+
+    void FetchPosition(const std::string& busName, PlayerState& player) {
+        DBusMessage* reply = GetProperty(busName, "Position");
+        if (!reply) {
+            return;
+        }
+
+        DBusMessageIter iter;
+        if (dbus_message_iter_init(reply, &iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_VARIANT) {
+            DBusMessageIter value;
+            dbus_message_iter_recurse(&iter, &value);
+            double position = 0.0;
+            if (ReadNumber(&value, position)) {
+                player.position = position / 1e6;
+                player.positionAt = Clock::now();
+            }
+        }
+        dbus_message_unref(reply);
+    }
+
+    // Oynatıcının tüm Player özelliklerini oku
+    void FetchAll(const std::string& busName, PlayerState& player) {
+        DBusMessage* message = dbus_message_new_method_call(busName.c_str(), kMprisPath, kPropertiesInterface, "GetAll");
+        if (!message) {
+            return;
+        }
+        const char* interfaceName = kPlayerInterface;
+        dbus_message_append_args(message, DBUS_TYPE_STRING, &interfaceName, DBUS_TYPE_INVALID);
+
+        DBusMessage* reply = Call(message);
+        if (!reply) {
+            return;
+        }
+
+        DBusMessageIter iter;
+        if (dbus_message_iter_init(reply, &iter)) {
+            bool hasPosition = false;
+            if (ParseProperties(&iter, player, hasPosition)) {
+                FetchPosition(busName, player);
+            }
+        }
+        dbus_message_unref(reply);
+    }
+
+    void AddPlayer(const std::string& busName, const std::string& uniqueName) {
+        PlayerState& player = players[uniqueName];
+        player = PlayerState();
+        player.name = PlayerName(busName);
+        player.activity = ++activityCounter;
+        FetchAll(uniqueName, player);
+    }
+
+    std::string GetNameOwner(const char* busName) {
+        DBusMessage* message = dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "GetNameOwner");
+        if (!message) {
+            return "";
+        }
+        dbus_message_append_args(message, DBUS_TYPE_STRING, &busName, DBUS_TYPE_INVALID);
+
+        DBusMessage* reply = Call(message);
+        if (!reply) {
+            return "";
+        }
+        const char* owner = nullptr;
+        std::string result;
+        if (dbus_message_get_args(reply, nullptr, DBUS_TYPE_STRING, &owner, DBUS_TYPE_INVALID) && owner) {
+            result = owner;
+        }
+        dbus_message_unref(reply);
+        return result;
+    }
+
+    // Veriyolundaki mevcut MPRIS oynatıcılarını bir kez oku
+    void LoadPlayers() {
+        DBusMessage* reply = Call(dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "ListNames"));
+        if (!reply) {
+            return;
+        }
+
+        std::vector<std::string> names;
+        DBusMessageIter iter;
+        if (dbus_message_iter_init(reply, &iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY) {
+            DBusMessageIter list;
+            dbus_message_iter_recurse(&iter, &list);
+            std::string name;
+            while (ReadString(&list, name)) {
+                if (IsMprisName(name.c_str())) {
+                    names.push_back(name);
+                }
+                dbus_message_iter_next(&list);
+            }
+        }
+        dbus_message_unref(reply);
+
+        for (const std::string& name : names) {
+            std::string uniqueName = GetNameOwner(name.c_str());
+            if (!uniqueName.empty()) {
+                AddPlayer(name, uniqueName);
+            }
+        }
+    }
+
+    bool Connect() {
+        DBusError error;
+        dbus_error_init(&error);
+
+        // Paylaşılan bağlantı yerine özel bağlantı: sadece bu thread kullanır
+        connection = dbus_bus_get_private(DBUS_BUS_SESSION, &error);
+        if (!connection) {
+            dbus_error_free(&error);
+            return false;
+        }
+        dbus_connection_set_exit_on_disconnect(connection, FALSE);
+
+        // Abonelikler önce kurulur ki listeleme sırasında açılan oynatıcı kaçmasın
+        dbus_bus_add_match(connection,
+            "type='signal',interface='org.freedesktop.DBus.Properties',member='PropertiesChanged',"
+            "path='/org/mpris/MediaPlayer2',arg0='org.mpris.MediaPlayer2.Player'", nullptr);
+        dbus_bus_add_match(connection,
+            "type='signal',interface='org.mpris.MediaPlayer2.Player',member='Seeked',path='/org/mpris/MediaPlayer2'", nullptr);
+        dbus_bus_add_match(connection,
+            "type='signal',sender='org.freedesktop.DBus',interface='org.freedesktop.DBus',member='NameOwnerChanged',"
+            "arg0namespace='org.mpris.MediaPlayer2'", nullptr);
+        dbus_connection_flush(connection);
+
+        players.clear();
+        LoadPlayers();
+        return true;
+    }
+
+    void Disconnect() {
+        if (connection) {
+            dbus_connection_close(connection);
+            dbus_connection_unref(connection);
+            connection = nullptr;
+        }
+        players.clear();
+    }
+
+    void HandlePropertiesChanged(DBusMessage* message) {
+        auto it = players.find(dbus_message_get_sender(message) ? dbus_message_get_sender(message) : "");
+        if (it == players.end()) {
+            return;
+        }
+
+        DBusMessageIter iter;
+        std::string interfaceName;
+        if (!dbus_message_iter_init(message, &iter) || !ReadString(&iter, interfaceName) ||
+            interfaceName != kPlayerInterface || !dbus_message_iter_next(&iter)) {
+            return;
+        }
+
+        PlayerState& player = it->second;
+        bool hasPosition = false;
+        bool needsPosition = ParseProperties(&iter, player, hasPosition);
+
+        // Değeri gönderilmeyen (invalidated) özellikler varsa hepsini yeniden oku
+        bool invalidated = false;
+        if (dbus_message_iter_next(&iter) && dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY) {
+            DBusMessageIter list;
+            dbus_message_iter_recurse(&iter, &list);
+            invalidated = dbus_message_iter_get_arg_type(&list) == DBUS_TYPE_STRING;
+        }
+
+        if (invalidated) {
+            FetchAll(it->first, player);
+        } else if (needsPosition) {
+            FetchPosition(it->first, player);
+        }
+        player.activity = ++activityCounter;
+    }
+
+    void HandleSeeked(DBusMessage* message) {
+        auto it = players.find(dbus_message_get_sender(message) ? dbus_message_get_sender(message) : "");
+        dbus_int64_t position = 0;
+        if (it == players.end() ||
+            !dbus_message_get_args(message, nullptr, DBUS_TYPE_INT64, &position, DBUS_TYPE_INVALID)) {
+            return;
+        }
+        it->second.position = static_cast<double>(position) / 1e6;
+        it->second.positionAt = Clock::now();
+    }
+
+    void HandleNameOwnerChanged(DBusMessage* message) {
+        const char* name = nullptr;
+        const char* oldOwner = nullptr;
+        const char* newOwner = nullptr;
+        if (!dbus_message_get_args(message, nullptr,
+                DBUS_TYPE_STRING, &name, DBUS_TYPE_STRING, &oldOwner, DBUS_TYPE_STRING, &newOwner,
+                DBUS_TYPE_INVALID) || !IsMprisName(name)) {
+            return;
+        }
+
+        if (oldOwner && *oldOwner) {
+            players.erase(oldOwner);
+        }
+        if (newOwner && *newOwner) {
+            AddPlayer(name, newOwner);
+        }
+    }
+
+    void Handle(DBusMessage* message) {
+        if (dbus_message_is_signal(message, kPropertiesInterface, "PropertiesChanged")) {
+            HandlePropertiesChanged(message);
+        } else if (dbus_message_is_signal(message, kPlayerInterface, "Seeked")) {
+            HandleSeeked(message);
+        } else if (dbus_message_is_signal(message, DBUS_INTERFACE_DBUS, "NameOwnerChanged")) {
+            HandleNameOwnerChanged(message);
+        } else {
+            return;
+        }
+        Refresh();
+    }
+
+    // Aktif oynatıcıyı seç ve durum değiştiyse yayınla
+    void Refresh() {
+        const PlayerState* active = nullptr;
+        for (const auto& entry : players) {
+            const PlayerState& player = entry.second;
+            if (!active ||
+                (player.Playing() && !active->Playing()) ||
+                (player.Playing() == active->Playing() && player.activity > active->activity)) {
+                active = &player;
+            }
+        }
+
+        MediaStatus status;
+        if (active) {
+            status.isPlaying = active->Playing();
+            status.title = active->title;
+            status.artist = active->artist;
+            status.album = active->album;
+            status.artUrl = active->artUrl;
+            status.player = active->name;
+            status.duration = active->duration;
+            status.position = active->CurrentPosition();
+            status.success = true;
+        } else {
+            status.title = "Medya oynatıcı bulunamadı";
+        }
+
+        // Sadece ilerleyen pozisyon farkı yeni bir bildirim sayılmaz
+        if (hasPublished &&
+            status.isPlaying == published.isPlaying && status.title == published.title &&
+            status.artist == published.artist && status.album == published.album &&
+            status.artUrl == published.artUrl && status.player == published.player &&
+            status.duration == published.duration && status.success == published.success &&
+            std::abs(status.position - ExpectedPosition()) < 1.0) {
+            return;
+        }
+
+        published = status;
+        publishedAt = Clock::now();
+        publishedRate = active && active->Playing() ? active->rate : 0.0;
+        hasPublished = true;
+        owner->Publish(status, publishedRate);
+    }
+
+    // Son yayınlanan pozisyonun şu anki tahmini
+    double ExpectedPosition() const {
+        std::chrono::duration<double> elapsed = Clock::now() - publishedAt;
+        return published.position + elapsed.count() * publishedRate;
+    }
+
+    void Dispatch() {
+        while (DBusMessage* message = dbus_connection_pop_message(connection)) {
+            Handle(message);
+            dbus_message_unref(message);
+        }
+    }
+
+    // Durdurma istenene kadar (veya zaman aşımına kadar) bekle; durdurulduysa false
+    bool Sleep(int timeoutMs) {
+        pollfd wake = { wakeFd, POLLIN, 0 };
+        poll(&wake, 1, timeoutMs);
+        return !stopping.load();
+    }
+
+    void Run() {
+        while (!stopping.load()) {
+            if (!connection) {
+                if (!Connect()) {
+                    // Oturum veriyolu yok (ör. headless sunucu); arada bir tekrar dene
+                    Disconnect();
+                    Sleep(kReconnectDelayMs);
+                    continue;
+                }
+                owner->SetReady(true);
+                Refresh();
+            }
+
+            // Engelleyen çağrılar sırasında okunup kuyrukta bekleyen mesajlar
+            Dispatch();
+
+            int busFd = -1;
+            dbus_connection_get_unix_fd(connection, &busFd);
+            pollfd fds[2] = {
+                { busFd, POLLIN, 0 },
+                { wakeFd, POLLIN, 0 }
+            };
+            poll(fds, 2, -1);
+
+            if (stopping.load()) {
+                break;
+            }
+
+            if (!dbus_connection_read_write(connection, 0) || !dbus_connection_get_is_connected(connection)) {
+                // Veriyolu kapandı (oturum sona erdi); yeniden bağlanmayı dene
+                Disconnect();
+                owner->SetReady(false);
+                Refresh();
+                Sleep(kReconnectDelayMs);
+                continue;
+            }
+            Dispatch();
+        }
+
+        Disconnect();
+    }
+};
+
+MediaSessionMonitor::MediaSessionMonitor() : impl_(new Impl()) {
+    impl_->owner = this;
+    status_.title = "Medya oynatıcı bulunamadı";
+}
+
+MediaSessionMonitor::~MediaSessionMonitor() {
+    // Thread modül temizliğinde durdurulur (Stop)
+}
+
+void MediaSessionMonitor::NativeStart() {
+    if (impl_->thread.joinable()) {
+        return;
+    }
+
+    // libdbus'ın global durumu Node'un diğer thread'leriyle paylaşılabilir
+    dbus_threads_init_default();
+
+    impl_->wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (impl_->wakeFd < 0) {
+        return;
+    }
+
+    impl_->stopping.store(false);
+    impl_->thread = std::thread([this]() { impl_->Run(); });
+}
+
+void MediaSessionMonitor::NativeStop() {
+    if (!impl_->thread.joinable()) {
+        return;
+    }
+
+    impl_->stopping.store(true);
+    uint64_t one = 1;
+    ssize_t written = write(impl_->wakeFd, &one, sizeof(one));
+    (void)written;
+    impl_->thread.join();
+
+    close(impl_->wakeFd);
+    impl_->wakeFd = -1;
+    SetReady(false);
+}
+
+const char* MediaSessionMonitor::NativeBackend() const {
+    return "mpris";
+}
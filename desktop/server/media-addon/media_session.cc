@@ -0,0 +1,118 @@
+#include "media_session.h"
+
+MediaSessionMonitor& DefaultMediaMonitor() {
+    static MediaSessionMonitor monitor;
+    return monitor;
+}
+
+void MediaSessionMonitor::UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder) {
+    testMode_ = mode;
+    recorder_ = recorder;
+}
+
+void MediaSessionMonitor::Start() {
+    if (testMode_ == testbackend::Mode::kNative) {
+        NativeStart();
+        return;
+    }
+
+    // Sabit bir parça çalıyormuş gibi başla (bağlantı hemen hazır)
+    MediaStatus status;
+    status.isPlaying = true;
+    status.title = "Test Parçası";
+    status.artist = "LocalDesk";
+    status.album = "Benchmark";
+    status.player = "test";
+    status.duration = 240.0;
+    status.success = true;
+    SetReady(true);
+    Publish(status, 1.0);
+}
+
+void MediaSessionMonitor::Stop() {
+    if (testMode_ == testbackend::Mode::kNative) {
+        NativeStop();
+        return;
+    }
+    SetReady(false);
+}
+
+const char* MediaSessionMonitor::Backend() const {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeBackend();
+    }
+    return testbackend::ModeName(testMode_);
+}
+
+MediaStatus MediaSessionMonitor::Status() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    MediaStatus status = status_;
+    if (status.isPlaying && positionRate_ > 0.0) {
+        // Pozisyon sinyali gelmez; son okunan değer geçen süre kadar ilerletilir
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - positionAt_;
+        status.position += elapsed.count() * positionRate_;
+        if (status.duration > 0.0 && status.position > status.duration) {
+            status.position = status.duration;
+        }
+    }
+
+    if (testMode_ != testbackend::Mode::kNative) {
+        recorder_->Record("status", status.player, status.position);
+    }
+    return status;
+}
+
+bool MediaSessionMonitor::Ready() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ready_;
+}
+
+void MediaSessionMonitor::SetReady(bool ready) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_ = ready;
+}
+
+void MediaSessionMonitor::SetChangeListener(MediaChangeListener listener) {
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    listener_ = std::move(listener);
+}
+
+void MediaSessionMonitor::Publish(const MediaStatus& status, double positionRate) {
+    if (testMode_ != testbackend::Mode::kNative) {
+        recorder_->Record("publish", status.title, status.position);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = status;
+        positionRate_ = positionRate;
+        positionAt_ = std::chrono::steady_clock::now();
+    }
+
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    if (listener_) {
+        listener_(status);
+    }
+}
+
+#if !defined(__linux__)
+// Henüz native backend olmayan platformlar (Windows: PowerShell yedeği kullanılır)
+
+struct MediaSessionMonitor::Impl {};
+
+MediaSessionMonitor::MediaSessionMonitor() : impl_(new Impl()) {
+    status_.title = "Medya oynatıcı bulunamadı";
+}
+
+MediaSessionMonitor::~MediaSessionMonitor() = default;
+
+void MediaSessionMonitor::NativeStart() {}
+
+void MediaSessionMonitor::NativeStop() {}
+
+const char* MediaSessionMonitor::NativeBackend() const {
+    return "none";
+}
+
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "../native-common/test_backend.h"
+
+// Şu an çalan medyanın önbellekteki durumu
+// Backend (Linux: D-Bus oturum veriyolu üzerinden MPRIS) kendi thread'inde
+// oynatıcıların değişiklik sinyallerini dinler ve durumu günceller; Status()
+// sadece bu önbelleği okur, oynatıcıya hiç sorgu göndermez.
+//
+// Test modunda (UseTestBackend) D-Bus'a bağlanılmaz: Start sentetik bir durum
+// yayınlar, sonraki durumlar dışarıdan Publish ile verilir ve kaydedilir.
+
+struct MediaStatus {
+    bool isPlaying = false;
+    std::string title;
+    std::string artist;
+    std::string album;
+    std::string artUrl;
+    std::string player;     // Oynatıcı kimliği (ör. "spotify", "vlc")
+    double duration = 0.0;  // Saniye
+    double position = 0.0;  // Saniye (okunduğu ana göre ilerletilmiş)
+    bool success = false;   // Aktif bir oynatıcı var mı
+};
+
+// Değişiklik bildirimi (backend thread'inden çağrılır)
+using MediaChangeListener = std::function<void(const MediaStatus& status)>;
+
+class MediaSessionMonitor {
+public:
+    MediaSessionMonitor();
+    ~MediaSessionMonitor();
+
+    MediaSessionMonitor(const MediaSessionMonitor&) = delete;
+    MediaSessionMonitor& operator=(const MediaSessionMonitor&) = delete;
+
+    // Test backend'ini seç (Start'tan önce bir kez)
+    void UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder);
+
+    // Dinleme thread'ini başlat / durdur
+    void Start();
+    void Stop();
+
+    // Önbellekteki durum (çalıyorsa pozisyon şimdiki ana ilerletilir)
+    MediaStatus Status();
+
+    // Backend adı ve dinleme thread'i veriyoluna bağlı mı
+    const char* Backend() const;
+    bool Ready();
+
+    // Değişiklik dinleyicisini ayarla (boş fonksiyon = kaldır)
+    void SetChangeListener(MediaChangeListener listener);
+
+    // Backend'ler tarafından çağrılır (dinleme thread'i)
+    // positionRate: çalarken pozisyonun saniyedeki ilerleyişi (MPRIS Rate)
+    void Publish(const MediaStatus& status, double positionRate);
+    void SetReady(bool ready);
+
+private:
+    struct Impl;
+
+    // Platform backend'i (media_mpris.cc)
+    void NativeStart();
+    void NativeStop();
+    const char* NativeBackend() const;
+
+    testbackend::Mode testMode_ = testbackend::Mode::kNative;
+    testbackend::Recorder* recorder_ = nullptr;
+
+    std::mutex mutex_;
+    MediaStatus status_;
+    double positionRate_ = 0.0;
+    std::chrono::steady_clock::time_point positionAt_;
+    bool ready_ = false;
+
+    std::mutex listenerMutex_;
+    MediaChangeListener listener_;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+// Process genelindeki medya izleyicisi
+MediaSessionMonitor& DefaultMediaMonitor();
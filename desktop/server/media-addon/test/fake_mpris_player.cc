@@ -0,0 +1,230 @@
+// Testler için sahte MPRIS oynatıcısı
+// Oturum veriyolunda org.mpris.MediaPlayer2.fake.test adını alır, Player
+// özelliklerini Properties.Get / GetAll ile sunar ve değişiklikleri gerçek bir
+// oynatıcı gibi PropertiesChanged (ve Seeked) sinyalleriyle yayınlar.
+// Ad alındıktan sonra stdout'a "ready" yazar; komutlar stdin'den satır satır:
+//
+//   play | pause             PlaybackStatus değişir
+//   track <başlık>           Metadata değişir (pozisyon 0'a döner)
+//   seek <saniye>            Seeked sinyali
+//   quit                     Veriyolundan ayrıl ve çık
+//
+// Derleme: node-gyp rebuild (build/Release/fake_mpris_player)
+
+#include <dbus/dbus.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+const char kBusName[] = "org.mpris.MediaPlayer2.fake.test";
+const char kPath[] = "/org/mpris/MediaPlayer2";
+const char kPlayerInterface[] = "org.mpris.MediaPlayer2.Player";
+const char kPropertiesInterface[] = "org.freedesktop.DBus.Properties";
+
+DBusConnection* connection = nullptr;
+
+std::string playbackStatus = "Paused";
+std::string title = "Song A";
+const char* const kArtists[] = { "Artist", "Feat" };
+const char kAlbum[] = "Album";
+dbus_int64_t lengthUs = 200000000;
+dbus_int64_t positionUs = 10000000;
+
+void AppendVariant(DBusMessageIter* iter, int type, const char* signature, const void* value) {
+    DBusMessageIter variant;
+    dbus_message_iter_open_container(iter, DBUS_TYPE_VARIANT, signature, &variant);
+    dbus_message_iter_append_basic(&variant, type, value);
+    dbus_message_iter_close_container(iter, &variant);
+}
+
+void AppendString(DBusMessageIter* iter, const char* value) {
+    AppendVariant(iter, DBUS_TYPE_STRING, "s", &value);
+}
+
+// { key: variant } girdisi; fill değeri variant olarak ekler
+template <typename Fill>
+void AppendEntry(DBusMessageIter* dict, const char* key, Fill fill) {
+    DBusMessageIter entry;
+    dbus_message_iter_open_container(dict, DBUS_TYPE_DICT_ENTRY, nullptr, &entry);
+    dbus_message_iter_append_basic(&entry, DBUS_TYPE_STRING, &key);
+    fill(&entry);
+    dbus_message_iter_close_container(dict, &entry);
+}
+
+void AppendMetadata(DBusMessageIter* iter) {
+    DBusMessageIter variant;
+    DBusMessageIter dict;
+    dbus_message_iter_open_container(iter, DBUS_TYPE_VARIANT, "a{sv}", &variant);
+    dbus_message_iter_open_container(&variant, DBUS_TYPE_ARRAY, "{sv}", &dict);
+
+    AppendEntry(&dict, "xesam:title", [](DBusMessageIter* entry) { AppendString(entry, title.c_str()); });
+    AppendEntry(&dict, "xesam:album", [](DBusMessageIter* entry) { AppendString(entry, kAlbum); });
+    AppendEntry(&dict, "xesam:artist", [](DBusMessageIter* entry) {
+        DBusMessageIter value;
+        DBusMessageIter list;
+        dbus_message_iter_open_container(entry, DBUS_TYPE_VARIANT, "as", &value);
+        dbus_message_iter_open_container(&value, DBUS_TYPE_ARRAY, "s", &list);
+        for (const char* artist : kArtists) {
+            dbus_message_iter_append_basic(&list, DBUS_TYPE_STRING, &artist);
+        }
+        dbus_message_iter_close_container(&value, &list);
+        dbus_message_iter_close_container(entry, &value);
+    });
+    AppendEntry(&dict, "mpris:length", [](DBusMessageIter* entry) {
+        AppendVariant(entry, DBUS_TYPE_INT64, "x", &lengthUs);
+    });
+
+    dbus_message_iter_close_container(&variant, &dict);
+    dbus_message_iter_close_container(iter, &variant);
+}
+
+void AppendProperty(DBusMessageIter* dict, const char* name) {
+    AppendEntry(dict, name, [name](DBusMessageIter* entry) {
+        if (std::strcmp(name, "PlaybackStatus") == 0) {
+            AppendString(entry, playbackStatus.c_str());
+        } else if (std::strcmp(name, "Metadata") == 0) {
+            AppendMetadata(entry);
+        } else if (std::strcmp(name, "Position") == 0) {
+            AppendVariant(entry, DBUS_TYPE_INT64, "x", &positionUs);
+        } else {
+            double rate = 1.0;
+            AppendVariant(entry, DBUS_TYPE_DOUBLE, "d", &rate);
+        }
+    });
+}
+
+void Send(DBusMessage* message) {
+    dbus_connection_send(connection, message, nullptr);
+    dbus_connection_flush(connection);
+    dbus_message_unref(message);
+}
+
+// Sadece değişen özellik gönderilir (invalidated listesi boş)
+void EmitChanged(const char* name) {
+    DBusMessage* signal = dbus_message_new_signal(kPath, kPropertiesInterface, "PropertiesChanged");
+    DBusMessageIter iter;
+    DBusMessageIter dict;
+    DBusMessageIter invalidated;
+    const char* interfaceName = kPlayerInterface;
+
+    dbus_message_iter_init_append(signal, &iter);
+    dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &interfaceName);
+    dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, "{sv}", &dict);
+    AppendProperty(&dict, name);
+    dbus_message_iter_close_container(&iter, &dict);
+    dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, "s", &invalidated);
+    dbus_message_iter_close_container(&iter, &invalidated);
+    Send(signal);
+}
+
+void HandleCall(DBusMessage* message) {
+    if (dbus_message_is_method_call(message, kPropertiesInterface, "GetAll")) {
+        DBusMessage* reply = dbus_message_new_method_return(message);
+        DBusMessageIter iter;
+        DBusMessageIter dict;
+        dbus_message_iter_init_append(reply, &iter);
+        dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, "{sv}", &dict);
+        for (const char* name : { "PlaybackStatus", "Metadata", "Position", "Rate" }) {
+            AppendProperty(&dict, name);
+        }
+        dbus_message_iter_close_container(&iter, &dict);
+        Send(reply);
+    } else if (dbus_message_is_method_call(message, kPropertiesInterface, "Get")) {
+        // İzleyici sadece Position'ı tek başına sorgular
+        DBusMessage* reply = dbus_message_new_method_return(message);
+        DBusMessageIter iter;
+        dbus_message_iter_init_append(reply, &iter);
+        AppendVariant(&iter, DBUS_TYPE_INT64, "x", &positionUs);
+        Send(reply);
+    }
+}
+
+// false: çıkış istendi
+bool HandleCommand(const std::string& line) {
+    if (line == "play" || line == "pause") {
+        playbackStatus = line == "play" ? "Playing" : "Paused";
+        EmitChanged("PlaybackStatus");
+    } else if (line.compare(0, 6, "track ") == 0) {
+        title = line.substr(6);
+        positionUs = 0;
+        EmitChanged("Metadata");
+    } else if (line.compare(0, 5, "seek ") == 0) {
+        positionUs = std::atoll(line.c_str() + 5) * 1000000LL;
+        DBusMessage* signal = dbus_message_new_signal(kPath, kPlayerInterface, "Seeked");
+        dbus_message_append_args(signal, DBUS_TYPE_INT64, &positionUs, DBUS_TYPE_INVALID);
+        Send(signal);
+    } else if (line == "quit") {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    DBusError error;
+    dbus_error_init(&error);
+    connection = dbus_bus_get_private(DBUS_BUS_SESSION, &error);
+    if (!connection) {
+        std::fprintf(stderr, "Oturum veriyoluna bağlanılamadı: %s\n", error.message);
+        return 1;
+    }
+    if (dbus_bus_request_name(connection, kBusName, DBUS_NAME_FLAG_DO_NOT_QUEUE, &error) !=
+        DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER) {
+        std::fprintf(stderr, "%s adı alınamadı\n", kBusName);
+        return 1;
+    }
+    std::printf("ready\n");
+    std::fflush(stdout);
+
+    int busFd = -1;
+    dbus_connection_get_unix_fd(connection, &busFd);
+    std::string pending;
+
+    for (;;) {
+        while (DBusMessage* message = dbus_connection_pop_message(connection)) {
+            HandleCall(message);
+            dbus_message_unref(message);
+        }
+        dbus_connection_flush(connection);
+
+        pollfd fds[2] = {
+            { busFd, POLLIN, 0 },
+            { STDIN_FILENO, POLLIN, 0 }
+        };
+        poll(fds, 2, -1);
+
+        if (fds[1].revents) {
+            char buffer[256];
+            ssize_t size = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (size <= 0) {
+                break;
+            }
+            pending.append(buffer, static_cast<size_t>(size));
+
+            bool quit = false;
+            size_t newline;
+            while (!quit && (newline = pending.find('\n')) != std::string::npos) {
+                quit = !HandleCommand(pending.substr(0, newline));
+                pending.erase(0, newline + 1);
+            }
+            if (quit) {
+                break;
+            }
+        }
+
+        if (!dbus_connection_read_write(connection, 0)) {
+            break;
+        }
+    }
+
+    dbus_connection_close(connection);
+    dbus_connection_unref(connection);
+    return 0;
+}
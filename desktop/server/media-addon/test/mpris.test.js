@@ -0,0 +1,27 @@
+// MPRIS izleyicisi: özel bir oturum veriyolunda (dbus-run-session) sahte oynatıcıyla
+// uçtan uca test (bkz. test/mpris_monitor_test.cc). Kullanıcının kendi oturum
+// veriyoluna dokunulmaz. dbus-run-session veya test programı yoksa atlanır.
+//
+// Çalıştırma: node --test test/ (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const { spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const MONITOR_TEST = path.join(__dirname, '..', 'build', 'Release', 'mpris_monitor_test');
+
+test('MPRIS oynatıcı değişiklikleri izleyiciye ulaşır', (t) => {
+  if (process.platform !== 'linux' || !fs.existsSync(MONITOR_TEST)) {
+    t.skip('mpris_monitor_test derlenmemiş');
+    return;
+  }
+  if (spawnSync('dbus-run-session', ['--version'], { stdio: 'ignore' }).error) {
+    t.skip('dbus-run-session yok');
+    return;
+  }
+
+  const result = spawnSync('dbus-run-session', ['--', MONITOR_TEST], { encoding: 'utf8', timeout: 30000 });
+  assert.strictEqual(result.status, 0, `${result.stdout}${result.stderr}`);
+});
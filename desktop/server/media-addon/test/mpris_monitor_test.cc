@@ -0,0 +1,192 @@
+// MPRIS izleyicisi testi: sahte oynatıcıyla (fake_mpris_player) uçtan uca
+// Oynatıcı açılınca durum GetAll ile okunmalı; play / pause, parça değişimi
+// (PropertiesChanged), Seeked ve oynatıcının kapanması (NameOwnerChanged) değişiklik
+// dinleyicisine (watchMedia'nın native tarafı) ulaşmalı.
+//
+// Derleme: node-gyp rebuild (build/Release/mpris_monitor_test)
+// Çalıştırma: dbus-run-session -- ./build/Release/mpris_monitor_test
+//   (veya node --test test/)
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../media_session.h"
+
+namespace {
+
+constexpr auto kTimeout = std::chrono::seconds(2);
+
+std::mutex mutex;
+std::condition_variable changedCv;
+std::vector<MediaStatus> changes;
+size_t consumed = 0;
+int failures = 0;
+
+void Check(bool ok, const std::string& what) {
+    std::printf("  %s %s\n", ok ? "ok  " : "HATA", what.c_str());
+    if (!ok) {
+        failures++;
+    }
+}
+
+bool Near(double value, double expected) {
+    return std::fabs(value - expected) < 1.0;
+}
+
+// predicate'i sağlayan yeni bir değişiklik gelene kadar bekle (öncekiler atlanır)
+bool WaitFor(const std::function<bool(const MediaStatus&)>& predicate, MediaStatus& out) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    for (;;) {
+        while (consumed < changes.size()) {
+            const MediaStatus& status = changes[consumed++];
+            if (predicate(status)) {
+                out = status;
+                return true;
+            }
+        }
+        if (changedCv.wait_until(lock, deadline) == std::cv_status::timeout && consumed == changes.size()) {
+            return false;
+        }
+    }
+}
+
+// Sahte oynatıcı süreci (stdin'den komut alır)
+struct Player {
+    pid_t pid = -1;
+    int input = -1;
+
+    bool Start(const std::string& path) {
+        int in[2];
+        int out[2];
+        if (pipe(in) != 0 || pipe(out) != 0) {
+            return false;
+        }
+
+        pid = fork();
+        if (pid == 0) {
+            dup2(in[0], STDIN_FILENO);
+            dup2(out[1], STDOUT_FILENO);
+            close(in[1]);
+            close(out[0]);
+            execl(path.c_str(), path.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+        close(in[0]);
+        close(out[1]);
+        input = in[1];
+
+        // Ad alınana kadar bekle ("ready")
+        char buffer[16] = {};
+        ssize_t size = read(out[0], buffer, sizeof(buffer) - 1);
+        close(out[0]);
+        return size > 0 && std::strncmp(buffer, "ready", 5) == 0;
+    }
+
+    void Command(const std::string& line) {
+        std::string text = line + "\n";
+        ssize_t ignored = write(input, text.data(), text.size());
+        (void)ignored;
+    }
+
+    void Wait() {
+        if (pid > 0) {
+            close(input);
+            int status = 0;
+            waitpid(pid, &status, 0);
+            pid = -1;
+        }
+    }
+};
+
+std::string PlayerPath(const char* argv0) {
+    std::string path = argv0;
+    size_t slash = path.rfind('/');
+    return (slash == std::string::npos ? std::string(".") : path.substr(0, slash)) + "/fake_mpris_player";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    if (!std::getenv("DBUS_SESSION_BUS_ADDRESS")) {
+        std::printf("DBUS_SESSION_BUS_ADDRESS yok (dbus-run-session ile çalıştırın)\n");
+        return 77;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    MediaSessionMonitor& monitor = DefaultMediaMonitor();
+    monitor.SetChangeListener([](const MediaStatus& status) {
+        std::lock_guard<std::mutex> lock(mutex);
+        changes.push_back(status);
+        changedCv.notify_all();
+    });
+    monitor.Start();
+
+    std::printf("MPRIS izleyicisi testi\n");
+    MediaStatus status;
+
+    Check(WaitFor([](const MediaStatus& s) { return !s.success; }, status) && monitor.Ready(),
+          "veriyoluna bağlandı, oynatıcı yok");
+
+    Player player;
+    if (!player.Start(PlayerPath(argv[0]))) {
+        std::printf("  fake_mpris_player başlatılamadı\n");
+        monitor.Stop();
+        return 1;
+    }
+
+    // Açılış: durum tek GetAll ile okunur
+    Check(WaitFor([](const MediaStatus& s) { return s.success; }, status), "oynatıcı bulundu");
+    Check(status.player == "fake", "oynatıcı adı: " + status.player);
+    Check(status.title == "Song A", "başlık: " + status.title);
+    Check(status.artist == "Artist, Feat", "sanatçılar birleştirildi: " + status.artist);
+    Check(status.album == "Album", "albüm: " + status.album);
+    Check(status.duration == 200.0, "süre: " + std::to_string(status.duration));
+    Check(!status.isPlaying && Near(status.position, 10.0), "duraklatılmış, pozisyon 10 s");
+
+    // PropertiesChanged: PlaybackStatus (pozisyon Get ile bir kez okunur)
+    player.Command("play");
+    Check(WaitFor([](const MediaStatus& s) { return s.isPlaying; }, status), "play -> isPlaying");
+    Check(Near(status.position, 10.0), "çalarken pozisyon 10 s'den devam eder");
+    Check(monitor.Status().isPlaying, "Status() önbelleği güncel");
+
+    // PropertiesChanged: Metadata
+    player.Command("track Song B");
+    Check(WaitFor([](const MediaStatus& s) { return s.title == "Song B"; }, status), "parça değişti");
+    Check(status.isPlaying && Near(status.position, 0.0), "yeni parça baştan çalıyor");
+
+    // Seeked: pozisyon tahmininden saptığı için yeni bildirim
+    player.Command("seek 42");
+    Check(WaitFor([](const MediaStatus& s) { return Near(s.position, 42.0); }, status), "seek -> 42 s");
+
+    player.Command("pause");
+    Check(WaitFor([](const MediaStatus& s) { return !s.isPlaying; }, status), "pause -> duraklatıldı");
+    Check(status.title == "Song B", "duraklatınca metadata korunur");
+
+    // NameOwnerChanged: oynatıcı kapandı
+    player.Command("quit");
+    player.Wait();
+    Check(WaitFor([](const MediaStatus& s) { return !s.success; }, status), "oynatıcı kapandı -> success false");
+
+    auto stopStart = std::chrono::steady_clock::now();
+    monitor.Stop();
+    double stopMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stopStart).count();
+    Check(stopMs < 100.0, "Stop hemen döner (" + std::to_string(stopMs) + " ms)");
+
+    std::printf("%s\n", failures == 0 ? "BAŞARILI" : "BAŞARISIZ");
+    return failures == 0 ? 0 : 1;
+}
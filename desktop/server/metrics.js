@@ -0,0 +1,85 @@
+// /metrics: Prometheus metin formatı (text/plain; version=0.0.4)
+// Native addon'ların getStats() çıktısı (native-common/metrics.h) ve birkaç
+// process göstergesi tek sayfada yazılır. getStats() sadece sayaçları okur;
+// istek başına maliyet addon başına birkaç mikrosaniyedir.
+
+const CONTENT_TYPE = 'text/plain; version=0.0.4; charset=utf-8';
+
+const QUANTILES = [
+  ['0.5', 'p50Us'],
+  ['0.9', 'p90Us'],
+  ['0.99', 'p99Us'],
+  ['0.999', 'p999Us']
+];
+
+function escapeLabel(value) {
+  return String(value).replace(/\\/g, '\\\\').replace(/"/g, '\\"').replace(/\n/g, '\\n');
+}
+
+function labels(pairs) {
+  return `{${Object.entries(pairs).map(([key, value]) => `${key}="${escapeLabel(value)}"`).join(',')}}`;
+}
+
+function seconds(us) {
+  return us / 1e6;
+}
+
+// Addon yüklenmemiş veya getStats'ı olmayan (eski derleme, yedek nesne) addon'lar atlanır
+function collectStats(addons) {
+  const stats = [];
+  for (const addon of addons) {
+    if (!addon || typeof addon.getStats !== 'function') continue;
+    try {
+      stats.push(addon.getStats());
+    } catch (error) {
+      // Bir addon'un hatası sayfanın geri kalanını bozmasın
+    }
+  }
+  return stats;
+}
+
+// addons: native addon nesneleri; gauges: [{ name, help, value }]
+function render(addons, gauges = []) {
+  const stats = collectStats(addons);
+  const out = [];
+
+  out.push('# HELP localdesk_native_call_duration_seconds Native addon çağrı süresi');
+  out.push('# TYPE localdesk_native_call_duration_seconds summary');
+  for (const { addon, apis } of stats) {
+    for (const api of apis) {
+      const base = { addon, api: api.name };
+      for (const [quantile, field] of QUANTILES) {
+        const value = api.calls > 0 ? seconds(api[field]) : NaN;
+        out.push(`localdesk_native_call_duration_seconds${labels({ ...base, quantile })} ${value}`);
+      }
+      out.push(`localdesk_native_call_duration_seconds_sum${labels(base)} ${seconds(api.sumUs)}`);
+      out.push(`localdesk_native_call_duration_seconds_count${labels(base)} ${api.calls}`);
+    }
+  }
+
+  out.push('# HELP localdesk_native_call_duration_max_seconds Process başından beri en uzun çağrı');
+  out.push('# TYPE localdesk_native_call_duration_max_seconds gauge');
+  for (const { addon, apis } of stats) {
+    for (const api of apis) {
+      out.push(`localdesk_native_call_duration_max_seconds${labels({ addon, api: api.name })} ${seconds(api.maxUs)}`);
+    }
+  }
+
+  out.push('# HELP localdesk_native_call_errors_total Hata fırlatan veya success=false döndüren çağrılar');
+  out.push('# TYPE localdesk_native_call_errors_total counter');
+  for (const { addon, apis } of stats) {
+    for (const api of apis) {
+      out.push(`localdesk_native_call_errors_total${labels({ addon, api: api.name })} ${api.errors}`);
+    }
+  }
+
+  for (const gauge of gauges) {
+    out.push(`# HELP ${gauge.name} ${gauge.help}`);
+    out.push(`# TYPE ${gauge.name} gauge`);
+    out.push(`${gauge.name} ${gauge.value}`);
+  }
+
+  return out.join('\n') + '\n';
+}
+
+module.exports = { CONTENT_TYPE, render };
@@ -0,0 +1,196 @@
+// yuv_convert doğrulama + benchmark
+// Önce her SIMD kernel'ın çıktısı skaler referansla bit düzeyinde karşılaştırılır
+// (tek/çift ve blok katı olmayan boyutlar, satır sonu dolgulu stride). Fark varsa
+// 1 ile çıkar. Sonra çözünürlük ve kernel başına BGRA giriş hızı (GB/s) ölçülür.
+//
+// Derleme: node-gyp rebuild (build/Release/yuv_convert_bench)
+// Çalıştırma: ./build/Release/yuv_convert_bench [kare_sayısı]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../yuv_convert.h"
+
+namespace {
+
+const YuvKernel kKernels[] = { YuvKernel::Scalar, YuvKernel::Sse2, YuvKernel::Avx2, YuvKernel::Neon };
+
+struct Frame {
+    int width;
+    int height;
+    int stride;
+    std::vector<uint8_t> pixels;
+};
+
+// Rastgele içerik + ekran görüntüsüne benzer düz alanlar (uç değerler dahil)
+Frame MakeFrame(int width, int height, int padding, uint32_t seed) {
+    Frame frame{ width, height, width * 4 + padding, {} };
+    frame.pixels.resize(static_cast<size_t>(frame.stride) * height);
+
+    std::mt19937 random(seed);
+    for (int y = 0; y < height; y++) {
+        uint8_t* row = frame.pixels.data() + static_cast<size_t>(y) * frame.stride;
+        for (int x = 0; x < frame.stride; x++) {
+            uint32_t value = random();
+            if ((y / 7 + x / 29) % 3 == 0) {
+                row[x] = (value & 1) ? 255 : 0;
+            } else {
+                row[x] = static_cast<uint8_t>(value);
+            }
+        }
+    }
+    return frame;
+}
+
+struct Output {
+    std::vector<uint8_t> y;
+    std::vector<uint8_t> u;
+    std::vector<uint8_t> v;
+};
+
+bool Run(const Frame& frame, bool nv12, YuvKernel kernel, Output& out) {
+    int chromaWidth = (frame.width + 1) / 2;
+    int chromaHeight = (frame.height + 1) / 2;
+    out.y.assign(static_cast<size_t>(frame.width) * frame.height, 0);
+
+    if (nv12) {
+        out.u.assign(static_cast<size_t>(chromaWidth) * 2 * chromaHeight, 0);
+        NV12Planes planes;
+        planes.y = out.y.data();
+        planes.yStride = frame.width;
+        planes.uv = out.u.data();
+        planes.uvStride = chromaWidth * 2;
+        return ConvertBGRAToNV12(frame.pixels.data(), frame.stride, frame.width, frame.height, planes, kernel);
+    }
+
+    out.u.assign(static_cast<size_t>(chromaWidth) * chromaHeight, 0);
+    out.v.assign(static_cast<size_t>(chromaWidth) * chromaHeight, 0);
+    I420Planes planes;
+    planes.y = out.y.data();
+    planes.yStride = frame.width;
+    planes.u = out.u.data();
+    planes.uStride = chromaWidth;
+    planes.v = out.v.data();
+    planes.vStride = chromaWidth;
+    return ConvertBGRAToI420(frame.pixels.data(), frame.stride, frame.width, frame.height, planes, kernel);
+}
+
+bool Verify() {
+    const int sizes[][2] = {
+        { 1, 1 }, { 2, 2 }, { 15, 3 }, { 16, 2 }, { 17, 5 }, { 31, 31 }, { 32, 2 },
+        { 33, 9 }, { 63, 4 }, { 100, 101 }, { 640, 360 }, { 1366, 767 }, { 1920, 1080 },
+    };
+
+    bool ok = true;
+    uint32_t seed = 1;
+    for (const auto& size : sizes) {
+        Frame frame = MakeFrame(size[0], size[1], (seed % 3) * 4 + 4, seed);
+        seed++;
+
+        for (bool nv12 : { false, true }) {
+            Output reference;
+            Run(frame, nv12, YuvKernel::Scalar, reference);
+
+            for (YuvKernel kernel : kKernels) {
+                if (kernel == YuvKernel::Scalar || !YuvKernelSupported(kernel)) {
+                    continue;
+                }
+                Output result;
+                Run(frame, nv12, kernel, result);
+                if (result.y != reference.y || result.u != reference.u || result.v != reference.v) {
+                    std::printf("HATA: %s %s %dx%d skaler referanstan farklı\n",
+                                YuvKernelName(kernel), nv12 ? "NV12" : "I420", frame.width, frame.height);
+                    ok = false;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+double MeasureSeconds(const Frame& frame, bool nv12, YuvKernel kernel, int frames) {
+    Output out;
+    Run(frame, nv12, kernel, out); // Isınma + çıktı tamponları
+
+    int chromaWidth = (frame.width + 1) / 2;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        if (nv12) {
+            NV12Planes planes;
+            planes.y = out.y.data();
+            planes.yStride = frame.width;
+            planes.uv = out.u.data();
+            planes.uvStride = chromaWidth * 2;
+            ConvertBGRAToNV12(frame.pixels.data(), frame.stride, frame.width, frame.height, planes, kernel);
+        } else {
+            I420Planes planes;
+            planes.y = out.y.data();
+            planes.yStride = frame.width;
+            planes.u = out.u.data();
+            planes.uStride = chromaWidth;
+            planes.v = out.v.data();
+            planes.vStride = chromaWidth;
+            ConvertBGRAToI420(frame.pixels.data(), frame.stride, frame.width, frame.height, planes, kernel);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 200;
+    if (frames <= 0) {
+        frames = 200;
+    }
+
+    std::printf("Seçilen kernel: %s\n", YuvKernelName(BestYuvKernel()));
+
+    if (!Verify()) {
+        return 1;
+    }
+    std::printf("Doğrulama: tüm kernel'lar skaler referansla bit düzeyinde aynı\n\n");
+
+    const struct {
+        const char* name;
+        int width;
+        int height;
+    } resolutions[] = {
+        { "720p", 1280, 720 },
+        { "1080p", 1920, 1080 },
+        { "1440p", 2560, 1440 },
+        { "2160p", 3840, 2160 },
+    };
+
+    std::printf("%-6s %-7s %-5s %10s %10s %8s\n", "Çözün.", "Kernel", "Biçim", "GB/s", "ms/kare", "hız");
+    for (const auto& resolution : resolutions) {
+        Frame frame = MakeFrame(resolution.width, resolution.height, 0, 42);
+        double bytes = static_cast<double>(frame.stride) * frame.height;
+
+        for (bool nv12 : { false, true }) {
+            double scalarSeconds = 0.0;
+            for (YuvKernel kernel : kKernels) {
+                if (!YuvKernelSupported(kernel)) {
+                    continue;
+                }
+                // Skaler yol çok yavaş olduğu için daha az kareyle ölçülür
+                int count = kernel == YuvKernel::Scalar ? (frames + 3) / 4 : frames;
+                double seconds = MeasureSeconds(frame, nv12, kernel, count) / count;
+                if (kernel == YuvKernel::Scalar) {
+                    scalarSeconds = seconds;
+                }
+                std::printf("%-6s %-7s %-5s %10.2f %10.3f %7.1fx\n", resolution.name, YuvKernelName(kernel),
+                            nv12 ? "NV12" : "I420", bytes / seconds / 1e9, seconds * 1e3,
+                            scalarSeconds / seconds);
+            }
+        }
+    }
+
+    return 0;
+}
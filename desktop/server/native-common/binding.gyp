@@ -0,0 +1,55 @@
+{
+  "targets": [
+    {
+      "target_name": "yuv_convert",
+      "type": "static_library",
+      "sources": [
+        "yuv_convert.cc",
+        "yuv_convert_sse2.cc",
+        "yuv_convert_neon.cc"
+      ],
+      "direct_dependent_settings": {
+        "include_dirs": [ "." ]
+      },
+      "conditions": [
+        ["target_arch=='x64' or target_arch=='ia32'", {
+          "defines": [ "YUV_CONVERT_AVX2" ],
+          "dependencies": [ "yuv_convert_avx2" ]
+        }]
+      ]
+    },
+    {
+      "target_name": "yuv_convert_avx2",
+      "type": "static_library",
+      "sources": [ "yuv_convert_avx2.cc" ],
+      "conditions": [
+        ["target_arch=='x64' or target_arch=='ia32'", {
+          "cflags": [ "-mavx2" ],
+          "xcode_settings": {
+            "OTHER_CFLAGS": [ "-mavx2" ]
+          },
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "EnableEnhancedInstructionSet": "5"
+            }
+          }
+        }]
+      ]
+    },
+    {
+      "target_name": "yuv_convert_bench",
+      "type": "executable",
+      "sources": [ "bench/yuv_convert_bench.cc" ],
+      "dependencies": [ "yuv_convert" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ]
+    },
+    {
+      "target_name": "image_resize_test",
+      "type": "executable",
+      "sources": [ "test/image_resize_test.cc", "image_resize.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ]
+    }
+  ]
+}
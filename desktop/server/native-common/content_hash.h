@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// İçerik özeti (64 bit FNV-1a)
+// Kriptografik değildir; önbellek anahtarı ve HTTP ETag için kullanılır.
+inline uint64_t ContentHash(const uint8_t* data, size_t size, uint64_t seed = 14695981039346656037ULL) {
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// 8 baytlık kelimelerle çalışan hızlı değişken (büyük ham bitmap'ler için,
+// bayt bayt FNV'den ~8 kat hızlı). ContentHash ile aynı değeri üretmez.
+inline uint64_t ContentHashWords(const uint8_t* data, size_t size, uint64_t seed = 14695981039346656037ULL) {
+    uint64_t hash = seed;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 29;
+    }
+    return ContentHash(data + i, size - i, hash);
+}
+
+// 16 haneli küçük harf hex (ETag / URL için)
+inline std::string HashToHex(uint64_t hash) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; i--) {
+        hex[i] = digits[hash & 0xF];
+        hash >>= 4;
+    }
+    return hex;
+}
@@ -0,0 +1,204 @@
+#include "image_codec.h"
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <jpeglib.h>
+#include <png.h>
+
+namespace {
+
+// libjpeg hataları longjmp ile çağırana döner (varsayılan davranış exit())
+struct JpegError {
+    jpeg_error_mgr manager;
+    jmp_buf jump;
+    char message[JMSG_LENGTH_MAX];
+};
+
+void JpegErrorExit(j_common_ptr info) {
+    JpegError* error = reinterpret_cast<JpegError*>(info->err);
+    (*info->err->format_message)(info, error->message);
+    longjmp(error->jump, 1);
+}
+
+bool SizeAllowed(unsigned width, unsigned height, std::string& error) {
+    if (width == 0 || height == 0 || width > kMaxImageSide || height > kMaxImageSide) {
+        error = "Görüntü boyutu desteklenmiyor (" + std::to_string(width) + "x" + std::to_string(height) +
+                ", en fazla " + std::to_string(kMaxImageSide) + ")";
+        return false;
+    }
+    return true;
+}
+
+bool IsJpeg(const uint8_t* data, size_t size) {
+    return size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+}
+
+bool IsPng(const uint8_t* data, size_t size) {
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    return size >= 8 && std::memcmp(data, signature, 8) == 0;
+}
+
+bool DecodeJpeg(const uint8_t* data, size_t size, ImageRGBA& image, std::string& error, int minSize) {
+    jpeg_decompress_struct info;
+    JpegError jerr;
+    info.err = jpeg_std_error(&jerr.manager);
+    jerr.manager.error_exit = JpegErrorExit;
+
+    if (setjmp(jerr.jump)) {
+        error = jerr.message;
+        jpeg_destroy_decompress(&info);
+        return false;
+    }
+
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, data, static_cast<unsigned long>(size));
+    jpeg_read_header(&info, TRUE);
+    if (!SizeAllowed(info.image_width, info.image_height, error)) {
+        jpeg_destroy_decompress(&info);
+        return false;
+    }
+
+    // libjpeg-turbo doğrudan RGBA üretir
+    info.out_color_space = JCS_EXT_RGBA;
+
+    // Hedef boyuttan küçük düşmeyecek en küçük DCT ölçeği
+    if (minSize > 0) {
+        for (unsigned denom = 8; denom > 1; denom /= 2) {
+            if (info.image_width / denom >= static_cast<unsigned>(minSize) &&
+                info.image_height / denom >= static_cast<unsigned>(minSize)) {
+                info.scale_num = 1;
+                info.scale_denom = denom;
+                break;
+            }
+        }
+    }
+
+    // Ölçekli çıktı da sınırın içinde kalmalı (ayrılacak bellek bundan hesaplanır)
+    jpeg_calc_output_dimensions(&info);
+    if (!SizeAllowed(info.output_width, info.output_height, error)) {
+        jpeg_destroy_decompress(&info);
+        return false;
+    }
+
+    jpeg_start_decompress(&info);
+
+    image.width = static_cast<int>(info.output_width);
+    image.height = static_cast<int>(info.output_height);
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+
+    while (info.output_scanline < info.output_height) {
+        JSAMPROW row = image.pixels.data() + static_cast<size_t>(info.output_scanline) * image.width * 4;
+        jpeg_read_scanlines(&info, &row, 1);
+    }
+
+    jpeg_finish_decompress(&info);
+    jpeg_destroy_decompress(&info);
+    return true;
+}
+
+bool DecodePng(const uint8_t* data, size_t size, ImageRGBA& image, std::string& error) {
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_memory(&png, data, size)) {
+        error = png.message;
+        return false;
+    }
+    if (!SizeAllowed(png.width, png.height, error)) {
+        png_image_free(&png);
+        return false;
+    }
+
+    png.format = PNG_FORMAT_RGBA;
+    image.width = static_cast<int>(png.width);
+    image.height = static_cast<int>(png.height);
+    image.pixels.resize(PNG_IMAGE_SIZE(png));
+
+    if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr)) {
+        error = png.message;
+        png_image_free(&png);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool DecodeImage(const uint8_t* data, size_t size, ImageRGBA& image, std::string& error, int minSize) {
+    if (IsJpeg(data, size)) {
+        return DecodeJpeg(data, size, image, error, minSize);
+    }
+    if (IsPng(data, size)) {
+        return DecodePng(data, size, image, error);
+    }
+    error = "Desteklenmeyen görüntü biçimi (JPEG/PNG bekleniyor)";
+    return false;
+}
+
+bool EncodeJpeg(const ImageRGBA& image, int quality, std::vector<uint8_t>& output, std::string& error) {
+    jpeg_compress_struct info;
+    JpegError jerr;
+    info.err = jpeg_std_error(&jerr.manager);
+    jerr.manager.error_exit = JpegErrorExit;
+
+    unsigned char* buffer = nullptr;
+    unsigned long bufferSize = 0;
+
+    if (setjmp(jerr.jump)) {
+        error = jerr.message;
+        jpeg_destroy_compress(&info);
+        free(buffer);
+        return false;
+    }
+
+    jpeg_create_compress(&info);
+    jpeg_mem_dest(&info, &buffer, &bufferSize);
+
+    info.image_width = static_cast<JDIMENSION>(image.width);
+    info.image_height = static_cast<JDIMENSION>(image.height);
+    info.input_components = 4;
+    info.in_color_space = JCS_EXT_RGBA; // Alfa kanalı atlanır
+    jpeg_set_defaults(&info);
+    jpeg_set_quality(&info, quality, TRUE);
+    info.optimize_coding = TRUE;
+
+    jpeg_start_compress(&info, TRUE);
+    while (info.next_scanline < info.image_height) {
+        JSAMPROW row = const_cast<uint8_t*>(image.pixels.data()) + static_cast<size_t>(info.next_scanline) * image.width * 4;
+        jpeg_write_scanlines(&info, &row, 1);
+    }
+    jpeg_finish_compress(&info);
+
+    output.assign(buffer, buffer + bufferSize);
+    jpeg_destroy_compress(&info);
+    free(buffer);
+    return true;
+}
+
+bool EncodePng(const ImageRGBA& image, std::vector<uint8_t>& output, std::string& error) {
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = static_cast<png_uint_32>(image.width);
+    png.height = static_cast<png_uint_32>(image.height);
+    png.format = PNG_FORMAT_RGBA;
+
+    // İlk çağrı sadece gereken boyutu hesaplar
+    png_alloc_size_t size = 0;
+    if (!png_image_write_to_memory(&png, nullptr, &size, 0, image.pixels.data(), 0, nullptr)) {
+        error = png.message;
+        return false;
+    }
+
+    output.resize(size);
+    if (!png_image_write_to_memory(&png, output.data(), &size, 0, image.pixels.data(), 0, nullptr)) {
+        error = png.message;
+        return false;
+    }
+    output.resize(size);
+    return true;
+}
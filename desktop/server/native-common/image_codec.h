@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "image_resize.h"
+
+// JPEG / PNG çözme, JPEG ve PNG kodlama
+// Linux: libjpeg-turbo + libpng (image_codec.cc), Windows: WIC (image_codec_win.cc)
+// Çözülen görüntü her zaman RGBA'dır; JPEG'e kodlarken alfa atılır, PNG'de korunur.
+
+// Başlığında bundan uzun kenar bildiren görüntü, piksel belleği ayrılmadan
+// reddedilir: birkaç yüz KB'lık bir PNG 30000x30000 bildirip GB'larca bellek
+// isteyebilir (kapak resmi adresi oynatıcıdan / web sayfasından gelir)
+constexpr unsigned kMaxImageSide = 8192;
+
+// minSize > 0 ise JPEG, her iki kenarı minSize'dan küçük olmayacak en küçük DCT
+// ölçeğinde (1/2, 1/4, 1/8) çözülür; büyük kapak resimlerinde çözme maliyeti düşer.
+bool DecodeImage(const uint8_t* data, size_t size, ImageRGBA& image, std::string& error, int minSize = 0);
+
+bool EncodeJpeg(const ImageRGBA& image, int quality, std::vector<uint8_t>& output, std::string& error);
+
+// Alfa kanallı çıktı (ikon atlası); kayıpsız, varsayılan zlib seviyesi
+bool EncodePng(const ImageRGBA& image, std::vector<uint8_t>& output, std::string& error);
@@ -0,0 +1,227 @@
+#include "image_codec.h"
+
+#include <utility>
+
+#include <windows.h>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+// Windows: aynı arayüz Windows Imaging Component (WIC) ile
+// (libjpeg-turbo / libpng yerine, ek bağımlılık yok). minSize kullanılmaz;
+// çözülen görüntü her zaman tam boyuttadır.
+
+using Microsoft::WRL::ComPtr;
+
+namespace {
+
+// COM'u çağıran thread için başlat. Electron ana thread'i zaten STA ise
+// RPC_E_CHANGED_MODE döner, sorun değil (COM kullanılabilir durumdadır).
+class ComScope {
+public:
+    ComScope() : hr_(CoInitializeEx(NULL, COINIT_APARTMENTTHREADED)) {}
+    ~ComScope() {
+        if (SUCCEEDED(hr_)) {
+            CoUninitialize();
+        }
+    }
+    bool Ok() const { return SUCCEEDED(hr_) || hr_ == RPC_E_CHANGED_MODE; }
+
+private:
+    HRESULT hr_;
+};
+
+bool CreateFactory(ComPtr<IWICImagingFactory>& factory, std::string& error) {
+    HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, NULL, CLSCTX_INPROC_SERVER,
+                                  IID_PPV_ARGS(&factory));
+    if (FAILED(hr)) {
+        error = "WIC fabrikası oluşturulamadı";
+        return false;
+    }
+    return true;
+}
+
+// Kodlayıcının yazdığı bellek akışı -> bayt dizisi
+bool ReadStream(IStream* stream, std::vector<uint8_t>& output, std::string& error) {
+    // Akışın gerçek uzunluğu (HGLOBAL bloğu daha büyük ayrılmış olabilir)
+    STATSTG stat = {};
+    HGLOBAL memory = NULL;
+    if (FAILED(stream->Stat(&stat, STATFLAG_NONAME)) || FAILED(GetHGlobalFromStream(stream, &memory))) {
+        error = "Kodlanmış çıktı okunamadı";
+        return false;
+    }
+
+    const void* bytes = GlobalLock(memory);
+    if (!bytes) {
+        error = "Kodlanmış çıktı okunamadı";
+        return false;
+    }
+    size_t length = static_cast<size_t>(stat.cbSize.QuadPart);
+    output.assign(static_cast<const uint8_t*>(bytes), static_cast<const uint8_t*>(bytes) + length);
+    GlobalUnlock(memory);
+    return true;
+}
+
+} // namespace
+
+bool DecodeImage(const uint8_t* data, size_t size, ImageRGBA& image, std::string& error, int) {
+    if (!data || size == 0 || size > MAXDWORD) {
+        error = "Görüntü verisi geçersiz";
+        return false;
+    }
+
+    ComScope com;
+    if (!com.Ok()) {
+        error = "COM başlatılamadı";
+        return false;
+    }
+    ComPtr<IWICImagingFactory> factory;
+    if (!CreateFactory(factory, error)) {
+        return false;
+    }
+
+    ComPtr<IWICStream> stream;
+    ComPtr<IWICBitmapDecoder> decoder;
+    ComPtr<IWICBitmapFrameDecode> frame;
+    ComPtr<IWICFormatConverter> converter;
+    if (FAILED(factory->CreateStream(&stream)) ||
+        FAILED(stream->InitializeFromMemory(const_cast<BYTE*>(data), static_cast<DWORD>(size))) ||
+        FAILED(factory->CreateDecoderFromStream(stream.Get(), NULL, WICDecodeMetadataCacheOnDemand, &decoder)) ||
+        FAILED(decoder->GetFrame(0, &frame))) {
+        error = "Desteklenmeyen görüntü biçimi";
+        return false;
+    }
+
+    // Boyut başlıktan okunur; piksel belleği ayrılmadan önce sınır (bkz. image_codec.h)
+    UINT width = 0;
+    UINT height = 0;
+    if (FAILED(frame->GetSize(&width, &height)) || width == 0 || height == 0 ||
+        width > kMaxImageSide || height > kMaxImageSide) {
+        error = "Görüntü boyutu desteklenmiyor (" + std::to_string(width) + "x" + std::to_string(height) +
+                ", en fazla " + std::to_string(kMaxImageSide) + ")";
+        return false;
+    }
+
+    if (FAILED(factory->CreateFormatConverter(&converter)) ||
+        FAILED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone,
+                                     NULL, 0.0, WICBitmapPaletteTypeCustom)) ||
+        FAILED(converter->GetSize(&width, &height)) || width == 0 || height == 0) {
+        error = "Görüntü RGBA'ya dönüştürülemedi";
+        return false;
+    }
+
+    image.width = static_cast<int>(width);
+    image.height = static_cast<int>(height);
+    image.pixels.resize(static_cast<size_t>(width) * height * 4);
+    if (FAILED(converter->CopyPixels(NULL, width * 4, static_cast<UINT>(image.pixels.size()),
+                                     image.pixels.data()))) {
+        error = "Görüntü çözülemedi";
+        return false;
+    }
+    return true;
+}
+
+bool EncodeJpeg(const ImageRGBA& image, int quality, std::vector<uint8_t>& output, std::string& error) {
+    if (image.width <= 0 || image.height <= 0 ||
+        image.pixels.size() < static_cast<size_t>(image.width) * image.height * 4) {
+        error = "Kodlanacak görüntü geçersiz";
+        return false;
+    }
+
+    ComScope com;
+    if (!com.Ok()) {
+        error = "COM başlatılamadı";
+        return false;
+    }
+    ComPtr<IWICImagingFactory> factory;
+    if (!CreateFactory(factory, error)) {
+        return false;
+    }
+
+    // WIC JPEG kodlayıcısı 24 bit BGR bekler; alfa atılır
+    UINT stride = static_cast<UINT>(image.width) * 3;
+    std::vector<uint8_t> bgr(static_cast<size_t>(stride) * image.height);
+    const uint8_t* source = image.pixels.data();
+    for (size_t i = 0, count = static_cast<size_t>(image.width) * image.height; i < count; i++) {
+        bgr[i * 3] = source[i * 4 + 2];
+        bgr[i * 3 + 1] = source[i * 4 + 1];
+        bgr[i * 3 + 2] = source[i * 4];
+    }
+
+    ComPtr<IStream> stream;
+    ComPtr<IWICBitmapEncoder> encoder;
+    ComPtr<IWICBitmapFrameEncode> frame;
+    ComPtr<IPropertyBag2> options;
+    if (FAILED(CreateStreamOnHGlobal(NULL, TRUE, &stream)) ||
+        FAILED(factory->CreateEncoder(GUID_ContainerFormatJpeg, NULL, &encoder)) ||
+        FAILED(encoder->Initialize(stream.Get(), WICBitmapEncoderNoCache)) ||
+        FAILED(encoder->CreateNewFrame(&frame, &options))) {
+        error = "JPEG kodlayıcı oluşturulamadı";
+        return false;
+    }
+
+    PROPBAG2 option = {};
+    option.pstrName = const_cast<LPOLESTR>(L"ImageQuality");
+    VARIANT value;
+    VariantInit(&value);
+    value.vt = VT_R4;
+    value.fltVal = static_cast<float>(quality < 1 ? 1 : (quality > 100 ? 100 : quality)) / 100.0f;
+    options->Write(1, &option, &value);
+
+    WICPixelFormatGUID format = GUID_WICPixelFormat24bppBGR;
+    if (FAILED(frame->Initialize(options.Get())) ||
+        FAILED(frame->SetSize(static_cast<UINT>(image.width), static_cast<UINT>(image.height))) ||
+        FAILED(frame->SetPixelFormat(&format)) || format != GUID_WICPixelFormat24bppBGR ||
+        FAILED(frame->WritePixels(static_cast<UINT>(image.height), stride, static_cast<UINT>(bgr.size()),
+                                  bgr.data())) ||
+        FAILED(frame->Commit()) || FAILED(encoder->Commit())) {
+        error = "JPEG kodlanamadı";
+        return false;
+    }
+
+    return ReadStream(stream.Get(), output, error);
+}
+
+bool EncodePng(const ImageRGBA& image, std::vector<uint8_t>& output, std::string& error) {
+    if (image.width <= 0 || image.height <= 0 ||
+        image.pixels.size() < static_cast<size_t>(image.width) * image.height * 4) {
+        error = "Kodlanacak görüntü geçersiz";
+        return false;
+    }
+
+    ComScope com;
+    if (!com.Ok()) {
+        error = "COM başlatılamadı";
+        return false;
+    }
+    ComPtr<IWICImagingFactory> factory;
+    if (!CreateFactory(factory, error)) {
+        return false;
+    }
+
+    // WIC PNG kodlayıcısının her Windows sürümünde desteklediği biçim 32 bit BGRA
+    UINT stride = static_cast<UINT>(image.width) * 4;
+    std::vector<uint8_t> bgra(image.pixels.begin(), image.pixels.begin() + static_cast<size_t>(stride) * image.height);
+    for (size_t i = 0; i < bgra.size(); i += 4) {
+        std::swap(bgra[i], bgra[i + 2]);
+    }
+
+    ComPtr<IStream> stream;
+    ComPtr<IWICBitmapEncoder> encoder;
+    ComPtr<IWICBitmapFrameEncode> frame;
+    WICPixelFormatGUID format = GUID_WICPixelFormat32bppBGRA;
+    if (FAILED(CreateStreamOnHGlobal(NULL, TRUE, &stream)) ||
+        FAILED(factory->CreateEncoder(GUID_ContainerFormatPng, NULL, &encoder)) ||
+        FAILED(encoder->Initialize(stream.Get(), WICBitmapEncoderNoCache)) ||
+        FAILED(encoder->CreateNewFrame(&frame, NULL)) ||
+        FAILED(frame->Initialize(NULL)) ||
+        FAILED(frame->SetSize(static_cast<UINT>(image.width), static_cast<UINT>(image.height))) ||
+        FAILED(frame->SetPixelFormat(&format)) || format != GUID_WICPixelFormat32bppBGRA ||
+        FAILED(frame->WritePixels(static_cast<UINT>(image.height), stride, static_cast<UINT>(bgra.size()),
+                                  bgra.data())) ||
+        FAILED(frame->Commit()) || FAILED(encoder->Commit())) {
+        error = "PNG kodlanamadı";
+        return false;
+    }
+
+    return ReadStream(stream.Get(), output, error);
+}
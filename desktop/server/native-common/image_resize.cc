@@ -0,0 +1,253 @@
+#include "image_resize.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_RESIZE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IMAGE_RESIZE_NEON 1
+#endif
+
+namespace {
+
+// Bir hedef pikselin kaynak aralığı ve ağırlıkları (toplamı 1)
+struct Contribution {
+    int first = 0;
+    std::vector<float> weights;
+};
+
+std::vector<Contribution> Contributions(int sourceSize, int targetSize) {
+    std::vector<Contribution> result(targetSize);
+    double scale = static_cast<double>(sourceSize) / targetSize;
+
+    for (int i = 0; i < targetSize; i++) {
+        double start = i * scale;
+        double end = std::min(static_cast<double>(sourceSize), (i + 1) * scale);
+        int first = static_cast<int>(start);
+        int last = std::min(sourceSize - 1, static_cast<int>(std::ceil(end)) - 1);
+
+        Contribution& contribution = result[i];
+        contribution.first = first;
+        for (int s = first; s <= last; s++) {
+            double overlap = std::min(end, s + 1.0) - std::max(start, static_cast<double>(s));
+            contribution.weights.push_back(static_cast<float>(overlap / scale));
+        }
+    }
+    return result;
+}
+
+inline uint8_t ToByte(float value) {
+    int rounded = static_cast<int>(value + 0.5f);
+    return static_cast<uint8_t>(rounded < 0 ? 0 : (rounded > 255 ? 255 : rounded));
+}
+
+bool ValidSizes(const ImageRGBA& source, int width, int height) {
+    return width > 0 && height > 0 && width <= source.width && height <= source.height &&
+        source.pixels.size() >= static_cast<size_t>(source.width) * source.height * 4;
+}
+
+// Yatay geçiş (skaler): kaynak satır -> hedef genişliğinde float RGBA
+void HorizontalScalar(const uint8_t* row, const std::vector<Contribution>& columns, float* out) {
+    for (const Contribution& column : columns) {
+        float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        const uint8_t* pixel = row + column.first * 4;
+        for (float weight : column.weights) {
+            for (int c = 0; c < 4; c++) {
+                sum[c] += pixel[c] * weight;
+            }
+            pixel += 4;
+        }
+        for (int c = 0; c < 4; c++) {
+            *out++ = sum[c];
+        }
+    }
+}
+
+// Dikey geçiş (skaler): ağırlıklı float satırlar -> 8 bit hedef satır
+void VerticalScalar(const float* rows, size_t stride, const Contribution& row, size_t count, uint8_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        float sum = 0.0f;
+        const float* value = rows + row.first * stride + i;
+        for (float weight : row.weights) {
+            sum += *value * weight;
+            value += stride;
+        }
+        out[i] = ToByte(sum);
+    }
+}
+
+#if defined(IMAGE_RESIZE_SSE2)
+
+// Bir RGBA pikseli (4 bayt) -> 4 float
+inline __m128 LoadPixel(const uint8_t* pixel) {
+    // memcpy: uint8_t tamponu int32_t olarak okumak strict aliasing ihlali olur
+    int32_t value;
+    std::memcpy(&value, pixel, sizeof(value));
+    __m128i zero = _mm_setzero_si128();
+    __m128i bytes = _mm_cvtsi32_si128(value);
+    __m128i words = _mm_unpacklo_epi8(bytes, zero);
+    return _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+}
+
+void HorizontalSimd(const uint8_t* row, const std::vector<Contribution>& columns, float* out) {
+    for (const Contribution& column : columns) {
+        __m128 sum = _mm_setzero_ps();
+        const uint8_t* pixel = row + column.first * 4;
+        for (float weight : column.weights) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(LoadPixel(pixel), _mm_set1_ps(weight)));
+            pixel += 4;
+        }
+        _mm_storeu_ps(out, sum);
+        out += 4;
+    }
+}
+
+void VerticalSimd(const float* rows, size_t stride, const Contribution& row, size_t count, uint8_t* out) {
+    size_t i = 0;
+    // 16 kanal (4 piksel) birden: 4 float vektör -> 16 bayt
+    for (; i + 16 <= count; i += 16) {
+        __m128 sum0 = _mm_setzero_ps();
+        __m128 sum1 = _mm_setzero_ps();
+        __m128 sum2 = _mm_setzero_ps();
+        __m128 sum3 = _mm_setzero_ps();
+        const float* value = rows + row.first * stride + i;
+        for (float w : row.weights) {
+            __m128 weight = _mm_set1_ps(w);
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(value), weight));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(value + 4), weight));
+            sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(value + 8), weight));
+            sum3 = _mm_add_ps(sum3, _mm_mul_ps(_mm_loadu_ps(value + 12), weight));
+            value += stride;
+        }
+
+        // +0.5 ile kesme = skaler ToByte ile aynı yuvarlama; packus doygunlukla sınırlar
+        __m128 half = _mm_set1_ps(0.5f);
+        __m128i a = _mm_cvttps_epi32(_mm_add_ps(sum0, half));
+        __m128i b = _mm_cvttps_epi32(_mm_add_ps(sum1, half));
+        __m128i c = _mm_cvttps_epi32(_mm_add_ps(sum2, half));
+        __m128i d = _mm_cvttps_epi32(_mm_add_ps(sum3, half));
+        __m128i words0 = _mm_packs_epi32(a, b);
+        __m128i words1 = _mm_packs_epi32(c, d);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(words0, words1));
+    }
+
+    if (i < count) {
+        VerticalScalar(rows + i, stride, row, count - i, out + i);
+    }
+}
+
+#elif defined(IMAGE_RESIZE_NEON)
+
+inline float32x4_t LoadPixel(const uint8_t* pixel) {
+    uint32_t value;
+    std::memcpy(&value, pixel, sizeof(value));
+    uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(value));
+    uint16x4_t words = vget_low_u16(vmovl_u8(bytes));
+    return vcvtq_f32_u32(vmovl_u16(words));
+}
+
+void HorizontalSimd(const uint8_t* row, const std::vector<Contribution>& columns, float* out) {
+    for (const Contribution& column : columns) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        const uint8_t* pixel = row + column.first * 4;
+        for (float weight : column.weights) {
+            sum = vmlaq_n_f32(sum, LoadPixel(pixel), weight);
+            pixel += 4;
+        }
+        vst1q_f32(out, sum);
+        out += 4;
+    }
+}
+
+void VerticalSimd(const float* rows, size_t stride, const Contribution& row, size_t count, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float32x4_t sum0 = vdupq_n_f32(0.0f);
+        float32x4_t sum1 = vdupq_n_f32(0.0f);
+        const float* value = rows + row.first * stride + i;
+        for (float weight : row.weights) {
+            sum0 = vmlaq_n_f32(sum0, vld1q_f32(value), weight);
+            sum1 = vmlaq_n_f32(sum1, vld1q_f32(value + 4), weight);
+            value += stride;
+        }
+
+        float32x4_t half = vdupq_n_f32(0.5f);
+        uint32x4_t a = vcvtq_u32_f32(vaddq_f32(sum0, half));
+        uint32x4_t b = vcvtq_u32_f32(vaddq_f32(sum1, half));
+        uint16x8_t words = vcombine_u16(vqmovn_u32(a), vqmovn_u32(b));
+        vst1_u8(out + i, vqmovn_u16(words));
+    }
+
+    if (i < count) {
+        VerticalScalar(rows + i, stride, row, count - i, out + i);
+    }
+}
+
+#else
+
+void HorizontalSimd(const uint8_t* row, const std::vector<Contribution>& columns, float* out) {
+    HorizontalScalar(row, columns, out);
+}
+
+void VerticalSimd(const float* rows, size_t stride, const Contribution& row, size_t count, uint8_t* out) {
+    VerticalScalar(rows, stride, row, count, out);
+}
+
+#endif
+
+template <typename Horizontal, typename Vertical>
+bool Resize(const ImageRGBA& source, int width, int height, ImageRGBA& result,
+            Horizontal horizontal, Vertical vertical) {
+    if (!ValidSizes(source, width, height)) {
+        return false;
+    }
+
+    std::vector<Contribution> columns = Contributions(source.width, width);
+    std::vector<Contribution> rows = Contributions(source.height, height);
+
+    // Yatay geçiş: her kaynak satırı hedef genişliğine indir
+    size_t stride = static_cast<size_t>(width) * 4;
+    std::vector<float> intermediate(stride * source.height);
+    for (int y = 0; y < source.height; y++) {
+        horizontal(source.pixels.data() + static_cast<size_t>(y) * source.width * 4, columns, intermediate.data() + y * stride);
+    }
+
+    // Dikey geçiş
+    result.width = width;
+    result.height = height;
+    result.pixels.resize(stride * height);
+    for (int y = 0; y < height; y++) {
+        vertical(intermediate.data(), stride, rows[y], stride, result.pixels.data() + y * stride);
+    }
+    return true;
+}
+
+} // namespace
+
+bool ResizeArea(const ImageRGBA& source, int width, int height, ImageRGBA& result) {
+    return Resize(source, width, height, result, HorizontalSimd, VerticalSimd);
+}
+
+bool ResizeAreaScalar(const ImageRGBA& source, int width, int height, ImageRGBA& result) {
+    return Resize(source, width, height, result, HorizontalScalar, VerticalScalar);
+}
+
+void FitWithin(int width, int height, int size, int& fitWidth, int& fitHeight) {
+    if (width <= size && height <= size) {
+        fitWidth = width;
+        fitHeight = height;
+        return;
+    }
+
+    if (width >= height) {
+        fitWidth = size;
+        fitHeight = std::max(1, static_cast<int>(static_cast<int64_t>(height) * size / width));
+    } else {
+        fitHeight = size;
+        fitWidth = std::max(1, static_cast<int>(static_cast<int64_t>(width) * size / height));
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 8 bit RGBA görüntü (satırlar arası boşluk yok)
+struct ImageRGBA {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+// Alan ortalamalı (box) küçültme: her hedef piksel, kapladığı kaynak alanın
+// ağırlıklı ortalamasıdır (kenarlarda kısmi piksel ağırlığı). Ayrılabilir iki
+// geçiş: yatay geçiş float ara tampona, dikey geçiş 8 bit çıktıya yazar.
+// x86'da SSE2, ARM'da NEON ile bir RGBA pikseli tek vektörde işlenir.
+// Sadece küçültme içindir; hedef kaynaktan büyükse false döner.
+bool ResizeArea(const ImageRGBA& source, int width, int height, ImageRGBA& result);
+
+// Aynı algoritmanın skaler referansı (SIMD doğrulaması: test/image_resize_test.cc)
+bool ResizeAreaScalar(const ImageRGBA& source, int width, int height, ImageRGBA& result);
+
+// En-boy oranını koruyarak size x size kutusuna sığdır (büyütmez)
+void FitWithin(int width, int height, int size, int& fitWidth, int& fitHeight);
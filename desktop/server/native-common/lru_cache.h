@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+// Bayt bütçeli LRU önbellek
+// Her girdi kendi boyutunu bildirir; toplam bütçeyi aşınca en eski kullanılan
+// girdiler atılır. Thread-safe değildir, sahibi kilitler.
+template <typename Key, typename Value>
+class LruCache {
+public:
+    explicit LruCache(size_t budget) : budget_(budget) {}
+
+    // Bulunursa en yeni kullanılan yapılır
+    const Value* Find(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return &it->second->value;
+    }
+
+    void Put(const Key& key, Value value, size_t size) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            used_ -= it->second->size;
+            entries_.erase(it->second);
+            index_.erase(it);
+        }
+
+        entries_.push_front({ key, std::move(value), size });
+        index_[key] = entries_.begin();
+        used_ += size;
+
+        // Yeni girdi tek başına bütçeyi aşsa bile tutulur
+        while (used_ > budget_ && entries_.size() > 1) {
+            Entry& oldest = entries_.back();
+            used_ -= oldest.size;
+            index_.erase(oldest.key);
+            entries_.pop_back();
+        }
+    }
+
+    bool Erase(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        used_ -= it->second->size;
+        entries_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    size_t Size() const { return entries_.size(); }
+    size_t Bytes() const { return used_; }
+
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t size;
+    };
+
+    size_t budget_;
+    size_t used_ = 0;
+    std::list<Entry> entries_;
+    std::unordered_map<Key, typename std::list<Entry>::iterator> index_;
+};
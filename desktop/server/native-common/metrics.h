@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Addon içi çağrı metrikleri (getStats / sunucudaki /metrics)
+// Her API için çağrı ve hata sayısı ile log-lineer (HDR benzeri) bir gecikme
+// histogramı tutulur. Kayıt kilitsizdir: her thread kendi parçasına (shard)
+// relaxed atomic ile yazar, parçalar sadece Snapshot'ta birleştirilir. Kayıt
+// maliyeti iki steady_clock okuması ve birkaç atomic eklemedir.
+
+namespace metrics {
+
+// Histogram: 2^kSubBits alt kova ile ~%12 çözünürlük, 8 ns - ~137 s aralığı
+constexpr uint32_t kSubBits = 3;
+constexpr uint32_t kSubCount = 1u << kSubBits;
+constexpr uint32_t kMaxExponent = 36;
+constexpr uint32_t kBucketCount = (kMaxExponent - kSubBits + 2) * kSubCount;
+
+// Aynı anda yazan thread sayısından az olursa parçalar paylaşılır (yine kilitsiz)
+constexpr uint32_t kShardCount = 4;
+
+// En yüksek bit (ns != 0)
+inline uint32_t HighestBit(uint64_t ns) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, ns);
+    return static_cast<uint32_t>(index);
+#else
+    return 63 - static_cast<uint32_t>(__builtin_clzll(ns));
+#endif
+}
+
+inline uint32_t BucketOf(uint64_t ns) {
+    if (ns < kSubCount) {
+        return static_cast<uint32_t>(ns);
+    }
+    uint32_t exponent = HighestBit(ns);
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+    uint32_t sub = static_cast<uint32_t>(ns >> (exponent - kSubBits)) & (kSubCount - 1);
+    return (exponent - kSubBits + 1) * kSubCount + sub;
+}
+
+// Kovanın üst sınırı (ns); yüzdelikler bu değerle raporlanır
+inline uint64_t BucketUpperBound(uint32_t bucket) {
+    if (bucket < kSubCount) {
+        return bucket;
+    }
+    uint32_t exponent = bucket / kSubCount - 1 + kSubBits;
+    uint64_t sub = bucket % kSubCount;
+    return ((kSubCount + sub + 1) << (exponent - kSubBits)) - 1;
+}
+
+using Clock = std::chrono::steady_clock;
+
+// Başlangıç ile farklı thread'lerde biten ölçümler için (Scope kullanılamayan yerler)
+inline uint64_t ElapsedNs(Clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+// Thread'in parçası (ilk kullanımda sırayla atanır)
+inline uint32_t ShardIndex() {
+    static std::atomic<uint32_t> next{0};
+    thread_local uint32_t index = next.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+    return index;
+}
+
+struct Summary {
+    const char* name;
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+    double sumUs = 0;
+    double p50Us = 0;
+    double p90Us = 0;
+    double p99Us = 0;
+    double p999Us = 0;
+    double maxUs = 0;
+};
+
+class Api {
+public:
+    explicit Api(const char* name) : name_(name) {}
+
+    Api(const Api&) = delete;
+    Api& operator=(const Api&) = delete;
+
+    void Record(uint64_t ns, bool error) {
+        Shard& shard = shards_[ShardIndex()];
+        shard.calls.fetch_add(1, std::memory_order_relaxed);
+        if (error) {
+            shard.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        shard.sumNs.fetch_add(ns, std::memory_order_relaxed);
+        shard.buckets[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t max = shard.maxNs.load(std::memory_order_relaxed);
+        while (ns > max && !shard.maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Parçaları birleştir; yazımlar sürerken de çağrılabilir (sayılar bir an geriden gelebilir)
+    Summary Snapshot() const {
+        Summary summary;
+        summary.name = name_;
+
+        std::array<uint64_t, kBucketCount> buckets{};
+        uint64_t sumNs = 0;
+        uint64_t maxNs = 0;
+        for (const Shard& shard : shards_) {
+            summary.calls += shard.calls.load(std::memory_order_relaxed);
+            summary.errors += shard.errors.load(std::memory_order_relaxed);
+            sumNs += shard.sumNs.load(std::memory_order_relaxed);
+            maxNs = std::max(maxNs, shard.maxNs.load(std::memory_order_relaxed));
+            for (uint32_t i = 0; i < kBucketCount; i++) {
+                buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        uint64_t total = 0;
+        for (uint64_t count : buckets) {
+            total += count;
+        }
+        summary.sumUs = static_cast<double>(sumNs) / 1000.0;
+        summary.maxUs = static_cast<double>(maxNs) / 1000.0;
+        if (total == 0) {
+            return summary;
+        }
+
+        // Tek geçişte dört yüzdelik; kova sınırı max'ı aşmasın
+        const double quantiles[] = { 0.50, 0.90, 0.99, 0.999 };
+        double* outputs[] = { &summary.p50Us, &summary.p90Us, &summary.p99Us, &summary.p999Us };
+        size_t next = 0;
+        uint64_t seen = 0;
+        for (uint32_t i = 0; i < kBucketCount && next < 4; i++) {
+            seen += buckets[i];
+            while (next < 4 && static_cast<double>(seen) >= quantiles[next] * static_cast<double>(total)) {
+                *outputs[next] = static_cast<double>(std::min(BucketUpperBound(i), maxNs)) / 1000.0;
+                next++;
+            }
+        }
+        return summary;
+    }
+
+    const char* Name() const { return name_; }
+
+private:
+    // Parçalar ayrı cache line'larda (false sharing yok)
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> sumNs{0};
+        std::atomic<uint64_t> maxNs{0};
+        std::atomic<uint64_t> buckets[kBucketCount] = {};
+    };
+
+    const char* name_;
+    Shard shards_[kShardCount];
+};
+
+// Addon'un API listesi
+// Add sadece modül yüklenirken çağrılır; dönen referans process boyunca geçerlidir.
+class Registry {
+public:
+    explicit Registry(const char* addon) : addon_(addon) {}
+
+    Api& Add(const char* name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        apis_.emplace_back(name);
+        return apis_.back();
+    }
+
+    std::vector<Summary> Snapshot() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<Summary> summaries;
+        summaries.reserve(apis_.size());
+        for (const Api& api : apis_) {
+            summaries.push_back(api.Snapshot());
+        }
+        return summaries;
+    }
+
+    const char* Addon() const { return addon_; }
+
+private:
+    const char* addon_;
+    std::mutex mutex_;
+    std::deque<Api> apis_; // Adresler sabit kalır
+};
+
+// Kapsam süresini api'ye yazar
+// Fail() çağrıldıysa çağrı hata sayılır.
+class Scope {
+public:
+    explicit Scope(Api& api) : api_(api), start_(Clock::now()) {}
+
+    ~Scope() {
+        api_.Record(ElapsedNs(start_), failed_);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    void Fail() { failed_ = true; }
+
+private:
+    Api& api_;
+    Clock::time_point start_;
+    bool failed_ = false;
+};
+
+} // namespace metrics
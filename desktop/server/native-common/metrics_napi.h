@@ -0,0 +1,70 @@
+#pragma once
+
+#include <napi.h>
+
+#include "metrics.h"
+
+// Metriklerin JS yüzü (getStats) ve ölçülen export'lar
+// Tüm addon'lar aynı şekli döndürür; sunucu /metrics çıktısını addon'dan
+// bağımsız üretir.
+
+namespace metrics {
+
+// { success: false } döndüren veya JS hatası fırlatan çağrı hata sayılır
+inline bool IsFailure(Napi::Env env, const Napi::Value& result) {
+    if (env.IsExceptionPending()) {
+        return true;
+    }
+    if (!result.IsObject() || result.IsArray()) {
+        return false;
+    }
+    Napi::Value success = result.As<Napi::Object>().Get("success");
+    return success.IsBoolean() && !success.As<Napi::Boolean>().Value();
+}
+
+// exports[name] = fn; her çağrının süresi ve sonucu registry'ye yazılır
+inline void Export(Napi::Env env, Napi::Object exports, Registry& registry, const char* name,
+                   Napi::Value (*fn)(const Napi::CallbackInfo&)) {
+    Api* api = &registry.Add(name);
+    exports.Set(Napi::String::New(env, name), Napi::Function::New(env, [api, fn](const Napi::CallbackInfo& info) {
+        Scope scope(*api);
+        try {
+            Napi::Value result = fn(info);
+            if (IsFailure(info.Env(), result)) {
+                scope.Fail();
+            }
+            return result;
+        } catch (...) {
+            scope.Fail();
+            throw;
+        }
+    }, name));
+}
+
+// { addon, apis: [{ name, calls, errors, sumUs, p50Us, p90Us, p99Us, p999Us, maxUs }] }
+inline Napi::Object StatsObject(Napi::Env env, Registry& registry) {
+    std::vector<Summary> summaries = registry.Snapshot();
+
+    Napi::Array apis = Napi::Array::New(env, summaries.size());
+    for (size_t i = 0; i < summaries.size(); i++) {
+        const Summary& summary = summaries[i];
+        Napi::Object entry = Napi::Object::New(env);
+        entry.Set("name", Napi::String::New(env, summary.name));
+        entry.Set("calls", Napi::Number::New(env, static_cast<double>(summary.calls)));
+        entry.Set("errors", Napi::Number::New(env, static_cast<double>(summary.errors)));
+        entry.Set("sumUs", Napi::Number::New(env, summary.sumUs));
+        entry.Set("p50Us", Napi::Number::New(env, summary.p50Us));
+        entry.Set("p90Us", Napi::Number::New(env, summary.p90Us));
+        entry.Set("p99Us", Napi::Number::New(env, summary.p99Us));
+        entry.Set("p999Us", Napi::Number::New(env, summary.p999Us));
+        entry.Set("maxUs", Napi::Number::New(env, summary.maxUs));
+        apis.Set(static_cast<uint32_t>(i), entry);
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("addon", Napi::String::New(env, registry.Addon()));
+    result.Set("apis", apis);
+    return result;
+}
+
+} // namespace metrics
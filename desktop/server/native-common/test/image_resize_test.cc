@@ -0,0 +1,73 @@
+// ResizeArea (SSE2 / NEON) ile ResizeAreaScalar çıktısı bayt bayt aynı olmalı
+// Tek sayılı kaynak / hedef boyutları kısmi piksel ağırlıklarını ve dikey
+// geçişin 16 kanallık SIMD döngüsünden artan skaler kuyruğu zorlar.
+//
+// Derleme: node-gyp rebuild (build/Release/image_resize_test)
+// Çalıştırma: ./build/Release/image_resize_test
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../image_resize.h"
+
+namespace {
+
+int failures = 0;
+
+void Check(bool ok, const std::string& what) {
+    std::printf("  %s %s\n", ok ? "ok  " : "HATA", what.c_str());
+    if (!ok) {
+        failures++;
+    }
+}
+
+// Tekrarlanabilir gürültü (xorshift32); düz renkler yuvarlama farkını gizlerdi
+ImageRGBA NoiseImage(int width, int height, uint32_t seed) {
+    ImageRGBA image;
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(static_cast<size_t>(width) * height * 4);
+    uint32_t state = seed;
+    for (uint8_t& value : image.pixels) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return image;
+}
+
+void CompareSizes(int sourceWidth, int sourceHeight, int width, int height) {
+    ImageRGBA source = NoiseImage(sourceWidth, sourceHeight, 0x9E3779B9u ^ (sourceWidth * 31 + sourceHeight));
+    ImageRGBA simd;
+    ImageRGBA scalar;
+    bool simdOk = ResizeArea(source, width, height, simd);
+    bool scalarOk = ResizeAreaScalar(source, width, height, scalar);
+
+    char line[96];
+    std::snprintf(line, sizeof(line), "%dx%d -> %dx%d aynı", sourceWidth, sourceHeight, width, height);
+    Check(simdOk && scalarOk && simd.width == width && simd.height == height &&
+          scalar.width == width && scalar.height == height && simd.pixels == scalar.pixels, line);
+}
+
+} // namespace
+
+int main() {
+    std::printf("ResizeArea / ResizeAreaScalar karşılaştırması\n");
+
+    CompareSizes(37, 23, 5, 3);
+    CompareSizes(101, 67, 33, 21);
+    CompareSizes(255, 129, 7, 127);
+    CompareSizes(641, 479, 317, 239);
+    CompareSizes(17, 9, 17, 9);  // Ölçeksiz
+    CompareSizes(3, 5, 1, 1);
+
+    ImageRGBA source = NoiseImage(9, 7, 1);
+    ImageRGBA result;
+    Check(!ResizeArea(source, 11, 7, result) && !ResizeAreaScalar(source, 11, 7, result),
+          "büyütme reddedilir");
+
+    std::printf("%s\n", failures == 0 ? "BAŞARILI" : "BAŞARISIZ");
+    return failures == 0 ? 0 : 1;
+}
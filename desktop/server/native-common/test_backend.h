@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Başsız ölçüm için test backend'leri (keyboard, volume ve media addon'ları)
+// LOCALDESK_TEST_BACKEND ortam değişkeni modül yüklenirken bir kez okunur:
+//   null      - işlemler OS'e gitmeden başarılı sayılır; uinput / SendInput,
+//               ses sunucusu ve D-Bus hiç açılmaz
+//   recording - null gibi, ayrıca her işlem zaman damgasıyla kaydedilir
+// Değişken yoksa veya tanınmıyorsa gerçek (native) backend kullanılır.
+
+namespace testbackend {
+
+enum class Mode : uint8_t {
+    kNative,
+    kNull,
+    kRecording,
+};
+
+inline Mode ModeFromEnvironment() {
+    const char* value = std::getenv("LOCALDESK_TEST_BACKEND");
+    if (value == nullptr) {
+        return Mode::kNative;
+    }
+    if (std::strcmp(value, "null") == 0) {
+        return Mode::kNull;
+    }
+    if (std::strcmp(value, "recording") == 0) {
+        return Mode::kRecording;
+    }
+    return Mode::kNative;
+}
+
+inline const char* ModeName(Mode mode) {
+    switch (mode) {
+    case Mode::kNull:
+        return "null";
+    case Mode::kRecording:
+        return "recording";
+    default:
+        return "native";
+    }
+}
+
+inline int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Kaydedilen işlem (ör. { "down", "CONTROL" }, { "volume", "master", 40 })
+struct Event {
+    int64_t timeNs;     // steady_clock
+    const char* op;     // Sabit string (literal)
+    std::string target;
+    double value;
+};
+
+// Thread-safe işlem kaydı
+// Sadece recording modunda saklar; null modunda sadece sayar. Kapasite dolunca
+// yeni işlemler sayılır ama saklanmaz (Take ile boşaltılana kadar).
+class Recorder {
+public:
+    static constexpr size_t kCapacity = 1 << 20;
+
+    void SetMode(Mode mode) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        mode_ = mode;
+    }
+
+    void Record(const char* op, std::string_view target, double value = 0) {
+        int64_t now = NowNs();
+        std::lock_guard<std::mutex> lock(mutex_);
+        total_++;
+        if (mode_ != Mode::kRecording) {
+            return;
+        }
+        if (events_.size() >= kCapacity) {
+            dropped_++;
+            return;
+        }
+        events_.push_back({ now, op, std::string(target), value });
+    }
+
+    // Kayıtları al ve temizle
+    std::vector<Event> Take() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<Event> events;
+        events.swap(events_);
+        return events;
+    }
+
+    uint64_t Total() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return total_;
+    }
+
+    uint64_t Dropped() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dropped_;
+    }
+
+private:
+    std::mutex mutex_;
+    Mode mode_ = Mode::kNative;
+    std::vector<Event> events_;
+    uint64_t total_ = 0;
+    uint64_t dropped_ = 0;
+};
+
+// Benchmark gecikme özeti (nanosaniye örneklerinden)
+struct LatencySummary {
+    size_t count = 0;
+    double p50Us = 0;
+    double p99Us = 0;
+    double p999Us = 0;
+    double maxUs = 0;
+};
+
+// Örnekleri sıralar (yerinde)
+inline LatencySummary Summarize(std::vector<int64_t>& samplesNs) {
+    LatencySummary summary;
+    summary.count = samplesNs.size();
+    if (samplesNs.empty()) {
+        return summary;
+    }
+
+    std::sort(samplesNs.begin(), samplesNs.end());
+    auto at = [&](double quantile) {
+        size_t index = static_cast<size_t>(quantile * static_cast<double>(samplesNs.size() - 1) + 0.5);
+        return static_cast<double>(samplesNs[index]) / 1000.0;
+    };
+    summary.p50Us = at(0.50);
+    summary.p99Us = at(0.99);
+    summary.p999Us = at(0.999);
+    summary.maxUs = static_cast<double>(samplesNs.back()) / 1000.0;
+    return summary;
+}
+
+} // namespace testbackend
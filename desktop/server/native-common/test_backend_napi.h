@@ -0,0 +1,38 @@
+#pragma once
+
+#include <napi.h>
+
+#include "test_backend.h"
+
+// Test backend'lerinin JS yüzü (getTestBackend / takeRecording)
+// Üç addon da aynı şekli döndürür; harness sonuçları addon'dan bağımsız okur.
+
+namespace testbackend {
+
+// { mode: 'native' | 'null' | 'recording', recorded, dropped }
+inline Napi::Object InfoObject(Napi::Env env, Mode mode, Recorder& recorder) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("mode", Napi::String::New(env, ModeName(mode)));
+    result.Set("recorded", Napi::Number::New(env, static_cast<double>(recorder.Total())));
+    result.Set("dropped", Napi::Number::New(env, static_cast<double>(recorder.Dropped())));
+    return result;
+}
+
+// [{ time (ms, steady_clock), op, target, value }] - kayıtlar boşaltılır
+inline Napi::Array RecordingArray(Napi::Env env, Recorder& recorder) {
+    std::vector<Event> events = recorder.Take();
+
+    Napi::Array list = Napi::Array::New(env, events.size());
+    for (size_t i = 0; i < events.size(); i++) {
+        const Event& event = events[i];
+        Napi::Object entry = Napi::Object::New(env);
+        entry.Set("time", Napi::Number::New(env, static_cast<double>(event.timeNs) / 1e6));
+        entry.Set("op", Napi::String::New(env, event.op));
+        entry.Set("target", Napi::String::New(env, event.target));
+        entry.Set("value", Napi::Number::New(env, event.value));
+        list.Set(static_cast<uint32_t>(i), entry);
+    }
+    return list;
+}
+
+} // namespace testbackend
@@ -0,0 +1,189 @@
+#include "yuv_convert.h"
+
+#include <cstddef>
+#include <initializer_list>
+
+#include "yuv_convert_rows.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || ((defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__))
+#define YUV_CONVERT_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define YUV_CONVERT_NEON 1
+#endif
+
+// AVX2 kernel'ı ayrı bir hedefte -mavx2 ile derlenir (bkz. binding.gyp);
+// gyp x86 yapılarında YUV_CONVERT_AVX2 tanımlar.
+
+namespace {
+
+inline uint8_t LumaOf(int r, int g, int b) {
+    return static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+inline uint8_t BlueDiffOf(int r, int g, int b) {
+    return static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+}
+
+inline uint8_t RedDiffOf(int r, int g, int b) {
+    return static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+// Skaler referans: satır çiftinin start sütunundan (çift) sonuna kadar
+void ScalarRow(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+               uint8_t* u, uint8_t* v, bool nv12, int start, int width) {
+    for (int x = start; x < width; x += 2) {
+        bool pair = x + 1 < width;
+        const uint8_t* a = row0 + x * 4;
+        const uint8_t* b = pair ? a + 4 : a;
+        const uint8_t* c = row1 + x * 4;
+        const uint8_t* d = pair ? c + 4 : c;
+
+        y0[x] = LumaOf(a[2], a[1], a[0]);
+        if (pair) y0[x + 1] = LumaOf(b[2], b[1], b[0]);
+        if (y1) {
+            y1[x] = LumaOf(c[2], c[1], c[0]);
+            if (pair) y1[x + 1] = LumaOf(d[2], d[1], d[0]);
+        }
+
+        int blue = (a[0] + b[0] + c[0] + d[0] + 2) >> 2;
+        int green = (a[1] + b[1] + c[1] + d[1] + 2) >> 2;
+        int red = (a[2] + b[2] + c[2] + d[2] + 2) >> 2;
+        if (nv12) {
+            u[x] = BlueDiffOf(red, green, blue);
+            u[x + 1] = RedDiffOf(red, green, blue);
+        } else {
+            u[x / 2] = BlueDiffOf(red, green, blue);
+            v[x / 2] = RedDiffOf(red, green, blue);
+        }
+    }
+}
+
+#if defined(YUV_CONVERT_X86) && defined(YUV_CONVERT_AVX2)
+bool CpuHasAvx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    // İşletim sistemi YMM yazmaçlarını kaydediyor mu
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+YuvRowFn RowFunction(YuvKernel kernel, bool nv12) {
+    switch (kernel) {
+#if defined(YUV_CONVERT_X86)
+    case YuvKernel::Sse2:
+        return nv12 ? YuvRowNV12Sse2 : YuvRowI420Sse2;
+#endif
+#if defined(YUV_CONVERT_X86) && defined(YUV_CONVERT_AVX2)
+    case YuvKernel::Avx2:
+        return nv12 ? YuvRowNV12Avx2 : YuvRowI420Avx2;
+#endif
+#if defined(YUV_CONVERT_NEON)
+    case YuvKernel::Neon:
+        return nv12 ? YuvRowNV12Neon : YuvRowI420Neon;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+bool Convert(const uint8_t* bgra, int bgraStride, int width, int height,
+             uint8_t* yPlane, int yStride, uint8_t* u, int uStride, uint8_t* v, int vStride,
+             bool nv12, YuvKernel kernel) {
+    if (!bgra || !yPlane || !u || (!nv12 && !v) || width <= 0 || height <= 0 ||
+        bgraStride < width * 4 || !YuvKernelSupported(kernel)) {
+        return false;
+    }
+
+    YuvRowFn row = RowFunction(kernel, nv12);
+    for (int y = 0; y < height; y += 2) {
+        bool pair = y + 1 < height;
+        const uint8_t* row0 = bgra + static_cast<size_t>(y) * bgraStride;
+        const uint8_t* row1 = pair ? row0 + bgraStride : row0;
+        uint8_t* y0 = yPlane + static_cast<size_t>(y) * yStride;
+        uint8_t* y1 = pair ? y0 + yStride : nullptr;
+        uint8_t* uRow = u + static_cast<size_t>(y / 2) * uStride;
+        uint8_t* vRow = nv12 ? nullptr : v + static_cast<size_t>(y / 2) * vStride;
+
+        int done = row ? row(row0, row1, y0, y1, uRow, vRow, width) : 0;
+        ScalarRow(row0, row1, y0, y1, uRow, vRow, nv12, done, width);
+    }
+    return true;
+}
+
+} // namespace
+
+bool YuvKernelSupported(YuvKernel kernel) {
+    switch (kernel) {
+    case YuvKernel::Scalar:
+        return true;
+#if defined(YUV_CONVERT_X86)
+    case YuvKernel::Sse2:
+        return true; // x86-64 tabanı; 32 bit yapılar da SSE2 ile derlenir
+#endif
+#if defined(YUV_CONVERT_X86) && defined(YUV_CONVERT_AVX2)
+    case YuvKernel::Avx2: {
+        static const bool available = CpuHasAvx2();
+        return available;
+    }
+#endif
+#if defined(YUV_CONVERT_NEON)
+    case YuvKernel::Neon:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+YuvKernel BestYuvKernel() {
+    static const YuvKernel best = []() {
+        for (YuvKernel kernel : { YuvKernel::Avx2, YuvKernel::Sse2, YuvKernel::Neon }) {
+            if (YuvKernelSupported(kernel)) {
+                return kernel;
+            }
+        }
+        return YuvKernel::Scalar;
+    }();
+    return best;
+}
+
+const char* YuvKernelName(YuvKernel kernel) {
+    switch (kernel) {
+    case YuvKernel::Scalar: return "scalar";
+    case YuvKernel::Sse2: return "sse2";
+    case YuvKernel::Avx2: return "avx2";
+    case YuvKernel::Neon: return "neon";
+    }
+    return "unknown";
+}
+
+bool ConvertBGRAToI420(const uint8_t* bgra, int bgraStride, int width, int height,
+                       const I420Planes& planes, YuvKernel kernel) {
+    return Convert(bgra, bgraStride, width, height, planes.y, planes.yStride,
+                   planes.u, planes.uStride, planes.v, planes.vStride, false, kernel);
+}
+
+bool ConvertBGRAToNV12(const uint8_t* bgra, int bgraStride, int width, int height,
+                       const NV12Planes& planes, YuvKernel kernel) {
+    return Convert(bgra, bgraStride, width, height, planes.y, planes.yStride,
+                   planes.uv, planes.uvStride, nullptr, 0, true, kernel);
+}
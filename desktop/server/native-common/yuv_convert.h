@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+// BGRA -> YUV 4:2:0 dönüşümü (I420: üç ayrı düzlem, NV12: Y + iç içe UV)
+// BT.601 sınırlı aralık (Y 16-235, UV 16-240), tamsayı katsayılarla:
+//   Y = ((66 R + 129 G +  25 B + 128) >> 8) + 16
+//   U = ((-38 R - 74 G + 112 B + 128) >> 8) + 128
+//   V = ((112 R - 94 G -  18 B + 128) >> 8) + 128
+// Kroma, 2x2 bloğun yuvarlanmış ortalama rengiyle hesaplanır; tek genişlik /
+// yükseklikte son sütun / satır tekrarlanır. SIMD kernel'ları skaler referansla
+// bit düzeyinde aynı çıktıyı üretir (bkz. bench/yuv_convert_bench.cc).
+
+enum class YuvKernel {
+    Scalar,
+    Sse2,
+    Avx2,
+    Neon
+};
+
+struct I420Planes {
+    uint8_t* y = nullptr;
+    int yStride = 0;
+    uint8_t* u = nullptr;
+    int uStride = 0;
+    uint8_t* v = nullptr;
+    int vStride = 0;
+};
+
+struct NV12Planes {
+    uint8_t* y = nullptr;
+    int yStride = 0;
+    uint8_t* uv = nullptr;
+    int uvStride = 0;
+};
+
+// Bu işlemcide çalışabilen en hızlı kernel (ilk çağrıda CPUID ile belirlenir)
+YuvKernel BestYuvKernel();
+bool YuvKernelSupported(YuvKernel kernel);
+const char* YuvKernelName(YuvKernel kernel);
+
+// bgraStride: kaynak satır başına byte. Desteklenmeyen kernel veya geçersiz
+// boyutta false döner. Kroma düzlemleri (width+1)/2 x (height+1)/2 boyutundadır.
+bool ConvertBGRAToI420(const uint8_t* bgra, int bgraStride, int width, int height,
+                       const I420Planes& planes, YuvKernel kernel = BestYuvKernel());
+bool ConvertBGRAToNV12(const uint8_t* bgra, int bgraStride, int width, int height,
+                       const NV12Planes& planes, YuvKernel kernel = BestYuvKernel());
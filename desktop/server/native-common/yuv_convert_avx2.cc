@@ -0,0 +1,118 @@
+#include "yuv_convert_rows.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || ((defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__))
+
+#include <immintrin.h>
+
+// AVX2 kernel: satır başına 32 piksel (SSE2 kernel'ı ile aynı aritmetik)
+// AVX2 pack komutları 128 bit şeritler içinde çalışır; girişler önce
+// _mm256_permute2x128_si256 ile yeniden dizildiği için sonuçlar sıralı kalır.
+// Bu dosya -mavx2 ile ayrı derlenir, sadece CPUID AVX2 bildirirse çağrılır.
+
+namespace {
+
+// a0..a7, b0..b7 (32 bit) -> a0..a7, b0..b7 (16 bit, sıralı)
+inline __m256i PackOrdered32(__m256i a, __m256i b) {
+    return _mm256_packs_epi32(_mm256_permute2x128_si256(a, b, 0x20),
+                              _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+// a0..a15, b0..b15 (16 bit) -> a0..a15, b0..b15 (8 bit, sıralı)
+inline __m256i PackOrdered16(__m256i a, __m256i b) {
+    return _mm256_packus_epi16(_mm256_permute2x128_si256(a, b, 0x20),
+                               _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+struct Channels {
+    __m256i b;
+    __m256i g;
+    __m256i r;
+};
+
+// 16 BGRA piksel -> 16 bit B, G, R şeritleri
+inline Channels Unpack(const uint8_t* pixels) {
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    __m256i p0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels));
+    __m256i p1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + 32));
+
+    Channels channels;
+    channels.b = PackOrdered32(_mm256_and_si256(p0, mask), _mm256_and_si256(p1, mask));
+    channels.g = PackOrdered32(_mm256_and_si256(_mm256_srli_epi32(p0, 8), mask),
+                               _mm256_and_si256(_mm256_srli_epi32(p1, 8), mask));
+    channels.r = PackOrdered32(_mm256_and_si256(_mm256_srli_epi32(p0, 16), mask),
+                               _mm256_and_si256(_mm256_srli_epi32(p1, 16), mask));
+    return channels;
+}
+
+inline __m256i Luma(const Channels& c) {
+    __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(c.r, _mm256_set1_epi16(66)),
+                                   _mm256_mullo_epi16(c.g, _mm256_set1_epi16(129)));
+    sum = _mm256_add_epi16(sum, _mm256_mullo_epi16(c.b, _mm256_set1_epi16(25)));
+    sum = _mm256_add_epi16(sum, _mm256_set1_epi16(128));
+    return _mm256_add_epi16(_mm256_srli_epi16(sum, 8), _mm256_set1_epi16(16));
+}
+
+// İki satırın 32'şer pikselinin 2x2 blok ortalaması (16 şerit)
+inline __m256i Average(__m256i top0, __m256i top1, __m256i bottom0, __m256i bottom1) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i first = _mm256_add_epi32(_mm256_madd_epi16(top0, ones), _mm256_madd_epi16(bottom0, ones));
+    __m256i second = _mm256_add_epi32(_mm256_madd_epi16(top1, ones), _mm256_madd_epi16(bottom1, ones));
+    __m256i sum = PackOrdered32(first, second);
+    return _mm256_srli_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(2)), 2);
+}
+
+inline __m256i Chroma(__m256i r, __m256i g, __m256i b, short cr, short cg, short cb) {
+    __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(cr)),
+                                   _mm256_mullo_epi16(g, _mm256_set1_epi16(cg)));
+    sum = _mm256_add_epi16(sum, _mm256_mullo_epi16(b, _mm256_set1_epi16(cb)));
+    sum = _mm256_add_epi16(sum, _mm256_set1_epi16(128));
+    return _mm256_add_epi16(_mm256_srai_epi16(sum, 8), _mm256_set1_epi16(128));
+}
+
+// 32 piksellik blok: Y satırları + 16 U (düşük yarı) ve 16 V (yüksek yarı)
+inline __m256i Block(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1) {
+    Channels top0 = Unpack(row0);
+    Channels top1 = Unpack(row0 + 64);
+    Channels bottom0 = Unpack(row1);
+    Channels bottom1 = Unpack(row1 + 64);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(y0), PackOrdered16(Luma(top0), Luma(top1)));
+    if (y1) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y1), PackOrdered16(Luma(bottom0), Luma(bottom1)));
+    }
+
+    __m256i b = Average(top0.b, top1.b, bottom0.b, bottom1.b);
+    __m256i g = Average(top0.g, top1.g, bottom0.g, bottom1.g);
+    __m256i r = Average(top0.r, top1.r, bottom0.r, bottom1.r);
+    return PackOrdered16(Chroma(r, g, b, -38, -74, 112), Chroma(r, g, b, 112, -94, -18));
+}
+
+} // namespace
+
+int YuvRowI420Avx2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width) {
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i uv = Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x / 2), _mm256_castsi256_si128(uv));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(v + x / 2), _mm256_extracti128_si256(uv, 1));
+    }
+    _mm256_zeroupper();
+    return x;
+}
+
+int YuvRowNV12Avx2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t*, int width) {
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i uv = Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr);
+        __m128i blue = _mm256_castsi256_si128(uv);
+        __m128i red = _mm256_extracti128_si256(uv, 1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x), _mm_unpacklo_epi8(blue, red));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x + 16), _mm_unpackhi_epi8(blue, red));
+    }
+    _mm256_zeroupper();
+    return x;
+}
+
+#endif
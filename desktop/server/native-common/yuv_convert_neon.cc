@@ -0,0 +1,82 @@
+#include "yuv_convert_rows.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+#include <arm_neon.h>
+
+// NEON kernel: satır başına 16 piksel (SSE2 kernel'ı ile aynı aritmetik)
+// vld4q_u8 BGRA'yı kanallara ayırır; Y 16 bit işaretsiz, U/V 16 bit işaretli
+// şeritlerde hesaplanır. 2x2 toplamları vpaddlq/vpadalq, yuvarlamalı ortalama
+// vrshrq_n_u16(sum, 2) = (sum + 2) >> 2 ile alınır.
+
+namespace {
+
+inline uint8x8_t LumaHalf(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+    uint16x8_t sum = vmull_u8(r, vdup_n_u8(66));
+    sum = vmlal_u8(sum, g, vdup_n_u8(129));
+    sum = vmlal_u8(sum, b, vdup_n_u8(25));
+    sum = vaddq_u16(sum, vdupq_n_u16(128));
+    return vadd_u8(vshrn_n_u16(sum, 8), vdup_n_u8(16));
+}
+
+inline uint8x16_t Luma(const uint8x16x4_t& p) {
+    return vcombine_u8(LumaHalf(vget_low_u8(p.val[2]), vget_low_u8(p.val[1]), vget_low_u8(p.val[0])),
+                       LumaHalf(vget_high_u8(p.val[2]), vget_high_u8(p.val[1]), vget_high_u8(p.val[0])));
+}
+
+inline int16x8_t Average(uint8x16_t top, uint8x16_t bottom) {
+    uint16x8_t sum = vpadalq_u8(vpaddlq_u8(top), bottom);
+    return vreinterpretq_s16_u16(vrshrq_n_u16(sum, 2));
+}
+
+inline uint8x8_t Chroma(int16x8_t r, int16x8_t g, int16x8_t b, int16_t cr, int16_t cg, int16_t cb) {
+    int16x8_t sum = vmulq_n_s16(r, cr);
+    sum = vmlaq_n_s16(sum, g, cg);
+    sum = vmlaq_n_s16(sum, b, cb);
+    sum = vaddq_s16(sum, vdupq_n_s16(128));
+    return vqmovun_s16(vaddq_s16(vshrq_n_s16(sum, 8), vdupq_n_s16(128)));
+}
+
+// 16 piksellik blok: Y satırları + 8 U ve 8 V
+inline uint8x8x2_t Block(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1) {
+    uint8x16x4_t top = vld4q_u8(row0);
+    uint8x16x4_t bottom = vld4q_u8(row1);
+
+    vst1q_u8(y0, Luma(top));
+    if (y1) {
+        vst1q_u8(y1, Luma(bottom));
+    }
+
+    int16x8_t b = Average(top.val[0], bottom.val[0]);
+    int16x8_t g = Average(top.val[1], bottom.val[1]);
+    int16x8_t r = Average(top.val[2], bottom.val[2]);
+
+    uint8x8x2_t uv;
+    uv.val[0] = Chroma(r, g, b, -38, -74, 112);
+    uv.val[1] = Chroma(r, g, b, 112, -94, -18);
+    return uv;
+}
+
+} // namespace
+
+int YuvRowI420Neon(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x8x2_t uv = Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr);
+        vst1_u8(u + x / 2, uv.val[0]);
+        vst1_u8(v + x / 2, uv.val[1]);
+    }
+    return x;
+}
+
+int YuvRowNV12Neon(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t*, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        vst2_u8(u + x, Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr));
+    }
+    return x;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+// yuv_convert kernel'larının ortak satır arayüzü (sadece yuv_convert*.cc içindir)
+//
+// Bir satır çifti (row1 = alt satır; tek yükseklikte son satırda row1 == row0 ve
+// y1 == nullptr) için soldan itibaren kernel'ın blok genişliğinin katı kadar
+// pikseli işler ve işlenen piksel sayısını döndürür. Kalan sütunları skaler yol
+// tamamlar. NV12'de u iç içe UV düzlemini gösterir, v kullanılmaz.
+
+using YuvRowFn = int (*)(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                         uint8_t* u, uint8_t* v, int width);
+
+int YuvRowI420Sse2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
+int YuvRowNV12Sse2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
+
+int YuvRowI420Avx2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
+int YuvRowNV12Avx2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
+
+int YuvRowI420Neon(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
+int YuvRowNV12Neon(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width);
@@ -0,0 +1,103 @@
+#include "yuv_convert_rows.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || ((defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__))
+
+#include <emmintrin.h>
+
+// SSE2 kernel: satır başına 16 piksel
+// Kanallar 16 bit şeritlere açılır. Y toplamı en fazla 56228 olduğu için
+// işaretsiz 16 bit'e sığar; U/V toplamları [-28432, 28688] aralığında olduğu için
+// işaretli 16 bit'e sığar. Böylece _mm_mullo_epi16 + kaydırma skaler formülle
+// bit düzeyinde aynı sonucu verir. 2x2 toplamları _mm_madd_epi16 (komşu
+// şerit çiftleri) ile alınır.
+
+namespace {
+
+struct Channels {
+    __m128i b;
+    __m128i g;
+    __m128i r;
+};
+
+// 8 BGRA piksel -> 16 bit B, G, R şeritleri
+inline Channels Unpack(const uint8_t* pixels) {
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+    __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 16));
+
+    Channels channels;
+    channels.b = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+    channels.g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask),
+                                 _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+    channels.r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask),
+                                 _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+    return channels;
+}
+
+inline __m128i Luma(const Channels& c) {
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(c.r, _mm_set1_epi16(66)),
+                                _mm_mullo_epi16(c.g, _mm_set1_epi16(129)));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(c.b, _mm_set1_epi16(25)));
+    sum = _mm_add_epi16(sum, _mm_set1_epi16(128));
+    return _mm_add_epi16(_mm_srli_epi16(sum, 8), _mm_set1_epi16(16));
+}
+
+// İki satırın 16'şar pikselinin 2x2 blok ortalaması (8 şerit)
+inline __m128i Average(__m128i top0, __m128i top1, __m128i bottom0, __m128i bottom1) {
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i first = _mm_add_epi32(_mm_madd_epi16(top0, ones), _mm_madd_epi16(bottom0, ones));
+    __m128i second = _mm_add_epi32(_mm_madd_epi16(top1, ones), _mm_madd_epi16(bottom1, ones));
+    __m128i sum = _mm_packs_epi32(first, second);
+    return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+}
+
+inline __m128i Chroma(__m128i r, __m128i g, __m128i b, short cr, short cg, short cb) {
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(cr)),
+                                _mm_mullo_epi16(g, _mm_set1_epi16(cg)));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, _mm_set1_epi16(cb)));
+    sum = _mm_add_epi16(sum, _mm_set1_epi16(128));
+    return _mm_add_epi16(_mm_srai_epi16(sum, 8), _mm_set1_epi16(128));
+}
+
+// 16 piksellik blok: Y satırları + 8 U ve 8 V (düşük/yüksek 8 byte)
+inline __m128i Block(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1) {
+    Channels top0 = Unpack(row0);
+    Channels top1 = Unpack(row0 + 32);
+    Channels bottom0 = Unpack(row1);
+    Channels bottom1 = Unpack(row1 + 32);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(y0), _mm_packus_epi16(Luma(top0), Luma(top1)));
+    if (y1) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y1), _mm_packus_epi16(Luma(bottom0), Luma(bottom1)));
+    }
+
+    __m128i b = Average(top0.b, top1.b, bottom0.b, bottom1.b);
+    __m128i g = Average(top0.g, top1.g, bottom0.g, bottom1.g);
+    __m128i r = Average(top0.r, top1.r, bottom0.r, bottom1.r);
+    return _mm_packus_epi16(Chroma(r, g, b, -38, -74, 112), Chroma(r, g, b, 112, -94, -18));
+}
+
+} // namespace
+
+int YuvRowI420Sse2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t* v, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i uv = Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(u + x / 2), uv);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(v + x / 2), _mm_srli_si128(uv, 8));
+    }
+    return x;
+}
+
+int YuvRowNV12Sse2(const uint8_t* row0, const uint8_t* row1, uint8_t* y0, uint8_t* y1,
+                   uint8_t* u, uint8_t*, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i uv = Block(row0 + x * 4, row1 + x * 4, y0 + x, y1 ? y1 + x : nullptr);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x), _mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 8)));
+    }
+    return x;
+}
+
+#endif
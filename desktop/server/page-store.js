@@ -0,0 +1,224 @@
+// Sayfa/kısayol kalıcılığı
+// store-addon varsa her düzenleme sadece değişen kayıtları log'a ekler (bkz.
+// store-addon/record_store.h); yoksa pages.json eskisi gibi tam yazılır, ama
+// geçici dosya + rename ile (yarım yazılmış pages.json kalmaz).
+//
+// Depo açıkken pages.json yoktur (içe aktarılınca pages.json.backup olur); varsa
+// depo kullanılamazken yazılmıştır ve depodan yenidir, depo açılınca tekrar
+// içe aktarılır. pages.json.backup her düzgün kapanışta depodan yenilenir; addon
+// sonradan yüklenemezse sayfalar buradan gelir.
+//
+// Kayıtlar:
+//   order             -> sayfa id'leri (sıra)
+//   p:<pageId>        -> sayfa; shortcuts yerine shortcutIds (kısayol sırası)
+//   s:<pageId>:<id>   -> kısayol
+// Bir düzenlemenin kayıtları tek commit'te atomik yazılır.
+
+const fs = require('fs').promises;
+const path = require('path');
+const log = require('./log');
+
+const STORE_NAME = 'pages';
+
+function pageKey(pageId) {
+  return `p:${pageId}`;
+}
+
+function shortcutKey(pageId, shortcutId) {
+  return `s:${pageId}:${shortcutId}`;
+}
+
+class PageStore {
+  constructor(addon, dataDir, pagesFile) {
+    this.addon = addon;
+    this.dataDir = dataDir;
+    this.pagesFile = pagesFile;
+    this.enabled = false;
+  }
+
+  // Depoyu aç; başarısızsa pages.json kullanılır
+  open() {
+    if (!this.addon || !this.addon.open) {
+      return false;
+    }
+
+    const result = this.addon.open(this.dataDir, STORE_NAME);
+    if (!result.success) {
+      log.warn('⚠️  Sayfa deposu açılamadı, pages.json kullanılacak:', result.error);
+      return false;
+    }
+    if (result.recoveredBytes > 0) {
+      log.warn(`⚠️  Sayfa deposu: yarım kalan son yazım atıldı (${result.recoveredBytes} bayt)`);
+    }
+    this.enabled = true;
+    return true;
+  }
+
+  // pages: addon sonradan yüklenemezse kullanılacak yedeğe yazılır
+  async close(pages) {
+    if (this.enabled) {
+      await this.addon.flush();
+      if (pages) {
+        await this.writeJson(`${this.pagesFile}.backup`, pages);
+      }
+      this.addon.close();
+      this.enabled = false;
+    }
+  }
+
+  // Depodaki sayfalar; depo boşsa null (pages.json'dan içe aktarılmalı)
+  load() {
+    const records = new Map(this.addon.entries());
+    const order = records.get('order');
+    if (order === undefined) {
+      return null;
+    }
+
+    const pages = [];
+    for (const pageId of JSON.parse(order)) {
+      const pageRecord = records.get(pageKey(pageId));
+      if (pageRecord === undefined) {
+        continue;
+      }
+      const { shortcutIds = [], ...page } = JSON.parse(pageRecord);
+      page.shortcuts = [];
+      for (const shortcutId of shortcutIds) {
+        const shortcut = records.get(shortcutKey(pageId, shortcutId));
+        if (shortcut !== undefined) {
+          page.shortcuts.push(JSON.parse(shortcut));
+        }
+      }
+      pages.push(page);
+    }
+    return pages;
+  }
+
+  // Kayıt oluşturucular (commit'e verilecek { key, value } listeleri)
+
+  orderOps(pages) {
+    return [{ key: 'order', value: JSON.stringify(pages.map(page => page.id)) }];
+  }
+
+  pageOps(page) {
+    const { shortcuts = [], ...meta } = page;
+    meta.shortcutIds = shortcuts.map(shortcut => shortcut.id);
+    return [{ key: pageKey(page.id), value: JSON.stringify(meta) }];
+  }
+
+  // Kısayol eklendi/değişti (sayfa kaydı da: kısayol listesi değişmiş olabilir)
+  shortcutOps(page, shortcut) {
+    return [
+      { key: shortcutKey(page.id, shortcut.id), value: JSON.stringify(shortcut) },
+      ...this.pageOps(page)
+    ];
+  }
+
+  // Kısayol sayfada hâlâ duruyorsa (id tipi uyuşmadı, filtre silmedi) kaydı da kalır
+  removeShortcutOps(page, shortcutId) {
+    const stillListed = (page.shortcuts || []).some(shortcut => String(shortcut.id) === String(shortcutId));
+    return [
+      ...(stillListed ? [] : [{ key: shortcutKey(page.id, shortcutId), value: null }]),
+      ...this.pageOps(page)
+    ];
+  }
+
+  // Yeni sayfa: sayfa, tüm kısayolları ve sıra
+  addPageOps(pages, page) {
+    return [
+      ...(page.shortcuts || []).map(shortcut => ({
+        key: shortcutKey(page.id, shortcut.id),
+        value: JSON.stringify(shortcut)
+      })),
+      ...this.pageOps(page),
+      ...this.orderOps(pages)
+    ];
+  }
+
+  removePageOps(pages, page) {
+    return [
+      ...(page.shortcuts || []).map(shortcut => ({ key: shortcutKey(page.id, shortcut.id), value: null })),
+      { key: pageKey(page.id), value: null },
+      ...this.orderOps(pages)
+    ];
+  }
+
+  // Tüm diziyi yaz (içe aktarma, saveShortcuts); depoda olup dizide olmayan kayıtlar silinir
+  replaceOps(pages) {
+    const ops = [];
+    const keep = new Set(['order']);
+    for (const page of pages) {
+      for (const op of this.addPageOps([], page)) {
+        if (op.key !== 'order') {
+          ops.push(op);
+          keep.add(op.key);
+        }
+      }
+    }
+    ops.push(...this.orderOps(pages));
+
+    if (this.enabled) {
+      for (const [key] of this.addon.entries()) {
+        if (!keep.has(key)) {
+          ops.push({ key, value: null });
+        }
+      }
+    }
+    return ops;
+  }
+
+  // ops depoya yazılır; depo yoksa pages tam yazılır
+  async save(pages, ops) {
+    if (this.enabled) {
+      await this.addon.commit(ops);
+      return;
+    }
+
+    await this.writeJson(this.pagesFile, pages);
+  }
+
+  async writeJson(file, pages) {
+    const temporary = `${file}.tmp`;
+    await fs.writeFile(temporary, JSON.stringify(pages, null, 2));
+    await fs.rename(temporary, file);
+  }
+
+  // pages.json (yoksa / okunamazsa null)
+  async readJson() {
+    try {
+      return JSON.parse(await fs.readFile(this.pagesFile, 'utf8'));
+    } catch (error) {
+      return null;
+    }
+  }
+
+  // pages.json depoya aktarıldıktan sonra yedek olarak saklanır
+  async retireJson() {
+    try {
+      await fs.rename(this.pagesFile, `${this.pagesFile}.backup`);
+    } catch (error) {
+      // pages.json hiç yoktu
+    }
+  }
+
+  // Depo kullanılmıyor ve pages.json yok ama depo önceden kullanılmışsa (addon
+  // sonradan yüklenemedi): son düzgün kapanıştaki yedek; düzenlemeler pages.json'a
+  // yazılır ve addon yüklenince depoya aktarılır
+  async restoreBackup() {
+    try {
+      await fs.access(path.join(this.dataDir, `${STORE_NAME}.log`));
+    } catch (error) {
+      return null; // Depo hiç kullanılmamış
+    }
+
+    log.warn('⚠️  Sayfalar store-addon deposunda (pages.log) ama addon yüklenemedi;');
+    log.warn('   son düzgün kapanıştaki pages.json.backup kullanılıyor. Çözüm: cd desktop/server/store-addon && npm install');
+    try {
+      return JSON.parse(await fs.readFile(`${this.pagesFile}.backup`, 'utf8'));
+    } catch (error) {
+      log.warn('⚠️  pages.json.backup okunamadı:', error.message);
+      return null;
+    }
+  }
+}
+
+module.exports = PageStore;
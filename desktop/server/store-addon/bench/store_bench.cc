@@ -0,0 +1,224 @@
+// Sayfa deposu benchmark'ı
+// Bir kısayol düzenlemesinin diske ulaşma süresini karşılaştırır:
+//   tam yazım - tüm sayfaların JSON'u geçici dosyaya yazılıp fsync + rename
+//               (pages.json'un atomik hali; eski savePages bunu fsync'siz yapıyordu)
+//   commit    - değişen kısayol + sayfa kaydı log'a eklenir, fdatasync beklenir
+// Ayrıca aynı anda commit eden thread'lerin group commit ile kaç fsync'e
+// indiği ve sıkıştırılmış snapshot'ın açılış (mmap + tablo) süresi ölçülür.
+//
+// Derleme: node-gyp rebuild (build/Release/store_bench)
+// Çalıştırma: ./build/Release/store_bench [kısayol sayısı] [dizin]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../record_store.h"
+
+namespace {
+
+constexpr size_t kEdits = 300;
+
+void Report(const char* label, std::vector<int64_t>& samples) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-22s %6zu örnek  p50 %8.1f us  p99 %8.1f us  max %8.1f us\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.maxUs);
+}
+
+// Gerçekçi boyutta bir kısayol (ikon yolu ve tuşlarla ~250 bayt)
+std::string ShortcutJson(size_t id, size_t revision) {
+    return "{\"id\":" + std::to_string(1700000000000ull + id) +
+           ",\"label\":\"Kısayol " + std::to_string(id) + " r" + std::to_string(revision) +
+           "\",\"icon\":\"icon-1700000000" + std::to_string(id) + ".png\",\"keys\":[\"CONTROL\",\"SHIFT\",\"F" +
+           std::to_string(id % 12 + 1) + "\"],\"color\":\"#1F6FEB\",\"actionType\":\"keys\",\"appPath\":\"\"}";
+}
+
+// Bir işin tamamlanmasını bekle (Completion yazıcı thread'inden gelir)
+class Waiter {
+public:
+    RecordStore::Completion Callback() {
+        return [this](bool success, const std::string&) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+            success_ = success;
+            cv_.notify_one();
+        };
+    }
+
+    bool Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return done_; });
+        done_ = false;
+        return success_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    bool success_ = false;
+};
+
+void RunFullRewrite(const std::string& dir, size_t shortcuts) {
+    std::string path = storefile::Join(dir, "pages.json");
+    std::string temporary = path + ".tmp";
+    std::vector<int64_t> samples;
+    size_t bytes = 0;
+
+    for (size_t edit = 0; edit < kEdits; edit++) {
+        int64_t start = testbackend::NowNs();
+        // savePages: tüm dizi her düzenlemede yeniden serileştirilir
+        std::string json = "[{\"id\":\"page-1\",\"name\":\"Genel\",\"shortcuts\":[";
+        for (size_t i = 0; i < shortcuts; i++) {
+            json += ShortcutJson(i, i == edit % shortcuts ? edit : 0);
+            json += i + 1 < shortcuts ? "," : "";
+        }
+        json += "]}]";
+
+        std::string error;
+        if (!storefile::WriteDurable(temporary, json.data(), json.size(), error) ||
+            !storefile::ReplaceDurable(temporary, path, error)) {
+            std::printf("  tam yazım başarısız: %s\n", error.c_str());
+            return;
+        }
+        samples.push_back(testbackend::NowNs() - start);
+        bytes = json.size();
+    }
+    Report("tam yazım", samples);
+    std::printf("  %-22s %zu bayt / düzenleme\n", "", bytes);
+}
+
+void RunCommits(RecordStore& store, size_t shortcuts) {
+    Waiter waiter;
+    std::vector<int64_t> samples;
+    std::string pageRecord = "{\"id\":\"page-1\",\"name\":\"Genel\",\"shortcutIds\":[...]}";
+
+    for (size_t edit = 0; edit < kEdits; edit++) {
+        size_t id = edit % shortcuts;
+        int64_t start = testbackend::NowNs();
+        std::string error;
+        store.Commit({ { "s:page-1:" + std::to_string(id), ShortcutJson(id, edit), false },
+                       { "p:page-1", pageRecord, false } },
+                     waiter.Callback(), error);
+        if (!waiter.Wait()) {
+            std::printf("  commit başarısız\n");
+            return;
+        }
+        samples.push_back(testbackend::NowNs() - start);
+    }
+    Report("commit (2 kayıt)", samples);
+}
+
+// threads thread'i kapalı döngüde commit eder; fsync'ler birleşir
+void RunConcurrent(RecordStore& store, size_t shortcuts, size_t threads) {
+    StoreInfo before = store.Info();
+    std::vector<std::vector<int64_t>> perThread(threads);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            Waiter waiter;
+            for (size_t edit = 0; edit < kEdits; edit++) {
+                size_t id = (edit * threads + t) % shortcuts;
+                int64_t begin = testbackend::NowNs();
+                std::string error;
+                store.Commit({ { "s:page-1:" + std::to_string(id), ShortcutJson(id, edit), false } },
+                             waiter.Callback(), error);
+                waiter.Wait();
+                perThread[t].push_back(testbackend::NowNs() - begin);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<int64_t> samples;
+    for (const std::vector<int64_t>& part : perThread) {
+        samples.insert(samples.end(), part.begin(), part.end());
+    }
+    StoreInfo after = store.Info();
+    Report("commit (eşzamanlı)", samples);
+    std::printf("  %-22s %zu thread, %.0f commit/s, %llu commit -> %llu fsync\n", "", threads,
+                samples.size() / seconds,
+                static_cast<unsigned long long>(after.commits - before.commits),
+                static_cast<unsigned long long>(after.syncs - before.syncs));
+}
+
+void RunOpen(const std::string& dir) {
+    std::vector<int64_t> samples;
+    size_t keys = 0;
+    for (int i = 0; i < 20; i++) {
+        RecordStore store;
+        std::string error;
+        int64_t start = testbackend::NowNs();
+        if (!store.Open(dir, "bench", error)) {
+            std::printf("  açılış başarısız: %s\n", error.c_str());
+            return;
+        }
+        samples.push_back(testbackend::NowNs() - start);
+        keys = store.Info().keys;
+        store.Close();
+    }
+    Report("açılış", samples);
+    std::printf("  %-22s %zu anahtar\n", "", keys);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t shortcuts = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 500;
+    std::string dir = argc > 2 ? argv[2] : "store-bench-data";
+    shortcuts = std::max<size_t>(shortcuts, 1);
+
+    std::string error;
+    if (!storefile::EnsureDirectory(dir, error)) {
+        std::printf("%s\n", error.c_str());
+        return 1;
+    }
+
+    std::printf("Sayfa deposu benchmark'ı (%zu kısayol, dizin: %s)\n", shortcuts, dir.c_str());
+    RunFullRewrite(dir, shortcuts);
+
+    {
+        RecordStore store;
+        if (!store.Open(dir, "bench", error)) {
+            std::printf("%s\n", error.c_str());
+            return 1;
+        }
+
+        // Başlangıç durumu: tüm kısayollar tek commit'te
+        std::vector<StoreOp> initial;
+        for (size_t i = 0; i < shortcuts; i++) {
+            initial.push_back({ "s:page-1:" + std::to_string(i), ShortcutJson(i, 0), false });
+        }
+        Waiter waiter;
+        store.Commit(initial, waiter.Callback(), error);
+        waiter.Wait();
+
+        RunCommits(store, shortcuts);
+        RunConcurrent(store, shortcuts, 4);
+
+        store.Compact(waiter.Callback(), error);
+        waiter.Wait();
+        StoreInfo info = store.Info();
+        std::printf("  sıkıştırma: snapshot %llu bayt, %llu sıkıştırma\n",
+                    static_cast<unsigned long long>(info.snapshotBytes),
+                    static_cast<unsigned long long>(info.compactions));
+        store.Close();
+    }
+
+    RunOpen(dir);
+    return 0;
+}
@@ -0,0 +1,60 @@
+{
+  "targets": [
+    {
+      "target_name": "store",
+      "sources": [ "store.cc", "record_store.cc" ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")"
+      ],
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').gyp\")"
+      ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "defines": [ "NAPI_CPP_EXCEPTIONS" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "store_file_win.cc" ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "ExceptionHandling": 1
+            }
+          }
+        }],
+        ["OS!='win'", {
+          "sources": [ "store_file_posix.cc" ]
+        }]
+      ]
+    },
+    {
+      "target_name": "store_bench",
+      "type": "executable",
+      "sources": [ "bench/store_bench.cc", "record_store.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "store_file_win.cc" ]
+        }],
+        ["OS!='win'", {
+          "sources": [ "store_file_posix.cc" ]
+        }]
+      ]
+    }
+  ],
+  "conditions": [
+    ["OS=='linux'", {
+      "targets": [
+        {
+          "target_name": "record_store_crash_test",
+          "type": "executable",
+          "sources": [ "test/record_store_crash_test.cc", "record_store.cc", "store_file_posix.cc" ],
+          "defines": [ "RECORD_STORE_CRASH_TEST" ],
+          "cflags!": [ "-fno-exceptions" ],
+          "cflags_cc!": [ "-fno-exceptions" ],
+          "libraries": [ "-lpthread" ]
+        }
+      ]
+    }]
+  ]
+}
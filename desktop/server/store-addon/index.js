@@ -0,0 +1,25 @@
+const path = require('path');
+const addonPath = path.join(__dirname, 'build', 'Release', 'store.node');
+
+let storeAddon = null;
+
+try {
+  storeAddon = require(addonPath);
+} catch (error) {
+  console.error('❌ Store addon yüklenemedi:', error.message);
+  console.error('💡 Çözüm: cd desktop/server/store-addon && npm install');
+  
+  // Fallback: open başarısız döner, sunucu pages.json'a tam yazıma geçer
+  storeAddon = {
+    open: () => ({ success: false, open: false, keys: 0, error: error.message }),
+    close: () => {},
+    get: () => null,
+    entries: () => [],
+    commit: () => Promise.reject(new Error('Store addon yüklenemedi')),
+    flush: () => Promise.resolve(true),
+    compact: () => Promise.resolve(true),
+    getStoreInfo: () => ({ open: false, keys: 0 })
+  };
+}
+
+module.exports = storeAddon;
@@ -0,0 +1,500 @@
+#include "record_store.h"
+
+#include <cstring>
+#include <iterator>
+
+#ifdef RECORD_STORE_CRASH_TEST
+#include <csignal>
+#include <cstdlib>
+#endif
+
+#include "../native-common/content_hash.h"
+
+namespace {
+
+// Dosya başlıkları (8 bayt); biçim değişirse sürüm artırılır
+const char kLogMagic[] = "LDLOG001";
+const char kSnapshotMagic[] = "LDSNAP01";
+constexpr size_t kMagicSize = 8;
+
+// Kayıt: [özet u64][tür u8][bayrak u8][ayrılmış u16][anahtar u32][değer u32][anahtar][değer]
+// Özet, özet alanından sonraki tüm baytları kapsar. Tamsayılar little-endian.
+constexpr size_t kHeaderSize = 20;
+constexpr uint8_t kTypePut = 1;
+constexpr uint8_t kTypeDelete = 2;
+constexpr uint8_t kFlagCommit = 1;
+
+// Tek kayıt üst sınırı; bozuk uzunluk alanı dev ayırmaya yol açmasın
+constexpr uint32_t kMaxFieldSize = 64u * 1024 * 1024;
+
+void PutU32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+void PutU64(uint8_t* out, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        out[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+uint32_t GetU32(const uint8_t* in) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; i--) {
+        value = (value << 8) | in[i];
+    }
+    return value;
+}
+
+uint64_t GetU64(const uint8_t* in) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) {
+        value = (value << 8) | in[i];
+    }
+    return value;
+}
+
+bool HasMagic(const uint8_t* data, size_t size, const char* magic) {
+    return size >= kMagicSize && std::memcmp(data, magic, kMagicSize) == 0;
+}
+
+#ifdef RECORD_STORE_CRASH_TEST
+// Çökme testi (test/record_store_crash_test.cc): RECORD_STORE_CRASH=<nokta> ise
+// süreç o noktada SIGKILL ile ölür. Sadece test hedefinde derlenir.
+void CrashPoint(const char* name) {
+    const char* point = std::getenv("RECORD_STORE_CRASH");
+    if (point != nullptr && std::strcmp(point, name) == 0) {
+        std::raise(SIGKILL);
+    }
+}
+#else
+void CrashPoint(const char*) {}
+#endif
+
+} // namespace
+
+RecordStore& DefaultStore() {
+    static RecordStore store;
+    return store;
+}
+
+RecordStore::~RecordStore() {
+    Close();
+}
+
+void RecordStore::EncodeRecord(std::string& out, const StoreOp& op, bool commit) {
+    size_t offset = out.size();
+    size_t valueSize = op.remove ? 0 : op.value.size();
+    out.resize(offset + kHeaderSize + op.key.size() + valueSize);
+
+    uint8_t* record = reinterpret_cast<uint8_t*>(&out[offset]);
+    record[8] = op.remove ? kTypeDelete : kTypePut;
+    record[9] = commit ? kFlagCommit : 0;
+    record[10] = 0;
+    record[11] = 0;
+    PutU32(record + 12, static_cast<uint32_t>(op.key.size()));
+    PutU32(record + 16, static_cast<uint32_t>(valueSize));
+    std::memcpy(record + kHeaderSize, op.key.data(), op.key.size());
+    if (valueSize > 0) {
+        std::memcpy(record + kHeaderSize + op.key.size(), op.value.data(), valueSize);
+    }
+
+    size_t covered = kHeaderSize - 8 + op.key.size() + valueSize;
+    PutU64(record, ContentHashWords(record + 8, covered));
+}
+
+size_t RecordStore::Replay(const uint8_t* data, size_t size, bool snapshot) {
+    size_t offset = 0;
+    size_t committed = 0;
+    std::vector<StoreOp> group;
+
+    while (size - offset >= kHeaderSize) {
+        const uint8_t* record = data + offset;
+        uint8_t type = record[8];
+        uint8_t flags = record[9];
+        uint32_t keySize = GetU32(record + 12);
+        uint32_t valueSize = GetU32(record + 16);
+
+        if ((type != kTypePut && type != kTypeDelete) || keySize > kMaxFieldSize || valueSize > kMaxFieldSize ||
+            size - offset - kHeaderSize < static_cast<size_t>(keySize) + valueSize) {
+            break;
+        }
+        size_t covered = kHeaderSize - 8 + keySize + valueSize;
+        if (ContentHashWords(record + 8, covered) != GetU64(record)) {
+            break;
+        }
+
+        StoreOp op;
+        op.key.assign(reinterpret_cast<const char*>(record + kHeaderSize), keySize);
+        op.remove = type == kTypeDelete;
+        if (!op.remove) {
+            op.value.assign(reinterpret_cast<const char*>(record + kHeaderSize + keySize), valueSize);
+        }
+        offset += kHeaderSize + keySize + valueSize;
+
+        // Snapshot tek bir büyük gruptur; ara kopya tutulmaz
+        if (snapshot) {
+            Apply(op);
+        } else {
+            group.push_back(std::move(op));
+        }
+
+        if (flags & kFlagCommit) {
+            for (const StoreOp& pendingOp : group) {
+                Apply(pendingOp);
+            }
+            group.clear();
+            committed = offset;
+        }
+    }
+    return committed;
+}
+
+void RecordStore::Apply(const StoreOp& op) {
+    if (op.remove) {
+        table_.erase(op.key);
+    } else {
+        table_[op.key] = op.value;
+    }
+}
+
+bool RecordStore::Open(const std::string& dir, const std::string& name, std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (open_) {
+        if (dir == dir_ && name == name_) {
+            return true;
+        }
+        error = "Depo zaten açık: " + logPath_;
+        return false;
+    }
+
+    dir_ = dir;
+    name_ = name;
+    logPath_ = storefile::Join(dir, name + ".log");
+    snapshotPath_ = storefile::Join(dir, name + ".snapshot");
+    table_.clear();
+    pending_.clear();
+    undo_.clear();
+    info_ = StoreInfo();
+    info_.path = logPath_;
+
+    if (!storefile::EnsureDirectory(dir, error) || !Load(error)) {
+        table_.clear();
+        log_.Close();
+        return false;
+    }
+
+    open_ = true;
+    stopping_ = false;
+    info_.open = true;
+    thread_ = std::thread(&RecordStore::Run, this);
+    return true;
+}
+
+bool RecordStore::Load(std::string& error) {
+    // Snapshot: tamamı geçerli olmalı (atomik taşındığı için yarım olamaz)
+    {
+        MappedFile snapshot;
+        if (!snapshot.Open(snapshotPath_, error)) {
+            return false;
+        }
+        if (snapshot.Size() > 0) {
+            if (!HasMagic(snapshot.Data(), snapshot.Size(), kSnapshotMagic)) {
+                error = "Snapshot biçimi tanınmadı: " + snapshotPath_;
+                return false;
+            }
+            size_t body = snapshot.Size() - kMagicSize;
+            if (Replay(snapshot.Data() + kMagicSize, body, true) != body) {
+                error = "Snapshot bozuk: " + snapshotPath_;
+                return false;
+            }
+        }
+        info_.snapshotBytes = snapshot.Size();
+    }
+
+    // Log: son commit'e kadar oynat, sonrası atılır
+    uint64_t validSize = kMagicSize;
+    uint64_t fileSize = 0;
+    {
+        MappedFile log;
+        if (!log.Open(logPath_, error)) {
+            return false;
+        }
+        fileSize = log.Size();
+        if (fileSize >= kMagicSize) {
+            if (!HasMagic(log.Data(), log.Size(), kLogMagic)) {
+                error = "Log biçimi tanınmadı: " + logPath_;
+                return false;
+            }
+            validSize += Replay(log.Data() + kMagicSize, log.Size() - kMagicSize, false);
+        }
+        // Eşleme kapanmadan kısaltılamaz (Windows)
+    }
+
+    if (!log_.Open(logPath_, false, error)) {
+        return false;
+    }
+    if (fileSize < kMagicSize) {
+        // Yeni dosya veya başlık yazılırken kesilmiş
+        if (!log_.Truncate(0, error) || !log_.Append(kLogMagic, kMagicSize, error) || !log_.Sync(error)) {
+            return false;
+        }
+    } else if (validSize < fileSize) {
+        info_.recoveredBytes = fileSize - validSize;
+        if (!log_.Truncate(validSize, error) || !log_.Sync(error)) {
+            return false;
+        }
+    }
+
+    info_.logBytes = log_.Size();
+    info_.keys = table_.size();
+    return true;
+}
+
+void RecordStore::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!open_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    log_.Close();
+    open_ = false;
+    stopping_ = false;
+    info_.open = false;
+}
+
+bool RecordStore::IsOpen() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return open_;
+}
+
+bool RecordStore::Get(const std::string& key, std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = table_.find(key);
+    if (it == table_.end()) {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+std::vector<std::pair<std::string, std::string>> RecordStore::Entries() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<std::pair<std::string, std::string>>(table_.begin(), table_.end());
+}
+
+bool RecordStore::Commit(const std::vector<StoreOp>& ops, Completion done, std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!open_ || stopping_) {
+            error = "Depo açık değil";
+            return false;
+        }
+        for (size_t i = 0; i < ops.size(); i++) {
+            if (ops[i].key.size() > kMaxFieldSize || ops[i].value.size() > kMaxFieldSize) {
+                error = "Kayıt çok büyük: " + ops[i].key.substr(0, 64);
+                return false;
+            }
+        }
+        for (size_t i = 0; i < ops.size(); i++) {
+            Undo undo;
+            undo.key = ops[i].key;
+            auto it = table_.find(ops[i].key);
+            if (it != table_.end()) {
+                undo.existed = true;
+                undo.value = it->second;
+            }
+            undo_.push_back(std::move(undo));
+            Apply(ops[i]);
+            EncodeRecord(pending_, ops[i], i + 1 == ops.size());
+        }
+        info_.commits++;
+        info_.keys = table_.size();
+        if (done) {
+            waiters_.push_back(std::move(done));
+        }
+    }
+    wake_.notify_one();
+    return true;
+}
+
+bool RecordStore::Flush(Completion done, std::string& error) {
+    return Commit({}, std::move(done), error);
+}
+
+bool RecordStore::Compact(Completion done, std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!open_ || stopping_) {
+            error = "Depo açık değil";
+            return false;
+        }
+        compactRequested_ = true;
+        if (done) {
+            compactWaiters_.push_back(std::move(done));
+        }
+    }
+    wake_.notify_one();
+    return true;
+}
+
+StoreInfo RecordStore::Info() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return info_;
+}
+
+// Yazıcı thread'i
+void RecordStore::Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this]() {
+            return stopping_ || !pending_.empty() || !waiters_.empty() || compactRequested_;
+        });
+        if (pending_.empty() && waiters_.empty() && !compactRequested_) {
+            break;
+        }
+
+        std::string batch;
+        batch.swap(pending_);
+        std::vector<Undo> undo;
+        undo.swap(undo_);
+        std::vector<Completion> waiters;
+        waiters.swap(waiters_);
+        bool compact = compactRequested_;
+        compactRequested_ = false;
+        std::vector<Completion> compactWaiters;
+        compactWaiters.swap(compactWaiters_);
+        uint64_t snapshotBytes = info_.snapshotBytes;
+        lock.unlock();
+
+        bool success = true;
+        std::string error;
+        if (!batch.empty()) {
+            success = WriteBatch(batch, error);
+        }
+        if (!success) {
+            // Diske ulaşmayan commit'ler geri alınır; bu arada gelenler onların
+            // üzerine uygulandığı için önce onlar geri alınır ve aynı hatayla biter
+            lock.lock();
+            RollBack(undo_);
+            RollBack(undo);
+            pending_.clear();
+            waiters.insert(waiters.end(), std::make_move_iterator(waiters_.begin()),
+                           std::make_move_iterator(waiters_.end()));
+            waiters_.clear();
+            info_.keys = table_.size();
+            lock.unlock();
+        }
+        for (Completion& waiter : waiters) {
+            waiter(success, error);
+        }
+
+        bool compacted = false;
+        if (compact || (success && log_.Size() > kCompactMinBytes && log_.Size() > snapshotBytes)) {
+            std::string compactError;
+            compacted = CompactNow(compactError);
+            for (Completion& waiter : compactWaiters) {
+                waiter(compacted, compactError);
+            }
+        }
+
+        lock.lock();
+        if (!batch.empty() && success) {
+            info_.syncs++;
+        }
+        if (compacted) {
+            info_.compactions++;
+        }
+        info_.logBytes = log_.Size();
+    }
+}
+
+bool RecordStore::WriteBatch(const std::string& batch, std::string& error) {
+    uint64_t before = log_.Size();
+    if (log_.Append(batch.data(), batch.size(), error) && log_.Sync(error)) {
+        return true;
+    }
+    // Yarım yazım sonraki commit'lerin önünde kalmasın
+    std::string ignored;
+    log_.Truncate(before, ignored);
+    return false;
+}
+
+void RecordStore::RollBack(std::vector<Undo>& undo) {
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+        if (it->existed) {
+            table_[it->key] = std::move(it->value);
+        } else {
+            table_.erase(it->key);
+        }
+    }
+    undo.clear();
+}
+
+// Yazıcı thread'i; tablo kilit altında serileştirilir, snapshot dosya işleri kilitsiz
+bool RecordStore::CompactNow(std::string& error) {
+    std::string data(kSnapshotMagic, kMagicSize);
+    std::vector<Completion> waiters;
+    bool logged = true;
+    std::string logError;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Snapshot sadece diske ulaşmış durumu içermeli: loga henüz yazılmamış
+        // commit'ler önce yazılır (kilit altında, araya yeni commit giremez). Yoksa
+        // log boşaltıldıktan sonra bu yazım başarısız olursa onaylanmamış commit
+        // snapshot'ta kalırdı.
+        if (!pending_.empty()) {
+            waiters.swap(waiters_);
+            logged = WriteBatch(pending_, logError);
+            if (logged) {
+                undo_.clear();
+                info_.syncs++;
+            } else {
+                RollBack(undo_);
+                info_.keys = table_.size();
+            }
+            pending_.clear();
+        }
+
+        if (logged) {
+            size_t index = 0;
+            StoreOp op;
+            for (const auto& entry : table_) {
+                op.key = entry.first;
+                op.value = entry.second;
+                EncodeRecord(data, op, ++index == table_.size());
+            }
+        }
+    }
+    for (Completion& waiter : waiters) {
+        waiter(logged, logError);
+    }
+    if (!logged) {
+        error = logError;
+        return false;
+    }
+
+    std::string temporary = snapshotPath_ + ".tmp";
+    if (!storefile::WriteDurable(temporary, data.data(), data.size(), error) ||
+        !storefile::ReplaceDurable(temporary, snapshotPath_, error)) {
+        return false;
+    }
+    CrashPoint("after-replace");
+
+    // Snapshot kalıcı: log başlığa kadar kısaltılabilir
+    if (!log_.Truncate(kMagicSize, error) || !log_.Sync(error)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    info_.snapshotBytes = data.size();
+    info_.logBytes = log_.Size();
+    return true;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "store_file.h"
+
+// Çökmeye dayanıklı anahtar/değer deposu (sayfalar ve kısayollar)
+// Değişiklikler tüm dosyayı yeniden yazmak yerine <name>.log'a eklenir:
+//
+//   Commit(ops) -> bellekteki tablo hemen güncellenir (okumalar anında görür)
+//               -> kayıtlar bekleyen tampona eklenir
+//   yazıcı thread'i: tamponu tek write + tek fdatasync ile diske yazar; fsync
+//                    sürerken gelen commit'ler bir sonraki yazımda birleşir
+//                    (group commit), sonra tüm bekleyenlerin callback'i çağrılır
+//
+// Bir Commit'in kayıtları atomiktir: sonuncusu "commit" bayrağı taşır, açılışta
+// bayrağa ulaşmayan yarım grup (çökme / elektrik kesintisi) atılır ve log o
+// noktadan kısaltılır. Her kaydın 64 bit özeti vardır; bozuk kayıt da log sonu sayılır.
+// Log yazımı başarısız olursa diske ulaşmayan commit'ler (ve onların üzerine
+// gelenler) tablodan geri alınır ve callback'leri hatayla çağrılır; tablo her
+// zaman diskteki duruma döner.
+//
+// Log snapshot'tan büyüyünce (ve kCompactMinBytes'ı geçince) yazıcı thread'i
+// önce bekleyen commit'leri loga yazar (snapshot sadece diske ulaşmış durumu
+// içerir), tablonun tamamını <name>.snapshot.tmp'ye yazar, diske ulaşmasını bekler,
+// snapshot'ın üzerine taşır ve logu boşaltır. Taşıma ile boşaltma arasında
+// çökülürse eski log yeni snapshot'ın üzerine tekrar oynatılır; sırayla oynatılan
+// put/delete'ler aynı son durumu verdiği için bu zararsızdır.
+// Açılışta snapshot bellek eşlemesiyle (mmap) okunur.
+
+struct StoreOp {
+    std::string key;
+    std::string value;
+    bool remove = false;
+};
+
+struct StoreInfo {
+    bool open = false;
+    std::string path;
+    size_t keys = 0;
+    uint64_t logBytes = 0;
+    uint64_t snapshotBytes = 0;
+    uint64_t commits = 0;      // Commit çağrısı
+    uint64_t syncs = 0;        // fdatasync (commits / syncs = batch boyu)
+    uint64_t compactions = 0;
+    uint64_t recoveredBytes = 0; // Açılışta atılan yarım/bozuk log sonu
+};
+
+class RecordStore {
+public:
+    // Yazıcı thread'inden çağrılır; success=false ise error doludur
+    using Completion = std::function<void(bool success, const std::string& error)>;
+
+    // Log bu boyutu ve snapshot'ı geçince sıkıştırılır
+    static constexpr uint64_t kCompactMinBytes = 256 * 1024;
+
+    RecordStore() = default;
+    ~RecordStore();
+
+    RecordStore(const RecordStore&) = delete;
+    RecordStore& operator=(const RecordStore&) = delete;
+
+    // <dir>/<name>.snapshot + <dir>/<name>.log'u yükle ve yazıcı thread'ini başlat
+    bool Open(const std::string& dir, const std::string& name, std::string& error);
+
+    // Bekleyen yazımları bitir ve kapat
+    void Close();
+
+    bool IsOpen();
+
+    bool Get(const std::string& key, std::string& value);
+    std::vector<std::pair<std::string, std::string>> Entries();
+
+    // done nullptr olabilir (sonuç beklenmez)
+    bool Commit(const std::vector<StoreOp>& ops, Completion done, std::string& error);
+
+    // Bekleyen her şey diske yazılınca done çağrılır
+    bool Flush(Completion done, std::string& error);
+
+    // Boyuttan bağımsız sıkıştır
+    bool Compact(Completion done, std::string& error);
+
+    StoreInfo Info();
+
+    // Kayıt biçimi (bench ve kurtarma için dışarıda)
+    static void EncodeRecord(std::string& out, const StoreOp& op, bool commit);
+
+private:
+    // Commit'ten önceki değer (log yazımı başarısız olursa geri almak için)
+    struct Undo {
+        std::string key;
+        bool existed = false;
+        std::string value;
+    };
+
+    bool Load(std::string& error);
+    // data/size: dosya başlığından sonrası; dönen değer geçerli son commit'in sonu
+    size_t Replay(const uint8_t* data, size_t size, bool snapshot);
+    void Apply(const StoreOp& op);
+
+    void Run();
+    bool CompactNow(std::string& error);
+    // Yazıcı thread'i: tek append + sync; başarısızsa yarım yazım kısaltılır
+    bool WriteBatch(const std::string& batch, std::string& error);
+    // mutex_ tutulurken: undo'yu ters sırayla uygula ve boşalt
+    void RollBack(std::vector<Undo>& undo);
+
+    std::string dir_;
+    std::string name_;
+    std::string logPath_;
+    std::string snapshotPath_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::unordered_map<std::string, std::string> table_;
+    std::string pending_;
+    std::vector<Undo> undo_; // pending_'deki commit'lerin geri alma kayıtları
+    std::vector<Completion> waiters_;
+    std::vector<Completion> compactWaiters_;
+    bool compactRequested_ = false;
+    bool stopping_ = false;
+    bool open_ = false;
+    StoreInfo info_;
+
+    // Sadece yazıcı thread'i (ve Open/Close) dokunur
+    AppendFile log_;
+    std::thread thread_;
+};
+
+RecordStore& DefaultStore();
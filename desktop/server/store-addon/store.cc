@@ -0,0 +1,276 @@
+#include <napi.h>
+
+#include <string>
+#include <vector>
+
+#include "../native-common/metrics_napi.h"
+#include "record_store.h"
+
+// Sayfa/kısayol deposu (bkz. record_store.h)
+// Okumalar (get / entries) bellekteki tablodan senkron döner. commit() tabloyu
+// hemen günceller ve kayıtlar diske ulaşınca (fdatasync) çözülen bir Promise
+// döner; aynı anda gelen commit'ler yazıcı thread'inde tek fsync'te birleşir.
+
+// Çağrı metrikleri (getStats)
+// "sync" yazıcı thread'inde commit'ten diske ulaşmaya kadar geçen süredir.
+metrics::Registry storeMetrics("store");
+metrics::Api& syncMetrics = storeMetrics.Add("sync");
+
+// Promise'ler yazıcı thread'inden ana thread'e taşınır
+struct StoreJob {
+    Napi::Promise::Deferred deferred;
+    bool success = false;
+    std::string error;
+
+    explicit StoreJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+};
+
+class StoreCompletionQueue {
+public:
+    void Start(Napi::Env env) {
+        tsfn_ = Napi::ThreadSafeFunction::New(
+            env,
+            Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+            "storeSync",
+            0,
+            1
+        );
+        // Bekleyen yazım process'in kapanmasını engellemesin (Close bitirir)
+        tsfn_.Unref(env);
+        active_ = true;
+    }
+
+    void Stop() {
+        if (active_) {
+            active_ = false;
+            tsfn_.Release();
+        }
+    }
+
+    // Yazıcı thread'i
+    void Complete(StoreJob* job, bool success, const std::string& error) {
+        job->success = success;
+        job->error = error;
+
+        napi_status status = tsfn_.NonBlockingCall(job, [](Napi::Env env, Napi::Function, StoreJob* job) {
+            if (job->success) {
+                job->deferred.Resolve(Napi::Boolean::New(env, true));
+            } else {
+                job->deferred.Reject(Napi::Error::New(env, job->error).Value());
+            }
+            delete job;
+        });
+
+        if (status != napi_ok) {
+            // Modül kapanıyor, Promise artık çözülemez
+            delete job;
+        }
+    }
+
+private:
+    Napi::ThreadSafeFunction tsfn_;
+    bool active_ = false;
+};
+
+StoreCompletionQueue storeCompletion;
+
+// Başlatılamayan işin Promise'i hemen reddedilir
+Napi::Value RejectedPromise(Napi::Env env, const std::string& error) {
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    deferred.Reject(Napi::Error::New(env, error).Value());
+    return deferred.Promise();
+}
+
+Napi::Object InfoObject(Napi::Env env, const StoreInfo& info) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("open", Napi::Boolean::New(env, info.open));
+    result.Set("path", Napi::String::New(env, info.path));
+    result.Set("keys", Napi::Number::New(env, static_cast<double>(info.keys)));
+    result.Set("logBytes", Napi::Number::New(env, static_cast<double>(info.logBytes)));
+    result.Set("snapshotBytes", Napi::Number::New(env, static_cast<double>(info.snapshotBytes)));
+    result.Set("commits", Napi::Number::New(env, static_cast<double>(info.commits)));
+    result.Set("syncs", Napi::Number::New(env, static_cast<double>(info.syncs)));
+    result.Set("compactions", Napi::Number::New(env, static_cast<double>(info.compactions)));
+    result.Set("recoveredBytes", Napi::Number::New(env, static_cast<double>(info.recoveredBytes)));
+    return result;
+}
+
+// N-API: open(dir, name) - { success, keys, logBytes, snapshotBytes, recoveredBytes, error? }
+Napi::Value Open(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
+        Napi::TypeError::New(env, "Dizin ve depo adı bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string error;
+    bool success = DefaultStore().Open(info[0].As<Napi::String>().Utf8Value(),
+                                       info[1].As<Napi::String>().Utf8Value(), error);
+
+    Napi::Object result = InfoObject(env, DefaultStore().Info());
+    result.Set("success", Napi::Boolean::New(env, success));
+    if (!success) {
+        result.Set("error", Napi::String::New(env, error));
+    }
+    return result;
+}
+
+// N-API: close() - bekleyen yazımlar diske yazılır (senkron)
+Napi::Value Close(const Napi::CallbackInfo& info) {
+    DefaultStore().Close();
+    return info.Env().Undefined();
+}
+
+// N-API: get(key) - string veya null
+Napi::Value Get(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Anahtar bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string value;
+    if (!DefaultStore().Get(info[0].As<Napi::String>().Utf8Value(), value)) {
+        return env.Null();
+    }
+    return Napi::String::New(env, value);
+}
+
+// N-API: entries() - [[key, value], ...] (sıra tanımsız)
+Napi::Value Entries(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    std::vector<std::pair<std::string, std::string>> entries = DefaultStore().Entries();
+
+    Napi::Array list = Napi::Array::New(env, entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        Napi::Array entry = Napi::Array::New(env, 2);
+        entry.Set(0u, Napi::String::New(env, entries[i].first));
+        entry.Set(1u, Napi::String::New(env, entries[i].second));
+        list.Set(static_cast<uint32_t>(i), entry);
+    }
+    return list;
+}
+
+// N-API: commit([{ key, value }]) - value null/undefined ise anahtar silinir
+// Tüm liste atomiktir; Promise<true> kayıtlar diske ulaşınca çözülür.
+Napi::Value Commit(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsArray()) {
+        Napi::TypeError::New(env, "İşlem listesi bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Array list = info[0].As<Napi::Array>();
+    std::vector<StoreOp> ops;
+    ops.reserve(list.Length());
+    for (uint32_t i = 0; i < list.Length(); i++) {
+        Napi::Value item = list[i];
+        if (!item.IsObject()) {
+            Napi::TypeError::New(env, "İşlem { key, value } olmalı").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        Napi::Object object = item.As<Napi::Object>();
+        Napi::Value key = object.Get("key");
+        Napi::Value value = object.Get("value");
+        if (!key.IsString() || !(value.IsString() || value.IsNull() || value.IsUndefined())) {
+            Napi::TypeError::New(env, "key string, value string/null olmalı").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+
+        StoreOp op;
+        op.key = key.As<Napi::String>().Utf8Value();
+        op.remove = !value.IsString();
+        if (!op.remove) {
+            op.value = value.As<Napi::String>().Utf8Value();
+        }
+        ops.push_back(std::move(op));
+    }
+
+    StoreJob* job = new StoreJob(env);
+    Napi::Promise promise = job->deferred.Promise();
+    metrics::Clock::time_point start = metrics::Clock::now();
+
+    std::string error;
+    bool started = DefaultStore().Commit(ops, [job, start](bool success, const std::string& error) {
+        syncMetrics.Record(metrics::ElapsedNs(start), !success);
+        storeCompletion.Complete(job, success, error);
+    }, error);
+    if (!started) {
+        delete job;
+        return RejectedPromise(env, error);
+    }
+    return promise;
+}
+
+// N-API: flush() - Promise<true>, önceki tüm commit'ler diske ulaşınca
+Napi::Value Flush(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    StoreJob* job = new StoreJob(env);
+    Napi::Promise promise = job->deferred.Promise();
+
+    std::string error;
+    bool started = DefaultStore().Flush([job](bool success, const std::string& error) {
+        storeCompletion.Complete(job, success, error);
+    }, error);
+    if (!started) {
+        delete job;
+        return RejectedPromise(env, error);
+    }
+    return promise;
+}
+
+// N-API: compact() - Promise<true>, snapshot yazılıp log boşaltılınca
+Napi::Value Compact(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    StoreJob* job = new StoreJob(env);
+    Napi::Promise promise = job->deferred.Promise();
+
+    std::string error;
+    bool started = DefaultStore().Compact([job](bool success, const std::string& error) {
+        storeCompletion.Complete(job, success, error);
+    }, error);
+    if (!started) {
+        delete job;
+        return RejectedPromise(env, error);
+    }
+    return promise;
+}
+
+// N-API: getStoreInfo() - { open, path, keys, logBytes, snapshotBytes, commits, syncs, compactions, recoveredBytes }
+Napi::Value GetStoreInfo(const Napi::CallbackInfo& info) {
+    return InfoObject(info.Env(), DefaultStore().Info());
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), storeMetrics);
+}
+
+// Modül başlatma
+Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    storeCompletion.Start(env);
+
+    env.AddCleanupHook([]() {
+        // Önce depo: bekleyen commit'ler diske yazılır, sonra Promise kuyruğu kapanır
+        DefaultStore().Close();
+        storeCompletion.Stop();
+    });
+
+    metrics::Export(env, exports, storeMetrics, "open", Open);
+    metrics::Export(env, exports, storeMetrics, "close", Close);
+    metrics::Export(env, exports, storeMetrics, "get", Get);
+    metrics::Export(env, exports, storeMetrics, "entries", Entries);
+    metrics::Export(env, exports, storeMetrics, "commit", Commit);
+    metrics::Export(env, exports, storeMetrics, "flush", Flush);
+    metrics::Export(env, exports, storeMetrics, "compact", Compact);
+    metrics::Export(env, exports, storeMetrics, "getStoreInfo", GetStoreInfo);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
+    return exports;
+}
+
+NODE_API_MODULE(store, Init)
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Kayıt deposunun dosya katmanı (store_file_posix.cc / store_file_win.cc)
+// Tüm metodlar hata durumunda false döner ve error'a okunabilir bir mesaj yazar.
+
+// Sadece sona yazılan dosya (op log)
+class AppendFile {
+public:
+    AppendFile();
+    ~AppendFile();
+
+    AppendFile(const AppendFile&) = delete;
+    AppendFile& operator=(const AppendFile&) = delete;
+
+    // Yoksa oluşturur; truncate=true ise içeriği siler
+    bool Open(const std::string& path, bool truncate, std::string& error);
+    void Close();
+    bool IsOpen() const;
+
+    bool Append(const void* data, size_t size, std::string& error);
+
+    // Verinin diske ulaşmasını bekle (Linux: fdatasync, Windows: FlushFileBuffers)
+    bool Sync(std::string& error);
+
+    // Yarım kalan yazımı geri almak için
+    bool Truncate(uint64_t size, std::string& error);
+
+    uint64_t Size() const { return size_; }
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    uint64_t size_ = 0;
+};
+
+// Salt okunur bellek eşlemesi (snapshot okuma)
+// Dosya yoksa Open true döner ve Size() 0 olur.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path, std::string& error);
+    void Close();
+
+    const uint8_t* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+namespace storefile {
+
+bool FileExists(const std::string& path);
+
+// Dizin yoksa oluştur (tek seviye)
+bool EnsureDirectory(const std::string& path, std::string& error);
+
+// Dosyayı baştan yaz ve diske ulaşmasını bekle
+bool WriteDurable(const std::string& path, const void* data, size_t size, std::string& error);
+
+// from'u to'nun üzerine atomik olarak taşı; dizin kaydı da diske yazılır
+bool ReplaceDurable(const std::string& from, const std::string& to, std::string& error);
+
+std::string Join(const std::string& dir, const std::string& name);
+
+} // namespace storefile
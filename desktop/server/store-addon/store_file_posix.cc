@@ -0,0 +1,240 @@
+#include "store_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+// POSIX: O_APPEND ile açılan log, fdatasync; snapshot mmap ile okunur.
+// rename(2) aynı dosya sisteminde atomiktir; kalıcı olması için dizin de fsync edilir.
+
+namespace {
+
+std::string ErrnoMessage(const char* what, const std::string& path) {
+    return std::string(what) + " (" + path + "): " + std::strerror(errno);
+}
+
+std::string ParentDirectory(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    return slash == std::string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash);
+}
+
+bool WriteAll(int fd, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool SyncDirectory(const std::string& dir, std::string& error) {
+    int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        error = ErrnoMessage("Dizin açılamadı", dir);
+        return false;
+    }
+    bool ok = fsync(fd) == 0;
+    if (!ok) {
+        error = ErrnoMessage("Dizin diske yazılamadı", dir);
+    }
+    close(fd);
+    return ok;
+}
+
+} // namespace
+
+struct AppendFile::Impl {
+    int fd = -1;
+    std::string path;
+};
+
+AppendFile::AppendFile() : impl_(new Impl()) {}
+
+AppendFile::~AppendFile() {
+    Close();
+}
+
+bool AppendFile::Open(const std::string& path, bool truncate, std::string& error) {
+    Close();
+
+    int flags = O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC | (truncate ? O_TRUNC : 0);
+    int fd = open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        error = ErrnoMessage("Log açılamadı", path);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        error = ErrnoMessage("Log okunamadı", path);
+        close(fd);
+        return false;
+    }
+
+    impl_->fd = fd;
+    impl_->path = path;
+    size_ = static_cast<uint64_t>(info.st_size);
+    return true;
+}
+
+void AppendFile::Close() {
+    if (impl_->fd >= 0) {
+        close(impl_->fd);
+        impl_->fd = -1;
+    }
+    size_ = 0;
+}
+
+bool AppendFile::IsOpen() const {
+    return impl_->fd >= 0;
+}
+
+bool AppendFile::Append(const void* data, size_t size, std::string& error) {
+    if (!WriteAll(impl_->fd, static_cast<const uint8_t*>(data), size)) {
+        error = ErrnoMessage("Log yazılamadı", impl_->path);
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+bool AppendFile::Sync(std::string& error) {
+#if defined(__APPLE__)
+    int result = fcntl(impl_->fd, F_FULLFSYNC);
+#else
+    int result = fdatasync(impl_->fd);
+#endif
+    if (result != 0) {
+        error = ErrnoMessage("Log diske yazılamadı", impl_->path);
+        return false;
+    }
+    return true;
+}
+
+bool AppendFile::Truncate(uint64_t size, std::string& error) {
+    if (ftruncate(impl_->fd, static_cast<off_t>(size)) != 0) {
+        error = ErrnoMessage("Log kısaltılamadı", impl_->path);
+        return false;
+    }
+    size_ = size;
+    return true;
+}
+
+struct MappedFile::Impl {
+    void* base = nullptr;
+    size_t length = 0;
+};
+
+MappedFile::MappedFile() : impl_(new Impl()) {}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path, std::string& error) {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return true;
+        }
+        error = ErrnoMessage("Snapshot açılamadı", path);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        error = ErrnoMessage("Snapshot okunamadı", path);
+        close(fd);
+        return false;
+    }
+
+    size_t length = static_cast<size_t>(info.st_size);
+    if (length > 0) {
+        void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            error = ErrnoMessage("Snapshot eşlenemedi", path);
+            close(fd);
+            return false;
+        }
+        // Tek geçişte baştan sona okunur
+        madvise(base, length, MADV_SEQUENTIAL);
+        impl_->base = base;
+        impl_->length = length;
+        data_ = static_cast<const uint8_t*>(base);
+        size_ = length;
+    }
+    // Eşleme dosya tanıtıcısından bağımsız yaşar
+    close(fd);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (impl_->base) {
+        munmap(impl_->base, impl_->length);
+        impl_->base = nullptr;
+        impl_->length = 0;
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+namespace storefile {
+
+bool FileExists(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+}
+
+bool EnsureDirectory(const std::string& path, std::string& error) {
+    if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        error = ErrnoMessage("Dizin oluşturulamadı", path);
+        return false;
+    }
+    return true;
+}
+
+bool WriteDurable(const std::string& path, const void* data, size_t size, std::string& error) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = ErrnoMessage("Dosya açılamadı", path);
+        return false;
+    }
+
+    bool ok = WriteAll(fd, static_cast<const uint8_t*>(data), size);
+    if (!ok) {
+        error = ErrnoMessage("Dosya yazılamadı", path);
+    } else if (fsync(fd) != 0) {
+        error = ErrnoMessage("Dosya diske yazılamadı", path);
+        ok = false;
+    }
+    close(fd);
+    return ok;
+}
+
+bool ReplaceDurable(const std::string& from, const std::string& to, std::string& error) {
+    if (rename(from.c_str(), to.c_str()) != 0) {
+        error = ErrnoMessage("Dosya taşınamadı", to);
+        return false;
+    }
+    return SyncDirectory(ParentDirectory(to), error);
+}
+
+std::string Join(const std::string& dir, const std::string& name) {
+    if (dir.empty() || dir.back() == '/') {
+        return dir + name;
+    }
+    return dir + "/" + name;
+}
+
+} // namespace storefile
@@ -0,0 +1,235 @@
+#include "store_file.h"
+
+#include <windows.h>
+
+// Windows: log tek yazan thread'den dosya sonuna yazılır, FlushFileBuffers ile diske yazılır;
+// snapshot CreateFileMapping ile okunur. MoveFileEx(MOVEFILE_REPLACE_EXISTING |
+// MOVEFILE_WRITE_THROUGH) hedefi atomik olarak değiştirir ve işlem bitmeden dönmez.
+// Yollar UTF-8 gelir (Node), geniş karakterli API'lere çevrilir.
+
+namespace {
+
+std::wstring Utf8ToWide(const std::string& text) {
+    if (text.empty()) {
+        return std::wstring();
+    }
+    int size = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()), NULL, 0);
+    std::wstring wide(size, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()), &wide[0], size);
+    return wide;
+}
+
+std::string LastErrorMessage(const char* what, const std::string& path) {
+    return std::string(what) + " (" + path + "): Windows hata kodu " + std::to_string(GetLastError());
+}
+
+bool WriteAll(HANDLE file, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+        DWORD written = 0;
+        if (!WriteFile(file, data, chunk, &written, NULL)) {
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+} // namespace
+
+struct AppendFile::Impl {
+    HANDLE file = INVALID_HANDLE_VALUE;
+    std::string path;
+};
+
+AppendFile::AppendFile() : impl_(new Impl()) {}
+
+AppendFile::~AppendFile() {
+    Close();
+}
+
+bool AppendFile::Open(const std::string& path, bool truncate, std::string& error) {
+    Close();
+
+    // SetEndOfFile (Truncate) için GENERIC_WRITE gerekir; Append konumu kendisi ayarlar
+    HANDLE file = CreateFileW(Utf8ToWide(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ, NULL, truncate ? CREATE_ALWAYS : OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = LastErrorMessage("Log açılamadı", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        error = LastErrorMessage("Log okunamadı", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    impl_->file = file;
+    impl_->path = path;
+    size_ = static_cast<uint64_t>(size.QuadPart);
+    return true;
+}
+
+void AppendFile::Close() {
+    if (impl_->file != INVALID_HANDLE_VALUE) {
+        CloseHandle(impl_->file);
+        impl_->file = INVALID_HANDLE_VALUE;
+    }
+    size_ = 0;
+}
+
+bool AppendFile::IsOpen() const {
+    return impl_->file != INVALID_HANDLE_VALUE;
+}
+
+bool AppendFile::Append(const void* data, size_t size, std::string& error) {
+    LARGE_INTEGER end;
+    end.QuadPart = 0;
+    if (!SetFilePointerEx(impl_->file, end, NULL, FILE_END) ||
+        !WriteAll(impl_->file, static_cast<const uint8_t*>(data), size)) {
+        error = LastErrorMessage("Log yazılamadı", impl_->path);
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+bool AppendFile::Sync(std::string& error) {
+    if (!FlushFileBuffers(impl_->file)) {
+        error = LastErrorMessage("Log diske yazılamadı", impl_->path);
+        return false;
+    }
+    return true;
+}
+
+bool AppendFile::Truncate(uint64_t size, std::string& error) {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(impl_->file, position, NULL, FILE_BEGIN) || !SetEndOfFile(impl_->file)) {
+        error = LastErrorMessage("Log kısaltılamadı", impl_->path);
+        return false;
+    }
+    size_ = size;
+    return true;
+}
+
+struct MappedFile::Impl {
+    HANDLE mapping = NULL;
+    const void* view = nullptr;
+};
+
+MappedFile::MappedFile() : impl_(new Impl()) {}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path, std::string& error) {
+    Close();
+
+    HANDLE file = CreateFileW(Utf8ToWide(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        if (GetLastError() == ERROR_FILE_NOT_FOUND) {
+            return true;
+        }
+        error = LastErrorMessage("Snapshot açılamadı", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        error = LastErrorMessage("Snapshot okunamadı", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    // Boş dosya eşlenemez
+    if (size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            error = LastErrorMessage("Snapshot eşlenemedi", path);
+            if (mapping) {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            return false;
+        }
+        impl_->mapping = mapping;
+        impl_->view = view;
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(size.QuadPart);
+    }
+    // Eşleme dosya tanıtıcısından bağımsız yaşar
+    CloseHandle(file);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (impl_->view) {
+        UnmapViewOfFile(impl_->view);
+        impl_->view = nullptr;
+    }
+    if (impl_->mapping) {
+        CloseHandle(impl_->mapping);
+        impl_->mapping = NULL;
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+namespace storefile {
+
+bool FileExists(const std::string& path) {
+    return GetFileAttributesW(Utf8ToWide(path).c_str()) != INVALID_FILE_ATTRIBUTES;
+}
+
+bool EnsureDirectory(const std::string& path, std::string& error) {
+    if (!CreateDirectoryW(Utf8ToWide(path).c_str(), NULL) && GetLastError() != ERROR_ALREADY_EXISTS) {
+        error = LastErrorMessage("Dizin oluşturulamadı", path);
+        return false;
+    }
+    return true;
+}
+
+bool WriteDurable(const std::string& path, const void* data, size_t size, std::string& error) {
+    HANDLE file = CreateFileW(Utf8ToWide(path).c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = LastErrorMessage("Dosya açılamadı", path);
+        return false;
+    }
+
+    bool ok = WriteAll(file, static_cast<const uint8_t*>(data), size);
+    if (!ok) {
+        error = LastErrorMessage("Dosya yazılamadı", path);
+    } else if (!FlushFileBuffers(file)) {
+        error = LastErrorMessage("Dosya diske yazılamadı", path);
+        ok = false;
+    }
+    CloseHandle(file);
+    return ok;
+}
+
+bool ReplaceDurable(const std::string& from, const std::string& to, std::string& error) {
+    if (!MoveFileExW(Utf8ToWide(from).c_str(), Utf8ToWide(to).c_str(),
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        error = LastErrorMessage("Dosya taşınamadı", to);
+        return false;
+    }
+    return true;
+}
+
+std::string Join(const std::string& dir, const std::string& name) {
+    if (dir.empty() || dir.back() == '\\' || dir.back() == '/') {
+        return dir + name;
+    }
+    return dir + "\\" + name;
+}
+
+} // namespace storefile
@@ -0,0 +1,23 @@
+// Kayıt deposu: sıkıştırma ortasında çökme (snapshot taşındı, log boşaltılmadı) ve
+// log yazımı başarısız olan commit'in geri alınması (bkz. test/record_store_crash_test.cc).
+// Test programı derlenmemişse atlanır.
+//
+// Çalıştırma: node --test test/ (önce node-gyp rebuild)
+
+const test = require('node:test');
+const assert = require('node:assert');
+const { spawnSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+const CRASH_TEST = path.join(__dirname, '..', 'build', 'Release', 'record_store_crash_test');
+
+test('sıkıştırma çökmesi ve başarısız log yazımı veri kaybettirmez', (t) => {
+  if (process.platform !== 'linux' || !fs.existsSync(CRASH_TEST)) {
+    t.skip('record_store_crash_test derlenmemiş');
+    return;
+  }
+
+  const result = spawnSync(CRASH_TEST, [], { encoding: 'utf8', timeout: 30000 });
+  assert.strictEqual(result.status, 0, `${result.stdout}${result.stderr}`);
+});
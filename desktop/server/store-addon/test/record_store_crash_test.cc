@@ -0,0 +1,236 @@
+// Kayıt deposu çökme / yazma hatası testi
+//   - sıkıştırma sırasında snapshot taşındıktan sonra, log boşaltılmadan önce
+//     süreç öldürülür (RECORD_STORE_CRASH=after-replace); yeniden açılışta eski log
+//     yeni snapshot'ın üzerine oynatılır ve onaylanmış tüm commit'ler görünmelidir
+//   - log yazımı başarısız olan commit (RLIMIT_FSIZE ile EFBIG) tablodan geri alınır
+//
+// Derleme: node-gyp rebuild (build/Release/record_store_crash_test, -DRECORD_STORE_CRASH_TEST)
+// Çalıştırma: ./build/Release/record_store_crash_test (veya node --test test/)
+
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../record_store.h"
+
+namespace {
+
+const char kName[] = "pages";
+
+int failures = 0;
+
+void Check(bool ok, const std::string& what) {
+    std::printf("  %s %s\n", ok ? "ok  " : "HATA", what.c_str());
+    if (!ok) {
+        failures++;
+    }
+}
+
+// Bir işin tamamlanmasını bekle (Completion yazıcı thread'inden gelir)
+class Waiter {
+public:
+    RecordStore::Completion Callback() {
+        return [this](bool success, const std::string& error) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+            success_ = success;
+            error_ = error;
+            cv_.notify_one();
+        };
+    }
+
+    bool Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return done_; });
+        done_ = false;
+        return success_;
+    }
+
+    const std::string& Error() const { return error_; }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    bool success_ = false;
+    std::string error_;
+};
+
+StoreOp Put(const std::string& key, const std::string& value) {
+    StoreOp op;
+    op.key = key;
+    op.value = value;
+    return op;
+}
+
+StoreOp Delete(const std::string& key) {
+    StoreOp op;
+    op.key = key;
+    op.remove = true;
+    return op;
+}
+
+bool CommitAndWait(RecordStore& store, const std::vector<StoreOp>& ops) {
+    Waiter waiter;
+    std::string error;
+    return store.Commit(ops, waiter.Callback(), error) && waiter.Wait();
+}
+
+std::map<std::string, std::string> Contents(RecordStore& store) {
+    std::vector<std::pair<std::string, std::string>> entries = store.Entries();
+    return std::map<std::string, std::string>(entries.begin(), entries.end());
+}
+
+uint64_t FileSize(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+}
+
+// Çocuk süreç: düzenlemeler, ardından sıkıştırma ortasında SIGKILL
+[[noreturn]] void CrashingWriter(const std::string& dir) {
+    RecordStore store;
+    std::string error;
+    if (!store.Open(dir, kName, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        _exit(2);
+    }
+
+    for (int i = 0; i < 100; i++) {
+        CommitAndWait(store, { Put("s:" + std::to_string(i), "v" + std::to_string(i)) });
+    }
+    CommitAndWait(store, { Put("s:7", "yeni"), Delete("s:8"), Put("order", "1,2,3") });
+    // Onay beklenmeden sıkıştırma istenir: commit snapshot'tan önce loga yazılmalı
+    std::string ignored;
+    store.Commit({ Put("son", "onaysız") }, nullptr, ignored);
+
+    setenv("RECORD_STORE_CRASH", "after-replace", 1);
+    Waiter compacted;
+    store.Compact(compacted.Callback(), error);
+    compacted.Wait();
+    _exit(3); // Buraya gelinmemeli
+}
+
+void TestCrashBetweenReplaceAndTruncate(const std::string& dir) {
+    std::printf("Sıkıştırma ortasında çökme\n");
+    std::fflush(stdout);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        CrashingWriter(dir);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    Check(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL, "süreç taşıma ile boşaltma arasında öldü");
+
+    std::string logPath = dir + "/" + kName + ".log";
+    std::string snapshotPath = dir + "/" + kName + ".snapshot";
+    Check(FileSize(snapshotPath) > 0, "yeni snapshot yerinde");
+    Check(FileSize(logPath) > 8, "log boşaltılmamış");
+
+    std::map<std::string, std::string> expected;
+    for (int i = 0; i < 100; i++) {
+        expected["s:" + std::to_string(i)] = "v" + std::to_string(i);
+    }
+    expected["s:7"] = "yeni";
+    expected.erase("s:8");
+    expected["order"] = "1,2,3";
+    expected["son"] = "onaysız";
+
+    RecordStore store;
+    std::string error;
+    Check(store.Open(dir, kName, error), "yeniden açıldı " + error);
+    Check(Contents(store) == expected, "eski log snapshot üzerine oynatıldı, durum aynı");
+    Check(store.Info().recoveredBytes == 0, "log sonunda atılan yarım kayıt yok");
+
+    // Depo kullanılmaya devam eder; normal sıkıştırma logu boşaltır
+    Check(CommitAndWait(store, { Put("s:9", "sonra") }), "çökme sonrası commit");
+    expected["s:9"] = "sonra";
+    Waiter compacted;
+    Check(store.Compact(compacted.Callback(), error) && compacted.Wait(), "sıkıştırma");
+    Check(store.Info().logBytes == 8, "log boşaltıldı");
+    store.Close();
+
+    Check(store.Open(dir, kName, error) && Contents(store) == expected, "kapat / aç sonrası durum aynı");
+    store.Close();
+}
+
+void TestFailedWriteRollsBack(const std::string& dir) {
+    std::printf("Log yazımı başarısız\n");
+
+    RecordStore store;
+    std::string error;
+    Check(store.Open(dir, kName, error), "açıldı " + error);
+    Check(CommitAndWait(store, { Put("a", "1"), Put("silinecek", "x") }), "ilk commit");
+
+    // Dosya boyutu sınırı: sonraki büyük yazım EFBIG ile başarısız olur
+    signal(SIGXFSZ, SIG_IGN);
+    rlimit original;
+    getrlimit(RLIMIT_FSIZE, &original);
+    rlimit limited = original;
+    limited.rlim_cur = static_cast<rlim_t>(store.Info().logBytes + 64);
+    setrlimit(RLIMIT_FSIZE, &limited);
+
+    Waiter failed;
+    store.Commit({ Put("a", std::string(4096, 'z')), Put("b", "yeni"), Delete("silinecek") },
+                 failed.Callback(), error);
+    bool success = failed.Wait();
+    setrlimit(RLIMIT_FSIZE, &original);
+
+    Check(!success && !failed.Error().empty(), "commit hatayla bitti: " + failed.Error());
+    std::string value;
+    Check(store.Get("a", value) && value == "1", "a eski değerine döndü");
+    Check(!store.Get("b", value), "b geri alındı");
+    Check(store.Get("silinecek", value) && value == "x", "silinen kayıt geri geldi");
+    Check(store.Info().keys == 2, "anahtar sayısı 2");
+
+    Check(CommitAndWait(store, { Put("c", "3") }), "sınır kalkınca commit");
+    store.Close();
+
+    std::map<std::string, std::string> expected = { { "a", "1" }, { "silinecek", "x" }, { "c", "3" } };
+    Check(store.Open(dir, kName, error) && Contents(store) == expected, "diskteki durum tabloyla aynı");
+    store.Close();
+}
+
+std::string TempDir() {
+    const char* base = std::getenv("TMPDIR");
+    std::string pattern = std::string(base ? base : "/tmp") + "/record-store-XXXXXX";
+    std::vector<char> buffer(pattern.begin(), pattern.end());
+    buffer.push_back('\0');
+    return mkdtemp(buffer.data()) ? std::string(buffer.data()) : "";
+}
+
+void RemoveDir(const std::string& dir) {
+    for (const char* suffix : { ".log", ".snapshot", ".snapshot.tmp" }) {
+        unlink((dir + "/" + kName + suffix).c_str());
+    }
+    rmdir(dir.c_str());
+}
+
+} // namespace
+
+int main() {
+    std::string crashDir = TempDir();
+    std::string failDir = TempDir();
+    if (crashDir.empty() || failDir.empty()) {
+        std::printf("Geçici dizin oluşturulamadı\n");
+        return 1;
+    }
+
+    TestCrashBetweenReplaceAndTruncate(crashDir);
+    TestFailedWriteRollsBack(failDir);
+
+    RemoveDir(crashDir);
+    RemoveDir(failDir);
+    std::printf("%s\n", failures == 0 ? "BAŞARILI" : "BAŞARISIZ");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+#include "audio_endpoint.h"
+
+EndpointController& DefaultEndpoint() {
+    static EndpointController controller;
+    return controller;
+}
+
+float EndpointController::ClampVolume(float volume) {
+    // 0-100 arasına sınırla
+    if (volume < 0.0f) volume = 0.0f;
+    if (volume > 100.0f) volume = 100.0f;
+    return volume;
+}
+
+void EndpointController::SetChangeListener(ChangeListener listener) {
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        listener_ = std::move(listener);
+    }
+
+    // Bağlantıyı (ve Linux'ta aboneliği) hemen kur ki ilk değişiklik kaçmasın
+    Info();
+}
+
+void EndpointController::NotifyChange(bool known, float volume, bool mute) {
+    std::lock_guard<std::mutex> lock(listenerMutex_);
+    if (listener_) {
+        listener_(known, volume, mute);
+    }
+}
+
+void EndpointController::UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    testMode_ = mode;
+    recorder_ = recorder;
+}
+
+bool EndpointController::GetVolume(float& volume) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeGetVolume(volume);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    volume = testVolume_;
+    return true;
+}
+
+bool EndpointController::SetVolume(float volume) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeSetVolume(volume);
+    }
+
+    bool mute;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        testVolume_ = ClampVolume(volume);
+        volume = testVolume_;
+        mute = testMute_;
+    }
+    recorder_->Record("volume", "master", volume);
+    NotifyChange(true, volume, mute);
+    return true;
+}
+
+bool EndpointController::GetMute(bool& mute) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeGetMute(mute);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    mute = testMute_;
+    return true;
+}
+
+bool EndpointController::SetMute(bool mute) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeSetMute(mute);
+    }
+
+    float volume;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        testMute_ = mute;
+        volume = testVolume_;
+    }
+    recorder_->Record("mute", "master", mute ? 1 : 0);
+    NotifyChange(true, volume, mute);
+    return true;
+}
+
+EndpointInfo EndpointController::Info() {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeInfo();
+    }
+    return { testbackend::ModeName(testMode_), true, "Test cihazı", "" };
+}
+
+#if !defined(_WIN32) && !defined(__linux__)
+// Desteklenmeyen platformlar için dummy implementation
+
+struct EndpointController::Impl {};
+
+EndpointController::EndpointController() : impl_(new Impl()) {}
+
+EndpointController::~EndpointController() = default;
+
+bool EndpointController::NativeGetVolume(float& volume) {
+    volume = 50.0f;
+    return false;
+}
+
+bool EndpointController::NativeSetVolume(float volume) {
+    return false;
+}
+
+bool EndpointController::NativeGetMute(bool& mute) {
+    mute = false;
+    return false;
+}
+
+bool EndpointController::NativeSetMute(bool mute) {
+    return false;
+}
+
+EndpointInfo EndpointController::NativeInfo() {
+    return { "none", false, "", "Bu platform desteklenmiyor" };
+}
+
+void EndpointController::Shutdown() {}
+
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "../native-common/test_backend.h"
+
+// Varsayılan ses çıkış cihazının kalıcı denetleyicisi
+// Cihaz ve ses arayüzleri (Windows: IMMDevice + IAudioEndpointVolume,
+// Linux: pa_threaded_mainloop + pa_context) process boyunca bir kez açılır;
+// her çağrıda yeniden oluşturulmaz. Varsayılan cihaz değiştiğinde sadece
+// bir sonraki çağrıda yeniden bağlanılır (rebind).
+//
+// Tüm metodlar thread-safe'dir (tek bir mutex ile sıralanır).
+//
+// Ses/mute değişiklikleri (başka uygulama, donanım tuşları, bizim yazdıklarımız)
+// backend'in kendi thread'inden ChangeListener'a bildirilir.
+//
+// UseTestBackend ile null / recording moduna alınırsa platform backend'i hiç
+// açılmaz: ses ve mute bellekte tutulur, yazımlar kaydedilir ve dinleyiciye
+// yazan thread'den bildirilir.
+
+struct EndpointInfo {
+    const char* backend;
+    bool ready;
+    std::string device;
+    std::string error;
+};
+
+// Değişiklik bildirimi (backend thread'inden çağrılır)
+// known=false: değerler bilinmiyor (ör. varsayılan cihaz değişti); dinleyici
+// değerleri Get* ile yeniden okumalı (bu da yeniden bağlanmayı tetikler). Get*
+// backend thread'ine istek gönderip beklediği için bildirimin içinden çağrılmaz.
+using ChangeListener = std::function<void(bool known, float volume, bool mute)>;
+
+class EndpointController {
+public:
+    EndpointController();
+    ~EndpointController();
+
+    EndpointController(const EndpointController&) = delete;
+    EndpointController& operator=(const EndpointController&) = delete;
+
+    // Ses seviyesi 0-100 arası
+    bool GetVolume(float& volume);
+    bool SetVolume(float volume);
+
+    bool GetMute(bool& mute);
+    bool SetMute(bool mute);
+
+    EndpointInfo Info();
+
+    // Değişiklik dinleyicisini ayarla (boş fonksiyon = kaldır)
+    // Linux'ta abonelik bağlantıyla kurulduğu için bağlantı burada açılır.
+    void SetChangeListener(ChangeListener listener);
+
+    // Backend'ler tarafından çağrılır (herhangi bir thread)
+    void NotifyChange(bool known, float volume, bool mute);
+
+    // Arayüzleri serbest bırak (modül kapanırken)
+    void Shutdown();
+
+    // Test backend'ini seç (modül yüklenirken, ilk çağrıdan önce bir kez)
+    void UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder);
+
+    static float ClampVolume(float volume);
+
+private:
+    struct Impl;
+
+    // Platform backend'i (audio_endpoint_pulse.cc / audio_endpoint_win.cc)
+    bool NativeGetVolume(float& volume);
+    bool NativeSetVolume(float volume);
+    bool NativeGetMute(bool& mute);
+    bool NativeSetMute(bool mute);
+    EndpointInfo NativeInfo();
+
+    std::mutex mutex_;
+    std::unique_ptr<Impl> impl_;
+
+    std::mutex listenerMutex_;
+    ChangeListener listener_;
+
+    testbackend::Mode testMode_ = testbackend::Mode::kNative;
+    testbackend::Recorder* recorder_ = nullptr;
+    float testVolume_ = 50.0f; // mutex_ ile korunur
+    bool testMute_ = false;
+};
+
+// Process genelindeki varsayılan cihaz denetleyicisi
+EndpointController& DefaultEndpoint();
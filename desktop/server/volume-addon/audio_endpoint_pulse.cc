@@ -0,0 +1,357 @@
+#include "audio_endpoint.h"
+
+#include <pulse/pulseaudio.h>
+#include <atomic>
+
+#include "pulse_mainloop.h"
+
+// Linux: PulseAudio (PipeWire'da pipewire-pulse) üzerinden varsayılan sink
+// Kalıcı bir pa_threaded_mainloop + pa_context process boyunca açık kalır.
+// Sunucunun varsayılan sink'i değiştiğinde (veya bağlı sink kaldırıldığında)
+// abonelik callback'i "stale" bayrağını işaretler; bir sonraki çağrı yeniden bağlanır.
+// Bağlantı koparsa (sunucu yeniden başlatıldı) bir sonraki çağrıda yeniden kurulur.
+// Bağlı sink'in değişiklik eventleri mainloop thread'inde asenkron bir sorguyla
+// okunup dinleyiciye iletilir (mainloop thread'i hiçbir zaman beklemez).
+
+struct EndpointController::Impl {
+    EndpointController* owner = nullptr;
+    pa_threaded_mainloop* mainloop = nullptr;
+    pa_context* context = nullptr;
+    std::atomic<bool> stale{true};
+    std::atomic<uint32_t> sinkIndex{PA_INVALID_INDEX};
+    std::string sinkName;
+    std::string description;
+    pa_cvolume volume;
+    bool mute = false;
+    std::string error;
+
+    // Tek bir sorgunun sonucu (callback -> bekleyen çağıran)
+    struct Request {
+        Impl* impl;
+        bool done = false;
+        bool success = false;
+        std::string sinkName;
+    };
+
+    static void ContextStateCallback(pa_context*, void* userdata) {
+        Impl* impl = static_cast<Impl*>(userdata);
+        pa_threaded_mainloop_signal(impl->mainloop, 0);
+    }
+
+    static void SubscribeCallback(pa_context*, pa_subscription_event_type_t type, uint32_t index, void* userdata) {
+        Impl* impl = static_cast<Impl*>(userdata);
+        unsigned facility = type & PA_SUBSCRIPTION_EVENT_FACILITY_MASK;
+        unsigned kind = type & PA_SUBSCRIPTION_EVENT_TYPE_MASK;
+
+        if (facility == PA_SUBSCRIPTION_EVENT_SERVER) {
+            // Varsayılan sink değişmiş olabilir; değerler yeniden okunmalı
+            impl->stale.store(true);
+            impl->owner->NotifyChange(false, 0.0f, false);
+        } else if (facility == PA_SUBSCRIPTION_EVENT_SINK && index == impl->sinkIndex.load()) {
+            if (kind == PA_SUBSCRIPTION_EVENT_REMOVE) {
+                impl->stale.store(true);
+                impl->owner->NotifyChange(false, 0.0f, false);
+            } else if (kind == PA_SUBSCRIPTION_EVENT_CHANGE) {
+                // Ses/mute değişti: yeni değerleri asenkron oku (burada beklenemez)
+                pa_operation* operation = pa_context_get_sink_info_by_index(impl->context, index, NotifySinkInfoCallback, impl);
+                if (operation) {
+                    pa_operation_unref(operation);
+                }
+            }
+        }
+    }
+
+    static void NotifySinkInfoCallback(pa_context*, const pa_sink_info* info, int eol, void* userdata) {
+        Impl* impl = static_cast<Impl*>(userdata);
+        if (eol != 0 || !info) {
+            return;
+        }
+
+        // Önbellek mainloop kilidi altında güncellenir (callback'ler kilitli çalışır)
+        impl->volume = info->volume;
+        impl->mute = info->mute != 0;
+        impl->owner->NotifyChange(true, static_cast<float>(pa_cvolume_max(&info->volume)) * 100.0f / PA_VOLUME_NORM, info->mute != 0);
+    }
+
+    static void ServerInfoCallback(pa_context*, const pa_server_info* info, void* userdata) {
+        Request* request = static_cast<Request*>(userdata);
+        if (info && info->default_sink_name) {
+            request->sinkName = info->default_sink_name;
+            request->success = true;
+        }
+        request->done = true;
+        pa_threaded_mainloop_signal(request->impl->mainloop, 0);
+    }
+
+    static void SinkInfoCallback(pa_context*, const pa_sink_info* info, int eol, void* userdata) {
+        Request* request = static_cast<Request*>(userdata);
+        if (eol == 0 && info) {
+            Impl* impl = request->impl;
+            impl->sinkIndex.store(info->index);
+            impl->sinkName = info->name ? info->name : "";
+            impl->description = info->description ? info->description : impl->sinkName;
+            impl->volume = info->volume;
+            impl->mute = info->mute != 0;
+            request->success = true;
+            return; // eol ile tekrar çağrılır
+        }
+        request->done = true;
+        pa_threaded_mainloop_signal(request->impl->mainloop, 0);
+    }
+
+    static void SuccessCallback(pa_context*, int success, void* userdata) {
+        Request* request = static_cast<Request*>(userdata);
+        request->success = success != 0;
+        request->done = true;
+        pa_threaded_mainloop_signal(request->impl->mainloop, 0);
+    }
+
+    // Mainloop kilidi tutulurken çağrılır: işlem bitene kadar bekle
+    bool Wait(pa_operation* operation, Request& request) {
+        if (!operation) {
+            return false;
+        }
+
+        while (!request.done && pa_operation_get_state(operation) == PA_OPERATION_RUNNING) {
+            pa_threaded_mainloop_wait(mainloop);
+        }
+        pa_operation_unref(operation);
+
+        return request.success;
+    }
+
+    bool Connected() {
+        if (!context) {
+            return false;
+        }
+        MainloopLock lock(mainloop);
+        return pa_context_get_state(context) == PA_CONTEXT_READY;
+    }
+
+    bool Connect() {
+        Disconnect();
+
+        mainloop = pa_threaded_mainloop_new();
+        if (!mainloop) {
+            error = "pa_threaded_mainloop oluşturulamadı";
+            return false;
+        }
+
+        context = pa_context_new(pa_threaded_mainloop_get_api(mainloop), "LocalDesk");
+        if (!context) {
+            error = "pa_context oluşturulamadı";
+            Disconnect();
+            return false;
+        }
+
+        pa_context_set_state_callback(context, ContextStateCallback, this);
+        pa_context_set_subscribe_callback(context, SubscribeCallback, this);
+
+        if (pa_context_connect(context, nullptr, PA_CONTEXT_NOAUTOSPAWN, nullptr) < 0 ||
+            pa_threaded_mainloop_start(mainloop) < 0) {
+            error = std::string("PulseAudio sunucusuna bağlanılamadı: ") + pa_strerror(pa_context_errno(context));
+            Disconnect();
+            return false;
+        }
+
+        if (!WaitReady()) {
+            error = std::string("PulseAudio sunucusuna bağlanılamadı: ") + pa_strerror(pa_context_errno(context));
+            Disconnect();
+            return false;
+        }
+
+        return true;
+    }
+
+    // Context hazır olana kadar bekle ve değişikliklere abone ol
+    bool WaitReady() {
+        MainloopLock lock(mainloop);
+
+        for (;;) {
+            pa_context_state_t state = pa_context_get_state(context);
+            if (state == PA_CONTEXT_READY) {
+                break;
+            }
+            if (!PA_CONTEXT_IS_GOOD(state)) {
+                return false;
+            }
+            pa_threaded_mainloop_wait(mainloop);
+        }
+
+        // Sunucu (varsayılan sink) ve sink değişikliklerine abone ol
+        pa_operation* operation = pa_context_subscribe(
+            context,
+            static_cast<pa_subscription_mask_t>(PA_SUBSCRIPTION_MASK_SERVER | PA_SUBSCRIPTION_MASK_SINK),
+            nullptr,
+            nullptr
+        );
+        if (operation) {
+            pa_operation_unref(operation);
+        }
+
+        return true;
+    }
+
+    void Disconnect() {
+        if (mainloop) {
+            pa_threaded_mainloop_stop(mainloop);
+        }
+        if (context) {
+            pa_context_disconnect(context);
+            pa_context_unref(context);
+            context = nullptr;
+        }
+        if (mainloop) {
+            pa_threaded_mainloop_free(mainloop);
+            mainloop = nullptr;
+        }
+        sinkIndex.store(PA_INVALID_INDEX);
+        stale.store(true);
+    }
+
+    // Mainloop kilidi tutulurken: varsayılan sink'i bul ve durumunu oku
+    bool BindDefaultSink() {
+        Request serverRequest{this};
+        if (!Wait(pa_context_get_server_info(context, ServerInfoCallback, &serverRequest), serverRequest)) {
+            error = "Varsayılan sink bulunamadı";
+            return false;
+        }
+
+        Request sinkRequest{this};
+        if (!Wait(pa_context_get_sink_info_by_name(context, serverRequest.sinkName.c_str(), SinkInfoCallback, &sinkRequest), sinkRequest)) {
+            error = "Sink bilgisi alınamadı: " + serverRequest.sinkName;
+            return false;
+        }
+
+        error.clear();
+        return true;
+    }
+
+    // Bağlantıyı ve sink'i hazırla; çağıran mainloop kilidini Ensure'dan sonra alır
+    bool Ensure() {
+        if (!Connected() && !Connect()) {
+            return false;
+        }
+
+        if (!stale.exchange(false)) {
+            return true;
+        }
+
+        MainloopLock lock(mainloop);
+        if (!BindDefaultSink()) {
+            stale.store(true);
+            return false;
+        }
+        return true;
+    }
+
+    // Mainloop kilidi tutulurken: bağlı sink'in güncel durumunu oku
+    bool RefreshSink() {
+        Request request{this};
+        return Wait(pa_context_get_sink_info_by_index(context, sinkIndex.load(), SinkInfoCallback, &request), request);
+    }
+};
+
+EndpointController::EndpointController() : impl_(new Impl()) {
+    impl_->owner = this;
+}
+
+EndpointController::~EndpointController() {
+    impl_->Disconnect();
+}
+
+bool EndpointController::NativeGetVolume(float& volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    volume = 50.0f;
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+    if (!impl_->RefreshSink()) {
+        impl_->stale.store(true);
+        return false;
+    }
+
+    // En yüksek kanal (Windows master scalar ile aynı anlam), PA_VOLUME_NORM = %100
+    volume = static_cast<float>(pa_cvolume_max(&impl_->volume)) * 100.0f / PA_VOLUME_NORM;
+    return true;
+}
+
+bool EndpointController::NativeSetVolume(float volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+
+    // Kanal dengesi korunarak en yüksek kanal hedef seviyeye ölçeklenir
+    pa_volume_t target = static_cast<pa_volume_t>(ClampVolume(volume) / 100.0f * PA_VOLUME_NORM + 0.5f);
+    pa_cvolume scaled = impl_->volume;
+    if (pa_cvolume_max(&scaled) == PA_VOLUME_MUTED) {
+        pa_cvolume_set(&scaled, scaled.channels, target);
+    } else {
+        pa_cvolume_scale(&scaled, target);
+    }
+
+    Impl::Request request{impl_.get()};
+    if (!impl_->Wait(pa_context_set_sink_volume_by_index(impl_->context, impl_->sinkIndex.load(), &scaled, Impl::SuccessCallback, &request), request)) {
+        impl_->stale.store(true);
+        return false;
+    }
+
+    impl_->volume = scaled;
+    return true;
+}
+
+bool EndpointController::NativeGetMute(bool& mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mute = false;
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+    if (!impl_->RefreshSink()) {
+        impl_->stale.store(true);
+        return false;
+    }
+
+    mute = impl_->mute;
+    return true;
+}
+
+bool EndpointController::NativeSetMute(bool mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+
+    Impl::Request request{impl_.get()};
+    if (!impl_->Wait(pa_context_set_sink_mute_by_index(impl_->context, impl_->sinkIndex.load(), mute ? 1 : 0, Impl::SuccessCallback, &request), request)) {
+        impl_->stale.store(true);
+        return false;
+    }
+
+    impl_->mute = mute;
+    return true;
+}
+
+EndpointInfo EndpointController::NativeInfo() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    bool ready = impl_->Ensure();
+    return { "pulseaudio", ready, ready ? impl_->description : "", ready ? "" : impl_->error };
+}
+
+void EndpointController::Shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->Disconnect();
+}
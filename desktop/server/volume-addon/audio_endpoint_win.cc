@@ -0,0 +1,361 @@
+#include "audio_endpoint.h"
+
+#include <windows.h>
+#include <initguid.h>
+#include <mmdeviceapi.h>
+#include <endpointvolume.h>
+#include <audioclient.h>
+#include <functiondiscoverykeys_devpkey.h>
+#include <atomic>
+
+#include "com_mta.h"
+
+#pragma comment(lib, "ole32.lib")
+#pragma comment(lib, "oleaut32.lib")
+
+// Windows: IMMDeviceEnumerator bir kez oluşturulur, varsayılan render cihazı ve
+// IAudioEndpointVolume arayüzü saklanır. IMMNotificationClient varsayılan cihaz
+// değişikliğinde sadece "stale" bayrağını işaretler; yeniden bağlanma bir sonraki
+// çağrıda yapılır. Tüm arayüzler MTA'da oluşturulur ve kullanılır (bkz. com_mta.h):
+// zamanlayıcı thread'i (MTA) ile JS thread'i (STA) aynı nesnelere erişir.
+// Bağlı cihaza IAudioEndpointVolumeCallback kaydedilir; bildirim zaten yeni
+// seviye ve mute durumunu taşıdığı için ek sorgu yapılmaz.
+
+namespace {
+
+std::string WideToUtf8(LPCWSTR text) {
+    if (!text) {
+        return "";
+    }
+
+    int size = WideCharToMultiByte(CP_UTF8, 0, text, -1, NULL, 0, NULL, NULL);
+    if (size <= 1) {
+        return "";
+    }
+
+    std::string result(size - 1, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, text, -1, &result[0], size, NULL, NULL);
+    return result;
+}
+
+// Cihaz değişikliklerini izler (COM'un kendi thread'inden çağrılır)
+class DeviceChangeListener : public IMMNotificationClient {
+public:
+    DeviceChangeListener(std::shared_ptr<std::atomic<bool>> stale, EndpointController* owner)
+        : stale_(std::move(stale)), owner_(owner) {}
+
+    ULONG STDMETHODCALLTYPE AddRef() override {
+        return InterlockedIncrement(&refs_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override {
+        ULONG refs = InterlockedDecrement(&refs_);
+        if (refs == 0) {
+            delete this;
+        }
+        return refs;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(IMMNotificationClient)) {
+            *ppv = static_cast<IMMNotificationClient*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = NULL;
+        return E_NOINTERFACE;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDefaultDeviceChanged(EDataFlow flow, ERole role, LPCWSTR) override {
+        if (flow == eRender && role == eConsole) {
+            stale_->store(true);
+            // Yeni cihazın değerleri bilinmiyor, dinleyici yeniden okuyacak
+            owner_->NotifyChange(false, 0.0f, false);
+        }
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDeviceStateChanged(LPCWSTR, DWORD) override {
+        // Bağlı cihaz çıkarılmış/devre dışı bırakılmış olabilir
+        stale_->store(true);
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDeviceAdded(LPCWSTR) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnDeviceRemoved(LPCWSTR) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnPropertyValueChanged(LPCWSTR, const PROPERTYKEY) override { return S_OK; }
+
+private:
+    LONG refs_ = 1;
+    std::shared_ptr<std::atomic<bool>> stale_;
+    EndpointController* owner_;
+};
+
+// Bağlı cihazın ses/mute değişiklikleri (COM'un kendi thread'inden çağrılır)
+class VolumeChangeListener : public IAudioEndpointVolumeCallback {
+public:
+    explicit VolumeChangeListener(EndpointController* owner) : owner_(owner) {}
+
+    ULONG STDMETHODCALLTYPE AddRef() override {
+        return InterlockedIncrement(&refs_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override {
+        ULONG refs = InterlockedDecrement(&refs_);
+        if (refs == 0) {
+            delete this;
+        }
+        return refs;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(IAudioEndpointVolumeCallback)) {
+            *ppv = static_cast<IAudioEndpointVolumeCallback*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = NULL;
+        return E_NOINTERFACE;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnNotify(PAUDIO_VOLUME_NOTIFICATION_DATA data) override {
+        if (data) {
+            owner_->NotifyChange(true, data->fMasterVolume * 100.0f, data->bMuted == TRUE);
+        }
+        return S_OK;
+    }
+
+private:
+    LONG refs_ = 1;
+    EndpointController* owner_;
+};
+
+} // namespace
+
+struct EndpointController::Impl {
+    EndpointController* owner = NULL;
+    IMMDeviceEnumerator* enumerator = NULL;
+    IMMDevice* device = NULL;
+    IAudioEndpointVolume* endpointVolume = NULL;
+    DeviceChangeListener* listener = NULL;
+    VolumeChangeListener* volumeListener = NULL;
+    std::shared_ptr<std::atomic<bool>> stale = std::make_shared<std::atomic<bool>>(true);
+    std::string deviceName;
+    std::string error;
+
+    // Enumerator'ı ve bildirim dinleyicisini oluştur (bir kez)
+    bool CreateEnumerator() {
+        if (enumerator) {
+            return true;
+        }
+
+        // MTA'da (RunInMta içinden) çağrılır
+        HRESULT hr = CoCreateInstance(
+            __uuidof(MMDeviceEnumerator),
+            NULL,
+            CLSCTX_ALL,
+            __uuidof(IMMDeviceEnumerator),
+            (void**)&enumerator
+        );
+        if (FAILED(hr)) {
+            enumerator = NULL;
+            error = "MMDeviceEnumerator oluşturulamadı";
+            return false;
+        }
+
+        listener = new DeviceChangeListener(stale, owner);
+        if (FAILED(enumerator->RegisterEndpointNotificationCallback(listener))) {
+            // Bildirim olmadan da çalışır; cihaz geçersiz olunca hata kodundan anlaşılır
+            listener->Release();
+            listener = NULL;
+        }
+
+        return true;
+    }
+
+    void ReleaseDevice() {
+        if (endpointVolume) {
+            if (volumeListener) {
+                endpointVolume->UnregisterControlChangeNotify(volumeListener);
+                volumeListener->Release();
+                volumeListener = NULL;
+            }
+            endpointVolume->Release();
+            endpointVolume = NULL;
+        }
+        if (device) {
+            device->Release();
+            device = NULL;
+        }
+    }
+
+    // Varsayılan render cihazına bağlan
+    bool Bind() {
+        ReleaseDevice();
+
+        if (!CreateEnumerator()) {
+            return false;
+        }
+
+        HRESULT hr = enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &device);
+        if (FAILED(hr)) {
+            device = NULL;
+            error = "Varsayılan ses cihazı bulunamadı";
+            return false;
+        }
+
+        hr = device->Activate(__uuidof(IAudioEndpointVolume), CLSCTX_ALL, NULL, (void**)&endpointVolume);
+        if (FAILED(hr)) {
+            endpointVolume = NULL;
+            ReleaseDevice();
+            error = "IAudioEndpointVolume alınamadı";
+            return false;
+        }
+
+        volumeListener = new VolumeChangeListener(owner);
+        if (FAILED(endpointVolume->RegisterControlChangeNotify(volumeListener))) {
+            volumeListener->Release();
+            volumeListener = NULL;
+        }
+
+        deviceName.clear();
+        IPropertyStore* store = NULL;
+        if (SUCCEEDED(device->OpenPropertyStore(STGM_READ, &store))) {
+            PROPVARIANT name;
+            PropVariantInit(&name);
+            if (SUCCEEDED(store->GetValue(PKEY_Device_FriendlyName, &name)) && name.vt == VT_LPWSTR) {
+                deviceName = WideToUtf8(name.pwszVal);
+            }
+            PropVariantClear(&name);
+            store->Release();
+        }
+
+        error.clear();
+        return true;
+    }
+
+    // Gerekirse yeniden bağlan
+    bool Ensure() {
+        if (!stale->exchange(false) && endpointVolume) {
+            return true;
+        }
+
+        if (!Bind()) {
+            stale->store(true);
+            return false;
+        }
+        return true;
+    }
+
+    // Arayüz çağrısı; cihaz geçersizleştiyse bir kez yeniden bağlanıp tekrar dene
+    template <typename Fn>
+    bool Call(Fn fn) {
+        if (!Ensure()) {
+            return false;
+        }
+
+        HRESULT hr = fn(endpointVolume);
+        if (hr == AUDCLNT_E_DEVICE_INVALIDATED) {
+            stale->store(true);
+            if (!Ensure()) {
+                return false;
+            }
+            hr = fn(endpointVolume);
+        }
+
+        return SUCCEEDED(hr);
+    }
+
+    void Shutdown() {
+        ReleaseDevice();
+
+        if (enumerator) {
+            if (listener) {
+                enumerator->UnregisterEndpointNotificationCallback(listener);
+                listener->Release();
+                listener = NULL;
+            }
+            enumerator->Release();
+            enumerator = NULL;
+        }
+
+        stale->store(true);
+    }
+};
+
+EndpointController::EndpointController() : impl_(new Impl()) {
+    impl_->owner = this;
+}
+
+EndpointController::~EndpointController() {
+    // COM process kapanırken zaten yıkılmış olabilir; Shutdown modül temizliğinde çağrılır
+}
+
+bool EndpointController::NativeGetVolume(float& volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    float scalar = 0.5f;
+    bool success = false;
+    RunInMta([&]() {
+        success = impl_->Call([&](IAudioEndpointVolume* endpoint) {
+            return endpoint->GetMasterVolumeLevelScalar(&scalar);
+        });
+    });
+
+    // 0.0 - 1.0 -> 0-100
+    volume = scalar * 100.0f;
+    return success;
+}
+
+bool EndpointController::NativeSetVolume(float volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    float scalar = ClampVolume(volume) / 100.0f;
+    bool success = false;
+    RunInMta([&]() {
+        success = impl_->Call([&](IAudioEndpointVolume* endpoint) {
+            return endpoint->SetMasterVolumeLevelScalar(scalar, NULL);
+        });
+    });
+    return success;
+}
+
+bool EndpointController::NativeGetMute(bool& mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    BOOL value = FALSE;
+    bool success = false;
+    RunInMta([&]() {
+        success = impl_->Call([&](IAudioEndpointVolume* endpoint) {
+            return endpoint->GetMute(&value);
+        });
+    });
+
+    mute = value == TRUE;
+    return success;
+}
+
+bool EndpointController::NativeSetMute(bool mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    bool success = false;
+    RunInMta([&]() {
+        success = impl_->Call([&](IAudioEndpointVolume* endpoint) {
+            return endpoint->SetMute(mute ? TRUE : FALSE, NULL);
+        });
+    });
+    return success;
+}
+
+EndpointInfo EndpointController::NativeInfo() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    bool ready = false;
+    RunInMta([&]() { ready = impl_->Ensure(); });
+    return { "wasapi", ready, impl_->deviceName, ready ? "" : impl_->error };
+}
+
+void EndpointController::Shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RunInMta([this]() { impl_->Shutdown(); });
+}
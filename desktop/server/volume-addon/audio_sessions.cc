@@ -0,0 +1,170 @@
+#include "audio_sessions.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "audio_endpoint.h"
+
+SessionTable& DefaultSessions() {
+    static SessionTable table;
+    return table;
+}
+
+std::string SessionTable::NormalizeKey(const std::string& app) {
+    std::string key = app;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return key;
+}
+
+// Akış başına girdileri (streams=1) uygulama başına birleştir, ilk görülme sırası korunur
+void SessionTable::MergeStreams(std::vector<AppSessionInfo>& sessions) {
+    std::vector<AppSessionInfo> merged;
+    merged.reserve(sessions.size());
+
+    for (AppSessionInfo& stream : sessions) {
+        auto it = std::find_if(merged.begin(), merged.end(), [&](const AppSessionInfo& app) {
+            return app.app == stream.app;
+        });
+        if (it == merged.end()) {
+            merged.push_back(std::move(stream));
+            continue;
+        }
+        it->volume = std::max(it->volume, stream.volume);
+        it->mute = it->mute && stream.mute;
+        it->streams += stream.streams;
+    }
+
+    sessions.swap(merged);
+}
+
+void SessionTable::UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    testMode_ = mode;
+    recorder_ = recorder;
+    testStreams_.clear();
+    if (mode == testbackend::Mode::kNative) {
+        return;
+    }
+
+    // Deck'te tipik uygulamalar; discord iki akışla (birleştirme yolu da ölçülsün)
+    auto add = [&](const char* app, const char* name, uint32_t pid, float volume) {
+        AppSessionInfo stream;
+        stream.app = app;
+        stream.name = name;
+        stream.pid = pid;
+        stream.volume = volume;
+        stream.streams = 1;
+        testStreams_.push_back(std::move(stream));
+    };
+    add("spotify", "Spotify", 1001, 80.0f);
+    add("discord", "Discord", 1002, 60.0f);
+    add("discord", "Discord", 1003, 60.0f);
+    add("firefox", "Firefox", 1004, 100.0f);
+}
+
+bool SessionTable::Snapshot(std::vector<AppSessionInfo>& streams) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeSnapshot(streams);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams = testStreams_;
+    return true;
+}
+
+bool SessionTable::SetVolume(const std::string& app, float volume) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeSetVolume(app, volume);
+    }
+
+    std::string key = NormalizeKey(app);
+    volume = EndpointController::ClampVolume(volume);
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (AppSessionInfo& stream : testStreams_) {
+            if (stream.app == key) {
+                stream.volume = volume;
+                found = true;
+            }
+        }
+    }
+    if (found) {
+        recorder_->Record("app-volume", key, volume);
+    }
+    return found;
+}
+
+bool SessionTable::SetMute(const std::string& app, bool mute) {
+    if (testMode_ == testbackend::Mode::kNative) {
+        return NativeSetMute(app, mute);
+    }
+
+    std::string key = NormalizeKey(app);
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (AppSessionInfo& stream : testStreams_) {
+            if (stream.app == key) {
+                stream.mute = mute;
+                found = true;
+            }
+        }
+    }
+    if (found) {
+        recorder_->Record("app-mute", key, mute ? 1 : 0);
+    }
+    return found;
+}
+
+bool SessionTable::List(std::vector<AppSessionInfo>& sessions) {
+    sessions.clear();
+    if (!Snapshot(sessions)) {
+        return false;
+    }
+    MergeStreams(sessions);
+    return true;
+}
+
+bool SessionTable::Get(const std::string& app, AppSessionInfo& session) {
+    std::vector<AppSessionInfo> sessions;
+    if (!List(sessions)) {
+        return false;
+    }
+
+    std::string key = NormalizeKey(app);
+    for (AppSessionInfo& entry : sessions) {
+        if (entry.app == key) {
+            session = std::move(entry);
+            return true;
+        }
+    }
+    return false;
+}
+
+#if !defined(_WIN32) && !defined(__linux__)
+// Desteklenmeyen platformlar için dummy implementation
+
+struct SessionTable::Impl {};
+
+SessionTable::SessionTable() : impl_(new Impl()) {}
+
+SessionTable::~SessionTable() = default;
+
+bool SessionTable::NativeSnapshot(std::vector<AppSessionInfo>& streams) {
+    return false;
+}
+
+bool SessionTable::NativeSetVolume(const std::string& app, float volume) {
+    return false;
+}
+
+bool SessionTable::NativeSetMute(const std::string& app, bool mute) {
+    return false;
+}
+
+void SessionTable::Shutdown() {}
+
+#endif
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../native-common/test_backend.h"
+
+// Uygulama başına ses oturumları
+// Windows: varsayılan render cihazının IAudioSessionManager2'si,
+// Linux: PulseAudio sink-input'ları.
+//
+// Oturumlar process boyunca tutulan bir tabloda önbelleğe alınır. Tablo bir kez
+// doldurulur, sonra backend bildirimleriyle (oturum oluştu/kapandı, ses değişti)
+// artımlı olarak güncellenir; okumalar her çağrıda yeniden listeleme yapmaz.
+//
+// Uygulama anahtarı küçük harfli çalıştırılabilir dosya adıdır (ör. "discord.exe",
+// "paplay"). Aynı uygulamanın birden fazla akışı tek girdi olarak görünür; yazımlar
+// tüm akışlara uygulanır.
+//
+// Test modunda (UseTestBackend) tablo sabit, sentetik oturumlarla doldurulur ve
+// yazımlar platform backend'i yerine kaydedilir.
+
+struct AppSessionInfo {
+    std::string app;        // Uygulama anahtarı
+    std::string name;       // Görünen ad
+    uint32_t pid = 0;       // İlk akışın process ID'si
+    float volume = 0.0f;    // 0-100, akışların en yükseği
+    bool mute = false;      // Tüm akışlar sessizse true
+    uint32_t streams = 0;   // Oturum / sink-input sayısı
+};
+
+class SessionTable {
+public:
+    SessionTable();
+    ~SessionTable();
+
+    SessionTable(const SessionTable&) = delete;
+    SessionTable& operator=(const SessionTable&) = delete;
+
+    // Tablonun anlık görüntüsü (uygulama başına bir girdi)
+    bool List(std::vector<AppSessionInfo>& sessions);
+
+    // app: uygulama anahtarı (büyük/küçük harf duyarsız)
+    bool Get(const std::string& app, AppSessionInfo& session);
+    bool SetVolume(const std::string& app, float volume);
+    bool SetMute(const std::string& app, bool mute);
+
+    // Arayüzleri serbest bırak (modül kapanırken)
+    void Shutdown();
+
+    // Test backend'ini seç (modül yüklenirken, ilk çağrıdan önce bir kez)
+    void UseTestBackend(testbackend::Mode mode, testbackend::Recorder* recorder);
+
+    // Karşılaştırma için anahtarı normalize et
+    static std::string NormalizeKey(const std::string& app);
+
+private:
+    struct Impl;
+
+    // Backend: akış başına birer girdi (streams=1), önbellekten okunur
+    bool Snapshot(std::vector<AppSessionInfo>& streams);
+    static void MergeStreams(std::vector<AppSessionInfo>& sessions);
+
+    // Platform backend'i (audio_sessions_pulse.cc / audio_sessions_win.cc)
+    bool NativeSnapshot(std::vector<AppSessionInfo>& streams);
+    bool NativeSetVolume(const std::string& app, float volume);
+    bool NativeSetMute(const std::string& app, bool mute);
+
+    std::mutex mutex_;
+    std::unique_ptr<Impl> impl_;
+
+    testbackend::Mode testMode_ = testbackend::Mode::kNative;
+    testbackend::Recorder* recorder_ = nullptr;
+    std::vector<AppSessionInfo> testStreams_; // mutex_ ile korunur
+};
+
+// Process genelindeki oturum tablosu
+SessionTable& DefaultSessions();
@@ -0,0 +1,318 @@
+#include "audio_sessions.h"
+
+#include <pulse/pulseaudio.h>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "audio_endpoint.h"
+#include "pulse_mainloop.h"
+
+// Linux: PulseAudio sink-input'ları uygulama oturumu olarak
+// Ana ses denetleyicisinden bağımsız, kendi pa_threaded_mainloop + pa_context'i
+// vardır. Bağlanınca sink-input listesi bir kez okunur; sonrasında SINK_INPUT
+// abonelik eventleri tabloyu mainloop thread'inde günceller (NEW/CHANGE: tek girdi
+// asenkron okunur, REMOVE: girdi silinir). Tablo mainloop kilidiyle korunur.
+// Test: `pactl load-module module-null-sink` + `paplay --device=null ...`
+
+namespace {
+
+struct Stream {
+    std::string app;
+    std::string name;
+    uint32_t pid = 0;
+    pa_cvolume volume;
+    bool mute = false;
+    bool writable = true;
+};
+
+} // namespace
+
+struct SessionTable::Impl {
+    pa_threaded_mainloop* mainloop = nullptr;
+    pa_context* context = nullptr;
+    // Sink-input index -> akış (mainloop kilidi altında)
+    std::unordered_map<uint32_t, Stream> streams;
+
+    // Tek bir sorgunun sonucu (callback -> bekleyen çağıran)
+    struct Request {
+        Impl* impl;
+        bool done = false;
+        bool success = false;
+    };
+
+    static void ContextStateCallback(pa_context*, void* userdata) {
+        Impl* impl = static_cast<Impl*>(userdata);
+        pa_threaded_mainloop_signal(impl->mainloop, 0);
+    }
+
+    static void Store(Impl* impl, const pa_sink_input_info* info) {
+        const char* binary = pa_proplist_gets(info->proplist, PA_PROP_APPLICATION_PROCESS_BINARY);
+        const char* name = pa_proplist_gets(info->proplist, PA_PROP_APPLICATION_NAME);
+        const char* pid = pa_proplist_gets(info->proplist, PA_PROP_APPLICATION_PROCESS_ID);
+
+        Stream& stream = impl->streams[info->index];
+        // Binary yoksa (ör. bazı PipeWire istemcileri) uygulama adı anahtar olur
+        stream.app = NormalizeKey(binary ? binary : (name ? name : "unknown"));
+        stream.name = name ? name : stream.app;
+        stream.pid = pid ? static_cast<uint32_t>(std::strtoul(pid, nullptr, 10)) : 0;
+        stream.volume = info->volume;
+        stream.mute = info->mute != 0;
+        stream.writable = info->volume_writable != 0;
+    }
+
+    static void SubscribeCallback(pa_context*, pa_subscription_event_type_t type, uint32_t index, void* userdata) {
+        Impl* impl = static_cast<Impl*>(userdata);
+        if ((type & PA_SUBSCRIPTION_EVENT_FACILITY_MASK) != PA_SUBSCRIPTION_EVENT_SINK_INPUT) {
+            return;
+        }
+
+        if ((type & PA_SUBSCRIPTION_EVENT_TYPE_MASK) == PA_SUBSCRIPTION_EVENT_REMOVE) {
+            impl->streams.erase(index);
+            return;
+        }
+
+        // Yeni akış veya ses/mute değişikliği: sadece bu girdiyi asenkron oku
+        pa_operation* operation = pa_context_get_sink_input_info(impl->context, index, UpdateCallback, impl);
+        if (operation) {
+            pa_operation_unref(operation);
+        }
+    }
+
+    static void UpdateCallback(pa_context*, const pa_sink_input_info* info, int eol, void* userdata) {
+        if (eol != 0 || !info) {
+            return;
+        }
+        Store(static_cast<Impl*>(userdata), info);
+    }
+
+    static void ListCallback(pa_context*, const pa_sink_input_info* info, int eol, void* userdata) {
+        Request* request = static_cast<Request*>(userdata);
+        if (eol == 0 && info) {
+            Store(request->impl, info);
+            return; // eol ile tekrar çağrılır
+        }
+        request->success = eol > 0;
+        request->done = true;
+        pa_threaded_mainloop_signal(request->impl->mainloop, 0);
+    }
+
+    static void SuccessCallback(pa_context*, int success, void* userdata) {
+        Request* request = static_cast<Request*>(userdata);
+        request->success = success != 0;
+        request->done = true;
+        pa_threaded_mainloop_signal(request->impl->mainloop, 0);
+    }
+
+    // Mainloop kilidi tutulurken çağrılır: işlem bitene kadar bekle
+    bool Wait(pa_operation* operation, Request& request) {
+        if (!operation) {
+            return false;
+        }
+
+        while (!request.done && pa_operation_get_state(operation) == PA_OPERATION_RUNNING) {
+            pa_threaded_mainloop_wait(mainloop);
+        }
+        pa_operation_unref(operation);
+
+        return request.success;
+    }
+
+    bool Connected() {
+        if (!context) {
+            return false;
+        }
+        MainloopLock lock(mainloop);
+        return pa_context_get_state(context) == PA_CONTEXT_READY;
+    }
+
+    bool Connect() {
+        Disconnect();
+
+        mainloop = pa_threaded_mainloop_new();
+        if (!mainloop) {
+            return false;
+        }
+
+        context = pa_context_new(pa_threaded_mainloop_get_api(mainloop), "LocalDesk Sessions");
+        if (!context) {
+            Disconnect();
+            return false;
+        }
+
+        pa_context_set_state_callback(context, ContextStateCallback, this);
+        pa_context_set_subscribe_callback(context, SubscribeCallback, this);
+
+        if (pa_context_connect(context, nullptr, PA_CONTEXT_NOAUTOSPAWN, nullptr) < 0 ||
+            pa_threaded_mainloop_start(mainloop) < 0 ||
+            !Populate()) {
+            Disconnect();
+            return false;
+        }
+
+        return true;
+    }
+
+    // Context hazır olunca abone ol, sonra mevcut sink-input'ları bir kez listele
+    // (Abonelik önce kurulur ki listeleme sırasında açılan akış kaçmasın.)
+    bool Populate() {
+        MainloopLock lock(mainloop);
+
+        for (;;) {
+            pa_context_state_t state = pa_context_get_state(context);
+            if (state == PA_CONTEXT_READY) {
+                break;
+            }
+            if (!PA_CONTEXT_IS_GOOD(state)) {
+                return false;
+            }
+            pa_threaded_mainloop_wait(mainloop);
+        }
+
+        pa_operation* operation = pa_context_subscribe(context, PA_SUBSCRIPTION_MASK_SINK_INPUT, nullptr, nullptr);
+        if (operation) {
+            pa_operation_unref(operation);
+        }
+
+        streams.clear();
+        Request request{this};
+        return Wait(pa_context_get_sink_input_info_list(context, ListCallback, &request), request);
+    }
+
+    void Disconnect() {
+        if (mainloop) {
+            pa_threaded_mainloop_stop(mainloop);
+        }
+        if (context) {
+            pa_context_disconnect(context);
+            pa_context_unref(context);
+            context = nullptr;
+        }
+        if (mainloop) {
+            pa_threaded_mainloop_free(mainloop);
+            mainloop = nullptr;
+        }
+        streams.clear();
+    }
+
+    // Bağlantı koptuysa (sunucu yeniden başlatıldı) yeniden kur ve tabloyu doldur
+    bool Ensure() {
+        return Connected() || Connect();
+    }
+
+    // Mainloop kilidi tutulurken: uygulamanın akışlarına işlem uygula
+    // volumeOnly: ses seviyesi yazılamayan akışlar (volume_writable=0) atlanır.
+    // apply(index, stream) sunucu işlemi onaylayınca önbelleğe yazar; bekleme sırasında
+    // kilit bırakıldığı için akış index ile yeniden aranır (bu arada kapanmış olabilir).
+    // İşlenecek akış yoksa veya bir işlem başarısızsa false.
+    template <typename Fn, typename Apply>
+    bool ForEachStream(const std::string& key, bool volumeOnly, Fn fn, Apply apply) {
+        struct Pending {
+            uint32_t index;
+            pa_operation* operation;
+            Request* request;
+        };
+        std::vector<Pending> pending;
+        for (auto& entry : streams) {
+            if (entry.second.app != key || (volumeOnly && !entry.second.writable)) {
+                continue;
+            }
+            Request* request = new Request{this};
+            pending.push_back({ entry.first, fn(entry.first, entry.second, request), request });
+        }
+
+        // İstekler tek seferde gönderilir, cevaplar birlikte beklenir
+        bool success = !pending.empty();
+        for (Pending& operation : pending) {
+            bool done = Wait(operation.operation, *operation.request);
+            delete operation.request;
+            if (done) {
+                auto stream = streams.find(operation.index);
+                if (stream != streams.end()) {
+                    apply(operation.index, stream->second);
+                }
+            }
+            success = done && success;
+        }
+        return success;
+    }
+};
+
+SessionTable::SessionTable() : impl_(new Impl()) {}
+
+SessionTable::~SessionTable() {
+    impl_->Disconnect();
+}
+
+bool SessionTable::NativeSnapshot(std::vector<AppSessionInfo>& sessions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+    sessions.reserve(impl_->streams.size());
+    for (const auto& entry : impl_->streams) {
+        const Stream& stream = entry.second;
+        AppSessionInfo info;
+        info.app = stream.app;
+        info.name = stream.name;
+        info.pid = stream.pid;
+        info.volume = static_cast<float>(pa_cvolume_max(&stream.volume)) * 100.0f / PA_VOLUME_NORM;
+        info.mute = stream.mute;
+        info.streams = 1;
+        sessions.push_back(std::move(info));
+    }
+    return true;
+}
+
+bool SessionTable::NativeSetVolume(const std::string& app, float volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    pa_volume_t target = static_cast<pa_volume_t>(EndpointController::ClampVolume(volume) / 100.0f * PA_VOLUME_NORM + 0.5f);
+
+    // Akış başına istenen seviye; önbelleğe sunucu onaylayınca yazılır
+    std::unordered_map<uint32_t, pa_cvolume> requested;
+
+    MainloopLock mainloopLock(impl_->mainloop);
+    return impl_->ForEachStream(NormalizeKey(app), true, [&](uint32_t index, Stream& stream, Impl::Request* request) {
+        // Kanal dengesi korunarak en yüksek kanal hedef seviyeye ölçeklenir
+        pa_cvolume scaled = stream.volume;
+        if (pa_cvolume_max(&scaled) == PA_VOLUME_MUTED) {
+            pa_cvolume_set(&scaled, scaled.channels, target);
+        } else {
+            pa_cvolume_scale(&scaled, target);
+        }
+        requested[index] = scaled;
+        return pa_context_set_sink_input_volume(impl_->context, index, &scaled, Impl::SuccessCallback, request);
+    }, [&](uint32_t index, Stream& stream) {
+        auto volume = requested.find(index);
+        if (volume != requested.end()) {
+            stream.volume = volume->second;
+        }
+    });
+}
+
+bool SessionTable::NativeSetMute(const std::string& app, bool mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!impl_->Ensure()) {
+        return false;
+    }
+
+    MainloopLock mainloopLock(impl_->mainloop);
+    return impl_->ForEachStream(NormalizeKey(app), false, [&](uint32_t index, Stream&, Impl::Request* request) {
+        return pa_context_set_sink_input_mute(impl_->context, index, mute ? 1 : 0, Impl::SuccessCallback, request);
+    }, [&](uint32_t, Stream& stream) {
+        stream.mute = mute;
+    });
+}
+
+void SessionTable::Shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->Disconnect();
+}
@@ -0,0 +1,551 @@
+#include "audio_sessions.h"
+
+#include <windows.h>
+#include <mmdeviceapi.h>
+#include <audiopolicy.h>
+#include <audioclient.h>
+#include <atomic>
+
+#include "audio_endpoint.h"
+#include "com_mta.h"
+
+// Windows: varsayılan render cihazının IAudioSessionManager2'si
+// Bağlanınca oturumlar bir kez listelenir. Sonrasında:
+// - IAudioSessionNotification yeni oturumları bekleyen listesine ekler (COM thread'i);
+//   bir sonraki çağrıda çağıranın thread'inde tabloya alınır. Olay callback'i
+//   içinde oturum kaydı yapılmaz (Microsoft'un uyarısı).
+// - Her oturumun IAudioSessionEvents'i ses/mute değerlerini önbelleğe yazar ve
+//   kapanan (expired/disconnected) oturumu işaretler; işaretliler tablodan çıkarılır.
+// - Varsayılan cihaz değişirse (IMMNotificationClient) tablo yeniden kurulur.
+// Ses denetleyicisi gibi tüm arayüzler MTA'da oluşturulur ve kullanılır (bkz. com_mta.h);
+// "çağıranın thread'i" MTA'daki thread'dir.
+
+namespace {
+
+std::string WideToUtf8(LPCWSTR text) {
+    if (!text) {
+        return "";
+    }
+
+    int size = WideCharToMultiByte(CP_UTF8, 0, text, -1, NULL, 0, NULL, NULL);
+    if (size <= 1) {
+        return "";
+    }
+
+    std::string result(size - 1, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, text, -1, &result[0], size, NULL, NULL);
+    return result;
+}
+
+// Process ID -> çalıştırılabilir dosya adı (ör. "Discord.exe")
+std::string ExeNameForPid(DWORD pid) {
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+    if (!process) {
+        return "";
+    }
+
+    WCHAR path[MAX_PATH];
+    DWORD size = MAX_PATH;
+    std::string name;
+    if (QueryFullProcessImageNameW(process, 0, path, &size)) {
+        LPCWSTR base = path;
+        for (LPCWSTR p = path; *p; p++) {
+            if (*p == L'\\') {
+                base = p + 1;
+            }
+        }
+        name = WideToUtf8(base);
+    }
+
+    CloseHandle(process);
+    return name;
+}
+
+// Oturumun önbellekteki durumu; COM olay thread'i buraya yazar
+struct SessionState {
+    std::atomic<float> volume{0.0f};
+    std::atomic<bool> mute{false};
+    std::atomic<bool> expired{false};
+};
+
+class SessionEvents : public IAudioSessionEvents {
+public:
+    explicit SessionEvents(std::shared_ptr<SessionState> state) : state_(std::move(state)) {}
+
+    ULONG STDMETHODCALLTYPE AddRef() override {
+        return InterlockedIncrement(&refs_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override {
+        ULONG refs = InterlockedDecrement(&refs_);
+        if (refs == 0) {
+            delete this;
+        }
+        return refs;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(IAudioSessionEvents)) {
+            *ppv = static_cast<IAudioSessionEvents*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = NULL;
+        return E_NOINTERFACE;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnSimpleVolumeChanged(float volume, BOOL mute, LPCGUID) override {
+        state_->volume.store(volume * 100.0f);
+        state_->mute.store(mute == TRUE);
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnStateChanged(AudioSessionState state) override {
+        if (state == AudioSessionStateExpired) {
+            state_->expired.store(true);
+        }
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnSessionDisconnected(AudioSessionDisconnectReason) override {
+        state_->expired.store(true);
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDisplayNameChanged(LPCWSTR, LPCGUID) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnIconPathChanged(LPCWSTR, LPCGUID) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnChannelVolumeChanged(DWORD, float[], DWORD, LPCGUID) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnGroupingParamChanged(LPCGUID, LPCGUID) override { return S_OK; }
+
+private:
+    LONG refs_ = 1;
+    std::shared_ptr<SessionState> state_;
+};
+
+// COM thread'inden gelen yeni oturumlar, bir sonraki çağrıda tabloya alınır
+struct PendingSessions {
+    std::mutex mutex;
+    std::vector<IAudioSessionControl*> controls;
+};
+
+class SessionCreatedListener : public IAudioSessionNotification {
+public:
+    explicit SessionCreatedListener(std::shared_ptr<PendingSessions> pending) : pending_(std::move(pending)) {}
+
+    ULONG STDMETHODCALLTYPE AddRef() override {
+        return InterlockedIncrement(&refs_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override {
+        ULONG refs = InterlockedDecrement(&refs_);
+        if (refs == 0) {
+            delete this;
+        }
+        return refs;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(IAudioSessionNotification)) {
+            *ppv = static_cast<IAudioSessionNotification*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = NULL;
+        return E_NOINTERFACE;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnSessionCreated(IAudioSessionControl* control) override {
+        if (control) {
+            control->AddRef();
+            std::lock_guard<std::mutex> lock(pending_->mutex);
+            pending_->controls.push_back(control);
+        }
+        return S_OK;
+    }
+
+private:
+    LONG refs_ = 1;
+    std::shared_ptr<PendingSessions> pending_;
+};
+
+// Varsayılan render cihazı değişince tabloyu eskimiş say
+class DefaultDeviceListener : public IMMNotificationClient {
+public:
+    explicit DefaultDeviceListener(std::shared_ptr<std::atomic<bool>> stale) : stale_(std::move(stale)) {}
+
+    ULONG STDMETHODCALLTYPE AddRef() override {
+        return InterlockedIncrement(&refs_);
+    }
+
+    ULONG STDMETHODCALLTYPE Release() override {
+        ULONG refs = InterlockedDecrement(&refs_);
+        if (refs == 0) {
+            delete this;
+        }
+        return refs;
+    }
+
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(IMMNotificationClient)) {
+            *ppv = static_cast<IMMNotificationClient*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = NULL;
+        return E_NOINTERFACE;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDefaultDeviceChanged(EDataFlow flow, ERole role, LPCWSTR) override {
+        if (flow == eRender && role == eConsole) {
+            stale_->store(true);
+        }
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDeviceStateChanged(LPCWSTR, DWORD) override {
+        stale_->store(true);
+        return S_OK;
+    }
+
+    HRESULT STDMETHODCALLTYPE OnDeviceAdded(LPCWSTR) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnDeviceRemoved(LPCWSTR) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE OnPropertyValueChanged(LPCWSTR, const PROPERTYKEY) override { return S_OK; }
+
+private:
+    LONG refs_ = 1;
+    std::shared_ptr<std::atomic<bool>> stale_;
+};
+
+struct Session {
+    IAudioSessionControl2* control = NULL;
+    ISimpleAudioVolume* volume = NULL;
+    SessionEvents* events = NULL;
+    std::shared_ptr<SessionState> state;
+    std::string instanceId;
+    std::string app;
+    std::string name;
+    DWORD pid = 0;
+};
+
+} // namespace
+
+struct SessionTable::Impl {
+    IMMDeviceEnumerator* enumerator = NULL;
+    DefaultDeviceListener* deviceListener = NULL;
+    IAudioSessionManager2* manager = NULL;
+    SessionCreatedListener* createdListener = NULL;
+    std::shared_ptr<std::atomic<bool>> stale = std::make_shared<std::atomic<bool>>(true);
+    std::shared_ptr<PendingSessions> pending = std::make_shared<PendingSessions>();
+    std::vector<Session> sessions;
+
+    bool CreateEnumerator() {
+        if (enumerator) {
+            return true;
+        }
+
+        // MTA'da (RunInMta içinden) çağrılır
+        HRESULT hr = CoCreateInstance(
+            __uuidof(MMDeviceEnumerator),
+            NULL,
+            CLSCTX_ALL,
+            __uuidof(IMMDeviceEnumerator),
+            (void**)&enumerator
+        );
+        if (FAILED(hr)) {
+            enumerator = NULL;
+            return false;
+        }
+
+        deviceListener = new DefaultDeviceListener(stale);
+        if (FAILED(enumerator->RegisterEndpointNotificationCallback(deviceListener))) {
+            deviceListener->Release();
+            deviceListener = NULL;
+        }
+
+        return true;
+    }
+
+    // Oturumu tabloya al (zaten varsa veya sistem sesleri ise atla)
+    void Add(IAudioSessionControl* control) {
+        AudioSessionState sessionState;
+        if (FAILED(control->GetState(&sessionState)) || sessionState == AudioSessionStateExpired) {
+            return;
+        }
+
+        Session session;
+        if (FAILED(control->QueryInterface(__uuidof(IAudioSessionControl2), (void**)&session.control))) {
+            return;
+        }
+
+        LPWSTR instanceId = NULL;
+        if (session.control->IsSystemSoundsSession() == S_OK ||
+            FAILED(session.control->GetSessionInstanceIdentifier(&instanceId))) {
+            session.control->Release();
+            return;
+        }
+        session.instanceId = WideToUtf8(instanceId);
+        CoTaskMemFree(instanceId);
+
+        // Listeleme ile bildirim aynı oturumu iki kez getirebilir
+        for (const Session& existing : sessions) {
+            if (existing.instanceId == session.instanceId) {
+                session.control->Release();
+                return;
+            }
+        }
+
+        if (FAILED(session.control->QueryInterface(__uuidof(ISimpleAudioVolume), (void**)&session.volume))) {
+            session.control->Release();
+            return;
+        }
+
+        session.control->GetProcessId(&session.pid);
+        std::string exeName = ExeNameForPid(session.pid);
+        session.app = NormalizeKey(exeName);
+
+        LPWSTR displayName = NULL;
+        if (SUCCEEDED(session.control->GetDisplayName(&displayName))) {
+            session.name = WideToUtf8(displayName);
+            CoTaskMemFree(displayName);
+        }
+        // Çoğu uygulama görünen ad ayarlamaz (veya "@%SystemRoot%..." kaynak yolu verir)
+        if (session.name.empty() || session.name[0] == '@') {
+            session.name = exeName;
+        }
+
+        session.state = std::make_shared<SessionState>();
+        float level = 0.0f;
+        BOOL mute = FALSE;
+        session.volume->GetMasterVolume(&level);
+        session.volume->GetMute(&mute);
+        session.state->volume.store(level * 100.0f);
+        session.state->mute.store(mute == TRUE);
+
+        session.events = new SessionEvents(session.state);
+        if (FAILED(session.control->RegisterAudioSessionNotification(session.events))) {
+            session.events->Release();
+            session.events = NULL;
+        }
+
+        sessions.push_back(std::move(session));
+    }
+
+    void Remove(Session& session) {
+        if (session.events) {
+            session.control->UnregisterAudioSessionNotification(session.events);
+            session.events->Release();
+        }
+        session.volume->Release();
+        session.control->Release();
+    }
+
+    // Bekleyen yeni oturumları ekle, kapananları çıkar
+    void Drain() {
+        std::vector<IAudioSessionControl*> created;
+        {
+            std::lock_guard<std::mutex> lock(pending->mutex);
+            created.swap(pending->controls);
+        }
+        for (IAudioSessionControl* control : created) {
+            Add(control);
+            control->Release();
+        }
+
+        for (size_t i = 0; i < sessions.size();) {
+            if (sessions[i].state->expired.load()) {
+                Remove(sessions[i]);
+                sessions.erase(sessions.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+
+    void ReleaseManager() {
+        for (Session& session : sessions) {
+            Remove(session);
+        }
+        sessions.clear();
+
+        if (manager) {
+            if (createdListener) {
+                manager->UnregisterSessionNotification(createdListener);
+                createdListener->Release();
+                createdListener = NULL;
+            }
+            manager->Release();
+            manager = NULL;
+        }
+
+        std::lock_guard<std::mutex> lock(pending->mutex);
+        for (IAudioSessionControl* control : pending->controls) {
+            control->Release();
+        }
+        pending->controls.clear();
+    }
+
+    // Varsayılan cihazın oturum yöneticisine bağlan ve tabloyu bir kez doldur
+    bool Bind() {
+        ReleaseManager();
+
+        if (!CreateEnumerator()) {
+            return false;
+        }
+
+        IMMDevice* device = NULL;
+        if (FAILED(enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &device))) {
+            return false;
+        }
+        HRESULT hr = device->Activate(__uuidof(IAudioSessionManager2), CLSCTX_ALL, NULL, (void**)&manager);
+        device->Release();
+        if (FAILED(hr)) {
+            manager = NULL;
+            return false;
+        }
+
+        // Önce bildirim kaydı, sonra listeleme: aradaki oturum kaçmaz (tekrarlar Add'de elenir).
+        // Bildirimler ancak GetSessionEnumerator çağrıldıktan sonra gelmeye başlar.
+        createdListener = new SessionCreatedListener(pending);
+        if (FAILED(manager->RegisterSessionNotification(createdListener))) {
+            createdListener->Release();
+            createdListener = NULL;
+        }
+
+        IAudioSessionEnumerator* list = NULL;
+        if (FAILED(manager->GetSessionEnumerator(&list))) {
+            ReleaseManager();
+            return false;
+        }
+
+        int count = 0;
+        list->GetCount(&count);
+        for (int i = 0; i < count; i++) {
+            IAudioSessionControl* control = NULL;
+            if (SUCCEEDED(list->GetSession(i, &control))) {
+                Add(control);
+                control->Release();
+            }
+        }
+        list->Release();
+
+        return true;
+    }
+
+    bool Ensure() {
+        if (stale->exchange(false) || !manager) {
+            if (!Bind()) {
+                stale->store(true);
+                return false;
+            }
+            return true;
+        }
+
+        Drain();
+        return true;
+    }
+
+    void Shutdown() {
+        ReleaseManager();
+
+        if (enumerator) {
+            if (deviceListener) {
+                enumerator->UnregisterEndpointNotificationCallback(deviceListener);
+                deviceListener->Release();
+                deviceListener = NULL;
+            }
+            enumerator->Release();
+            enumerator = NULL;
+        }
+
+        stale->store(true);
+    }
+};
+
+SessionTable::SessionTable() : impl_(new Impl()) {}
+
+SessionTable::~SessionTable() {
+    // COM process kapanırken zaten yıkılmış olabilir; Shutdown modül temizliğinde çağrılır
+}
+
+bool SessionTable::NativeSnapshot(std::vector<AppSessionInfo>& streams) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Değerler olay callback'lerinin yazdığı önbellekten okunur (COM çağrısı yok)
+    bool ready = false;
+    RunInMta([&]() { ready = impl_->Ensure(); });
+    if (!ready) {
+        return false;
+    }
+
+    streams.reserve(impl_->sessions.size());
+    for (const Session& session : impl_->sessions) {
+        AppSessionInfo info;
+        info.app = session.app;
+        info.name = session.name;
+        info.pid = session.pid;
+        info.volume = session.state->volume.load();
+        info.mute = session.state->mute.load();
+        info.streams = 1;
+        streams.push_back(std::move(info));
+    }
+    return true;
+}
+
+bool SessionTable::NativeSetVolume(const std::string& app, float volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::string key = NormalizeKey(app);
+    float scalar = EndpointController::ClampVolume(volume) / 100.0f;
+    bool found = false;
+    bool success = true;
+    RunInMta([&]() {
+        if (!impl_->Ensure()) {
+            success = false;
+            return;
+        }
+        for (Session& session : impl_->sessions) {
+            if (session.app != key) {
+                continue;
+            }
+            found = true;
+            if (SUCCEEDED(session.volume->SetMasterVolume(scalar, NULL))) {
+                // Olay gelmeden önce okunursa da güncel değer dönsün
+                session.state->volume.store(scalar * 100.0f);
+            } else {
+                success = false;
+            }
+        }
+    });
+    return found && success;
+}
+
+bool SessionTable::NativeSetMute(const std::string& app, bool mute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::string key = NormalizeKey(app);
+    bool found = false;
+    bool success = true;
+    RunInMta([&]() {
+        if (!impl_->Ensure()) {
+            success = false;
+            return;
+        }
+        for (Session& session : impl_->sessions) {
+            if (session.app != key) {
+                continue;
+            }
+            found = true;
+            if (SUCCEEDED(session.volume->SetMute(mute ? TRUE : FALSE, NULL))) {
+                session.state->mute.store(mute);
+            } else {
+                success = false;
+            }
+        }
+    });
+    return found && success;
+}
+
+void SessionTable::Shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RunInMta([this]() { impl_->Shutdown(); });
+}
@@ -0,0 +1,188 @@
+// Ses yolu benchmark'ı (recording test backend'i ile)
+// scheduleVolume / setAppVolume yolunu JS olmadan ölçer: istek zamanlayıcıya
+// verilir, zamanlayıcı thread'i hedefi test backend'ine yazar. Gecikme: Set
+// çağrısından yazımın (ana seste değişiklik bildiriminin) görülmesine kadar.
+//
+// Senaryolar: tek değişiklik (kSetInterval'dan seyrek), slider sürükleme
+// (yazım birleştirme oranı ve son değerin oturma süresi) ve çok hedefli yük
+// (ana ses + uygulama oturumları, her biri ayrı thread'den).
+//
+// Derleme: node-gyp rebuild (build/Release/volume_bench)
+// Çalıştırma: ./build/Release/volume_bench [tek değişiklik sayısı]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../native-common/test_backend.h"
+#include "../audio_endpoint.h"
+#include "../audio_sessions.h"
+#include "../volume_scheduler.h"
+
+namespace {
+
+testbackend::Recorder recorder;
+
+// Son yazılan seviye ve zamanı (zamanlayıcı thread'i yazar)
+struct WriteProbe {
+    std::atomic<float> level{-1.0f};
+    std::atomic<int64_t> timeNs{0};
+};
+
+WriteProbe masterProbe;
+
+// Yazılan seviye beklenen değere ulaşana kadar bekle
+int64_t WaitLevel(const WriteProbe& probe, float level) {
+    while (probe.level.load(std::memory_order_acquire) != level) {
+        std::this_thread::yield();
+    }
+    return probe.timeNs.load(std::memory_order_acquire);
+}
+
+VolumeTarget AppTarget(const std::string& app, WriteProbe& probe) {
+    return {
+        [app](float& volume) {
+            AppSessionInfo session;
+            if (!DefaultSessions().Get(app, session)) {
+                return false;
+            }
+            volume = session.volume;
+            return true;
+        },
+        [app, &probe](float volume) {
+            bool success = DefaultSessions().SetVolume(app, volume);
+            probe.timeNs.store(testbackend::NowNs(), std::memory_order_release);
+            probe.level.store(volume, std::memory_order_release);
+            return success;
+        }
+    };
+}
+
+VolumeTarget MasterTarget() {
+    return {
+        [](float& volume) { return DefaultEndpoint().GetVolume(volume); },
+        [](float volume) { return DefaultEndpoint().SetVolume(volume); }
+    };
+}
+
+void Report(const char* label, std::vector<int64_t>& samples) {
+    testbackend::LatencySummary summary = testbackend::Summarize(samples);
+    std::printf("  %-14s %6zu örnek  p50 %8.1f us  p99 %8.1f us  p99.9 %8.1f us  max %8.1f us\n",
+                label, summary.count, summary.p50Us, summary.p99Us, summary.p999Us, summary.maxUs);
+}
+
+// Seyrek tek değişiklikler: her Set hemen yazılmalı
+void RunSingle(size_t count) {
+    std::vector<int64_t> samples;
+    samples.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        float level = static_cast<float>(i % 2 == 0 ? 30 + i % 50 : 80 - i % 50);
+        int64_t start = testbackend::NowNs();
+        DefaultScheduler().Set("master", MasterTarget(), level);
+        samples.push_back(WaitLevel(masterProbe, level) - start);
+        std::this_thread::sleep_for(VolumeScheduler::kSetInterval + std::chrono::milliseconds(5));
+    }
+    Report("tek değişiklik", samples);
+}
+
+// Slider: 2 ms'de bir Set; birleştirme oranı ve son değerin oturma süresi
+void RunSlider(size_t drags) {
+    constexpr size_t kStepsPerDrag = 250;
+    std::vector<int64_t> settle;
+    size_t sets = 0;
+    uint64_t writesBefore = recorder.Total();
+
+    for (size_t drag = 0; drag < drags; drag++) {
+        float level = 0;
+        for (size_t step = 0; step < kStepsPerDrag; step++) {
+            level = static_cast<float>((drag % 2 == 0 ? step : kStepsPerDrag - step) * 100 / kStepsPerDrag);
+            DefaultScheduler().Set("master", MasterTarget(), level);
+            sets++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        int64_t released = testbackend::NowNs();
+        settle.push_back(WaitLevel(masterProbe, level) - released);
+    }
+
+    uint64_t writes = recorder.Total() - writesBefore;
+    Report("slider oturma", settle);
+    std::printf("  %-14s %6zu set -> %llu yazım (%.1fx birleştirme)\n", "slider", sets,
+                static_cast<unsigned long long>(writes), static_cast<double>(sets) / writes);
+}
+
+// Ana ses ve uygulamalar ayrı thread'lerden; her thread kendi yazımını bekler
+void RunMultiTarget(size_t perTarget) {
+    const char* const apps[] = { "spotify", "discord", "firefox" };
+    WriteProbe appProbes[3];
+    std::vector<std::vector<int64_t>> perThread(4);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < perTarget; i++) {
+                float level = static_cast<float>((i * 7 + t) % 100);
+                int64_t begin = testbackend::NowNs();
+                if (t == 0) {
+                    DefaultScheduler().Set("master", MasterTarget(), level);
+                    perThread[t].push_back(WaitLevel(masterProbe, level) - begin);
+                } else {
+                    std::string app = apps[t - 1];
+                    DefaultScheduler().Set("app:" + app, AppTarget(app, appProbes[t - 1]), level);
+                    perThread[t].push_back(WaitLevel(appProbes[t - 1], level) - begin);
+                }
+                std::this_thread::sleep_for(VolumeScheduler::kSetInterval + std::chrono::milliseconds(2));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<int64_t> samples;
+    for (const std::vector<int64_t>& part : perThread) {
+        samples.insert(samples.end(), part.begin(), part.end());
+    }
+    size_t count = samples.size();
+    Report("çok hedef", samples);
+    std::printf("  %-14s %6zu yazım / %.1f s (%.0f yazım/s)\n", "çok hedef", count, seconds, count / seconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 100;
+
+    recorder.SetMode(testbackend::Mode::kRecording);
+    DefaultEndpoint().UseTestBackend(testbackend::Mode::kRecording, &recorder);
+    DefaultSessions().UseTestBackend(testbackend::Mode::kRecording, &recorder);
+
+    // Ana ses yazımı değişiklik bildirimiyle görülür (watchVolume yolu)
+    DefaultEndpoint().SetChangeListener([](bool, float volume, bool) {
+        masterProbe.timeNs.store(testbackend::NowNs(), std::memory_order_release);
+        masterProbe.level.store(volume, std::memory_order_release);
+    });
+
+    DefaultScheduler().Start();
+
+    std::printf("Ses yolu benchmark'ı (recording backend, set aralığı %lld ms, tur %lld ms)\n",
+                static_cast<long long>(VolumeScheduler::kSetInterval.count()),
+                static_cast<long long>(VolumeScheduler::kTickInterval.count()));
+    RunSingle(count);
+    RunSlider(count / 10 + 1);
+    RunMultiTarget(count);
+
+    DefaultScheduler().Stop();
+    DefaultEndpoint().SetChangeListener(nullptr);
+
+    size_t events = recorder.Take().size();
+    std::printf("  kayıt: %zu işlem\n", events);
+    return 0;
+}
@@ -2,30 +2,54 @@
   "targets": [
     {
       "target_name": "volume",
-      "sources": [ "volume.cc" ],
+      "sources": [ "volume.cc", "audio_endpoint.cc", "audio_sessions.cc", "volume_scheduler.cc" ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")"
       ],
       "dependencies": [
         "<!(node -p \"require('node-addon-api').gyp\")"
       ],
-      "libraries": [
-        "-lole32",
-        "-loleaut32"
-      ],
       "cflags!": [ "-fno-exceptions" ],
       "cflags_cc!": [ "-fno-exceptions" ],
       "defines": [ "NAPI_CPP_EXCEPTIONS" ],
       "conditions": [
         ["OS=='win'", {
+          "sources": [ "audio_endpoint_win.cc", "audio_sessions_win.cc", "com_mta_win.cc" ],
+          "libraries": [
+            "-lole32",
+            "-loleaut32"
+          ],
           "msvs_settings": {
             "VCCLCompilerTool": {
               "ExceptionHandling": 1
             }
           }
+        }],
+        ["OS=='linux'", {
+          "sources": [ "audio_endpoint_pulse.cc", "audio_sessions_pulse.cc" ],
+          "libraries": [ "-lpulse" ]
+        }]
+      ]
+    },
+    {
+      "target_name": "volume_bench",
+      "type": "executable",
+      "sources": [ "bench/volume_bench.cc", "audio_endpoint.cc", "audio_sessions.cc", "volume_scheduler.cc" ],
+      "cflags!": [ "-fno-exceptions" ],
+      "cflags_cc!": [ "-fno-exceptions" ],
+      "conditions": [
+        ["OS=='win'", {
+          "sources": [ "audio_endpoint_win.cc", "audio_sessions_win.cc", "com_mta_win.cc" ],
+          "libraries": [
+            "-lole32",
+            "-loleaut32"
+          ]
+        }],
+        ["OS=='linux'", {
+          "sources": [ "audio_endpoint_pulse.cc", "audio_sessions_pulse.cc" ],
+          "libraries": [ "-lpulse" ]
         }]
       ]
     }
   ]
 }
-
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <functional>
+
+// Windows: ses arayüzlerinin COM apartmanı
+// IMMDeviceEnumerator, IAudioEndpointVolume ve oturum arayüzleri her zaman MTA'da
+// oluşturulur ve kullanılır. Zamanlayıcı thread'i MTA'ya katıldığı için çağrıları
+// doğrudan yapar; STA'daki (Electron ana thread'i) veya COM'u başlatılmamış bir
+// thread'den gelen çağrılar process genelindeki tek bir MTA thread'inde çalıştırılır
+// ve sonucu beklenir. Çağıranın thread'inin apartmanı hiçbir zaman değiştirilmez.
+
+// fn'i MTA'da çalıştır ve bitmesini bekle (fn içinde RunInMta tekrar çağrılabilir)
+void RunInMta(const std::function<void()>& fn);
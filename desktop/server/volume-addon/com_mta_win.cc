@@ -0,0 +1,79 @@
+#include "com_mta.h"
+
+#include <windows.h>
+#include <objbase.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// MTA thread'i ilk ihtiyaçta başlatılır ve process boyunca yaşar (ses arayüzleri
+// bu apartmanda olduğu için kapanışta da çağrılar buradan geçer).
+
+namespace {
+
+class MtaThread {
+public:
+    MtaThread() {
+        std::thread([this]() { Run(); }).detach();
+    }
+
+    void Invoke(const std::function<void()>& fn) {
+        Task task;
+        task.fn = &fn;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_.push_back(&task);
+        wakeCv_.notify_one();
+        doneCv_.wait(lock, [&task]() { return task.done; });
+    }
+
+private:
+    struct Task {
+        const std::function<void()>* fn = nullptr;
+        bool done = false;
+    };
+
+    void Run() {
+        CoInitializeEx(NULL, COINIT_MULTITHREADED);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wakeCv_.wait(lock, [this]() { return !queue_.empty(); });
+            Task* task = queue_.front();
+            queue_.pop_front();
+
+            lock.unlock();
+            (*task->fn)();
+            lock.lock();
+
+            task->done = true;
+            doneCv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    std::condition_variable doneCv_;
+    std::deque<Task*> queue_;
+};
+
+bool InMta() {
+    APTTYPE type;
+    APTTYPEQUALIFIER qualifier;
+    // Başlatılmamış thread CO_E_NOTINITIALIZED döner (örtük MTA hariç)
+    return SUCCEEDED(CoGetApartmentType(&type, &qualifier)) && type == APTTYPE_MTA;
+}
+
+} // namespace
+
+void RunInMta(const std::function<void()>& fn) {
+    if (InMta()) {
+        fn();
+        return;
+    }
+
+    // Kasıtlı olarak yıkılmaz: modül temizliği de bu thread'e ihtiyaç duyar
+    static MtaThread* thread = new MtaThread();
+    thread->Invoke(fn);
+}
@@ -13,8 +13,16 @@ try {
   volumeAddon = {
     getVolume: () => ({ volume: 50, success: false }),
     setVolume: () => ({ success: false }),
+    scheduleVolume: () => ({ success: false }),
+    fadeTo: () => Promise.resolve(false),
     setMute: () => ({ success: false }),
-    getMute: () => ({ mute: false, success: false })
+    getMute: () => ({ mute: false, success: false }),
+    getAudioSessions: () => ({ sessions: [], success: false }),
+    getAppVolume: () => ({ volume: 0, mute: false, success: false }),
+    setAppVolume: () => ({ success: false }),
+    setAppMute: () => ({ success: false }),
+    fadeAppTo: () => Promise.resolve(false),
+    getEndpointInfo: () => ({ backend: 'none', ready: false, device: '', error: error.message })
   };
 }
 
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <pulse/pulseaudio.h>
+
+// pa_threaded_mainloop kilidi (RAII)
+// Ana ses denetleyicisi ve oturum tablosu kendi mainloop'larını bu sınıfla kilitler.
+class MainloopLock {
+public:
+    explicit MainloopLock(pa_threaded_mainloop* mainloop) : mainloop_(mainloop) {
+        pa_threaded_mainloop_lock(mainloop_);
+    }
+    ~MainloopLock() {
+        pa_threaded_mainloop_unlock(mainloop_);
+    }
+
+    MainloopLock(const MainloopLock&) = delete;
+    MainloopLock& operator=(const MainloopLock&) = delete;
+
+private:
+    pa_threaded_mainloop* mainloop_;
+};
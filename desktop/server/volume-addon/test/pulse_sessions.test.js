@@ -0,0 +1,164 @@
+// PulseAudio uygulama sesi: remote-app-volume'un kullandığı setAppVolume /
+// setAppMute / fadeAppTo çağrıları gerçek sink-input'u değiştirmeli.
+// Geçici bir pulseaudio süreci başlatılır, module-null-sink yüklenir ve paplay
+// ile bir akış açılır; sonuç pactl ile okunur. pulseaudio / pactl / paplay yoksa
+// test atlanır. Kullanıcının kendi ses sunucusuna dokunulmaz (PULSE_SERVER).
+//
+// Çalıştırma: node --test test/ (önce node-gyp rebuild)
+
+const { test, before, after } = require('node:test');
+const assert = require('node:assert');
+const { spawn, spawnSync } = require('child_process');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const SINK = 'localdesk_test';
+const APP = 'paplay';
+
+let runtimeDir = null;
+let daemon = null;
+let player = null;
+let addon = null;
+let skipReason = null;
+
+function hasCommand(name) {
+  return spawnSync(name, ['--version'], { stdio: 'ignore' }).error === undefined;
+}
+
+function pulseEnv() {
+  return { ...process.env, PULSE_SERVER: `unix:${path.join(runtimeDir, 'native')}`, XDG_RUNTIME_DIR: runtimeDir };
+}
+
+function pactl(...args) {
+  const result = spawnSync('pactl', args, { env: pulseEnv(), encoding: 'utf8' });
+  if (result.status !== 0) {
+    throw new Error(`pactl ${args.join(' ')}: ${result.stderr}`);
+  }
+  return result.stdout;
+}
+
+// paplay'in sink-input'u -> { index, volume (ilk kanal, %), mute } | null
+function sinkInput() {
+  const blocks = pactl('list', 'sink-inputs').split(/^Sink Input #/m).slice(1);
+  for (const block of blocks) {
+    if (!block.includes(`application.process.binary = "${APP}"`)) {
+      continue;
+    }
+    const volume = block.match(/^\s*Volume:.*?(\d+)%/m);
+    const mute = block.match(/^\s*Mute:\s*(\w+)/m);
+    return {
+      index: Number(block.split('\n')[0]),
+      volume: volume ? Number(volume[1]) : NaN,
+      mute: mute ? mute[1] === 'yes' : false
+    };
+  }
+  return null;
+}
+
+async function waitFor(predicate, timeoutMs = 3000) {
+  const deadline = Date.now() + timeoutMs;
+  while (Date.now() < deadline) {
+    if (predicate()) {
+      return true;
+    }
+    await new Promise(resolve => setTimeout(resolve, 25));
+  }
+  return predicate();
+}
+
+before(async () => {
+  if (process.platform !== 'linux' || !['pulseaudio', 'pactl', 'paplay'].every(hasCommand)) {
+    skipReason = 'pulseaudio / pactl / paplay yok';
+    return;
+  }
+
+  runtimeDir = fs.mkdtempSync(path.join(os.tmpdir(), 'localdesk-pulse-'));
+  daemon = spawn('pulseaudio', [
+    '-n', '--daemonize=no', '--exit-idle-time=-1', '--use-pid-file=no', '--disable-shm=yes',
+    '-L', `module-native-protocol-unix auth-anonymous=1 socket=${path.join(runtimeDir, 'native')}`
+  ], { env: { ...pulseEnv(), HOME: runtimeDir }, stdio: 'ignore' });
+
+  if (!await waitFor(() => fs.existsSync(path.join(runtimeDir, 'native')))) {
+    skipReason = 'pulseaudio başlatılamadı';
+    return;
+  }
+
+  pactl('load-module', 'module-null-sink', `sink_name=${SINK}`);
+  pactl('set-default-sink', SINK);
+
+  // /dev/zero: null sink gerçek zamanlı tükettiği için akış test boyunca açık kalır
+  player = spawn('paplay', ['--raw', `--device=${SINK}`, '/dev/zero'], { env: pulseEnv(), stdio: 'ignore' });
+  if (!await waitFor(() => sinkInput() !== null)) {
+    skipReason = 'paplay akışı açılamadı';
+    return;
+  }
+
+  // Addon ses sunucusuna ilk çağrıda bağlanır
+  process.env.PULSE_SERVER = pulseEnv().PULSE_SERVER;
+  addon = require(path.join(__dirname, '..', 'build', 'Release', 'volume.node'));
+});
+
+after(() => {
+  if (player) {
+    player.kill();
+  }
+  if (daemon) {
+    daemon.kill();
+  }
+  if (runtimeDir) {
+    fs.rmSync(runtimeDir, { recursive: true, force: true });
+  }
+});
+
+test('paplay akışı uygulama oturumu olarak görünür', async (t) => {
+  if (skipReason) {
+    t.skip(skipReason);
+    return;
+  }
+
+  assert.ok(await waitFor(() => addon.getAudioSessions().sessions.some(session => session.app === APP)));
+  assert.strictEqual(addon.getAppVolume(APP).success, true);
+});
+
+test("'set' sink-input sesini değiştirir", async (t) => {
+  if (skipReason) {
+    t.skip(skipReason);
+    return;
+  }
+
+  assert.strictEqual(addon.setAppVolume(APP, 25).success, true);
+  assert.ok(await waitFor(() => sinkInput().volume === 25), `sink-input: ${JSON.stringify(sinkInput())}`);
+});
+
+test("'mute' sink-input'u sessize alır ve geri açar", async (t) => {
+  if (skipReason) {
+    t.skip(skipReason);
+    return;
+  }
+
+  assert.strictEqual(addon.setAppMute(APP, true).success, true);
+  assert.ok(await waitFor(() => sinkInput().mute === true));
+  assert.strictEqual(addon.setAppMute(APP, false).success, true);
+  assert.ok(await waitFor(() => sinkInput().mute === false));
+});
+
+test("'fade' hedef sese ulaşınca tamamlanır", async (t) => {
+  if (skipReason) {
+    t.skip(skipReason);
+    return;
+  }
+
+  assert.strictEqual(await addon.fadeAppTo(APP, 60, 200, 'linear'), true);
+  assert.ok(await waitFor(() => sinkInput().volume === 60), `sink-input: ${JSON.stringify(sinkInput())}`);
+});
+
+test('dışarıdan yapılan değişiklik önbelleğe yansır', async (t) => {
+  if (skipReason) {
+    t.skip(skipReason);
+    return;
+  }
+
+  pactl('set-sink-input-volume', String(sinkInput().index), '40%');
+  assert.ok(await waitFor(() => Math.round(addon.getAppVolume(APP).volume) === 40));
+});
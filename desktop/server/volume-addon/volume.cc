@@ -1,343 +1,671 @@
 #include <napi.h>
 
-#ifdef _WIN32
-#include <windows.h>
-#include <mmdeviceapi.h>
-#include <endpointvolume.h>
-#include <comdef.h>
-#include <comutil.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
-#pragma comment(lib, "ole32.lib")
-#pragma comment(lib, "oleaut32.lib")
+#include "../native-common/metrics_napi.h"
+#include "../native-common/test_backend_napi.h"
+#include "audio_endpoint.h"
+#include "audio_sessions.h"
+#include "volume_scheduler.h"
 
-// COM interface GUID'leri
-const CLSID CLSID_MMDeviceEnumerator = __uuidof(MMDeviceEnumerator);
-const IID IID_IMMDeviceEnumerator = __uuidof(IMMDeviceEnumerator);
-const IID IID_IAudioEndpointVolume = __uuidof(IAudioEndpointVolume);
+// Sonuç nesneleri (eski fonksiyonlar ve AudioEndpoint metodları aynı şekli döndürür)
 
-// Ses seviyesini al
-Napi::Value GetVolume(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    
-    HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
-    if (FAILED(hr)) {
-        Napi::Error::New(env, "COM başlatılamadı").ThrowAsJavaScriptException();
-        return env.Null();
-    }
-    
+Napi::Value VolumeResult(Napi::Env env, EndpointController& controller) {
     float volume = 50.0f;
-    bool success = false;
-    
-    try {
-        // MMDeviceEnumerator oluştur
-        IMMDeviceEnumerator* pEnumerator = NULL;
-        hr = CoCreateInstance(
-            CLSID_MMDeviceEnumerator,
-            NULL,
-            CLSCTX_ALL,
-            IID_IMMDeviceEnumerator,
-            (void**)&pEnumerator
-        );
-        
-        if (SUCCEEDED(hr)) {
-            // Varsayılan ses cihazını al
-            IMMDevice* pDevice = NULL;
-            hr = pEnumerator->GetDefaultAudioEndpoint(eRender, eConsole, &pDevice);
-            
-            if (SUCCEEDED(hr)) {
-                // IAudioEndpointVolume interface'ini al
-                IAudioEndpointVolume* pEndpointVolume = NULL;
-                hr = pDevice->Activate(IID_IAudioEndpointVolume, CLSCTX_ALL, NULL, (void**)&pEndpointVolume);
-                
-                if (SUCCEEDED(hr)) {
-                    // Ses seviyesini al (0.0 - 1.0 arası)
-                    hr = pEndpointVolume->GetMasterVolumeLevelScalar(&volume);
-                    
-                    if (SUCCEEDED(hr)) {
-                        volume = volume * 100.0f; // 0-100 arasına çevir
-                        success = true;
-                    }
-                    
-                    pEndpointVolume->Release();
-                }
-                
-                pDevice->Release();
-            }
-            
-            pEnumerator->Release();
-        }
-    } catch (...) {
-        // Hata durumunda varsayılan değer
-    }
-    
-    CoUninitialize();
-    
+    bool success = controller.GetVolume(volume);
+
     Napi::Object result = Napi::Object::New(env);
     result.Set("volume", Napi::Number::New(env, volume));
     result.Set("success", Napi::Boolean::New(env, success));
-    
+
     return result;
 }
 
-// Ses seviyesini ayarla
-Napi::Value SetVolume(const Napi::CallbackInfo& info) {
+Napi::Value SetVolumeResult(const Napi::CallbackInfo& info, EndpointController& controller) {
     Napi::Env env = info.Env();
-    
+
     if (info.Length() < 1 || !info[0].IsNumber()) {
         Napi::TypeError::New(env, "Ses seviyesi (0-100) bekleniyor").ThrowAsJavaScriptException();
         return env.Null();
     }
-    
-    float volume = info[0].As<Napi::Number>().FloatValue();
-    
-    // 0-100 arasına sınırla
-    if (volume < 0.0f) volume = 0.0f;
-    if (volume > 100.0f) volume = 100.0f;
-    
-    // 0.0-1.0 arasına normalize et
-    float normalizedVolume = volume / 100.0f;
-    
-    HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
-    if (FAILED(hr)) {
-        Napi::Error::New(env, "COM başlatılamadı").ThrowAsJavaScriptException();
-        return env.Null();
-    }
-    
-    bool success = false;
-    
-    try {
-        // MMDeviceEnumerator oluştur
-        IMMDeviceEnumerator* pEnumerator = NULL;
-        hr = CoCreateInstance(
-            CLSID_MMDeviceEnumerator,
-            NULL,
-            CLSCTX_ALL,
-            IID_IMMDeviceEnumerator,
-            (void**)&pEnumerator
-        );
-        
-        if (SUCCEEDED(hr)) {
-            // Varsayılan ses cihazını al
-            IMMDevice* pDevice = NULL;
-            hr = pEnumerator->GetDefaultAudioEndpoint(eRender, eConsole, &pDevice);
-            
-            if (SUCCEEDED(hr)) {
-                // IAudioEndpointVolume interface'ini al
-                IAudioEndpointVolume* pEndpointVolume = NULL;
-                hr = pDevice->Activate(IID_IAudioEndpointVolume, CLSCTX_ALL, NULL, (void**)&pEndpointVolume);
-                
-                if (SUCCEEDED(hr)) {
-                    // Ses seviyesini ayarla
-                    hr = pEndpointVolume->SetMasterVolumeLevelScalar(normalizedVolume, NULL);
-                    
-                    if (SUCCEEDED(hr)) {
-                        success = true;
-                    }
-                    
-                    pEndpointVolume->Release();
-                }
-                
-                pDevice->Release();
-            }
-            
-            pEnumerator->Release();
-        }
-    } catch (...) {
-        // Hata durumunda
-    }
-    
-    CoUninitialize();
-    
+
+    bool success = controller.SetVolume(info[0].As<Napi::Number>().FloatValue());
+
     Napi::Object result = Napi::Object::New(env);
     result.Set("success", Napi::Boolean::New(env, success));
-    
+
     return result;
 }
 
-// Sesi kapat/aç
-Napi::Value SetMute(const Napi::CallbackInfo& info) {
+Napi::Value MuteResult(Napi::Env env, EndpointController& controller) {
+    bool mute = false;
+    bool success = controller.GetMute(mute);
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("mute", Napi::Boolean::New(env, mute));
+    result.Set("success", Napi::Boolean::New(env, success));
+
+    return result;
+}
+
+Napi::Value SetMuteResult(const Napi::CallbackInfo& info, EndpointController& controller) {
     Napi::Env env = info.Env();
-    
+
     if (info.Length() < 1 || !info[0].IsBoolean()) {
         Napi::TypeError::New(env, "Boolean (mute durumu) bekleniyor").ThrowAsJavaScriptException();
         return env.Null();
     }
-    
-    BOOL mute = info[0].As<Napi::Boolean>().Value() ? TRUE : FALSE;
-    
-    HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
-    if (FAILED(hr)) {
-        Napi::Error::New(env, "COM başlatılamadı").ThrowAsJavaScriptException();
-        return env.Null();
+
+    bool success = controller.SetMute(info[0].As<Napi::Boolean>().Value());
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("success", Napi::Boolean::New(env, success));
+
+    return result;
+}
+
+Napi::Value InfoResult(Napi::Env env, EndpointController& controller) {
+    EndpointInfo endpoint = controller.Info();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("backend", Napi::String::New(env, endpoint.backend));
+    result.Set("ready", Napi::Boolean::New(env, endpoint.ready));
+    result.Set("device", Napi::String::New(env, endpoint.device));
+    result.Set("error", Napi::String::New(env, endpoint.error));
+
+    return result;
+}
+
+// Çağrı metrikleri (getStats)
+// "deviceWrite" zamanlayıcının cihaza yaptığı gerçek yazımları ölçer;
+// birleştirilen slider değerleri burada görünmez.
+metrics::Registry volumeMetrics("volume");
+metrics::Api& deviceWriteMetrics = volumeMetrics.Add("deviceWrite");
+
+bool MeasuredWrite(bool success, metrics::Scope& scope) {
+    if (!success) {
+        scope.Fail();
     }
-    
-    bool success = false;
-    
-    try {
-        // MMDeviceEnumerator oluştur
-        IMMDeviceEnumerator* pEnumerator = NULL;
-        hr = CoCreateInstance(
-            CLSID_MMDeviceEnumerator,
-            NULL,
-            CLSCTX_ALL,
-            IID_IMMDeviceEnumerator,
-            (void**)&pEnumerator
-        );
-        
-        if (SUCCEEDED(hr)) {
-            // Varsayılan ses cihazını al
-            IMMDevice* pDevice = NULL;
-            hr = pEnumerator->GetDefaultAudioEndpoint(eRender, eConsole, &pDevice);
-            
-            if (SUCCEEDED(hr)) {
-                // IAudioEndpointVolume interface'ini al
-                IAudioEndpointVolume* pEndpointVolume = NULL;
-                hr = pDevice->Activate(IID_IAudioEndpointVolume, CLSCTX_ALL, NULL, (void**)&pEndpointVolume);
-                
-                if (SUCCEEDED(hr)) {
-                    // Mute durumunu ayarla
-                    hr = pEndpointVolume->SetMute(mute, NULL);
-                    
-                    if (SUCCEEDED(hr)) {
-                        success = true;
-                    }
-                    
-                    pEndpointVolume->Release();
-                }
-                
-                pDevice->Release();
+    return success;
+}
+
+// Zamanlayıcı hedefi: varsayılan çıkış cihazının ana sesi
+const char kMasterKey[] = "master";
+
+VolumeTarget MasterTarget() {
+    return {
+        [](float& volume) { return DefaultEndpoint().GetVolume(volume); },
+        [](float volume) {
+            metrics::Scope scope(deviceWriteMetrics);
+            return MeasuredWrite(DefaultEndpoint().SetVolume(volume), scope);
+        }
+    };
+}
+
+// Uygulama oturumu hedefi; zamanlayıcı anahtarı "app:<exe>"
+std::string AppKey(const std::string& app) {
+    return "app:" + SessionTable::NormalizeKey(app);
+}
+
+VolumeTarget AppTarget(const std::string& app) {
+    return {
+        [app](float& volume) {
+            AppSessionInfo session;
+            if (!DefaultSessions().Get(app, session)) {
+                return false;
             }
-            
-            pEnumerator->Release();
+            volume = session.volume;
+            return true;
+        },
+        [app](float volume) {
+            metrics::Scope scope(deviceWriteMetrics);
+            return MeasuredWrite(DefaultSessions().SetVolume(app, volume), scope);
         }
-    } catch (...) {
-        // Hata durumunda
+    };
+}
+
+// fadeTo Promise'i; zamanlayıcı thread'inden ana thread'e taşınır
+struct FadeJob {
+    Napi::Promise::Deferred deferred;
+    bool completed = false;
+
+    explicit FadeJob(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+};
+
+class FadeCompletionQueue {
+public:
+    void Start(Napi::Env env) {
+        tsfn_ = Napi::ThreadSafeFunction::New(
+            env,
+            Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+            "volumeFade",
+            0,
+            1
+        );
+        // Devam eden geçiş process'in kapanmasını engellemesin
+        tsfn_.Unref(env);
+        active_ = true;
+    }
+
+    void Stop() {
+        if (active_) {
+            active_ = false;
+            tsfn_.Release();
+        }
+    }
+
+    // Zamanlayıcı thread'i
+    void Complete(FadeJob* job, bool completed) {
+        job->completed = completed;
+
+        napi_status status = tsfn_.NonBlockingCall(job, [](Napi::Env env, Napi::Function, FadeJob* job) {
+            job->deferred.Resolve(Napi::Boolean::New(env, job->completed));
+            delete job;
+        });
+
+        if (status != napi_ok) {
+            // Modül kapanıyor, Promise artık çözülemez
+            delete job;
+        }
+    }
+
+private:
+    Napi::ThreadSafeFunction tsfn_;
+    bool active_ = false;
+};
+
+FadeCompletionQueue fadeCompletion;
+
+// "linear" (varsayılan) veya "log"/"logarithmic"
+bool ReadFadeCurve(const Napi::CallbackInfo& info, size_t index, FadeCurve& curve) {
+    curve = FadeCurve::kLinear;
+    if (info.Length() <= index || info[index].IsUndefined()) {
+        return true;
+    }
+    if (!info[index].IsString()) {
+        return false;
+    }
+
+    std::string name = info[index].As<Napi::String>().Utf8Value();
+    if (name == "linear") {
+        return true;
     }
-    
-    CoUninitialize();
-    
+    if (name == "log" || name == "logarithmic") {
+        curve = FadeCurve::kLogarithmic;
+        return true;
+    }
+    return false;
+}
+
+// Seviyeyi zamanlayıcıya bırak; aynı hedefe daha yeni bir istek gelirse bu değer hiç yazılmayabilir
+// first: seviye argümanının indeksi (uygulama fonksiyonlarında 0. argüman uygulama adıdır)
+Napi::Value ScheduleResult(const Napi::CallbackInfo& info, size_t first, const std::string& key, VolumeTarget target) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < first + 1 || !info[first].IsNumber()) {
+        Napi::TypeError::New(env, "Ses seviyesi (0-100) bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    float level = EndpointController::ClampVolume(info[first].As<Napi::Number>().FloatValue());
+    DefaultScheduler().Set(key, std::move(target), level);
+
     Napi::Object result = Napi::Object::New(env);
-    result.Set("success", Napi::Boolean::New(env, success));
-    
+    result.Set("success", Napi::Boolean::New(env, true));
+
     return result;
 }
 
-// Mute durumunu al
-Napi::Value GetMute(const Napi::CallbackInfo& info) {
+// Promise<boolean>: geçiş tamamlandıysa true, yeni bir istekle iptal edildiyse false
+Napi::Value FadeResult(const Napi::CallbackInfo& info, size_t first, const std::string& key, VolumeTarget target) {
     Napi::Env env = info.Env();
-    
-    HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
-    if (FAILED(hr)) {
-        Napi::Error::New(env, "COM başlatılamadı").ThrowAsJavaScriptException();
+
+    if (info.Length() < first + 2 || !info[first].IsNumber() || !info[first + 1].IsNumber()) {
+        Napi::TypeError::New(env, "Ses seviyesi (0-100) ve süre (ms) bekleniyor").ThrowAsJavaScriptException();
         return env.Null();
     }
-    
-    BOOL mute = FALSE;
-    bool success = false;
-    
-    try {
-        // MMDeviceEnumerator oluştur
-        IMMDeviceEnumerator* pEnumerator = NULL;
-        hr = CoCreateInstance(
-            CLSID_MMDeviceEnumerator,
-            NULL,
-            CLSCTX_ALL,
-            IID_IMMDeviceEnumerator,
-            (void**)&pEnumerator
-        );
-        
-        if (SUCCEEDED(hr)) {
-            // Varsayılan ses cihazını al
-            IMMDevice* pDevice = NULL;
-            hr = pEnumerator->GetDefaultAudioEndpoint(eRender, eConsole, &pDevice);
-            
-            if (SUCCEEDED(hr)) {
-                // IAudioEndpointVolume interface'ini al
-                IAudioEndpointVolume* pEndpointVolume = NULL;
-                hr = pDevice->Activate(IID_IAudioEndpointVolume, CLSCTX_ALL, NULL, (void**)&pEndpointVolume);
-                
-                if (SUCCEEDED(hr)) {
-                    // Mute durumunu al
-                    hr = pEndpointVolume->GetMute(&mute);
-                    
-                    if (SUCCEEDED(hr)) {
-                        success = true;
-                    }
-                    
-                    pEndpointVolume->Release();
-                }
-                
-                pDevice->Release();
-            }
-            
-            pEnumerator->Release();
-        }
-    } catch (...) {
-        // Hata durumunda
+
+    FadeCurve curve;
+    if (!ReadFadeCurve(info, first + 2, curve)) {
+        Napi::TypeError::New(env, "Geçiş eğrisi 'linear' veya 'log' olmalı").ThrowAsJavaScriptException();
+        return env.Null();
     }
-    
-    CoUninitialize();
-    
+
+    float level = EndpointController::ClampVolume(info[first].As<Napi::Number>().FloatValue());
+    double duration = info[first + 1].As<Napi::Number>().DoubleValue();
+    // En fazla bir dakika
+    uint32_t durationMs = duration > 0 ? static_cast<uint32_t>(duration < 60000.0 ? duration : 60000.0) : 0;
+
+    FadeJob* job = new FadeJob(env);
+    Napi::Promise promise = job->deferred.Promise();
+
+    DefaultScheduler().FadeTo(key, std::move(target), level, durationMs, curve, [job](bool completed) {
+        fadeCompletion.Complete(job, completed);
+    });
+
+    return promise;
+}
+
+// Uygulama oturumları
+
+Napi::Object SessionObject(Napi::Env env, const AppSessionInfo& session) {
     Napi::Object result = Napi::Object::New(env);
-    result.Set("mute", Napi::Boolean::New(env, mute == TRUE));
-    result.Set("success", Napi::Boolean::New(env, success));
-    
+    result.Set("app", Napi::String::New(env, session.app));
+    result.Set("name", Napi::String::New(env, session.name));
+    result.Set("pid", Napi::Number::New(env, session.pid));
+    result.Set("volume", Napi::Number::New(env, session.volume));
+    result.Set("mute", Napi::Boolean::New(env, session.mute));
+    result.Set("streams", Napi::Number::New(env, session.streams));
     return result;
 }
 
-// Modül başlatma
-Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "getVolume"), Napi::Function::New(env, GetVolume));
-    exports.Set(Napi::String::New(env, "setVolume"), Napi::Function::New(env, SetVolume));
-    exports.Set(Napi::String::New(env, "setMute"), Napi::Function::New(env, SetMute));
-    exports.Set(Napi::String::New(env, "getMute"), Napi::Function::New(env, GetMute));
-    return exports;
+// İlk argüman uygulama anahtarı olmalı
+bool ReadAppName(const Napi::CallbackInfo& info, std::string& app) {
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(info.Env(), "Uygulama adı (ör. \"discord.exe\") bekleniyor").ThrowAsJavaScriptException();
+        return false;
+    }
+    app = info[0].As<Napi::String>().Utf8Value();
+    return true;
 }
 
-NODE_API_MODULE(volume, Init)
+// AudioEndpoint: varsayılan çıkış cihazı için kalıcı denetleyici
+// Tüm örnekler process genelindeki tek EndpointController'ı paylaşır; COM/PulseAudio
+// arayüzleri her çağrıda yeniden oluşturulmaz.
+class AudioEndpoint : public Napi::ObjectWrap<AudioEndpoint> {
+public:
+    static Napi::Function Define(Napi::Env env) {
+        return DefineClass(env, "AudioEndpoint", {
+            InstanceMethod("getVolume", &AudioEndpoint::GetVolume),
+            InstanceMethod("setVolume", &AudioEndpoint::SetVolume),
+            InstanceMethod("getMute", &AudioEndpoint::GetMute),
+            InstanceMethod("setMute", &AudioEndpoint::SetMute),
+            InstanceMethod("getInfo", &AudioEndpoint::GetInfo),
+            InstanceMethod("scheduleVolume", &AudioEndpoint::ScheduleVolume),
+            InstanceMethod("fadeTo", &AudioEndpoint::FadeTo)
+        });
+    }
 
-#else
-// Windows dışı platformlar için dummy implementation
+    explicit AudioEndpoint(const Napi::CallbackInfo& info)
+        : Napi::ObjectWrap<AudioEndpoint>(info), controller_(DefaultEndpoint()) {}
 
-Napi::Value GetVolume(const Napi::CallbackInfo& info) {
+private:
+    Napi::Value GetVolume(const Napi::CallbackInfo& info) {
+        return VolumeResult(info.Env(), controller_);
+    }
+
+    Napi::Value SetVolume(const Napi::CallbackInfo& info) {
+        return SetVolumeResult(info, controller_);
+    }
+
+    Napi::Value GetMute(const Napi::CallbackInfo& info) {
+        return MuteResult(info.Env(), controller_);
+    }
+
+    Napi::Value SetMute(const Napi::CallbackInfo& info) {
+        return SetMuteResult(info, controller_);
+    }
+
+    Napi::Value GetInfo(const Napi::CallbackInfo& info) {
+        return InfoResult(info.Env(), controller_);
+    }
+
+    Napi::Value ScheduleVolume(const Napi::CallbackInfo& info) {
+        return ScheduleResult(info, 0, kMasterKey, MasterTarget());
+    }
+
+    Napi::Value FadeTo(const Napi::CallbackInfo& info) {
+        return FadeResult(info, 0, kMasterKey, MasterTarget());
+    }
+
+    EndpointController& controller_;
+};
+
+// Ses/mute değişikliklerini JS'e ileten bildirici
+// Backend thread'lerinden gelen değişiklikler tek bir bekleyen slotta birleştirilir:
+// JS thread'i bir önceki bildirimi işlemeden gelen yenileri sadece slotu günceller,
+// böylece bir donanım tuşu fırtınası event loop'a tek çağrı olarak ulaşır.
+// Aynı değer tekrar gelirse (ör. kendi yazdığımızın yankısı) JS çağrılmaz.
+// Değerleri bilinmeyen değişiklik (varsayılan cihaz değişti) kendi okuma thread'inde
+// yeniden okunur: backend callback'lerinde beklenemez, JS thread'i de bloklanmamalı.
+class VolumeNotifier {
+public:
+    void Start(Napi::Env env, Napi::Function callback) {
+        Stop();
+
+        tsfn_ = Napi::ThreadSafeFunction::New(env, callback, "volumeChanged", 0, 1);
+        // Bildirim beklemek process'in kapanmasını engellemesin
+        tsfn_.Unref(env);
+        lastVolume_ = -1.0f;
+        lastMute_ = -1;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            active_ = true;
+            pending_ = false;
+            refresh_ = false;
+        }
+        reader_ = std::thread([this]() { ReadLoop(); });
+
+        DefaultEndpoint().SetChangeListener([this](bool known, float volume, bool mute) {
+            Post(known, volume, mute);
+        });
+    }
+
+    void Stop() {
+        DefaultEndpoint().SetChangeListener(nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (active_) {
+                active_ = false;
+                tsfn_.Release();
+            }
+        }
+        readWake_.notify_all();
+        if (reader_.joinable()) {
+            reader_.join();
+        }
+    }
+
+private:
+    // Backend thread'i (veya okuma thread'i)
+    void Post(bool known, float volume, bool mute) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!active_) {
+            return;
+        }
+
+        if (!known) {
+            // Güncel değerler okuma thread'inden known=true olarak gelir
+            refresh_ = true;
+            readWake_.notify_one();
+            return;
+        }
+
+        volume_ = volume;
+        mute_ = mute;
+
+        if (pending_) {
+            return;
+        }
+
+        pending_ = true;
+        if (tsfn_.NonBlockingCall([this](Napi::Env env, Napi::Function callback) { Deliver(env, callback); }) != napi_ok) {
+            pending_ = false;
+        }
+    }
+
+    // Okuma thread'i: yeniden bağlan ve güncel değerleri oku
+    // Okuma sürerken gelen yeni istekler tek bir yeniden okumada birleşir.
+    void ReadLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            readWake_.wait(lock, [this]() { return !active_ || refresh_; });
+            if (!active_) {
+                return;
+            }
+            refresh_ = false;
+            lock.unlock();
+
+            float volume;
+            bool mute;
+            if (DefaultEndpoint().GetVolume(volume) && DefaultEndpoint().GetMute(mute)) {
+                Post(true, volume, mute);
+            }
+
+            lock.lock();
+        }
+    }
+
+    // JS thread'i
+    void Deliver(Napi::Env env, Napi::Function callback) {
+        float volume;
+        bool mute;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ = false;
+            volume = volume_;
+            mute = mute_;
+        }
+
+        float rounded = static_cast<float>(static_cast<int>(volume * 10.0f + 0.5f)) / 10.0f;
+        if (rounded == lastVolume_ && static_cast<int>(mute) == lastMute_) {
+            return;
+        }
+        lastVolume_ = rounded;
+        lastMute_ = mute ? 1 : 0;
+
+        Napi::Object change = Napi::Object::New(env);
+        change.Set("volume", Napi::Number::New(env, rounded));
+        change.Set("mute", Napi::Boolean::New(env, mute));
+        callback.Call({ change });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable readWake_;
+    std::thread reader_;
+    Napi::ThreadSafeFunction tsfn_;
+    bool active_ = false;
+    bool pending_ = false;
+    bool refresh_ = false; // Değerleri bilinmeyen değişiklik var, okuma thread'i okusun
+    float volume_ = 0.0f;
+    bool mute_ = false;
+
+    // Sadece JS thread'i
+    float lastVolume_ = -1.0f;
+    int lastMute_ = -1;
+};
+
+VolumeNotifier volumeNotifier;
+
+// N-API: watchVolume(callback) - callback({ volume, mute }) değişiklikte çağrılır
+Napi::Value WatchVolume(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    Napi::Object result = Napi::Object::New(env);
-    result.Set("volume", Napi::Number::New(env, 50.0));
-    result.Set("success", Napi::Boolean::New(env, false));
-    return result;
+
+    if (info.Length() < 1 || !info[0].IsFunction()) {
+        Napi::TypeError::New(env, "Callback fonksiyonu bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    volumeNotifier.Start(env, info[0].As<Napi::Function>());
+    return Napi::Boolean::New(env, true);
+}
+
+// N-API: unwatchVolume()
+Napi::Value UnwatchVolume(const Napi::CallbackInfo& info) {
+    volumeNotifier.Stop();
+    return info.Env().Undefined();
 }
 
+// Eski fonksiyonel API (server/index.js) aynı denetleyiciyi kullanır
+
+// Ses seviyesini al
+Napi::Value GetVolume(const Napi::CallbackInfo& info) {
+    return VolumeResult(info.Env(), DefaultEndpoint());
+}
+
+// Ses seviyesini ayarla
 Napi::Value SetVolume(const Napi::CallbackInfo& info) {
+    return SetVolumeResult(info, DefaultEndpoint());
+}
+
+// Ses seviyesini zamanlayıcı üzerinden ayarla (slider akışları için, son değer kazanır)
+Napi::Value ScheduleVolume(const Napi::CallbackInfo& info) {
+    return ScheduleResult(info, 0, kMasterKey, MasterTarget());
+}
+
+// fadeTo(level, durationMs, curve?) - Promise<boolean>
+Napi::Value FadeTo(const Napi::CallbackInfo& info) {
+    return FadeResult(info, 0, kMasterKey, MasterTarget());
+}
+
+// Oturum tablosunun anlık görüntüsü: { success, sessions: [{ app, name, pid, volume, mute, streams }] }
+Napi::Value GetAudioSessions(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+
+    std::vector<AppSessionInfo> sessions;
+    bool success = DefaultSessions().List(sessions);
+
+    Napi::Array list = Napi::Array::New(env, sessions.size());
+    for (size_t i = 0; i < sessions.size(); i++) {
+        list.Set(static_cast<uint32_t>(i), SessionObject(env, sessions[i]));
+    }
+
     Napi::Object result = Napi::Object::New(env);
-    result.Set("success", Napi::Boolean::New(env, false));
+    result.Set("sessions", list);
+    result.Set("success", Napi::Boolean::New(env, success));
+
     return result;
 }
 
-Napi::Value SetMute(const Napi::CallbackInfo& info) {
+// getAppVolume(app) - { volume, mute, success }
+Napi::Value GetAppVolume(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+
+    std::string app;
+    if (!ReadAppName(info, app)) {
+        return env.Null();
+    }
+
+    AppSessionInfo session;
+    bool success = DefaultSessions().Get(app, session);
+
     Napi::Object result = Napi::Object::New(env);
-    result.Set("success", Napi::Boolean::New(env, false));
+    result.Set("volume", Napi::Number::New(env, session.volume));
+    result.Set("mute", Napi::Boolean::New(env, session.mute));
+    result.Set("success", Napi::Boolean::New(env, success));
+
     return result;
 }
 
-Napi::Value GetMute(const Napi::CallbackInfo& info) {
+// setAppVolume(app, level) - zamanlayıcı üzerinden, uygulamanın tüm akışlarına
+Napi::Value SetAppVolume(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+
+    std::string app;
+    if (!ReadAppName(info, app)) {
+        return env.Null();
+    }
+
+    // Uygulama çalışmıyorsa zamanlayıcıya hiç bırakma
+    AppSessionInfo session;
+    if (!DefaultSessions().Get(app, session)) {
+        Napi::Object result = Napi::Object::New(env);
+        result.Set("success", Napi::Boolean::New(env, false));
+        return result;
+    }
+
+    return ScheduleResult(info, 1, AppKey(app), AppTarget(app));
+}
+
+// setAppMute(app, mute)
+Napi::Value SetAppMute(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    std::string app;
+    if (!ReadAppName(info, app)) {
+        return env.Null();
+    }
+    if (info.Length() < 2 || !info[1].IsBoolean()) {
+        Napi::TypeError::New(env, "Boolean (mute durumu) bekleniyor").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    bool success = DefaultSessions().SetMute(app, info[1].As<Napi::Boolean>().Value());
+
     Napi::Object result = Napi::Object::New(env);
-    result.Set("mute", Napi::Boolean::New(env, false));
-    result.Set("success", Napi::Boolean::New(env, false));
+    result.Set("success", Napi::Boolean::New(env, success));
+
     return result;
 }
 
+// fadeAppTo(app, level, durationMs, curve?) - Promise<boolean>
+Napi::Value FadeAppTo(const Napi::CallbackInfo& info) {
+    std::string app;
+    if (!ReadAppName(info, app)) {
+        return info.Env().Null();
+    }
+    return FadeResult(info, 1, AppKey(app), AppTarget(app));
+}
+
+// Sesi kapat/aç
+Napi::Value SetMute(const Napi::CallbackInfo& info) {
+    return SetMuteResult(info, DefaultEndpoint());
+}
+
+// Mute durumunu al
+Napi::Value GetMute(const Napi::CallbackInfo& info) {
+    return MuteResult(info.Env(), DefaultEndpoint());
+}
+
+// Backend ve cihaz bilgisi
+Napi::Value GetEndpointInfo(const Napi::CallbackInfo& info) {
+    return InfoResult(info.Env(), DefaultEndpoint());
+}
+
+// Test backend'i (LOCALDESK_TEST_BACKEND): ses sunucusu açılmadan yazımlar kaydedilir
+testbackend::Mode volumeMode = testbackend::Mode::kNative;
+testbackend::Recorder volumeRecorder;
+
+// N-API: getTestBackend() -> { mode, recorded, dropped }
+Napi::Value GetTestBackend(const Napi::CallbackInfo& info) {
+    return testbackend::InfoObject(info.Env(), volumeMode, volumeRecorder);
+}
+
+// N-API: takeRecording() -> [{ time, op, target, value }] (recording modunda)
+Napi::Value TakeRecording(const Napi::CallbackInfo& info) {
+    return testbackend::RecordingArray(info.Env(), volumeRecorder);
+}
+
+// N-API: getStats() -> { addon, apis: [{ name, calls, errors, p50Us, ... }] }
+Napi::Value GetStats(const Napi::CallbackInfo& info) {
+    return metrics::StatsObject(info.Env(), volumeMetrics);
+}
+
+// Modül başlatma
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    exports.Set(Napi::String::New(env, "getVolume"), Napi::Function::New(env, GetVolume));
-    exports.Set(Napi::String::New(env, "setVolume"), Napi::Function::New(env, SetVolume));
-    exports.Set(Napi::String::New(env, "setMute"), Napi::Function::New(env, SetMute));
-    exports.Set(Napi::String::New(env, "getMute"), Napi::Function::New(env, GetMute));
+    // Zamanlayıcı thread'i başlamadan seçilir, sonra değişmez
+    volumeMode = testbackend::ModeFromEnvironment();
+    volumeRecorder.SetMode(volumeMode);
+    DefaultEndpoint().UseTestBackend(volumeMode, &volumeRecorder);
+    DefaultSessions().UseTestBackend(volumeMode, &volumeRecorder);
+
+    fadeCompletion.Start(env);
+    DefaultScheduler().Start();
+
+    env.AddCleanupHook([]() {
+        // Önce zamanlayıcı: iptal edilen geçişler hâlâ fadeCompletion'a yazar
+        DefaultScheduler().Stop();
+        fadeCompletion.Stop();
+        volumeNotifier.Stop();
+        DefaultSessions().Shutdown();
+        DefaultEndpoint().Shutdown();
+    });
+
+    exports.Set(Napi::String::New(env, "AudioEndpoint"), AudioEndpoint::Define(env));
+    metrics::Export(env, exports, volumeMetrics, "getVolume", GetVolume);
+    metrics::Export(env, exports, volumeMetrics, "setVolume", SetVolume);
+    metrics::Export(env, exports, volumeMetrics, "scheduleVolume", ScheduleVolume);
+    metrics::Export(env, exports, volumeMetrics, "fadeTo", FadeTo);
+    metrics::Export(env, exports, volumeMetrics, "setMute", SetMute);
+    metrics::Export(env, exports, volumeMetrics, "getMute", GetMute);
+    metrics::Export(env, exports, volumeMetrics, "getEndpointInfo", GetEndpointInfo);
+    metrics::Export(env, exports, volumeMetrics, "getAudioSessions", GetAudioSessions);
+    metrics::Export(env, exports, volumeMetrics, "getAppVolume", GetAppVolume);
+    metrics::Export(env, exports, volumeMetrics, "setAppVolume", SetAppVolume);
+    metrics::Export(env, exports, volumeMetrics, "setAppMute", SetAppMute);
+    metrics::Export(env, exports, volumeMetrics, "fadeAppTo", FadeAppTo);
+    metrics::Export(env, exports, volumeMetrics, "watchVolume", WatchVolume);
+    metrics::Export(env, exports, volumeMetrics, "unwatchVolume", UnwatchVolume);
+    metrics::Export(env, exports, volumeMetrics, "getTestBackend", GetTestBackend);
+    metrics::Export(env, exports, volumeMetrics, "takeRecording", TakeRecording);
+    exports.Set(Napi::String::New(env, "getStats"), Napi::Function::New(env, GetStats));
     return exports;
 }
 
 NODE_API_MODULE(volume, Init)
-
-#endif
-
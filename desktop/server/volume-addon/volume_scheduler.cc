@@ -0,0 +1,267 @@
+#include "volume_scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef _WIN32
+#include <objbase.h>
+#endif
+
+namespace {
+
+// Logaritmik geçişte sessizliğin karşılığı
+constexpr float kFloorDb = -60.0f;
+
+float ToDb(float level) {
+    if (level <= 0.0f) {
+        return kFloorDb;
+    }
+    return std::max(kFloorDb, 20.0f * std::log10(level / 100.0f));
+}
+
+float FromDb(float db) {
+    if (db <= kFloorDb) {
+        return 0.0f;
+    }
+    return 100.0f * std::pow(10.0f, db / 20.0f);
+}
+
+float Clamp(float level) {
+    return std::min(100.0f, std::max(0.0f, level));
+}
+
+} // namespace
+
+constexpr std::chrono::milliseconds VolumeScheduler::kTickInterval;
+constexpr std::chrono::milliseconds VolumeScheduler::kSetInterval;
+
+VolumeScheduler& DefaultScheduler() {
+    static VolumeScheduler scheduler;
+    return scheduler;
+}
+
+float VolumeScheduler::Interpolate(float from, float to, float progress, FadeCurve curve) {
+    if (progress >= 1.0f) {
+        return to;
+    }
+    if (progress <= 0.0f) {
+        return from;
+    }
+
+    if (curve == FadeCurve::kLogarithmic) {
+        float fromDb = ToDb(from);
+        return FromDb(fromDb + (ToDb(to) - fromDb) * progress);
+    }
+
+    return from + (to - from) * progress;
+}
+
+void VolumeScheduler::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread_.joinable()) {
+        return;
+    }
+
+    stopping_ = false;
+    thread_ = std::thread([this]() { Run(); });
+}
+
+void VolumeScheduler::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!thread_.joinable()) {
+            return;
+        }
+        stopping_ = true;
+    }
+    wakeCv_.notify_one();
+    thread_.join();
+
+    // Başlamamış geçişleri de iptal olarak bildir
+    for (auto& entry : mailbox_) {
+        if (entry.second.done) {
+            entry.second.done(false);
+        }
+    }
+    mailbox_.clear();
+}
+
+void VolumeScheduler::Set(const std::string& key, VolumeTarget target, float level) {
+    Command command;
+    command.target = std::move(target);
+    command.level = Clamp(level);
+    Post(key, std::move(command));
+}
+
+void VolumeScheduler::FadeTo(const std::string& key, VolumeTarget target, float level,
+                             uint32_t durationMs, FadeCurve curve, FadeCompletion done) {
+    Command command;
+    command.target = std::move(target);
+    command.level = Clamp(level);
+    command.fade = true;
+    command.durationMs = durationMs;
+    command.curve = curve;
+    command.done = std::move(done);
+    Post(key, std::move(command));
+}
+
+void VolumeScheduler::Post(const std::string& key, Command command) {
+    FadeCompletion superseded;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Command& slot = mailbox_[key];
+        // Henüz işlenmemiş bir geçiş ezildiyse iptal olarak bildir (kilit dışında)
+        superseded = std::move(slot.done);
+        slot = std::move(command);
+    }
+
+    if (superseded) {
+        superseded(false);
+    }
+    wakeCv_.notify_one();
+}
+
+void VolumeScheduler::Run() {
+#ifdef _WIN32
+    // Ses arayüzleri MTA'da yaşar (bkz. com_mta.h); bu thread MTA'ya katıldığı
+    // için hedeflerin yazımları thread değiştirmeden doğrudan yapılır
+    CoInitializeEx(NULL, COINIT_MULTITHREADED);
+#endif
+
+    std::unordered_map<std::string, Command> commands;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            if (fades_.empty() && deferred_.empty()) {
+                wakeCv_.wait(lock, [this]() { return stopping_ || !mailbox_.empty(); });
+            } else {
+                wakeCv_.wait_for(lock, kTickInterval, [this]() { return stopping_ || !mailbox_.empty(); });
+            }
+
+            if (stopping_) {
+                break;
+            }
+
+            commands.swap(mailbox_);
+        }
+
+        Clock::time_point now = Clock::now();
+        for (auto& entry : commands) {
+            Apply(entry.first, entry.second, now);
+        }
+        commands.clear();
+
+        FlushDeferred(now);
+        Step(now);
+    }
+
+    for (auto& entry : fades_) {
+        if (entry.second.done) {
+            entry.second.done(false);
+        }
+    }
+    fades_.clear();
+    deferred_.clear();
+    lastSet_.clear();
+
+#ifdef _WIN32
+    CoUninitialize();
+#endif
+}
+
+void VolumeScheduler::Apply(const std::string& key, Command& command, Clock::time_point now) {
+    // Aynı hedefteki devam eden geçiş yeni istekle iptal olur
+    auto running = fades_.find(key);
+    if (running != fades_.end()) {
+        if (running->second.done) {
+            running->second.done(false);
+        }
+        fades_.erase(running);
+    }
+
+    // Yeni istek, aralık bekleyen eski "set"i geçersiz kılar
+    deferred_.erase(key);
+
+    if (!command.fade) {
+        auto last = lastSet_.find(key);
+        if (last != lastSet_.end() && now - last->second < kSetInterval) {
+            // Çok yakın: aralık dolunca sadece en yeni değer yazılır
+            deferred_[key] = std::move(command);
+            return;
+        }
+        command.target.set(command.level);
+        lastSet_[key] = now;
+        return;
+    }
+
+    if (command.durationMs == 0) {
+        bool success = command.target.set(command.level);
+        if (command.done) {
+            command.done(success);
+        }
+        return;
+    }
+
+    Fade fade;
+    if (!command.target.get(fade.from)) {
+        if (command.done) {
+            command.done(false);
+        }
+        return;
+    }
+
+    fade.target = std::move(command.target);
+    fade.to = command.level;
+    fade.start = Clock::now();
+    fade.duration = std::chrono::milliseconds(command.durationMs);
+    fade.curve = command.curve;
+    fade.done = std::move(command.done);
+    fades_.emplace(key, std::move(fade));
+}
+
+void VolumeScheduler::FlushDeferred(Clock::time_point now) {
+    for (auto it = deferred_.begin(); it != deferred_.end();) {
+        Clock::time_point& last = lastSet_[it->first];
+        if (now - last < kSetInterval) {
+            ++it;
+            continue;
+        }
+        it->second.target.set(it->second.level);
+        last = now;
+        it = deferred_.erase(it);
+    }
+}
+
+void VolumeScheduler::Step(Clock::time_point now) {
+    std::vector<std::string> finished;
+
+    for (auto& entry : fades_) {
+        Fade& fade = entry.second;
+
+        float progress = std::chrono::duration<float>(now - fade.start).count() /
+                         std::chrono::duration<float>(fade.duration).count();
+        float level = Interpolate(fade.from, fade.to, progress, fade.curve);
+        bool last = progress >= 1.0f;
+
+        // Fark edilmeyecek kadar küçük adımlar yazılmaz
+        bool ok = true;
+        if (last || std::fabs(level - fade.lastWritten) >= 0.1f) {
+            ok = fade.target.set(level);
+            fade.lastWritten = level;
+        }
+
+        if (last || !ok) {
+            if (fade.done) {
+                fade.done(last && ok);
+            }
+            finished.push_back(entry.first);
+        }
+    }
+
+    for (const std::string& key : finished) {
+        fades_.erase(key);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Ses seviyesi zamanlayıcısı
+// Her hedef (ana ses, ileride uygulama oturumları) için tek slotluk bir posta kutusu
+// tutulur: yeni istek bekleyeni ezer, native thread her turda sadece en yeni hedefi
+// yazar. Aynı hedefe iki yazım arasında en az kSetInterval bırakılır; slider
+// sürüklenirken gelen yüzlerce "set" birkaç cihaz yazımına iner.
+// fadeTo geçişleri aynı thread'de sabit aralıklarla yürütülür; aynı hedefe gelen
+// yeni bir istek devam eden geçişi iptal eder (son değer kazanır).
+
+enum class FadeCurve {
+    kLinear,      // Seviye doğrusal değişir
+    kLogarithmic  // dB cinsinden doğrusal (kulağa eşit adımlı gelir)
+};
+
+// Bir hedefin okunup yazılması (0-100)
+struct VolumeTarget {
+    std::function<bool(float&)> get;
+    std::function<bool(float)> set;
+};
+
+// Geçiş tamamlandı (true) veya yeni bir istekle/kapanışla iptal edildi (false)
+// Zamanlayıcı thread'inden çağrılır.
+using FadeCompletion = std::function<void(bool completed)>;
+
+class VolumeScheduler {
+public:
+    void Start();
+    void Stop();
+
+    // Hedefi hemen (bir sonraki turda) bu seviyeye getir; bekleyen isteği ezer
+    void Set(const std::string& key, VolumeTarget target, float level);
+
+    // durationMs boyunca level'e geçiş yap
+    void FadeTo(const std::string& key, VolumeTarget target, float level,
+                uint32_t durationMs, FadeCurve curve, FadeCompletion done);
+
+    // Geçiş adımları arası süre (~60 Hz)
+    static constexpr std::chrono::milliseconds kTickInterval{16};
+
+    // Aynı hedefe art arda "set" yazımları arasındaki en kısa süre
+    static constexpr std::chrono::milliseconds kSetInterval{30};
+
+    static float Interpolate(float from, float to, float progress, FadeCurve curve);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Command {
+        VolumeTarget target;
+        float level = 0.0f;
+        bool fade = false;
+        uint32_t durationMs = 0;
+        FadeCurve curve = FadeCurve::kLinear;
+        FadeCompletion done;
+    };
+
+    struct Fade {
+        VolumeTarget target;
+        float from = 0.0f;
+        float to = 0.0f;
+        float lastWritten = -1.0f;
+        Clock::time_point start;
+        Clock::duration duration;
+        FadeCurve curve = FadeCurve::kLinear;
+        FadeCompletion done;
+    };
+
+    void Post(const std::string& key, Command command);
+    void Run();
+    void Apply(const std::string& key, Command& command, Clock::time_point now);
+    void Step(Clock::time_point now);
+    void FlushDeferred(Clock::time_point now);
+
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    // Hedef başına tek slot (yeni istek eskisini ezer)
+    std::unordered_map<std::string, Command> mailbox_;
+    bool stopping_ = false;
+    std::thread thread_;
+
+    // Sadece zamanlayıcı thread'i
+    std::unordered_map<std::string, Fade> fades_;
+    // Hedefin son "set" yazım zamanı ve aralık dolmadan gelen en yeni değer
+    std::unordered_map<std::string, Clock::time_point> lastSet_;
+    std::unordered_map<std::string, Command> deferred_;
+};
+
+// Process genelindeki zamanlayıcı
+VolumeScheduler& DefaultScheduler();
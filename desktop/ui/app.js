@@ -316,9 +316,11 @@ async function handlePageSubmit(e) {
     if (!name) return;
     const icon = selectedPageIcon || undefined;
     const targetApp = selectedPageTargetApp || undefined;
+    const deliveryModeInput = document.querySelector('input[name="deliveryMode"]:checked');
+    const deliveryMode = deliveryModeInput ? deliveryModeInput.value : 'focus';
     
-    // Sayfa oluştur (targetApp ile birlikte)
-    const newPage = await window.electronAPI.addPage(name, icon, targetApp);
+    // Sayfa oluştur (targetApp ve gönderim modu ile birlikte)
+    const newPage = await window.electronAPI.addPage(name, icon, targetApp, deliveryMode);
     
     closePageModal();
     await loadPages();